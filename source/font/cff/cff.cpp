@@ -24,44 +24,20 @@ namespace font::cff
 		}
 
 		index.offset_bytes = consume_u8(buf);
+		if(index.offset_bytes < 1 || index.offset_bytes > 4)
+			sap::error("font/cff", "unsupported offset size '{}'", index.offset_bytes);
 
 		// there should be `count+1` entries, because the last one tells us the
-		// size of the last data object
-		for(uint16_t i = 0; i < index.count + 1; i++)
-		{
-			// the offset is from the last byte of the index data itself; since we are
-			// consuming the entire INDEX structure, subtract 1 to get the "real" offset
-			// from the start of the final buffer.
-			if(index.offset_bytes == 1)
-			{
-				index.offsets.push_back(consume_u8(buf) - 1);
-			}
-			else if(index.offset_bytes == 2)
-			{
-				index.offsets.push_back(consume_u16(buf) - 1);
-			}
-			else if(index.offset_bytes == 3)
-			{
-				// what a pain...
-				uint32_t b0 = consume_u8(buf);
-				uint32_t b1 = consume_u8(buf);
-				uint32_t b2 = consume_u8(buf);
+		// size of the last data object. only that one is needed now, to know where the INDEX ends.
+		size_t num_offsets = index.count + 1;
+		if(buf.size() < num_offsets * index.offset_bytes)
+			sap::error("font/cff", "INDEX offset array is truncated");
 
-				index.offsets.push_back(((b0 << 16) | (b1 << 8) | (b2)) - 1);
-			}
-			else if(index.offset_bytes == 4)
-			{
-				index.offsets.push_back(consume_u32(buf) - 1);
-			}
-			else
-			{
-				sap::error("font/cff", "unsupported offset size '{}'", index.offset_bytes);
-			}
-		}
+		index.offset_array = buf.take(num_offsets * index.offset_bytes);
+		buf.remove_prefix(num_offsets * index.offset_bytes);
 
-		index.data = buf.take(index.offsets.back());
+		index.data = buf.take(index.get_offset(index.count));
 
-		assert(index.count + 1 == index.offsets.size());
 		if(total_size)
 			*total_size = (start.size() - buf.size()) + index.data.size();
 
@@ -187,6 +163,7 @@ namespace font::cff
 			buf.remove_prefix(size);
 
 			cff->global_subrs = read_subrs_from_index(index);
+			cff->global_subrs_bias = computeSubrBias(cff->global_subrs.size());
 		}
 
 
@@ -214,34 +191,6 @@ namespace font::cff
 
 
 
-		// populate the glyph list.
-		{
-			auto charset_ofs = cff->top_dict.integer(DictKey::charset);
-
-			std::map<uint16_t, uint16_t> charset_mapping {};
-
-			if(charset_ofs == 0 || charset_ofs == 1 || charset_ofs == 2)
-				charset_mapping = getPredefinedCharset(charset_ofs);
-			else
-				charset_mapping = readCharsetTable(cff->charstrings_table.count, cff->bytes.drop(charset_ofs));
-
-			// charset-mapping maps from gid -> sid or cid, depending on whether this is a CID font or not
-			for(auto& [gid, sid] : charset_mapping)
-			{
-				Glyph glyph {};
-				glyph.gid = gid;
-				glyph.charstring = cff->charstrings_table.get_item(gid);
-				glyph.font_dict_idx = 0;
-
-				if(!cff->is_cidfont)
-					glyph.glyph_name = string_table.get_item(sid - NUM_STANDARD_STRINGS).cast<char>();
-				else
-					glyph.cid = sid;
-
-				cff->glyphs.push_back(std::move(glyph));
-			}
-		}
-
 		auto read_private_dict_and_local_subrs_from_dict = [cff](const Dictionary& dict) -> auto
 		{
 			auto foo = dict.get(DictKey::Private);
@@ -276,6 +225,7 @@ namespace font::cff
 			FontDict fontdict {};
 			fontdict.private_dict = std::move(private_dict);
 			fontdict.local_subrs = std::move(local_subrs);
+			fontdict.local_subrs_bias = computeSubrBias(fontdict.local_subrs.size());
 
 			cff->font_dicts.push_back(std::move(fontdict));
 		}
@@ -292,47 +242,86 @@ namespace font::cff
 				auto [private_dict, local_subrs] = read_private_dict_and_local_subrs_from_dict(fd.dict);
 				fd.private_dict = std::move(private_dict);
 				fd.local_subrs = std::move(local_subrs);
+				fd.local_subrs_bias = computeSubrBias(fd.local_subrs.size());
 
 				cff->font_dicts.push_back(std::move(fd));
 			}
+		}
+
+
+		return cff;
+	}
 
+	std::vector<uint8_t> readFDSelect(size_t num_glyphs, zst::byte_span fdselect_data)
+	{
+		std::vector<uint8_t> font_dicts(num_glyphs, 0);
 
-			auto fdselect_ofs = cff->top_dict.integer(DictKey::FDSelect);
-			auto fdselect_data = cff->bytes.drop(fdselect_ofs);
+		auto format = fdselect_data[0];
+		fdselect_data.remove_prefix(1);
 
-			auto format = fdselect_data[0];
-			fdselect_data.remove_prefix(1);
+		if(format == 0)
+		{
+			for(size_t i = 0; i < num_glyphs; i++)
+				font_dicts[i] = consume_u8(fdselect_data);
+		}
+		else if(format == 3)
+		{
+			auto num_ranges = consume_u16(fdselect_data);
+			auto last_gid = peek_u16(fdselect_data.drop(num_ranges * 3));
 
-			if(format == 0)
-			{
-				for(size_t i = 0; i < cff->glyphs.size(); i++)
-					cff->glyphs[i].font_dict_idx = consume_u8(fdselect_data);
-			}
-			else if(format == 3)
+			for(size_t i = 0; i < num_ranges; i++)
 			{
-				auto num_ranges = consume_u16(fdselect_data);
-				auto last_gid = peek_u16(fdselect_data.drop(num_ranges * 3));
+				auto first = consume_u16(fdselect_data);
+				auto fd = consume_u8(fdselect_data);
 
-				for(size_t i = 0; i < num_ranges; i++)
-				{
-					auto first = consume_u16(fdselect_data);
-					auto fd = consume_u8(fdselect_data);
+				auto last = (i + 1 == num_ranges) ? last_gid : peek_u16(fdselect_data);
 
-					auto last = (i + 1 == num_ranges) ? last_gid : peek_u16(fdselect_data);
+				for(size_t gid = first; gid < last && gid < num_glyphs; gid++)
+					font_dicts[gid] = fd;
+			}
+		}
+		else
+		{
+			sap::error("font/cff", "unsupported FDSelect format '{}' (expected 0 or 3)", format);
+		}
 
-					for(auto gid = first; gid < last; gid++)
-						cff->glyphs[gid].font_dict_idx = fd;
-				}
+		return font_dicts;
+	}
 
-				fdselect_data.remove_prefix(2);
-			}
+	std::vector<Glyph> readGlyphs(const CFFData* cff)
+	{
+		auto num_glyphs = cff->charstrings_table.count;
+
+		// for CID fonts, the charset maps from gid -> cid. otherwise it gives the glyph names, which we don't need.
+		std::vector<uint16_t> cids {};
+		std::vector<uint8_t> font_dicts {};
+		if(cff->is_cidfont)
+		{
+			if(auto charset_ofs = cff->top_dict.integer(DictKey::charset); charset_ofs <= 2)
+				cids = getPredefinedCharset(charset_ofs, num_glyphs);
 			else
-			{
-				sap::error("font/cff", "unsupported FDSelect format '{}' (expected 0 or 3)", format);
-			}
+				cids = readCharsetTable(num_glyphs, cff->bytes.drop(charset_ofs));
+
+			font_dicts = readFDSelect(num_glyphs, cff->bytes.drop(cff->top_dict.integer(DictKey::FDSelect)));
 		}
 
+		std::vector<Glyph> glyphs {};
+		glyphs.reserve(num_glyphs);
 
-		return cff;
+		for(size_t gid = 0; gid < num_glyphs; gid++)
+		{
+			if(cff->is_cidfont && gid >= cids.size())
+				break;
+
+			Glyph glyph {};
+			glyph.gid = static_cast<uint16_t>(gid);
+			glyph.cid = cff->is_cidfont ? cids[gid] : 0;
+			glyph.charstring = cff->charstrings_table.get_item(gid);
+			glyph.font_dict_idx = cff->is_cidfont ? font_dicts[gid] : 0;
+
+			glyphs.push_back(std::move(glyph));
+		}
+
+		return glyphs;
 	}
 }
@@ -2,6 +2,8 @@
 // Copyright (c) 2022, zhiayang
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
+
 #include "error.h"
 #include "font/cff.h"
 #include "font/font.h"
@@ -58,59 +60,97 @@ namespace font::cff
 	constexpr uint8_t CMD_ESC_HFLEX1 = 36;
 	constexpr uint8_t CMD_ESC_FLEX1 = 37;
 
+	// the Type 2 charstring spec limits the argument stack to 48 entries, and subroutine nesting to 10 levels.
+	constexpr size_t MAX_STACK_DEPTH = 48;
+	constexpr size_t MAX_CALL_DEPTH = 10;
+
 	struct InterpState
 	{
-		std::vector<Operand> stack;
+		Operand stack[MAX_STACK_DEPTH];
+		size_t stack_size = 0;
+
+		zst::byte_span call_stack[MAX_CALL_DEPTH];
+		size_t call_depth = 0;
 
 		int num_hstems = 0;
 		int num_vstems = 0;
 		bool in_header = false;
 
+		// if set, the instructions are collected here (with the subroutine calls inlined).
+		std::vector<zst::byte_span>* tokens = nullptr;
+		bool last_token_was_number = false;
+
+		// if the charstring does arithmetic or computes subr numbers, it can't be desubroutinised.
+		bool cannot_inline = false;
+
 		inline void ensure(size_t n)
 		{
-			if(stack.size() < n)
+			if(stack_size < n)
 				sap::error("font/cff", "stack underflow");
 		}
 
 		inline Operand pop()
 		{
 			ensure(1);
-
-			auto ret = stack.back();
-			stack.pop_back();
-			return ret;
+			return stack[--stack_size];
 		}
 
 		inline Operand peek()
 		{
 			ensure(1);
-			return stack.back();
+			return stack[stack_size - 1];
+		}
+
+		inline void push(Operand oper)
+		{
+			if(stack_size == MAX_STACK_DEPTH)
+				sap::error("font/cff", "stack overflow");
+
+			stack[stack_size++] = oper;
+		}
+
+		inline void drop(size_t n)
+		{
+			ensure(n);
+			stack_size -= n;
 		}
 
-		inline void push(Operand oper) { stack.push_back(std::move(oper)); }
+		inline void clear() { stack_size = 0; }
 	};
 
-	static bool run_charstring(zst::byte_span instrs, std::vector<Subroutine>& global_subrs, std::vector<Subroutine>& local_subrs,
-		InterpState& interp)
+	static void run_charstring(zst::byte_span instrs, CFFData* cff, FontDict& font_dict, InterpState& interp)
 	{
-		auto calculate_bias = [](const std::vector<Subroutine>& subrs) {
-			if(subrs.size() < 1240)
-				return 107;
-			else if(subrs.size() < 33900)
-				return 1131;
-			else
-				return 32768;
-		};
-
-		auto global_bias = calculate_bias(global_subrs);
-		auto local_bias = calculate_bias(local_subrs);
-
-		while(instrs.size() > 0)
+		auto& global_subrs = cff->global_subrs;
+		auto& local_subrs = font_dict.local_subrs;
+
+		while(true)
 		{
+			// falling off the end of a subroutine is an implicit return (CFF2 has no `return` at all);
+			// falling off the end of the charstring itself is an implicit endchar.
+			if(instrs.size() == 0)
+			{
+				if(interp.call_depth == 0)
+					return;
+
+				instrs = interp.call_stack[--interp.call_depth];
+				continue;
+			}
+
 			auto x = instrs[0];
+			auto instr_start = instrs;
+
+			// the bytes of the current instruction, including its operands (for escapes and masks)
+			auto current_instr = [&]() {
+				return instr_start.take(instr_start.size() - instrs.size());
+			};
+
 			if(x == 28 || (32 <= x && x <= 255))
 			{
 				interp.push(*readNumberFromCharString(instrs));
+				if(interp.tokens != nullptr)
+					interp.tokens->push_back(current_instr());
+
+				interp.last_token_was_number = true;
 				continue;
 			}
 
@@ -120,18 +160,18 @@ namespace font::cff
 			{
 				case CMD_HSTEM:
 				case CMD_HSTEMHM:
-					interp.num_hstems += interp.stack.size() / 2;
+					interp.num_hstems += interp.stack_size / 2;
 					break;
 
 				case CMD_VSTEM:
 				case CMD_VSTEMHM:
-					interp.num_vstems += interp.stack.size() / 2;
+					interp.num_vstems += interp.stack_size / 2;
 					break;
 
 				case CMD_HINTMASK:
 				case CMD_CNTRMASK: {
 					// for the first one, there is an implicit vstem, so add another hint:
-					interp.num_vstems += (interp.stack.size() / 2);
+					interp.num_vstems += (interp.stack_size / 2);
 
 					// calculate the required mask length.
 					auto num_hints = interp.num_hstems + interp.num_vstems;
@@ -145,40 +185,55 @@ namespace font::cff
 				}
 
 				case CMD_RETURN:
-					return false;
+					if(interp.call_depth == 0)
+						sap::error("font/cff", "'return' outside of a subroutine");
+
+					instrs = interp.call_stack[--interp.call_depth];
+					clear_stack = false;
+					break;
 
 				case CMD_ENDCHAR:
-					return true;
+					if(interp.tokens != nullptr)
+						interp.tokens->push_back(current_instr());
+					return;
 
 				case CMD_CALLSUBR:
 				case CMD_CALLGSUBR: {
+					auto subr_num = interp.pop().integer();
 
-					interp.ensure(1);
+					// when inlining, the subr number must be a literal, which is dropped along with the call.
+					if(interp.tokens != nullptr)
+					{
+						if(interp.last_token_was_number)
+							interp.tokens->pop_back();
+						else
+							interp.cannot_inline = true;
+					}
 
-					zst::byte_span subr_cs {};
-					auto subr_num = interp.pop().integer();
+					Subroutine* subr = nullptr;
 					if(x == CMD_CALLSUBR)
 					{
-						subr_num += local_bias;
-						if(subr_num >= (int32_t) local_subrs.size())
+						subr_num += font_dict.local_subrs_bias;
+						if(subr_num < 0 || subr_num >= (int32_t) local_subrs.size())
 							sap::error("font/cff", "local subr {} out of bounds (max {})", subr_num, local_subrs.size());
 
-						subr_cs = local_subrs[subr_num].charstring;
-						local_subrs[subr_num].used = true;
+						subr = &local_subrs[subr_num];
 					}
 					else
 					{
-						subr_num += global_bias;
-						if(subr_num >= (int32_t) global_subrs.size())
+						subr_num += cff->global_subrs_bias;
+						if(subr_num < 0 || subr_num >= (int32_t) global_subrs.size())
 							sap::error("font/cff", "global subr {} out of bounds (max {})", subr_num, global_subrs.size());
 
-						subr_cs = global_subrs[subr_num].charstring;
-						global_subrs[subr_num].used = true;
+						subr = &global_subrs[subr_num];
 					}
 
-					auto finish = run_charstring(subr_cs, global_subrs, local_subrs, interp);
-					if(finish)
-						return true;
+					if(interp.call_depth == MAX_CALL_DEPTH)
+						sap::error("font/cff", "subroutine nesting exceeds {} levels", MAX_CALL_DEPTH);
+
+					subr->used = true;
+					interp.call_stack[interp.call_depth++] = instrs;
+					instrs = subr->charstring;
 
 					clear_stack = false;
 					break;
@@ -228,6 +283,9 @@ namespace font::cff
 					break;
 
 				case CMD_ESCAPE: {
+					if(instrs.size() == 0)
+						sap::error("font/cff", "truncated escape opcode");
+
 					auto x = instrs[0];
 					instrs.remove_prefix(1);
 
@@ -249,37 +307,26 @@ namespace font::cff
 
 
 						case CMD_ESC_ADD:
-							interp.ensure(2);
-							interp.pop();
-							clear_stack = false;
-							break;
 						case CMD_ESC_SUB:
-							interp.ensure(2);
-							interp.pop();
-							clear_stack = false;
-							break;
 						case CMD_ESC_DIV:
-							interp.ensure(2);
-							interp.pop();
-							clear_stack = false;
-							break;
 						case CMD_ESC_MUL:
-							interp.ensure(2);
-							interp.pop();
+						case CMD_ESC_AND:
+						case CMD_ESC_OR:
+						case CMD_ESC_EQ:
+							interp.drop(2);
+							interp.push(Operand().integer(0));
 							clear_stack = false;
 							break;
+
 						case CMD_ESC_NEG:
-							interp.ensure(1);
-							clear_stack = false;
-							break;
 						case CMD_ESC_ABS:
-							interp.ensure(1);
-							clear_stack = false;
-							break;
 						case CMD_ESC_SQRT:
+						case CMD_ESC_NOT:
+						case CMD_ESC_GET:
 							interp.ensure(1);
 							clear_stack = false;
 							break;
+
 						case CMD_ESC_RANDOM:
 							interp.push(Operand().integer(0));
 							clear_stack = false;
@@ -290,75 +337,60 @@ namespace font::cff
 							auto i = interp.pop().integer();
 							if(i <= 0)
 								interp.push(interp.peek());
+							else if((size_t) i < interp.stack_size)
+								interp.push(interp.stack[interp.stack_size - i - 1]);
 							else
-								interp.push(interp.stack[interp.stack.size() - i - 1]);
+								sap::error("font/cff", "'index' out of bounds");
 
 							clear_stack = false;
 							break;
 						}
 
 						case CMD_ESC_ROLL: {
-							// TODO: implement `roll`
 							interp.ensure(2);
+							auto j = interp.pop().integer();
+							auto n = interp.pop().integer();
+							if(n < 0 || (size_t) n > interp.stack_size)
+								sap::error("font/cff", "'roll' out of bounds");
+
+							if(n > 0)
+							{
+								// positive j rolls towards the top of the stack
+								auto first = &interp.stack[interp.stack_size - n];
+								auto shift = ((j % n) + n) % n;
+								std::rotate(first, first + (n - shift), first + n);
+							}
+
 							clear_stack = false;
 							break;
 						}
 
 						case CMD_ESC_EXCH: {
 							interp.ensure(2);
-							std::swap(interp.stack[interp.stack.size() - 1], interp.stack[interp.stack.size() - 2]);
+							std::swap(interp.stack[interp.stack_size - 1], interp.stack[interp.stack_size - 2]);
 							clear_stack = false;
 							break;
 						}
 
 						case CMD_ESC_DROP:
-							interp.ensure(1);
-							interp.pop();
+							interp.drop(1);
 							clear_stack = false;
 							break;
 						case CMD_ESC_DUP:
-							interp.ensure(1);
 							interp.push(interp.peek());
 							clear_stack = false;
 							break;
 
 						case CMD_ESC_PUT:
-							interp.ensure(2);
-							interp.pop();
-							interp.pop();
-							clear_stack = false;
-							break;
-
-						case CMD_ESC_GET:
-							interp.ensure(1);
+							interp.drop(2);
 							clear_stack = false;
 							break;
 
-						case CMD_ESC_AND:
-							interp.ensure(2);
-							interp.pop();
-							clear_stack = false;
-							break;
-						case CMD_ESC_OR:
-							interp.ensure(2);
-							interp.pop();
-							clear_stack = false;
-							break;
-						case CMD_ESC_NOT:
-							interp.ensure(1);
-							clear_stack = false;
-							break;
-						case CMD_ESC_EQ:
-							interp.ensure(2);
-							interp.pop();
-							clear_stack = false;
-							break;
 						case CMD_ESC_IFELSE:
-							interp.ensure(4);
-							interp.pop();
-							interp.pop();
-							interp.pop();
+							// s1 s2 v1 v2 ifelse -> (s1 or s2); the result is always 1 entry.
+							interp.drop(3);
 							clear_stack = false;
+							break;
 
 						default:
 							sap::error("font/cff", "invalid opcode '0c {x}'", x);
@@ -372,18 +404,49 @@ namespace font::cff
 					break;
 			}
 
+			// the subr calls were handled above, and `return` is implied by inlining.
+			if(interp.tokens != nullptr && x != CMD_CALLSUBR && x != CMD_CALLGSUBR && x != CMD_RETURN)
+				interp.tokens->push_back(current_instr());
+
+			interp.last_token_was_number = false;
+
+			// only the stem, path, and mask operators clear the stack; everything else is arithmetic.
+			if(!clear_stack && x == CMD_ESCAPE)
+				interp.cannot_inline = true;
+
 			if(clear_stack)
-				interp.stack.clear();
+				interp.clear();
 		}
+	}
 
-		// finish by default
-		return true;
+	int32_t computeSubrBias(size_t num_subrs)
+	{
+		if(num_subrs < 1240)
+			return 107;
+		else if(num_subrs < 33900)
+			return 1131;
+		else
+			return 32768;
 	}
 
-	void interpretCharStringAndMarkSubrs(zst::byte_span instrs, std::vector<Subroutine>& global_subrs,
-		std::vector<Subroutine>& local_subrs)
+	void interpretCharStringAndMarkSubrs(zst::byte_span instrs, CFFData* cff, FontDict& font_dict)
 	{
 		InterpState interp {};
-		run_charstring(instrs, global_subrs, local_subrs, interp);
+		run_charstring(instrs, cff, font_dict, interp);
+	}
+
+	std::optional<std::vector<zst::byte_span>> desubroutiniseCharString(zst::byte_span instrs, CFFData* cff,
+		FontDict& font_dict)
+	{
+		std::vector<zst::byte_span> tokens {};
+
+		InterpState interp {};
+		interp.tokens = &tokens;
+		run_charstring(instrs, cff, font_dict, interp);
+
+		if(interp.cannot_inline)
+			return std::nullopt;
+
+		return tokens;
 	}
 }
@@ -0,0 +1,359 @@
+// subroutines.cpp
+// Copyright (c) 2022, zhiayang
+// SPDX-License-Identifier: Apache-2.0
+
+#include <numeric>
+#include <algorithm>
+
+#include "util.h"
+#include "error.h"
+
+#include "font/cff.h"
+#include "font/font.h"
+
+namespace font::cff
+{
+	constexpr uint8_t CMD_RETURN = 11;
+	constexpr uint8_t CMD_HINTMASK = 19;
+	constexpr uint8_t CMD_CNTRMASK = 20;
+	constexpr uint8_t CMD_CALLGSUBR = 29;
+
+	// same as the limit in the charstring interpreter.
+	constexpr size_t MAX_STACK_DEPTH = 48;
+
+	// with fewer than 1240 subrs the bias is 107, so every subr number fits in (at most) a 2-byte operand.
+	constexpr size_t MAX_SUBRS = 1239;
+
+	// a call is the subr number (2 bytes at most) and `callgsubr`; each subr also needs a `return` and an
+	// entry in the INDEX (2 bytes, mostly).
+	constexpr size_t CALL_COST = 3;
+	constexpr size_t SUBR_OVERHEAD = 3;
+
+	// a sequence of instructions that appears more than once; it occurs at the suffixes sa[lb..rb].
+	struct Candidate
+	{
+		uint32_t length;
+		uint32_t lb;
+		uint32_t rb;
+		size_t num_bytes;
+		size_t savings;
+	};
+
+	struct NewSubr
+	{
+		uint32_t start;
+		uint32_t length;
+		std::vector<uint32_t> calls;
+	};
+
+	static void append_integer(zst::byte_buffer& buf, int32_t x)
+	{
+		if(-107 <= x && x <= 107)
+		{
+			buf.append(static_cast<uint8_t>(x + 139));
+		}
+		else if(108 <= x && x <= 1131)
+		{
+			x -= 108;
+			buf.append(static_cast<uint8_t>((x >> 8) + 247));
+			buf.append(static_cast<uint8_t>(x & 0xFF));
+		}
+		else if(-1131 <= x && x <= -108)
+		{
+			x = -x - 108;
+			buf.append(static_cast<uint8_t>((x >> 8) + 251));
+			buf.append(static_cast<uint8_t>(x & 0xFF));
+		}
+		else
+		{
+			buf.append(28);
+			buf.append_bytes(util::convertBEU16(static_cast<uint16_t>(x)));
+		}
+	}
+
+	// prefix doubling; the strings here are (at most) a few hundred thousand instructions long.
+	static std::vector<uint32_t> build_suffix_array(const std::vector<uint32_t>& str)
+	{
+		auto n = str.size();
+
+		std::vector<uint32_t> sa(n);
+		std::iota(sa.begin(), sa.end(), 0);
+
+		std::vector<uint32_t> rank(str.begin(), str.end());
+		std::vector<uint32_t> tmp(n);
+
+		for(size_t k = 1; n > 0; k *= 2)
+		{
+			// suffixes that end before `i + k` sort first.
+			auto key = [&](uint32_t i) { return std::pair<uint32_t, int64_t>(rank[i], i + k < n ? rank[i + k] : -1); };
+			std::sort(sa.begin(), sa.end(), [&](uint32_t a, uint32_t b) { return key(a) < key(b); });
+
+			tmp[sa[0]] = 0;
+			for(size_t i = 1; i < n; i++)
+				tmp[sa[i]] = tmp[sa[i - 1]] + (key(sa[i - 1]) < key(sa[i]) ? 1 : 0);
+
+			rank.swap(tmp);
+			if(rank[sa[n - 1]] == n - 1)
+				break;
+		}
+
+		return sa;
+	}
+
+	// Kasai's algorithm; lcp[i] is the length of the common prefix of the suffixes sa[i - 1] and sa[i].
+	static std::vector<uint32_t> build_lcp_array(const std::vector<uint32_t>& str, const std::vector<uint32_t>& sa)
+	{
+		auto n = str.size();
+
+		std::vector<uint32_t> rank(n);
+		for(size_t i = 0; i < n; i++)
+			rank[sa[i]] = static_cast<uint32_t>(i);
+
+		std::vector<uint32_t> lcp(n, 0);
+
+		uint32_t h = 0;
+		for(size_t i = 0; i < n; i++)
+		{
+			if(rank[i] == 0)
+			{
+				h = 0;
+				continue;
+			}
+
+			auto j = sa[rank[i] - 1];
+			while(i + h < n && j + h < n && str[i + h] == str[j + h])
+				h++;
+
+			lcp[rank[i]] = h;
+			if(h > 0)
+				h--;
+		}
+
+		return lcp;
+	}
+
+	bool resubroutiniseCharStrings(CFFData* cff, zst::byte_buffer& storage)
+	{
+		/*
+		    Inline all the subroutines, and put the instructions of every glyph into one string (of instruction
+		    ids), with a unique separator after each glyph. Masks are given unique ids as well, since their length
+		    depends on the number of stem hints before them; subrs containing them could be called with a different
+		    number of hints.
+		*/
+		std::vector<zst::byte_span> tokens {};
+		std::vector<uint32_t> str {};
+		std::vector<std::pair<uint32_t, uint32_t>> glyph_ranges {};
+
+		std::unordered_map<std::string, uint32_t> token_ids {};
+		uint32_t next_id = 0;
+
+		size_t original_size = 0;
+		for(auto& glyph : cff->glyphs)
+		{
+			auto glyph_tokens = desubroutiniseCharString(glyph.charstring, cff, cff->font_dicts[glyph.font_dict_idx]);
+			if(not glyph_tokens.has_value())
+				return false;
+
+			glyph_ranges.emplace_back(static_cast<uint32_t>(str.size()), static_cast<uint32_t>(glyph_tokens->size()));
+			for(auto& tok : *glyph_tokens)
+			{
+				if(tok[0] == CMD_HINTMASK || tok[0] == CMD_CNTRMASK)
+				{
+					str.push_back(next_id++);
+				}
+				else
+				{
+					auto [it, inserted] = token_ids.try_emplace(std::string(tok.chars().data(), tok.size()), next_id);
+					if(inserted)
+						next_id++;
+
+					str.push_back(it->second);
+				}
+
+				tokens.push_back(tok);
+			}
+
+			str.push_back(next_id++);
+			tokens.push_back({});
+
+			original_size += glyph.charstring.size();
+		}
+
+		for(auto& subr : cff->global_subrs)
+			original_size += subr.used ? subr.charstring.size() : 0;
+
+		for(auto& fd : cff->font_dicts)
+		{
+			for(auto& subr : fd.local_subrs)
+				original_size += subr.used ? subr.charstring.size() : 0;
+		}
+
+		auto n = str.size();
+
+		// byte_offsets[i] is the size of all the instructions before i, and stack_depth[i] is the number of
+		// operands that are on the stack before instruction i (there's no arithmetic, so they're all literals).
+		std::vector<size_t> byte_offsets(n + 1, 0);
+		std::vector<uint32_t> stack_depth(n, 0);
+		for(size_t i = 0; i < n; i++)
+		{
+			byte_offsets[i + 1] = byte_offsets[i] + tokens[i].size();
+
+			bool prev_is_number = i > 0 && tokens[i - 1].size() > 0 && (tokens[i - 1][0] == 28 || tokens[i - 1][0] >= 32);
+			stack_depth[i] = prev_is_number ? stack_depth[i - 1] + 1 : 0;
+		}
+
+		auto sa = build_suffix_array(str);
+		auto lcp = build_lcp_array(str, sa);
+
+		/*
+		    Every repeated sequence is the common prefix of some interval of the suffix array, so walk the
+		    lcp-intervals (with a stack), and keep the ones that would save space if they were a subr.
+		*/
+		std::vector<Candidate> candidates {};
+		auto add_candidate = [&](uint32_t length, uint32_t lb, uint32_t rb) {
+			auto num_bytes = byte_offsets[sa[lb] + length] - byte_offsets[sa[lb]];
+			auto count = rb - lb + 1;
+
+			if(num_bytes > CALL_COST && count * (num_bytes - CALL_COST) > num_bytes + SUBR_OVERHEAD)
+			{
+				auto savings = count * (num_bytes - CALL_COST) - (num_bytes + SUBR_OVERHEAD);
+				candidates.push_back(Candidate { length, lb, rb, num_bytes, savings });
+			}
+		};
+
+		std::vector<std::pair<uint32_t, uint32_t>> interval_stack { { 0, 0 } };
+		for(size_t i = 1; i <= n; i++)
+		{
+			auto h = (i < n) ? lcp[i] : 0;
+			auto lb = static_cast<uint32_t>(i - 1);
+
+			while(interval_stack.back().first > h)
+			{
+				auto [len, start] = interval_stack.back();
+				interval_stack.pop_back();
+
+				add_candidate(len, start, static_cast<uint32_t>(i - 1));
+				lb = start;
+			}
+
+			if(interval_stack.back().first < h)
+				interval_stack.emplace_back(h, lb);
+		}
+
+		std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+			return a.savings > b.savings;
+		});
+
+		// greedily take the best candidates, at the places where they don't overlap an earlier one.
+		std::vector<NewSubr> subrs {};
+		std::vector<bool> covered(n, false);
+		for(auto& cand : candidates)
+		{
+			if(subrs.size() == MAX_SUBRS)
+				break;
+
+			std::vector<uint32_t> positions(sa.begin() + cand.lb, sa.begin() + cand.rb + 1);
+			std::sort(positions.begin(), positions.end());
+
+			std::vector<uint32_t> calls {};
+			uint32_t next_free = 0;
+			for(auto pos : positions)
+			{
+				// the subr number needs one more slot on the stack.
+				if(pos < next_free || stack_depth[pos] + 1 >= MAX_STACK_DEPTH)
+					continue;
+
+				if(std::any_of(covered.begin() + pos, covered.begin() + pos + cand.length, [](bool x) { return x; }))
+					continue;
+
+				calls.push_back(pos);
+				next_free = pos + cand.length;
+			}
+
+			if(calls.size() * (cand.num_bytes - CALL_COST) <= cand.num_bytes + SUBR_OVERHEAD)
+				continue;
+
+			for(auto pos : calls)
+				std::fill(covered.begin() + pos, covered.begin() + pos + cand.length, true);
+
+			subrs.push_back(NewSubr { calls[0], cand.length, std::move(calls) });
+		}
+
+		// the most used subrs get the smallest numbers.
+		std::stable_sort(subrs.begin(), subrs.end(), [](const auto& a, const auto& b) {
+			return a.calls.size() > b.calls.size();
+		});
+
+		auto bias = computeSubrBias(subrs.size());
+
+		std::vector<int32_t> call_at(n, -1);
+		for(size_t i = 0; i < subrs.size(); i++)
+		{
+			for(auto pos : subrs[i].calls)
+				call_at[pos] = static_cast<int32_t>(i);
+		}
+
+		auto append_tokens = [&](uint32_t start, uint32_t length) {
+			for(auto i = start; i < start + length;)
+			{
+				if(auto subr = call_at[i]; subr >= 0)
+				{
+					append_integer(storage, subr - bias);
+					storage.append(CMD_CALLGSUBR);
+
+					i += subrs[subr].length;
+				}
+				else
+				{
+					storage.append(tokens[i]);
+					i++;
+				}
+			}
+		};
+
+		// the storage might move while appending, so make the spans at the end.
+		std::vector<std::pair<size_t, size_t>> glyph_spans {};
+		std::vector<std::pair<size_t, size_t>> subr_spans {};
+
+		auto new_size = storage.size();
+		for(auto& [start, length] : glyph_ranges)
+		{
+			auto ofs = storage.size();
+			append_tokens(start, length);
+			glyph_spans.emplace_back(ofs, storage.size() - ofs);
+		}
+
+		for(auto& subr : subrs)
+		{
+			// the body of the subr is not itself subroutinised, so it needs the original instructions.
+			auto ofs = storage.size();
+			for(auto i = subr.start; i < subr.start + subr.length; i++)
+				storage.append(tokens[i]);
+
+			storage.append(CMD_RETURN);
+			subr_spans.emplace_back(ofs, storage.size() - ofs);
+		}
+
+		new_size = storage.size() - new_size;
+		if(new_size >= original_size)
+			return false;
+
+		auto bytes = zst::byte_span(storage.data(), storage.size());
+		for(size_t i = 0; i < cff->glyphs.size(); i++)
+			cff->glyphs[i].charstring = bytes.drop(glyph_spans[i].first).take(glyph_spans[i].second);
+
+		cff->global_subrs.clear();
+		for(auto& [ofs, len] : subr_spans)
+			cff->global_subrs.push_back(Subroutine { .charstring = bytes.drop(ofs).take(len), .used = true });
+
+		cff->global_subrs_bias = bias;
+
+		for(auto& fd : cff->font_dicts)
+		{
+			fd.local_subrs.clear();
+			fd.local_subrs_bias = computeSubrBias(0);
+		}
+
+		return true;
+	}
+}
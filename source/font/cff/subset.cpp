@@ -12,7 +12,7 @@
 
 namespace font::cff
 {
-	static void write_charset_table(CFFData* cff, zst::byte_buffer& buffer, const std::unordered_set<GlyphId>& used_glyphs)
+	static void write_charset_table(CFFData* cff, zst::byte_buffer& buffer, const GlyphSet& used_glyphs)
 	{
 		// format 0
 		buffer.append(0);
@@ -30,7 +30,7 @@ namespace font::cff
 		}
 	}
 
-	static void perform_glyph_pruning(CFFData* cff, const std::unordered_set<GlyphId>& used_glyphs)
+	static void perform_glyph_pruning(CFFData* cff, const GlyphSet& used_glyphs)
 	{
 		std::set<uint8_t> used_font_dicts {};
 
@@ -38,7 +38,7 @@ namespace font::cff
 			if(!cff->is_cidfont)
 			{
 				// for non-CID fonts, the glyph we get from sap/pdf is already the gid.
-				return glyph.gid != 0 && used_glyphs.find(GlyphId { glyph.gid }) == used_glyphs.end();
+				return glyph.gid != 0 && !used_glyphs.contains(GlyphId { glyph.gid });
 			}
 			else
 			{
@@ -52,7 +52,7 @@ namespace font::cff
 				    this seems to imply that glyph ids gotten from the PDF layer are actually CIDs to
 				    the CFF font; thus, we match against CIDs instead.
 				*/
-				bool unused = glyph.gid != 0 && used_glyphs.find(GlyphId { glyph.cid }) == used_glyphs.end();
+				bool unused = glyph.gid != 0 && !used_glyphs.contains(GlyphId { glyph.cid });
 
 				// also, mark the fontdict as used if the glyph was used.
 				if(!unused)
@@ -89,16 +89,20 @@ namespace font::cff
 		// finally, interpret the charstrings of all used glyphs, and mark used subrs for elimination.
 		for(auto& glyph : cff->glyphs)
 		{
-			interpretCharStringAndMarkSubrs(glyph.charstring, cff->global_subrs,
-				cff->font_dicts[glyph.font_dict_idx].local_subrs);
+			interpretCharStringAndMarkSubrs(glyph.charstring, cff, cff->font_dicts[glyph.font_dict_idx]);
 		}
 	}
 
 
-	CFFSubset createCFFSubset(FontFile* font, zst::str_view subset_name, const std::unordered_set<GlyphId>& used_glyphs)
+	CFFSubset createCFFSubset(FontFile* font, zst::str_view subset_name, const GlyphSet& used_glyphs,
+		bool resubroutinise)
 	{
-		auto cff = font->cff_data;
-		assert(cff != nullptr);
+		assert(font->cff_data != nullptr);
+
+		// pruning glyphs and marking subrs modifies the CFFData, so work on a copy; the original may be
+		// subset again later, or shared with other faces in a font collection.
+		auto cff_copy = *font->cff_data;
+		auto cff = &cff_copy;
 
 		zst::byte_buffer buffer {};
 
@@ -142,11 +146,20 @@ namespace font::cff
 		        this allows us to not need to modify the charstring data for glyphs and re-number the subrs.
 		        once the CFF is compressed, any decent compression algorithm should be able to reduce the
 		        repeated values.
+
+		    5. if we're resubroutinising, the subrs (and the charstrings) are instead replaced by new global
+		        subrs made for just this subset, so there are no unused ones at all.
 		*/
 
 		// first, figure out which glyphs we don't use.
+		cff->glyphs = readGlyphs(cff);
 		perform_glyph_pruning(cff, used_glyphs);
 
+		// owns the new charstrings, if any
+		zst::byte_buffer charstring_storage {};
+		if(resubroutinise)
+			resubroutiniseCharStrings(cff, charstring_storage);
+
 
 		// write the header
 		buffer.append(1); // major
@@ -258,6 +271,11 @@ namespace font::cff
 			// returns the absolute offset to the private dict
 			auto serialise_fontdict = [&](FontDict& fd) -> std::pair<size_t, size_t> {
 				auto priv_builder = DictBuilder(fd.private_dict);
+
+				// the local subrs might have been removed (when resubroutinising).
+				if(fd.local_subrs.empty())
+					priv_builder.erase(DictKey::Subrs);
+
 				auto priv_size = priv_builder.computeSize();
 				auto priv_ofs = current_abs_ofs();
 
@@ -370,7 +388,7 @@ namespace font::cff
 
 		CFFSubset ret {};
 		ret.cff = std::move(buffer);
-		ret.cmap = createCMapForCFFSubset(font);
+		ret.cmap = createCMapForCFFSubset(cff);
 
 		return ret;
 	}
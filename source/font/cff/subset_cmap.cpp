@@ -11,7 +11,7 @@
 
 namespace font::cff
 {
-	zst::byte_buffer createCMapForCFFSubset(FontFile* file)
+	zst::byte_buffer createCMapForCFFSubset(CFFData* cff)
 	{
 		/*
 		    i guess what we want to do is just map the cid to the gid...
@@ -21,7 +21,6 @@ namespace font::cff
 			buf.append_bytes(util::convertBEU16(x));
 		};
 
-		auto cff = file->cff_data;
 		assert(cff != nullptr);
 
 		zst::byte_buffer cmap {};
@@ -2,7 +2,6 @@
 // Copyright (c) 2021, zhiayang
 // SPDX-License-Identifier: Apache-2.0
 
-#include "util.h"
 #include "error.h"
 
 #include "font/font.h"
@@ -44,37 +43,57 @@ namespace font
 		consume_u16(subtable);  // entry_selector (ignored)
 		consume_u16(subtable);  // range_shift (ignored)
 
-		auto u16_array = subtable.cast<uint16_t>();
-		auto end_codes = u16_array.take_prefix(seg_count);
-		u16_array.remove_prefix(1);  // reserved
+		// decode the four segment arrays up front; idRangeOffset is kept as a view, since it is also used to
+		// index into the glyphIdArray that immediately follows it.
+		std::vector<uint16_t> end_codes(seg_count);
+		std::vector<uint16_t> start_codes(seg_count);
+		std::vector<uint16_t> id_deltas(seg_count);
+		std::vector<uint16_t> id_range_offsets(seg_count);
 
-		auto start_codes = u16_array.take_prefix(seg_count);
-		auto id_deltas = u16_array.take_prefix(seg_count);
-		auto id_range_offsets = u16_array.take_prefix(seg_count);
+		consume_u16_array(subtable, seg_count).decodeInto(end_codes.data());
+		consume_u16(subtable); // reserved
+		consume_u16_array(subtable, seg_count).decodeInto(start_codes.data());
+		consume_u16_array(subtable, seg_count).decodeInto(id_deltas.data());
+
+		auto range_ofs_and_glyph_ids = consume_u16_array(subtable, subtable.size() / sizeof(uint16_t));
+		for(size_t i = 0; i < seg_count; i++)
+			id_range_offsets[i] = range_ofs_and_glyph_ids[i];
 
 		CharacterMapping mapping {};
 		for(size_t i = 0; i < seg_count; i++)
 		{
-			auto start = util::convertBEU16(start_codes[i]);
-			auto end = util::convertBEU16(end_codes[i]);
-			auto delta = util::convertBEU16(id_deltas[i]);
-			auto range_ofs = util::convertBEU16(id_range_offsets[i]);
+			auto start = start_codes[i];
+			auto end = end_codes[i];
+			auto delta = id_deltas[i];
+			auto range_ofs = id_range_offsets[i];
 
 			for(uint32_t cp = start; cp <= end; cp++)
 			{
+				GlyphId gid {};
 				if(range_ofs != 0)
 				{
-					auto idx = util::convertBEU16(*(id_range_offsets.data() + i + range_ofs / 2 + (cp - start)));
-					auto gid = GlyphId { static_cast<uint32_t>((delta + idx) & 0xffff) };
-					mapping.forward[Codepoint { cp }] = gid;
-					mapping.reverse[gid] = Codepoint { cp };
+					auto idx_idx = i + range_ofs / 2 + (cp - start);
+					if(idx_idx >= range_ofs_and_glyph_ids.size())
+						break;
+
+					// a 0 in the glyphIdArray means the glyph is missing.
+					auto idx = range_ofs_and_glyph_ids[idx_idx];
+					if(idx == 0)
+						continue;
+
+					gid = GlyphId { static_cast<uint32_t>((delta + idx) & 0xffff) };
 				}
 				else
 				{
-					auto gid = GlyphId { static_cast<uint32_t>((delta + cp) & 0xffff) };
-					mapping.forward[Codepoint { cp }] = gid;
-					mapping.reverse[gid] = Codepoint { cp };
+					gid = GlyphId { static_cast<uint32_t>((delta + cp) & 0xffff) };
 				}
+
+				// the last segment (0xFFFF) is just a terminator that maps to .notdef
+				if(gid == GlyphId::notdef)
+					continue;
+
+				mapping.forward[Codepoint { cp }] = gid;
+				mapping.reverse[gid] = Codepoint { cp };
 			}
 		}
 
@@ -91,12 +110,13 @@ namespace font
 
 		auto first = consume_u16(subtable);
 		auto count = consume_u16(subtable);
+		auto glyph_ids = consume_u16_array(subtable, count).decode();
 
 		CharacterMapping mapping {};
 		for(size_t i = 0; i < count; i++)
 		{
 			auto cp = Codepoint { static_cast<uint32_t>(first + i) };
-			auto gid = GlyphId { subtable.cast<uint16_t>()[i] };
+			auto gid = GlyphId { glyph_ids[i] };
 
 			mapping.forward[cp] = gid;
 			mapping.reverse[gid] = cp;
@@ -115,12 +135,13 @@ namespace font
 
 		auto first = consume_u32(subtable);
 		auto count = consume_u32(subtable);
+		auto glyph_ids = consume_u16_array(subtable, count).decode();
 
 		CharacterMapping mapping {};
 		for(size_t i = 0; i < count; i++)
 		{
 			auto cp = Codepoint { static_cast<uint32_t>(first + i) };
-			auto gid = GlyphId { subtable.cast<uint32_t>()[i] };
+			auto gid = GlyphId { glyph_ids[i] };
 
 			mapping.forward[cp] = gid;
 			mapping.reverse[gid] = cp;
@@ -140,12 +161,15 @@ namespace font
 
 		auto num_groups = consume_u32(subtable);
 
+		// each group is (startCharCode, endCharCode, glyphID)
+		auto groups = consume_u32_array(subtable, 3 * (size_t) num_groups).decode();
+
 		CharacterMapping mapping {};
 		for(size_t i = 0; i < num_groups; i++)
 		{
-			auto first = consume_u32(subtable);
-			auto last = consume_u32(subtable);
-			auto g = consume_u32(subtable);
+			auto first = groups[3 * i + 0];
+			auto last = groups[3 * i + 1];
+			auto g = groups[3 * i + 2];
 
 			for(auto x = first; x <= last; x++)
 			{
@@ -0,0 +1,566 @@
+// discovery.cpp
+// Copyright (c) 2022, zhiayang
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "pool.h"
+#include "error.h"
+
+#include "font/font.h"
+#include "font/discovery.h"
+
+namespace font
+{
+	static constexpr const char* INDEX_FILE_MAGIC = "sap-font-index 1";
+
+	struct FileStamp
+	{
+		int64_t mtime = 0;
+		uint64_t size = 0;
+
+		bool operator==(const FileStamp& other) const { return mtime == other.mtime && size == other.size; }
+	};
+
+	static std::optional<FileStamp> stat_file(const std::string& path, bool* is_dir = nullptr)
+	{
+		struct stat st;
+		if(stat(path.c_str(), &st) < 0)
+			return std::nullopt;
+
+		if(is_dir)
+			*is_dir = S_ISDIR(st.st_mode);
+
+#if defined(__APPLE__)
+		auto mtime = (int64_t) st.st_mtimespec.tv_sec * 1'000'000'000 + st.st_mtimespec.tv_nsec;
+#else
+		auto mtime = (int64_t) st.st_mtim.tv_sec * 1'000'000'000 + st.st_mtim.tv_nsec;
+#endif
+		return FileStamp { mtime, static_cast<uint64_t>(st.st_size) };
+	}
+
+	static std::string to_lower(zst::str_view sv)
+	{
+		std::string ret(sv.data(), sv.size());
+		for(auto& c : ret)
+		{
+			if('A' <= c && c <= 'Z')
+				c = (char) (c - 'A' + 'a');
+		}
+		return ret;
+	}
+
+	static bool is_font_file(const std::string& name)
+	{
+		auto dot = name.rfind('.');
+		if(dot == std::string::npos)
+			return false;
+
+		auto ext = to_lower(zst::str_view(name).drop(dot + 1));
+		return ext == "ttf" || ext == "otf" || ext == "ttc" || ext == "otc";
+	}
+
+	static std::string parent_directory(const std::string& path)
+	{
+		auto slash = path.rfind('/');
+		if(slash == std::string::npos)
+			return ".";
+
+		return path.substr(0, slash);
+	}
+
+	static std::vector<FontFaceInfo> scan_font_file(const std::string& path, uint64_t size)
+	{
+		if(size < 12 || access(path.c_str(), R_OK) != 0)
+			return {};
+
+		// don't use util::readEntireFile, since that is fatal on errors (and never unmaps the file).
+		auto fd = open(path.c_str(), O_RDONLY);
+		if(fd < 0)
+			return {};
+
+		auto ptr = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, /* offset: */ 0);
+		close(fd);
+
+		if(ptr == MAP_FAILED)
+			return {};
+
+		auto faces = readFontFaceInfo(path, zst::byte_span(reinterpret_cast<uint8_t*>(ptr), size));
+		munmap(ptr, size);
+
+		return faces;
+	}
+
+
+
+
+	/*
+	    The cache file is line-based, with tab-separated fields:
+
+	    D <mtime> <path>            -- a scanned directory
+	    F <mtime> <size> <path>     -- a scanned font file, followed by its faces:
+	    A <face_idx> <weight> <italic> <family> <subfamily> <postscript_name> <coverage>
+
+	    coverage is a comma-separated list of `word:hex` for the non-zero words of the CoverageSummary.
+	*/
+	struct CachedFile
+	{
+		FileStamp stamp;
+		std::vector<FontFaceInfo> faces;
+	};
+
+	struct IndexCache
+	{
+		util::hashmap<std::string, int64_t> directories;
+		util::hashmap<std::string, CachedFile> files;
+	};
+
+	static std::vector<zst::str_view> split_fields(zst::str_view line)
+	{
+		std::vector<zst::str_view> fields {};
+		while(true)
+		{
+			auto tab = line.find('\t');
+			if(tab == (size_t) -1)
+			{
+				fields.push_back(line);
+				break;
+			}
+
+			fields.push_back(line.take(tab));
+			line.remove_prefix(tab + 1);
+		}
+		return fields;
+	}
+
+	static std::string sanitise_field(const std::string& str)
+	{
+		auto ret = str;
+		for(auto& c : ret)
+		{
+			if(c == '\t' || c == '\n' || c == '\r')
+				c = ' ';
+		}
+		return ret;
+	}
+
+	static IndexCache read_cache_file(const std::string& cache_path)
+	{
+		IndexCache cache {};
+
+		auto file = fopen(cache_path.c_str(), "rb");
+		if(file == nullptr)
+			return cache;
+
+		std::string contents {};
+		char buf[4096];
+		while(auto n = fread(buf, 1, sizeof(buf), file))
+			contents.append(buf, n);
+
+		fclose(file);
+
+		auto sv = zst::str_view(contents);
+		auto next_line = [&sv]() -> zst::str_view {
+			auto nl = sv.find('\n');
+			auto line = (nl == (size_t) -1) ? sv : sv.take(nl);
+			sv.remove_prefix(nl == (size_t) -1 ? sv.size() : nl + 1);
+			return line;
+		};
+
+		// a cache from a different version is just thrown away.
+		if(next_line() != INDEX_FILE_MAGIC)
+			return cache;
+
+		CachedFile* current_file = nullptr;
+		while(sv.size() > 0)
+		{
+			auto fields = split_fields(next_line());
+			if(fields[0] == "D" && fields.size() == 3)
+			{
+				cache.directories[fields[2].str()] = strtoll(fields[1].str().c_str(), nullptr, 10);
+			}
+			else if(fields[0] == "F" && fields.size() == 4)
+			{
+				current_file = &cache.files[fields[3].str()];
+				current_file->stamp.mtime = strtoll(fields[1].str().c_str(), nullptr, 10);
+				current_file->stamp.size = strtoull(fields[2].str().c_str(), nullptr, 10);
+			}
+			else if(fields[0] == "A" && fields.size() == 8 && current_file != nullptr)
+			{
+				FontFaceInfo face {};
+				face.face_index = strtoull(fields[1].str().c_str(), nullptr, 10);
+				face.weight = (int) strtol(fields[2].str().c_str(), nullptr, 10);
+				face.italic = fields[3] == "1";
+				face.family = fields[4].str();
+				face.subfamily = fields[5].str();
+				face.postscript_name = fields[6].str();
+
+				auto cov = fields[7];
+				while(cov.size() > 0)
+				{
+					auto comma = cov.find(',');
+					auto item = (comma == (size_t) -1) ? cov : cov.take(comma);
+					cov.remove_prefix(comma == (size_t) -1 ? cov.size() : comma + 1);
+
+					auto colon = item.find(':');
+					if(colon == (size_t) -1)
+						continue;
+
+					auto word = strtoull(item.take(colon).str().c_str(), nullptr, 10);
+					if(word < CoverageSummary::NUM_WORDS)
+						face.coverage.words[word] = strtoull(item.drop(colon + 1).str().c_str(), nullptr, 16);
+				}
+
+				current_file->faces.push_back(std::move(face));
+			}
+		}
+
+		return cache;
+	}
+
+	static void write_cache_file(const std::string& cache_path, const IndexCache& cache)
+	{
+		std::string out {};
+		out += INDEX_FILE_MAGIC;
+		out += "\n";
+
+		for(auto& [dir, mtime] : cache.directories)
+			out += zpr::sprint("D\t{}\t{}\n", mtime, sanitise_field(dir));
+
+		for(auto& [path, file] : cache.files)
+		{
+			out += zpr::sprint("F\t{}\t{}\t{}\n", file.stamp.mtime, file.stamp.size, sanitise_field(path));
+			for(auto& face : file.faces)
+			{
+				std::string coverage {};
+				for(size_t i = 0; i < CoverageSummary::NUM_WORDS; i++)
+				{
+					if(face.coverage.words[i] == 0)
+						continue;
+
+					if(!coverage.empty())
+						coverage += ",";
+
+					coverage += zpr::sprint("{}:{x}", i, face.coverage.words[i]);
+				}
+
+				out += zpr::sprint("A\t{}\t{}\t{}\t{}\t{}\t{}\t{}\n", face.face_index, face.weight, face.italic ? 1 : 0,
+					sanitise_field(face.family), sanitise_field(face.subfamily), sanitise_field(face.postscript_name),
+					coverage);
+			}
+		}
+
+		// create the directory for the cache if needed (just one level; the parent should exist already)
+		mkdir(parent_directory(cache_path).c_str(), 0755);
+
+		// write to a temporary file and rename it, so a concurrent run never sees a half-written index.
+		auto tmp_path = cache_path + ".tmp";
+		auto file = fopen(tmp_path.c_str(), "wb");
+		if(file == nullptr)
+		{
+			sap::warn("font/index", "could not write font index to '{}'", cache_path);
+			return;
+		}
+
+		fwrite(out.data(), 1, out.size(), file);
+		fclose(file);
+
+		rename(tmp_path.c_str(), cache_path.c_str());
+	}
+
+
+
+	struct IndexBuilder
+	{
+		const IndexCache& old_cache;
+		IndexCache new_cache {};
+		bool changed = false;
+
+		// for directories whose mtime has not changed, the list of entries is the same as last time.
+		util::hashmap<std::string, std::vector<std::string>> cached_children {};
+
+		void visit_file(const std::string& path)
+		{
+			if(new_cache.files.find(path) != new_cache.files.end())
+				return;
+
+			auto stamp = stat_file(path);
+			if(not stamp.has_value())
+			{
+				changed = true;
+				return;
+			}
+
+			if(auto it = old_cache.files.find(path); it != old_cache.files.end() && it->second.stamp == *stamp)
+			{
+				new_cache.files[path] = it->second;
+				return;
+			}
+
+			changed = true;
+
+			CachedFile file {};
+			file.stamp = *stamp;
+			file.faces = scan_font_file(path, stamp->size);
+
+			new_cache.files[path] = std::move(file);
+		}
+
+		void visit_directory(const std::string& path)
+		{
+			if(new_cache.directories.find(path) != new_cache.directories.end())
+				return;
+
+			bool is_dir = false;
+			auto stamp = stat_file(path, &is_dir);
+			if(not stamp.has_value() || not is_dir)
+			{
+				if(old_cache.directories.find(path) != old_cache.directories.end())
+					changed = true;
+
+				return;
+			}
+
+			new_cache.directories[path] = stamp->mtime;
+
+			if(auto it = old_cache.directories.find(path); it != old_cache.directories.end() && it->second == stamp->mtime)
+			{
+				// nothing was added or removed here, so we don't need to list the directory again.
+				// files can still have been modified in place though, so they are still stat-ed.
+				if(auto c = cached_children.find(path); c != cached_children.end())
+				{
+					for(auto& child : c->second)
+					{
+						if(old_cache.directories.find(child) != old_cache.directories.end())
+							this->visit_directory(child);
+						else
+							this->visit_file(child);
+					}
+				}
+
+				return;
+			}
+
+			changed = true;
+
+			auto dir = opendir(path.c_str());
+			if(dir == nullptr)
+				return;
+
+			std::vector<std::string> subdirs {};
+			std::vector<std::string> files {};
+			while(auto ent = readdir(dir))
+			{
+				auto name = std::string(ent->d_name);
+				if(name == "." || name == "..")
+					continue;
+
+				auto child = path + "/" + name;
+
+				bool child_is_dir = false;
+				if(ent->d_type == DT_DIR)
+					child_is_dir = true;
+				else if(ent->d_type == DT_UNKNOWN || ent->d_type == DT_LNK)
+					stat_file(child, &child_is_dir);
+
+				if(child_is_dir)
+					subdirs.push_back(std::move(child));
+				else if(is_font_file(name))
+					files.push_back(std::move(child));
+			}
+
+			closedir(dir);
+
+			for(auto& f : files)
+				this->visit_file(f);
+
+			for(auto& d : subdirs)
+				this->visit_directory(d);
+		}
+	};
+
+	FontIndex* FontIndex::load(const std::vector<std::string>& directories, const std::string& cache_path)
+	{
+		auto old_cache = read_cache_file(cache_path);
+
+		IndexBuilder builder { old_cache };
+		for(auto& [path, _] : old_cache.files)
+			builder.cached_children[parent_directory(path)].push_back(path);
+
+		for(auto& [path, _] : old_cache.directories)
+			builder.cached_children[parent_directory(path)].push_back(path);
+
+		std::vector<std::string> roots {};
+		for(auto& dir : directories)
+		{
+			// strip trailing slashes so that paths are consistent between runs
+			auto d = dir;
+			while(d.size() > 1 && d.back() == '/')
+				d.pop_back();
+
+			builder.visit_directory(d);
+			roots.push_back(std::move(d));
+		}
+
+		// files or directories that disappeared (or were outside the configured directories) also need a rewrite
+		if(builder.new_cache.files.size() != old_cache.files.size()
+			|| builder.new_cache.directories.size() != old_cache.directories.size())
+			builder.changed = true;
+
+		if(builder.changed)
+			write_cache_file(cache_path, builder.new_cache);
+
+		/*
+		    when two faces tie, the first one added wins, so the files are added in the order of the directories
+		    they are in (the first one that contains them), and by path within each directory. this way the order
+		    doesn't depend on hash order, and earlier directories shadow later ones.
+		*/
+		auto directory_rank = [&roots](const std::string& path) -> size_t {
+			for(size_t i = 0; i < roots.size(); i++)
+			{
+				auto& root = roots[i];
+				if(path.size() > root.size() && path.starts_with(root) && (path[root.size()] == '/' || root == "/"))
+					return i;
+			}
+
+			return roots.size();
+		};
+
+		std::vector<std::pair<size_t, std::string>> paths {};
+		for(auto& [path, _] : builder.new_cache.files)
+			paths.emplace_back(directory_rank(path), path);
+
+		std::sort(paths.begin(), paths.end());
+
+		auto index = util::make<FontIndex>();
+		for(auto& [_, path] : paths)
+		{
+			for(auto& face : builder.new_cache.files[path].faces)
+			{
+				auto f = face;
+				f.path = path;
+				index->add_face(std::move(f));
+			}
+		}
+
+		return index;
+	}
+
+	void FontIndex::add_face(FontFaceInfo face)
+	{
+		auto idx = m_faces.size();
+
+		m_families[to_lower(face.family)].push_back(idx);
+		m_postscript_names.emplace(to_lower(face.postscript_name), idx);
+
+		m_faces.push_back(std::move(face));
+	}
+
+	const FontFaceInfo* FontIndex::findFace(zst::str_view family, zst::str_view subfamily) const
+	{
+		auto it = m_families.find(to_lower(family));
+		if(it == m_families.end())
+			return nullptr;
+
+		auto sub = to_lower(subfamily);
+		for(auto idx : it->second)
+		{
+			if(to_lower(m_faces[idx].subfamily) == sub)
+				return &m_faces[idx];
+		}
+
+		return nullptr;
+	}
+
+	const FontFaceInfo* FontIndex::findFace(zst::str_view family, int weight, bool italic) const
+	{
+		auto it = m_families.find(to_lower(family));
+		if(it == m_families.end())
+			return nullptr;
+
+		// prefer the right slant over the right weight; between equally distant weights, prefer the heavier one
+		// if we asked for something bold, and the lighter one otherwise.
+		const FontFaceInfo* best = nullptr;
+		int best_score = 0;
+		for(auto idx : it->second)
+		{
+			auto& face = m_faces[idx];
+
+			int score = 4 * std::abs(face.weight - weight);
+			if(face.italic != italic)
+				score += 10000;
+
+			if(face.weight != weight && ((face.weight > weight) != (weight > 500)))
+				score += 1;
+
+			if(best == nullptr || score < best_score)
+				best = &face, best_score = score;
+		}
+
+		return best;
+	}
+
+	const FontFaceInfo* FontIndex::findFaceByPostscriptName(zst::str_view name) const
+	{
+		if(auto it = m_postscript_names.find(to_lower(name)); it != m_postscript_names.end())
+			return &m_faces[it->second];
+
+		return nullptr;
+	}
+
+	FontFile* FontIndex::loadFace(const FontFaceInfo* face) const
+	{
+		assert(face != nullptr);
+		return FontFile::parseFromFile(face->path, face->face_index);
+	}
+
+	std::string FontIndex::defaultCachePath()
+	{
+		if(auto xdg = getenv("XDG_CACHE_HOME"); xdg != nullptr && *xdg)
+			return zpr::sprint("{}/sap/font-index", xdg);
+
+		if(auto home = getenv("HOME"); home != nullptr && *home)
+		{
+			// the index goes into ~/.cache/sap/, so make sure ~/.cache exists.
+			auto cache_dir = zpr::sprint("{}/.cache", home);
+			mkdir(cache_dir.c_str(), 0755);
+
+			return zpr::sprint("{}/sap/font-index", cache_dir);
+		}
+
+		return ".sap-font-index";
+	}
+
+	std::vector<std::string> FontIndex::defaultSearchDirectories()
+	{
+		// project-local fonts come first.
+		std::vector<std::string> dirs = { "fonts" };
+
+		if(auto home = getenv("HOME"); home != nullptr && *home)
+		{
+			dirs.push_back(zpr::sprint("{}/.fonts", home));
+			dirs.push_back(zpr::sprint("{}/.local/share/fonts", home));
+#if defined(__APPLE__)
+			dirs.push_back(zpr::sprint("{}/Library/Fonts", home));
+#endif
+		}
+
+#if defined(__APPLE__)
+		dirs.push_back("/Library/Fonts");
+		dirs.push_back("/System/Library/Fonts");
+#else
+		dirs.push_back("/usr/local/share/fonts");
+		dirs.push_back("/usr/share/fonts");
+#endif
+		return dirs;
+	}
+}
@@ -2,6 +2,8 @@
 // Copyright (c) 2021, zhiayang
 // SPDX-License-Identifier: Apache-2.0
 
+#include <mutex>
+
 #include "util.h"
 #include "error.h"
 #include "font/font.h"
@@ -60,6 +62,23 @@ namespace font::off
 	template std::vector<uint16_t> getLookupTablesForFeatures(GPosTable& table, const FeatureSet& features);
 	template std::vector<uint16_t> getLookupTablesForFeatures(GSubTable& table, const FeatureSet& features);
 
+	const ShapePlan& getShapePlan(FontFile* font, const FeatureSet& features)
+	{
+		// words are shaped on several threads at once. the map's elements don't move, so the returned
+		// reference stays valid after the lock is released.
+		static std::mutex mutex {};
+		std::lock_guard lock(mutex);
+
+		if(auto it = font->shape_plans.find(features); it != font->shape_plans.end())
+			return it->second;
+
+		ShapePlan plan {};
+		plan.gsub_lookups = getLookupTablesForFeatures(font->gsub_table, features);
+		plan.gpos_lookups = getLookupTablesForFeatures(font->gpos_table, features);
+
+		return font->shape_plans.emplace(features, std::move(plan)).first->second;
+	}
+
 	static Language parse_one_language(Tag tag, zst::byte_span buf)
 	{
 		Language lang {};
@@ -183,7 +202,9 @@ namespace font::off
 					lookup.subtables.push_back(lookup_start.drop(consume_u16(tbl_buf)));
 			}
 
-			lookup.mark_filtering_set = consume_u16(tbl_buf);
+			// the mark filtering set is only there if the flag says so.
+			if(lookup.flags & LOOKUP_FLAG_USE_MARK_FILTERING_SET)
+				lookup.mark_filtering_set = consume_u16(tbl_buf);
 
 			table_list.push_back(std::move(lookup));
 		}
@@ -191,6 +212,73 @@ namespace font::off
 		return table_list;
 	}
 
+	GlyphSetDigest computeLookupDigest(const LookupTable& lookup, bool is_gsub)
+	{
+		GlyphSetDigest digest {};
+
+		bool contextual = is_gsub ? (lookup.type == gsub::LOOKUP_CONTEXTUAL) : (lookup.type == gpos::LOOKUP_CONTEXTUAL);
+		bool chained = is_gsub ? (lookup.type == gsub::LOOKUP_CHAINING_CONTEXT)
+		                       : (lookup.type == gpos::LOOKUP_CHAINING_CONTEXT);
+
+		// everything else (that we know of) has the coverage offset right after the format.
+		bool known_type = is_gsub ? (lookup.type < gsub::LOOKUP_MAX && lookup.type != gsub::LOOKUP_EXTENSION_SUBST)
+		                          : (lookup.type < gpos::LOOKUP_MAX && lookup.type != gpos::LOOKUP_EXTENSION_POS);
+
+		for(auto subtable : lookup.subtables)
+		{
+			auto subtable_start = subtable;
+			if(!known_type || subtable.size() < 4)
+			{
+				digest.addAll();
+				break;
+			}
+
+			// unknown formats get warned about (and skipped) later, but we can't know where their coverage is.
+			auto format = consume_u16(subtable);
+			if(format == 0 || format > 3)
+			{
+				digest.addAll();
+				break;
+			}
+
+			// format 3 of the contextual lookups has one coverage table for each glyph; we want the first one.
+			uint16_t cov_ofs = 0;
+			if((contextual || chained) && format == 3)
+			{
+				if(contextual)
+				{
+					auto num_glyphs = consume_u16(subtable);
+					consume_u16(subtable); // num_records
+
+					cov_ofs = (num_glyphs > 0) ? consume_u16(subtable) : 0;
+				}
+				else
+				{
+					auto num_lookbehind = consume_u16(subtable);
+					subtable.remove_prefix(num_lookbehind * sizeof(uint16_t));
+
+					auto num_glyphs = consume_u16(subtable);
+					cov_ofs = (num_glyphs > 0) ? consume_u16(subtable) : 0;
+				}
+			}
+			else
+			{
+				cov_ofs = consume_u16(subtable);
+			}
+
+			if(cov_ofs == 0)
+			{
+				digest.addAll();
+				break;
+			}
+
+			for(auto& [idx, gid] : parseCoverageTable(subtable_start.drop(cov_ofs)))
+				digest.add(gid);
+		}
+
+		return digest;
+	}
+
 	std::vector<TaggedTable> parseTaggedList(zst::byte_span buf, size_t starting_offset)
 	{
 		std::vector<TaggedTable> ret {};
@@ -230,6 +318,10 @@ namespace font::off
 		output->scripts = parseScriptAndLanguageTables(table_start.drop(script_list_ofs));
 		output->features = parseFeatureList(table_start.drop(feature_list_ofs));
 		output->lookups = parseLookupList(table_start.drop(lookup_list_ofs));
+		output->classdefs.table_start = table_start.data();
+
+		for(auto& lookup : output->lookups)
+			lookup.digest = computeLookupDigest(lookup, /* is_gsub: */ std::is_same_v<TableType, GSubTable>);
 
 		if(major == 1 && minor == 1)
 		{
@@ -244,6 +336,10 @@ namespace font::off
 		buf.remove_prefix(table.offset);
 
 		parseGPosOrGSub(font, &font->gpos_table, buf);
+
+		auto& gpos = font->gpos_table;
+		for(auto& lookup : gpos.lookups)
+			gpos.compiled_lookups.push_back(gpos::compileLookup(gpos.classdefs, lookup));
 	}
 
 	void parseGSub(FontFile* font, const Table& table)
@@ -252,5 +348,9 @@ namespace font::off
 		buf.remove_prefix(table.offset);
 
 		parseGPosOrGSub(font, &font->gsub_table, buf);
+
+		auto& gsub = font->gsub_table;
+		for(auto& lookup : gsub.lookups)
+			gsub.compiled_lookups.push_back(gsub::compileLookup(gsub.classdefs, lookup));
 	}
 }
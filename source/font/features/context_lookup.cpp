@@ -9,323 +9,289 @@
 
 namespace font::off
 {
-	static std::vector<ContextualLookupRecord> parse_records(size_t num_records, zst::byte_span table)
+	static std::unordered_set<GlyphId> coverage_set(zst::byte_span coverage_table)
 	{
+		std::unordered_set<GlyphId> ret {};
+		for(auto& [idx, gid] : parseCoverageTable(coverage_table))
+			ret.insert(gid);
+
+		return ret;
+	}
+
+	static std::vector<uint16_t> consume_values(zst::byte_span& buf, size_t count)
+	{
+		return consume_u16_array(buf, count).decode();
+	}
+
+	static std::vector<ContextualLookupRecord> consume_records(zst::byte_span& buf, size_t count)
+	{
+		auto values = consume_values(buf, 2 * count);
+
 		std::vector<ContextualLookupRecord> ret {};
-		for(size_t k = 0; k < num_records; k++)
+		for(size_t i = 0; i < count; i++)
+			ret.push_back({ values[2 * i + 0], values[2 * i + 1] });
+
+		return ret;
+	}
+
+	static CompiledContextRule compile_context_rule(zst::byte_span rule, bool chained)
+	{
+		CompiledContextRule ret {};
+		if(chained)
+		{
+			ret.lookbehind = consume_values(rule, consume_u16(rule));
+
+			auto num_glyphs = consume_u16(rule);
+			ret.input.push_back(0); // the first glyph isn't stored in the rule; it was used to find the rule set
+			if(num_glyphs > 0)
+			{
+				auto tmp = consume_values(rule, num_glyphs - 1u);
+				ret.input.insert(ret.input.end(), tmp.begin(), tmp.end());
+			}
+
+			ret.lookahead = consume_values(rule, consume_u16(rule));
+			ret.records = consume_records(rule, consume_u16(rule));
+		}
+		else
+		{
+			auto num_glyphs = consume_u16(rule);
+			auto num_records = consume_u16(rule);
+
+			ret.input.push_back(0);
+			if(num_glyphs > 0)
+			{
+				auto tmp = consume_values(rule, num_glyphs - 1u);
+				ret.input.insert(ret.input.end(), tmp.begin(), tmp.end());
+			}
+
+			ret.records = consume_records(rule, num_records);
+		}
+
+		return ret;
+	}
+
+	// reads a RuleSet / ClassSet (they have the same layout), which is a list of offsets to rules
+	static std::vector<CompiledContextRule> compile_rule_set(zst::byte_span rule_set, uint16_t first, bool chained)
+	{
+		auto rule_set_start = rule_set;
+
+		std::vector<CompiledContextRule> ret {};
+
+		auto num_rules = consume_u16(rule_set);
+		for(auto ofs : consume_values(rule_set, num_rules))
 		{
-			ContextualLookupRecord record {};
-			record.glyph_idx = consume_u16(table);
-			record.lookup_idx = consume_u16(table);
+			auto rule = compile_context_rule(rule_set_start.drop(ofs), chained);
+			rule.input[0] = first;
 
-			ret.push_back(std::move(record));
+			ret.push_back(std::move(rule));
 		}
 
 		return ret;
 	}
 
-	std::optional<std::pair<std::vector<ContextualLookupRecord>, size_t>> performContextualLookup(zst::byte_span subtable,
-		zst::span<GlyphId> glyphs)
+	std::optional<CompiledContextSubtable> compileContextSubtable(ClassDefCache& classdefs, zst::byte_span subtable,
+		bool chained)
 	{
 		auto subtable_start = subtable;
 		auto format = consume_u16(subtable);
 
 		if(format != 1 && format != 2 && format != 3)
 		{
-			sap::warn("font/off", "unknown subtable format '{}' in GPOS/GSUB Contextual", format);
+			sap::warn("font/off", "unknown subtable format '{}' in GPOS/GSUB {}", format,
+				chained ? "ChainingContext" : "Contextual");
 			return std::nullopt;
 		}
 
+		CompiledContextSubtable ret {};
+		ret.format = format;
+
 		if(format == 3)
 		{
-			auto num_glyphs = consume_u16(subtable);
-			auto num_records = consume_u16(subtable);
+			auto consume_coverages = [&](size_t count) {
+				std::vector<std::unordered_set<GlyphId>> covs {};
+				for(auto ofs : consume_values(subtable, count))
+					covs.push_back(coverage_set(subtable_start.drop(ofs)));
 
-			// can't match this rule, not enough glyphs
-			if(glyphs.size() < num_glyphs)
-				return std::nullopt;
+				return covs;
+			};
 
-			for(size_t i = 0; i < num_glyphs; i++)
+			if(chained)
 			{
-				// basically, the idea is that for glyph[i], it must appear in coverage[i].
-				auto coverage = subtable_start.drop(consume_u16(subtable));
-				if(!getGlyphCoverageIndex(coverage, glyphs[i]).has_value())
-					return std::nullopt;
+				ret.lookbehind_coverage = consume_coverages(consume_u16(subtable));
+				ret.input_coverage = consume_coverages(consume_u16(subtable));
+				ret.lookahead_coverage = consume_coverages(consume_u16(subtable));
+				ret.records = consume_records(subtable, consume_u16(subtable));
 			}
+			else
+			{
+				auto num_glyphs = consume_u16(subtable);
+				auto num_records = consume_u16(subtable);
 
-			return std::pair(parse_records(num_records, subtable), num_glyphs);
-		}
-		else
-		{
-			assert(format == 1 || format == 2);
-			auto cov_ofs = consume_u16(subtable);
-
-			// both formats 1 and 2 uses a coverage table to gate the first glyph. If the first
-			// glyph in our sequence is not covered, skip this subtable.
-			auto cov_idx = off::getGlyphCoverageIndex(subtable_start.drop(cov_ofs), glyphs[0]);
-			if(!cov_idx.has_value())
-				return std::nullopt;
+				ret.input_coverage = consume_coverages(num_glyphs);
+				ret.records = consume_records(subtable, num_records);
+			}
 
-			auto try_match_rule = [&glyphs](zst::byte_span& rule, auto&& trf) -> std::tuple<bool, uint16_t, uint16_t> {
-				auto num_glyphs = consume_u16(rule);
-				auto num_records = consume_u16(rule);
+			return ret;
+		}
 
-				// can't match this rule, not enough glyphs
-				if(glyphs.size() < num_glyphs)
-					return { false, 0, 0 };
+		auto coverage = parseCoverageTable(subtable_start.drop(consume_u16(subtable)));
+		if(format == 1)
+		{
+			auto num_rule_sets = consume_u16(subtable);
+			auto rule_set_offsets = consume_values(subtable, num_rule_sets);
 
-				for(auto k = 1; k < num_glyphs; k++)
-				{
-					if(static_cast<uint16_t>(trf(glyphs[k])) != consume_u16(rule))
-						return { false, 0, 0 };
-				}
+			for(auto& [cov_idx, gid] : coverage)
+			{
+				if(static_cast<size_t>(cov_idx) >= num_rule_sets || rule_set_offsets[cov_idx] == 0)
+					continue;
 
-				return { true, num_glyphs, num_records };
+				auto first = static_cast<uint16_t>(gid);
+				ret.rule_sets[first] = compile_rule_set(subtable_start.drop(rule_set_offsets[cov_idx]), first, chained);
+			}
+		}
+		else
+		{
+			for(auto& [cov_idx, gid] : coverage)
+				ret.coverage.insert(gid);
+
+			// the lookbehind and lookahead classdefs can be null if no rule uses them; everything is then class 0.
+			auto consume_classes = [&]() -> const ClassDef* {
+				if(auto ofs = consume_u16(subtable); ofs != 0)
+					return &classdefs.decode(subtable_start.drop(ofs));
+				return nullptr;
 			};
 
-			if(format == 1)
+			if(chained)
 			{
-				/*
-				    Format 1 defines lookups based on glyph ids. After slogging through the tables,
-				    the fundamental idea is to match the input glyphstring with an expected sequence,
-				    which is given in glyph ids.
-				*/
-
-				auto num_rulesets = consume_u16(subtable);
-				assert(*cov_idx < num_rulesets);
-
-				subtable.remove_prefix(*cov_idx * sizeof(uint16_t));
-				auto ruleset_ofs = consume_u16(subtable);
-
-				auto ruleset_table = subtable_start.drop(ruleset_ofs);
-				auto ruleset_table_start = ruleset_table;
-
-				auto num_rules = consume_u16(ruleset_table);
-				for(size_t i = 0; i < num_rules; i++)
-				{
-					auto rule = ruleset_table_start.drop(consume_u16(ruleset_table));
-					auto [matched, num_glyphs, num_records] = try_match_rule(rule, [](auto x) {
-						return x;
-					});
-
-					if(matched)
-						return std::pair(parse_records(num_records, rule), num_glyphs);
-				}
+				ret.lookbehind_classes = consume_classes();
+				ret.input_classes = consume_classes();
+				ret.lookahead_classes = consume_classes();
 			}
 			else
 			{
-				/*
-				    Format 2 defines lookups based on classes. The first glyph is still gated
-				    by the initial coverage table. At the final stage (Rule), glyphs in the
-				    input glyphstring are matched by *class id*, not glyph id.
-				*/
-				auto classdef_ofs = consume_u16(subtable);
-
-				/*
-				    Here, we don't parse the entire table at once, but rather lookup the classdef table
-				    separately. We can perform a binary search on the table, so it's not too slow.
-
-				    Building a datastructure (ie. parsing the whole table) is probably not a good idea,
-				    since it won't (and can't, for now...) be cached between lookups.
-				*/
-				auto classdef_table = subtable_start.drop(classdef_ofs);
-				auto num_class_sets = consume_u16(subtable);
-
-				auto first_class_id = getGlyphClass(classdef_table, glyphs[0]);
-				assert(first_class_id < num_class_sets);
-
-				auto classset = subtable_start.drop(peek_u16(subtable.drop(first_class_id * sizeof(uint16_t))));
-				auto classset_start = classset;
-
-				auto num_rules = consume_u16(classset);
-				for(size_t i = 0; i < num_rules; i++)
-				{
-					auto rule = classset_start.drop(consume_u16(classset));
-					auto [matched, num_glyphs, num_records] = try_match_rule(rule, [&classdef_table](auto gid) {
-						return getGlyphClass(classdef_table, gid);
-					});
-
-					if(matched)
-						return std::pair(parse_records(num_records, rule), num_glyphs);
-				}
+				ret.input_classes = consume_classes();
 			}
-		}
 
-		return std::nullopt;
-	}
+			auto num_class_sets = consume_u16(subtable);
+			auto class_set_offsets = consume_values(subtable, num_class_sets);
 
-
-	std::optional<std::pair<std::vector<ContextualLookupRecord>, size_t>> performChainedContextLookup(zst::byte_span subtable,
-		zst::span<GlyphId> glyphs, size_t position)
-	{
-		auto subtable_start = subtable;
-		auto format = consume_u16(subtable);
-
-		if(format != 1 && format != 2 && format != 3)
-		{
-			sap::warn("font/off", "unknown subtable format '{}' in GPOS/GSUB ChainingContext", format);
-			return std::nullopt;
+			for(uint16_t cls = 0; cls < num_class_sets; cls++)
+			{
+				if(class_set_offsets[cls] != 0)
+					ret.rule_sets[cls] = compile_rule_set(subtable_start.drop(class_set_offsets[cls]), cls, chained);
+			}
 		}
 
-		if(format == 3)
-		{
-			auto num_lookbehind = consume_u16(subtable);
-			auto num_glyphs = peek_u16(subtable.drop(num_lookbehind * sizeof(uint16_t)));
+		return ret;
+	}
 
-			// note: here, the input sequence includes glyph[position] itself, so there is no -1 to cancel
-			auto num_lookahead = peek_u16(subtable.drop((num_lookbehind + num_glyphs + 1) * sizeof(uint16_t)));
 
-			if(position < num_lookbehind)
-				return std::nullopt;
-			else if(position + num_glyphs > glyphs.size())
-				return std::nullopt;
-			else if(position + num_glyphs + num_lookahead >= glyphs.size())
-				return std::nullopt;
-
-			for(size_t k = 0; k < num_lookbehind; k++)
+	std::optional<std::pair<const std::vector<ContextualLookupRecord>*, size_t>> matchContextSubtable(
+		const CompiledContextSubtable& subtable, bool chained, zst::span<GlyphId> glyphs, size_t position,
+		const SkippyIterator& iter)
+	{
+		/*
+		    match `count` glyphs after (or before) glyphs[start], where the k-th one must satisfy `matches(k, gid)`.
+		    glyphs that the lookup ignores are skipped over. Returns the index of the last glyph that was matched
+		    (or `start`, if count is 0).
+		*/
+		auto match_forward = [&](size_t start, size_t count, auto&& matches) -> std::optional<size_t> {
+			for(size_t k = 0; k < count; k++)
 			{
-				auto coverage = subtable_start.drop(consume_u16(subtable));
-				if(!getGlyphCoverageIndex(coverage, glyphs[position - k - 1]).has_value())
+				auto next = iter.next(glyphs, start);
+				if(!next.has_value() || !matches(k, glyphs[*next]))
 					return std::nullopt;
+
+				start = *next;
 			}
 
-			consume_u16(subtable); // num_glyphs, which we already read
-			for(size_t k = 0; k < num_glyphs; k++)
+			return start;
+		};
+
+		auto match_backward = [&](size_t start, size_t count, auto&& matches) -> std::optional<size_t> {
+			for(size_t k = 0; k < count; k++)
 			{
-				auto coverage = subtable_start.drop(consume_u16(subtable));
-				if(!getGlyphCoverageIndex(coverage, glyphs[position + k]).has_value())
+				auto prev = iter.prev(glyphs, start);
+				if(!prev.has_value() || !matches(k, glyphs[*prev]))
 					return std::nullopt;
+
+				start = *prev;
 			}
 
-			consume_u16(subtable); // num_lookahead, which we already read
-			for(size_t k = 0; k < num_lookahead; k++)
+			return start;
+		};
+
+		// the first input glyph is at `position`, so returns the number of glyphs spanned by the whole input sequence.
+		auto match_sequences = [&](size_t num_lookbehind, auto&& lookbehind_matches, size_t num_input, auto&& input_matches,
+								   size_t num_lookahead, auto&& lookahead_matches) -> std::optional<size_t> {
+			if(num_input == 0 || !input_matches(0, glyphs[position]))
+				return std::nullopt;
+
+			auto input_end = match_forward(position, num_input - 1, [&](size_t k, GlyphId gid) {
+				return input_matches(k + 1, gid);
+			});
+
+			if(!input_end.has_value())
+				return std::nullopt;
+
+			if(chained)
 			{
-				auto coverage = subtable_start.drop(consume_u16(subtable));
-				if(!getGlyphCoverageIndex(coverage, glyphs[position + num_glyphs + k]).has_value())
+				if(!match_backward(position, num_lookbehind, lookbehind_matches).has_value() ||
+					!match_forward(*input_end, num_lookahead, lookahead_matches).has_value())
 					return std::nullopt;
 			}
 
-			// match success
-			auto num_records = consume_u16(subtable);
-			return std::pair(parse_records(num_records, subtable), num_glyphs);
-		}
-		else
+			return *input_end + 1 - position;
+		};
+
+		if(subtable.format == 3)
 		{
-			assert(format == 1 || format == 2);
-			auto cov_ofs = consume_u16(subtable);
+			auto covered_by = [](const std::vector<std::unordered_set<GlyphId>>& coverages) {
+				return [&coverages](size_t k, GlyphId gid) -> bool {
+					return coverages[k].contains(gid);
+				};
+			};
+
+			auto num_input = match_sequences(subtable.lookbehind_coverage.size(), covered_by(subtable.lookbehind_coverage),
+				subtable.input_coverage.size(), covered_by(subtable.input_coverage), subtable.lookahead_coverage.size(),
+				covered_by(subtable.lookahead_coverage));
 
-			// both formats 1 and 2 uses a coverage table to gate the first glyph. If the first
-			// glyph in our sequence is not covered, skip this subtable.
-			auto cov_idx = off::getGlyphCoverageIndex(subtable_start.drop(cov_ofs), glyphs[position]);
-			if(!cov_idx.has_value())
+			if(!num_input.has_value())
 				return std::nullopt;
 
-			auto try_match_rule = [&glyphs, position](zst::byte_span& rule, auto&& lookbehind_trf, auto&& gid_trf,
-									  auto&& lookahead_trf) -> std::pair<bool, uint16_t> {
-				auto num_lookbehind = consume_u16(rule);
-				auto num_glyphs = peek_u16(rule.drop(num_lookbehind * sizeof(uint16_t)));
-
-				// note: I know the input sequence only has num_glyphs - 1 uint16s, but we also
-				// account for the `num_glyphs` u16 itself, so the -1 and +1 cancel out.
-				auto num_lookahead = peek_u16(rule.drop((num_lookbehind + num_glyphs) * sizeof(uint16_t)));
-
-				// if we don't have enough to backtrack, bail
-				if(position < num_lookbehind)
-					return { false, 0 };
-				else if(position + num_glyphs > glyphs.size())
-					return { false, 0 };
-				else if(position + num_glyphs + num_lookahead >= glyphs.size())
-					return { false, 0 };
-
-				for(size_t k = 0; k < num_lookbehind; k++)
-				{
-					if(static_cast<uint16_t>(lookbehind_trf(glyphs[position - k - 1])) != consume_u16(rule))
-						return { false, 0 };
-				}
-
-				consume_u16(rule); // num_glyphs, which we already read
-				for(size_t k = 1; k < num_glyphs; k++)
-				{
-					if(static_cast<uint16_t>(gid_trf(glyphs[position + k])) != consume_u16(rule))
-						return { false, 0 };
-				}
-
-				consume_u16(rule); // num_lookahead, which we already read
-				for(size_t k = 0; k < num_lookahead; k++)
-				{
-					if(static_cast<uint16_t>(lookahead_trf(glyphs[position + num_glyphs + k])) != consume_u16(rule))
-						return { false, 0 };
-				}
-
-				return { true, num_glyphs };
-			};
+			return std::pair(&subtable.records, *num_input);
+		}
 
+		auto get_class = [](const ClassDef* classes, GlyphId gid) -> uint16_t {
+			return classes == nullptr ? 0 : classes->classOf(gid);
+		};
 
-			// note that this is very similar (structurally) to normal contextual lookups;
-			// see if we can deduplicate this code in the future.
-			if(format == 1)
-			{
-				auto num_rulesets = consume_u16(subtable);
-				assert(*cov_idx < num_rulesets);
+		// format 1 compares glyph ids directly, format 2 compares their classes
+		auto value_of = [&](const ClassDef* classes, GlyphId gid) -> uint16_t {
+			return subtable.format == 1 ? static_cast<uint16_t>(gid) : get_class(classes, gid);
+		};
 
-				subtable.remove_prefix(*cov_idx * sizeof(uint16_t));
-				auto ruleset_ofs = consume_u16(subtable);
+		auto equal_to = [&](const std::vector<uint16_t>& values, const ClassDef* classes) {
+			return [&values, classes, &value_of](size_t k, GlyphId gid) -> bool {
+				return value_of(classes, gid) == values[k];
+			};
+		};
 
-				auto ruleset_table = subtable_start.drop(ruleset_ofs);
-				auto ruleset_table_start = ruleset_table;
+		if(subtable.format == 2 && !subtable.coverage.contains(glyphs[position]))
+			return std::nullopt;
 
-				auto identity_trf = [](GlyphId x) {
-					return x;
-				};
+		auto rule_set = subtable.rule_sets.find(value_of(subtable.input_classes, glyphs[position]));
+		if(rule_set == subtable.rule_sets.end())
+			return std::nullopt;
 
-				auto num_rules = consume_u16(ruleset_table);
-				for(size_t i = 0; i < num_rules; i++)
-				{
-					auto rule = ruleset_table_start.drop(consume_u16(ruleset_table));
-					if(auto [match, num_glyphs] = try_match_rule(rule, identity_trf, identity_trf, identity_trf); match)
-					{
-						auto num_records = consume_u16(rule);
-						return std::pair(parse_records(num_records, rule), num_glyphs);
-					}
-				}
-			}
-			else
-			{
-				auto lookbehind_classdefs = subtable_start.drop(consume_u16(subtable));
-				auto input_classdefs = subtable_start.drop(consume_u16(subtable));
-				auto lookahead_classdefs = subtable_start.drop(consume_u16(subtable));
-
-				auto num_class_sets = consume_u16(subtable);
-
-				auto first_class_id = getGlyphClass(input_classdefs, glyphs[position]);
-				assert(first_class_id < num_class_sets);
-
-				auto classset = subtable_start.drop(peek_u16(subtable.drop(first_class_id * sizeof(uint16_t))));
-				auto classset_start = classset;
-
-				auto num_rules = consume_u16(classset);
-				for(size_t i = 0; i < num_rules; i++)
-				{
-					auto rule = classset_start.drop(consume_u16(classset));
-					auto lookbehind_trf = [&lookbehind_classdefs](GlyphId gid) {
-						return getGlyphClass(lookbehind_classdefs, gid);
-					};
-
-					auto input_trf = [&input_classdefs](GlyphId gid) {
-						return getGlyphClass(input_classdefs, gid);
-					};
-
-					auto lookahead_trf = [&lookahead_classdefs](GlyphId gid) {
-						return getGlyphClass(lookahead_classdefs, gid);
-					};
-
-					if(auto [match, num_glyphs] = try_match_rule(rule, lookbehind_trf, input_trf, lookahead_trf); match)
-					{
-						auto num_records = consume_u16(rule);
-						return std::pair(parse_records(num_records, rule), num_glyphs);
-					}
-				}
-			}
+		for(auto& rule : rule_set->second)
+		{
+			auto num_input = match_sequences(rule.lookbehind.size(), equal_to(rule.lookbehind, subtable.lookbehind_classes),
+				rule.input.size(), equal_to(rule.input, subtable.input_classes), rule.lookahead.size(),
+				equal_to(rule.lookahead, subtable.lookahead_classes));
+
+			if(num_input.has_value())
+				return std::pair(&rule.records, *num_input);
 		}
 
 		return std::nullopt;
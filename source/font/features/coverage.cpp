@@ -2,7 +2,6 @@
 // Copyright (c) 2022, zhiayang
 // SPDX-License-Identifier: Apache-2.0
 
-#include "util.h"
 #include "error.h"
 
 #include "font/font.h"
@@ -18,19 +17,22 @@ namespace font::off
 		if(format == 1)
 		{
 			auto count = consume_u16(cov_table);
+			auto glyphs = consume_u16_array(cov_table, count).decode();
 
 			// the first glyphid in the array has index 0, then 1, and so on.
 			for(size_t i = 0; i < count; i++)
-				coverage_map[i] = GlyphId { consume_u16(cov_table) };
+				coverage_map[i] = GlyphId { glyphs[i] };
 		}
 		else if(format == 2)
 		{
 			auto num_ranges = consume_u16(cov_table);
+			auto ranges = consume_u16_array(cov_table, 3 * (size_t) num_ranges).decode();
+
 			for(size_t i = 0; i < num_ranges; i++)
 			{
-				auto first = consume_u16(cov_table);
-				auto last = consume_u16(cov_table);
-				auto start_cov = consume_u16(cov_table);
+				auto first = ranges[3 * i + 0];
+				auto last = ranges[3 * i + 1];
+				auto start_cov = ranges[3 * i + 2];
 
 				for(auto i = first; i < last + 1; i++)
 					coverage_map[start_cov + (i - first)] = GlyphId { i };
@@ -52,7 +54,7 @@ namespace font::off
 		if(format == 1)
 		{
 			auto count = consume_u16(cov_table);
-			auto array = cov_table.cast<uint16_t>();
+			auto array = consume_u16_array(cov_table, count);
 
 			// binary search
 			size_t low = 0;
@@ -61,7 +63,7 @@ namespace font::off
 			while(low < high)
 			{
 				auto mid = (low + high) / 2u;
-				auto val = util::convertBEU16(array[mid]);
+				auto val = array[mid];
 
 				if(val == gid16)
 					return static_cast<int32_t>(mid);
@@ -75,16 +77,9 @@ namespace font::off
 		}
 		else if(format == 2)
 		{
-			struct RangeRecord
-			{
-				uint16_t start;
-				uint16_t end;
-				uint16_t cov_idx;
-			} __attribute__((packed));
-			static_assert(sizeof(RangeRecord) == 3 * sizeof(uint16_t));
-
+			// each RangeRecord is (startGlyphID, endGlyphID, startCoverageIndex)
 			auto count = consume_u16(cov_table);
-			auto array = cov_table.take(count * sizeof(RangeRecord)).cast<RangeRecord>();
+			auto array = consume_u16_array(cov_table, 3 * (size_t) count);
 
 			// binary search the RangeRecords
 			size_t low = 0;
@@ -92,13 +87,12 @@ namespace font::off
 			while(low < high)
 			{
 				auto mid = (low + high) / 2u;
-				auto val = array[mid];
 
-				auto start = util::convertBEU16(val.start);
-				auto end = util::convertBEU16(val.end);
+				auto start = array[3 * mid + 0];
+				auto end = array[3 * mid + 1];
 
 				if(start <= gid16 && gid16 <= end)
-					return static_cast<int32_t>(util::convertBEU16(val.cov_idx) + gid16 - start);
+					return static_cast<int32_t>(array[3 * mid + 2] + gid16 - start);
 				else if(end < gid16)
 					low = mid + 1;
 				else
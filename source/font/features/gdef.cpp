@@ -3,8 +3,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <cassert>
+#include <algorithm>
 
-#include "util.h"
 #include "error.h"
 #include "font/font.h"
 #include "font/features.h"
@@ -28,35 +28,27 @@ namespace font::off
 			if(gid16 < start_gid || gid16 >= start_gid + num_glyphs)
 				return 0;
 
-			auto array = table.cast<uint16_t>();
-			return util::convertBEU16(array[gid16 - start_gid]);
+			auto array = consume_u16_array(table, num_glyphs);
+			return array[gid16 - start_gid];
 		}
 		else if(format == 2)
 		{
 			auto num_ranges = consume_u16(table);
 
-			struct ClassRangeRecord
-			{
-				uint16_t start_gid;
-				uint16_t end_gid;
-				uint16_t glyph_class;
-			} __attribute__((packed));
-			static_assert(sizeof(ClassRangeRecord) == 3 * sizeof(uint16_t));
-
-			auto array = table.take(num_ranges * sizeof(ClassRangeRecord)).cast<ClassRangeRecord>();
+			// each ClassRangeRecord is (startGlyphID, endGlyphID, class)
+			auto array = consume_u16_array(table, 3 * (size_t) num_ranges);
 
 			size_t low = 0;
 			size_t high = num_ranges;
 			while(low < high)
 			{
 				auto mid = (low + high) / 2u;
-				auto rec = array[mid];
 
-				auto start_gid = util::convertBEU16(rec.start_gid);
-				auto end_gid = util::convertBEU16(rec.end_gid);
+				auto start_gid = array[3 * mid + 0];
+				auto end_gid = array[3 * mid + 1];
 
 				if(start_gid <= gid16 && gid16 <= end_gid)
-					return util::convertBEU16(rec.glyph_class);
+					return array[3 * mid + 2];
 				else if(end_gid < gid16)
 					low = mid + 1;
 				else
@@ -83,19 +75,21 @@ namespace font::off
 		{
 			auto start_gid = consume_u16(table);
 			auto num_glyphs = consume_u16(table);
+			auto classes = consume_u16_array(table, num_glyphs).decode();
 
 			for(uint32_t i = 0; i < num_glyphs; i++)
-				callback(consume_u16(table), GlyphId { start_gid + i });
+				callback(classes[i], GlyphId { start_gid + i });
 		}
 		else
 		{
 			auto num_ranges = consume_u16(table);
+			auto ranges = consume_u16_array(table, 3 * (size_t) num_ranges).decode();
 
 			for(size_t i = 0; i < num_ranges; i++)
 			{
-				auto first_gid = consume_u16(table);
-				auto last_gid = consume_u16(table);
-				auto class_id = consume_u16(table);
+				auto first_gid = ranges[3 * i + 0];
+				auto last_gid = ranges[3 * i + 1];
+				auto class_id = ranges[3 * i + 2];
 
 				for(auto g = first_gid; g <= last_gid; g++)
 					callback(class_id, GlyphId { g });
@@ -123,4 +117,194 @@ namespace font::off
 
 		return class_ids;
 	}
+
+
+	ClassDef decodeClassDef(zst::byte_span table)
+	{
+		auto format = consume_u16(table);
+
+		if(format != 1 && format != 2)
+			sap::internal_error("invalid ClassDef format {}", format);
+
+		ClassDef ret {};
+		if(format == 1)
+		{
+			ret.first_glyph = consume_u16(table);
+			ret.classes = consume_u16_array(table, consume_u16(table)).decode();
+			return ret;
+		}
+
+		auto num_ranges = consume_u16(table);
+		auto ranges = consume_u16_array(table, 3 * (size_t) num_ranges).decode();
+		if(num_ranges == 0)
+			return ret;
+
+		// the ranges should be sorted, but don't rely on it.
+		uint16_t first_gid = UINT16_MAX;
+		uint16_t last_gid = 0;
+		for(size_t i = 0; i < num_ranges; i++)
+		{
+			first_gid = std::min(first_gid, ranges[3 * i + 0]);
+			last_gid = std::max(last_gid, ranges[3 * i + 1]);
+		}
+
+		if(first_gid > last_gid)
+			return ret;
+
+		ret.first_glyph = first_gid;
+		ret.classes.resize(static_cast<size_t>(last_gid - first_gid) + 1, 0);
+
+		for(size_t i = 0; i < num_ranges; i++)
+		{
+			for(size_t g = ranges[3 * i + 0]; g <= ranges[3 * i + 1]; g++)
+				ret.classes[g - first_gid] = ranges[3 * i + 2];
+		}
+
+		return ret;
+	}
+
+	const ClassDef& ClassDefCache::decode(zst::byte_span classdef_table)
+	{
+		assert(this->table_start != nullptr && classdef_table.data() >= this->table_start);
+
+		auto offset = static_cast<size_t>(classdef_table.data() - this->table_start);
+		if(auto it = this->tables.find(offset); it != this->tables.end())
+			return it->second;
+
+		return this->tables.emplace(offset, decodeClassDef(classdef_table)).first->second;
+	}
+
+	const ClassDef* ClassDefCache::find(zst::byte_span classdef_table) const
+	{
+		if(this->table_start == nullptr || classdef_table.data() < this->table_start)
+			return nullptr;
+
+		auto offset = static_cast<size_t>(classdef_table.data() - this->table_start);
+		if(auto it = this->tables.find(offset); it != this->tables.end())
+			return &it->second;
+
+		return nullptr;
+	}
+
+
+
+	SkippyIterator::SkippyIterator(const GDefTable& gdef, const LookupTable& lookup)
+	{
+		m_gdef = &gdef;
+		m_flags = lookup.flags;
+		m_mark_set = nullptr;
+
+		if(m_flags & LOOKUP_FLAG_USE_MARK_FILTERING_SET)
+		{
+			// a set that doesn't exist has no glyphs in it, so all the marks are skipped.
+			static const std::vector<bool> empty_set {};
+
+			auto set = lookup.mark_filtering_set;
+			m_mark_set = (set < gdef.mark_glyph_sets.size()) ? &gdef.mark_glyph_sets[set] : &empty_set;
+		}
+
+		constexpr uint16_t skipping_flags = LOOKUP_FLAG_IGNORE_BASE_GLYPHS | LOOKUP_FLAG_IGNORE_LIGATURES |
+		                                    LOOKUP_FLAG_IGNORE_MARKS | LOOKUP_FLAG_USE_MARK_FILTERING_SET |
+		                                    LOOKUP_FLAG_MARK_ATTACHMENT_TYPE;
+
+		// without glyph classes, nothing can be skipped; most lookups also don't ignore anything.
+		m_active = !gdef.glyph_props.empty() && (m_flags & skipping_flags) != 0;
+	}
+
+	std::optional<size_t> SkippyIterator::next(zst::span<GlyphId> glyphs, size_t i) const
+	{
+		for(size_t k = i + 1; k < glyphs.size(); k++)
+		{
+			if(!this->skip(glyphs[k]))
+				return k;
+		}
+
+		return std::nullopt;
+	}
+
+	std::optional<size_t> SkippyIterator::prev(zst::span<GlyphId> glyphs, size_t i) const
+	{
+		for(size_t k = i; k > 0; k--)
+		{
+			if(!this->skip(glyphs[k - 1]))
+				return k - 1;
+		}
+
+		return std::nullopt;
+	}
+
+
+	void parseGDef(FontFile* font, const Table& table)
+	{
+		auto buf = zst::byte_span(font->file_bytes, font->file_size);
+		buf.remove_prefix(table.offset);
+
+		auto table_start = buf;
+
+		auto major = consume_u16(buf);
+		auto minor = consume_u16(buf);
+
+		if(major != 1)
+		{
+			sap::warn("font/off", "unsupported GDEF table version {}.{}, ignoring", major, minor);
+			return;
+		}
+
+		auto glyph_class_ofs = consume_u16(buf);
+		consume_u16(buf); // AttachList
+		consume_u16(buf); // LigCaretList
+		auto mark_attach_class_ofs = consume_u16(buf);
+
+		auto& gdef = font->gdef_table;
+
+		// the glyph classes (1: base, 2: ligature, 3: mark, 4: component) become the GLYPH_* bits.
+		if(glyph_class_ofs != 0)
+		{
+			constexpr uint16_t class_props[] = { 0, GDefTable::GLYPH_BASE, GDefTable::GLYPH_LIGATURE, GDefTable::GLYPH_MARK,
+				GDefTable::GLYPH_COMPONENT };
+
+			gdef.glyph_props.resize(font->num_glyphs, 0);
+			parse_classdef_table(table_start.drop(glyph_class_ofs), [&](int cls, GlyphId gid) {
+				if(static_cast<size_t>(gid) < gdef.glyph_props.size() && 0 <= cls && cls <= 4)
+					gdef.glyph_props[static_cast<size_t>(gid)] = class_props[cls];
+			});
+		}
+
+		// the mark attachment class is only meaningful for marks, so only keep it for them.
+		if(mark_attach_class_ofs != 0 && !gdef.glyph_props.empty())
+		{
+			parse_classdef_table(table_start.drop(mark_attach_class_ofs), [&](int cls, GlyphId gid) {
+				auto idx = static_cast<size_t>(gid);
+				if(idx < gdef.glyph_props.size() && (gdef.glyph_props[idx] & GDefTable::GLYPH_MARK) && 0 < cls && cls < 256)
+					gdef.glyph_props[idx] |= static_cast<uint16_t>(cls << 8);
+			});
+		}
+
+		// version 1.2 added the mark glyph sets, which are a list of coverage tables.
+		if(minor >= 2)
+		{
+			if(auto sets_ofs = consume_u16(buf); sets_ofs != 0)
+			{
+				auto sets = table_start.drop(sets_ofs);
+				auto sets_start = sets;
+
+				if(auto format = consume_u16(sets); format != 1)
+				{
+					sap::warn("font/off", "unknown MarkGlyphSets format '{}' in GDEF", format);
+					return;
+				}
+
+				auto num_sets = consume_u16(sets);
+				for(size_t i = 0; i < num_sets; i++)
+				{
+					auto& set = gdef.mark_glyph_sets.emplace_back(font->num_glyphs, false);
+					for(auto& [cov_idx, gid] : parseCoverageTable(sets_start.drop(consume_u32(sets))))
+					{
+						if(static_cast<size_t>(gid) < set.size())
+							set[static_cast<size_t>(gid)] = true;
+					}
+				}
+			}
+		}
+	}
 }
@@ -0,0 +1,87 @@
+// glyph_buffer.cpp
+// Copyright (c) 2022, zhiayang
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cassert>
+
+#include "font/features.h"
+
+namespace font
+{
+	void GlyphBuffer::reset(zst::span<GlyphId> input_glyphs)
+	{
+		// assigning (instead of reallocating) keeps the capacity of the arrays.
+		this->input.assign(input_glyphs.begin(), input_glyphs.end());
+		this->glyphs.assign(input_glyphs.begin(), input_glyphs.end());
+
+		this->clusters.resize(input_glyphs.size());
+		for(size_t i = 0; i < input_glyphs.size(); i++)
+			this->clusters[i] = static_cast<uint32_t>(i);
+
+		this->props.assign(input_glyphs.size(), 0);
+		this->adjustments.assign(input_glyphs.size(), GlyphAdjustment {});
+	}
+
+	void GlyphBuffer::replace(size_t start, size_t count, zst::span<GlyphId> replacement, uint8_t new_props)
+	{
+		assert(count > 0 && replacement.size() > 0);
+		assert(start + count <= this->glyphs.size());
+
+		this->mergeClusters(start, start + count);
+
+		auto cluster = this->clusters[start];
+		auto glyph_props = static_cast<uint8_t>(this->props[start] | new_props);
+
+		// make the arrays the right size first, then overwrite the glyphs in the replaced range.
+		auto grow = [&](auto& array, auto value) {
+			if(replacement.size() > count)
+				array.insert(array.begin() + start + count, replacement.size() - count, value);
+			else if(replacement.size() < count)
+				array.erase(array.begin() + start + replacement.size(), array.begin() + start + count);
+		};
+
+		grow(this->glyphs, GlyphId::notdef);
+		grow(this->clusters, cluster);
+		grow(this->props, glyph_props);
+		grow(this->adjustments, GlyphAdjustment {});
+
+		for(size_t i = 0; i < replacement.size(); i++)
+		{
+			this->glyphs[start + i] = replacement[i];
+			this->props[start + i] = glyph_props;
+		}
+	}
+
+	void GlyphBuffer::remove(size_t i)
+	{
+		assert(i < this->glyphs.size());
+
+		this->glyphs.erase(this->glyphs.begin() + i);
+		this->clusters.erase(this->clusters.begin() + i);
+		this->props.erase(this->props.begin() + i);
+		this->adjustments.erase(this->adjustments.begin() + i);
+	}
+
+	void GlyphBuffer::mergeClusters(size_t start, size_t end)
+	{
+		assert(start < end && end <= this->clusters.size());
+
+		auto first_cluster = this->clusters[start];
+		auto last_cluster = this->clusters[end - 1];
+
+		// if the last glyph shared its cluster with the glyphs after it, those need to be merged too.
+		for(size_t i = start; i < this->clusters.size() && (i < end || this->clusters[i] == last_cluster); i++)
+			this->clusters[i] = first_cluster;
+	}
+
+	std::pair<size_t, size_t> GlyphBuffer::inputRange(size_t i) const
+	{
+		assert(i < this->clusters.size());
+
+		size_t k = i + 1;
+		while(k < this->clusters.size() && this->clusters[k] == this->clusters[i])
+			k++;
+
+		return { this->clusters[i], k < this->clusters.size() ? this->clusters[k] : this->input.size() };
+	}
+}
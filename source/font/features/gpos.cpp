@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <cassert>
+#include <algorithm>
 
 #include "util.h"
 #include "error.h"
@@ -21,24 +22,22 @@ namespace font::off::gpos
 	}
 
 	/*
-	    Perform a lookup in the provided table for any adjustments to glyphs in the provided sequence.
-	    Returns a mapping from sequence index to the adjustment for the glyph at that index.
+	    Apply the lookup to the glyphs in the buffer, starting from buffer.glyphs[position]; glyphs at prior
+	    indices (ie. < position) are used as lookbehind for chained contextual lookups, if necessary. The
+	    adjustments are added to the ones already in the buffer.
 
-	    Since this is a general lookup, it takes the entire glyphstring as well as a current position;
-	    glyphs at prior indices (ie. < position) are used as lookbehind for chained contextual lookups,
-	    if necessary.
-
-	    Lookups will be searched for glyphs starting from glyphs[position], and *not* at glyph[0].
-
-	    In the returned mapping,
-	        adjustments[0] adjusts glyphs[position],
-	        adjustments[1] adjusts glyphs[position + 1],
-
-	    and so on. it does *not* apply to glyphs[0], glyphs[1], etc., unless position == 0.
+	    Nested lookups (from contextual positioning) only apply to the glyph at `position`, and not the
+	    rest of the glyphstring; that's what `only_at_position` is for.
 	*/
-	std::map<size_t, GlyphAdjustment> lookupForGlyphSequence(const GPosTable& gpos_table, const LookupTable& lookup,
-		zst::span<GlyphId> glyphs, size_t position)
+	static void apply_lookup(const GPosTable& gpos_table, const GDefTable& gdef, size_t lookup_idx, GlyphBuffer& buffer,
+		size_t position, bool only_at_position = false)
 	{
+		assert(lookup_idx < gpos_table.lookups.size());
+		auto& lookup = gpos_table.lookups[lookup_idx];
+		auto& compiled_lookup = gpos_table.compiled_lookups[lookup_idx];
+
+		auto iter = SkippyIterator(gdef, lookup);
+
 		/*
 		    OFF 1.9, page 217 (part 2)
 
@@ -57,56 +56,87 @@ namespace font::off::gpos
 		    the number of glyphs in the input sequence, so I assume that they all get skipped.
 		*/
 
-		std::map<size_t, GlyphAdjustment> adjustments {};
-		for(size_t i = position; i < glyphs.size(); i++)
+		auto& glyphs = buffer.glyphs;
+		auto& adjustments = buffer.adjustments;
+		auto span = zst::span<GlyphId>(glyphs.data(), glyphs.size());
+
+		for(size_t i = position; i < glyphs.size() && (!only_at_position || i == position);)
 		{
 			// this should have been eliminated during initial parsing already
 			assert(lookup.type != gpos::LOOKUP_EXTENSION_POS);
 
+			// skip glyphs that this lookup can't possibly start at, or that it ignores
+			if(!lookup.digest.mayHave(glyphs[i]) || iter.skip(glyphs[i]))
+			{
+				i++;
+				continue;
+			}
+
 			if(lookup.type == gpos::LOOKUP_SINGLE)
 			{
 				if(auto adj = gpos::lookupSingleAdjustment(lookup, glyphs[i]); adj.has_value())
-					combine_adjustments(adjustments[i - position], *adj);
+					combine_adjustments(adjustments[i], *adj);
+
+				i += 1;
 			}
-			else if((lookup.type == gpos::LOOKUP_PAIR) && (i + 1 < glyphs.size()))
+			else if(lookup.type == gpos::LOOKUP_PAIR)
 			{
-				auto [a1, a2] = gpos::lookupPairAdjustment(lookup, glyphs[i], glyphs[i + 1]);
+				// the second glyph of the pair is the next one that isn't skipped (eg. kerning across marks)
+				auto second = iter.next(span, i);
+				if(!second.has_value())
+					break;
+
+				auto [a1, a2] = gpos::lookupPairAdjustment(compiled_lookup, glyphs[i], glyphs[*second]);
 				if(a1.has_value())
-					combine_adjustments(adjustments[i - position], *a1);
+					combine_adjustments(adjustments[i], *a1);
 
+				// if the second adjustment was not null, then we skip the second glyph
 				if(a2.has_value())
 				{
-					// if the second adjustment was not null, then we skip the second glyph
-					combine_adjustments(adjustments[i - position + 1], *a2);
-					i += 1;
+					combine_adjustments(adjustments[*second], *a2);
+					i = *second;
 				}
+
+				i += 1;
 			}
 			else if(lookup.type == gpos::LOOKUP_CONTEXTUAL || lookup.type == gpos::LOOKUP_CHAINING_CONTEXT)
 			{
 				// this one requires both lookahead and lookbehind
-				std::optional<gpos::AdjustmentResult> result {};
+				auto chained = (lookup.type == gpos::LOOKUP_CHAINING_CONTEXT);
 
-				if(lookup.type == gpos::LOOKUP_CONTEXTUAL)
-					result = lookupContextualPositioning(gpos_table, lookup, glyphs.drop(i));
-				else
-					result = lookupChainedContextPositioning(gpos_table, lookup, glyphs, /* pos: */ i);
+				std::optional<std::pair<const std::vector<ContextualLookupRecord>*, size_t>> match {};
+				for(auto& subtable : compiled_lookup.contexts)
+				{
+					if(match = matchContextSubtable(subtable, chained, span, /* pos: */ i, iter); match.has_value())
+						break;
+				}
+
+				if(!match.has_value())
+				{
+					i += 1;
+					continue;
+				}
 
-				if(result.has_value())
+				// as for GSUB, the records index the glyphs of the input sequence, without the skipped glyphs.
+				auto input_end = i + match->second;
+				for(auto [glyph_idx, nested_idx] : *match->first)
 				{
-					// same deal with offsets and jumping as normal contextual lookups
-					for(auto& [idx, adj] : result->adjustments)
-						combine_adjustments(adjustments[i + idx - position], adj);
+					auto pos = std::optional<size_t>(i);
+					for(size_t k = 0; k < glyph_idx && pos.has_value(); k++)
+						pos = iter.next(span.take(input_end), *pos);
 
-					// i already gets incremented by 1 by the loop
-					i += result->input_consumed - 1;
+					if(pos.has_value())
+						apply_lookup(gpos_table, gdef, nested_idx, buffer, /* pos: */ *pos, /* only_at_position: */ true);
 				}
 
-				// if(new_adjs.size() > 0)
-				// 	i += new_adjs.rbegin()->first;
+				// same deal with jumping as contextual substitutions
+				i = input_end;
+			}
+			else
+			{
+				i += 1;
 			}
 		}
-
-		return adjustments;
 	}
 
 
@@ -198,165 +228,170 @@ namespace font::off::gpos
 		return std::nullopt;
 	}
 
-	std::pair<OptionalGA, OptionalGA> lookupPairAdjustment(const LookupTable& lookup, GlyphId gid1, GlyphId gid2)
+	std::pair<OptionalGA, OptionalGA> lookupPairAdjustment(const CompiledPosLookup& lookup, GlyphId gid1, GlyphId gid2)
 	{
-		assert(lookup.type == LOOKUP_PAIR);
-		for(auto subtable : lookup.subtables)
+		auto g1 = static_cast<uint32_t>(gid1);
+		auto g2 = static_cast<uint32_t>(gid2);
+
+		for(auto& subtable : lookup.pair_subtables)
 		{
-			auto subtable_start = subtable;
+			const std::pair<GlyphAdjustment, GlyphAdjustment>* adjustments = nullptr;
+			if(subtable.format == 1)
+			{
+				// if the pair is not in this subtable (even if the first glyph is covered), try the next one.
+				if(auto it = subtable.pairs.find((g1 << 16) | g2); it != subtable.pairs.end())
+					adjustments = &it->second;
+			}
+			else
+			{
+				auto cls1 = g1 < subtable.first_classes.size() ? subtable.first_classes[g1] : CompiledPairSubtable::NO_CLASS;
+				auto cls2 = g2 < subtable.second_classes.size() ? subtable.second_classes[g2] : uint16_t(0);
 
-			auto format = consume_u16(subtable);
-			auto cov_ofs = consume_u16(subtable);
-			auto value_fmt1 = consume_u16(subtable);
-			auto value_fmt2 = consume_u16(subtable);
+				if(cls1 != CompiledPairSubtable::NO_CLASS && cls2 != CompiledPairSubtable::NO_CLASS)
+					adjustments = &subtable.class_adjustments[cls1 * subtable.num_second_classes + cls2];
+			}
 
-			if(format != 1 && format != 2)
-			{
-				sap::warn("font/gpos", "unknown subtable format '{}' in GPOS/Pair", format);
+			if(adjustments == nullptr)
 				continue;
-			}
 
-			// the coverage table only lists the first glyph id.
-			if(auto cov_idx = off::getGlyphCoverageIndex(subtable_start.drop(cov_ofs), gid1); cov_idx.has_value())
-			{
-				if(format == 1)
-				{
-					auto num_pair_sets = consume_u16(subtable);
-					assert(*cov_idx < num_pair_sets);
-
-					const auto PairRecordSize =
-						sizeof(uint16_t) + get_value_record_size(value_fmt1) + get_value_record_size(value_fmt2);
-
-					auto pairset_offset = peek_u16(subtable.drop(*cov_idx * sizeof(uint16_t)));
-					auto pairset_table = subtable_start.drop(pairset_offset);
-
-					auto num_pairs = consume_u16(pairset_table);
-
-					// now, binary search the second set.
-					size_t low = 0;
-					size_t high = num_pairs;
-
-					while(low < high)
-					{
-						auto mid = (low + high) / 2u;
-						auto glyph = GlyphId { peek_u16(pairset_table.drop(mid * PairRecordSize)) };
-
-						if(glyph == gid2)
-						{
-							// we need to drop the glyph id itself to get to the actual data
-							auto tmp = pairset_table.drop(mid * PairRecordSize).drop(sizeof(uint16_t));
-
-							auto a1 = parse_value_record(tmp, value_fmt1);
-							auto a2 = parse_value_record(tmp, value_fmt2);
-
-							return std::make_pair(a1, a2);
-						}
-						else if(glyph < gid2)
-						{
-							low = mid + 1;
-						}
-						else
-						{
-							high = mid;
-						}
-					}
-				}
-				else
-				{
-					auto cls_ofs1 = consume_u16(subtable);
-					auto cls_ofs2 = consume_u16(subtable);
+			auto a1 = subtable.has_first_adjustment ? OptionalGA(adjustments->first) : std::nullopt;
+			auto a2 = subtable.has_second_adjustment ? OptionalGA(adjustments->second) : std::nullopt;
+			return { a1, a2 };
+		}
 
-					auto num_cls1 = consume_u16(subtable);
-					auto num_cls2 = consume_u16(subtable);
+		return { std::nullopt, std::nullopt };
+	}
 
-					auto g1_class = off::getGlyphClass(subtable_start.drop(cls_ofs1), gid1);
-					auto g2_class = off::getGlyphClass(subtable_start.drop(cls_ofs2), gid2);
+	static std::optional<CompiledPairSubtable> compile_pair_subtable(ClassDefCache& classdefs, zst::byte_span subtable)
+	{
+		auto subtable_start = subtable;
 
-					// note that num_cls1/2 include class 0
-					if(g1_class < num_cls1 && g2_class < num_cls2)
-					{
-						const auto RecordSize = get_value_record_size(value_fmt1) + get_value_record_size(value_fmt2);
+		auto format = consume_u16(subtable);
+		auto cov_ofs = consume_u16(subtable);
+		auto value_fmt1 = consume_u16(subtable);
+		auto value_fmt2 = consume_u16(subtable);
 
-						// skip all the way to the correct Class2Record
-						auto cls2_start = subtable.drop(g1_class * num_cls2 * RecordSize);
-						auto pair_start = cls2_start.drop(g2_class * RecordSize);
+		if(format != 1 && format != 2)
+		{
+			sap::warn("font/gpos", "unknown subtable format '{}' in GPOS/Pair", format);
+			return std::nullopt;
+		}
+
+		CompiledPairSubtable ret {};
+		ret.format = format;
+		ret.has_first_adjustment = (value_fmt1 != 0);
+		ret.has_second_adjustment = (value_fmt2 != 0);
 
-						auto a1 = parse_value_record(pair_start, value_fmt1);
-						auto a2 = parse_value_record(pair_start, value_fmt2);
+		auto read_adjustments = [&](zst::byte_span& buf) {
+			auto a1 = parse_value_record(buf, value_fmt1);
+			auto a2 = parse_value_record(buf, value_fmt2);
+			return std::pair(a1.value_or(GlyphAdjustment {}), a2.value_or(GlyphAdjustment {}));
+		};
 
-						return std::make_pair(a1, a2);
-					}
+		// the coverage table only lists the first glyph id.
+		auto coverage = off::parseCoverageTable(subtable_start.drop(cov_ofs));
+
+		if(format == 1)
+		{
+			auto num_pair_sets = consume_u16(subtable);
+			auto pair_set_offsets = consume_u16_array(subtable, num_pair_sets).decode();
+
+			for(auto& [cov_idx, gid1] : coverage)
+			{
+				if(static_cast<size_t>(cov_idx) >= num_pair_sets)
+					continue;
+
+				auto pair_set = subtable_start.drop(pair_set_offsets[cov_idx]);
+				auto num_pairs = consume_u16(pair_set);
+
+				for(size_t i = 0; i < num_pairs; i++)
+				{
+					auto gid2 = consume_u16(pair_set);
+					auto key = (static_cast<uint32_t>(gid1) << 16) | gid2;
+
+					ret.pairs.emplace(key, read_adjustments(pair_set));
 				}
 			}
 		}
+		else
+		{
+			auto cls_ofs1 = consume_u16(subtable);
+			auto cls_ofs2 = consume_u16(subtable);
 
-		return { std::nullopt, std::nullopt };
-	}
+			// note that num_cls1/2 include class 0
+			auto num_cls1 = consume_u16(subtable);
+			auto num_cls2 = consume_u16(subtable);
 
+			if(num_cls1 == 0 || num_cls2 == 0)
+				return std::nullopt;
 
+			auto& classes1 = classdefs.decode(subtable_start.drop(cls_ofs1));
+			auto& classes2 = classdefs.decode(subtable_start.drop(cls_ofs2));
 
+			// the first glyph must be covered, and is class 0 if the classdef doesn't mention it
+			if(!coverage.empty())
+			{
+				auto max_gid = std::max_element(coverage.begin(), coverage.end(), [](auto& a, auto& b) {
+					return a.second < b.second;
+				})->second;
 
+				ret.first_classes.resize(static_cast<size_t>(max_gid) + 1, CompiledPairSubtable::NO_CLASS);
+				for(auto& [cov_idx, gid] : coverage)
+				{
+					if(auto cls = classes1.classOf(gid); cls < num_cls1)
+						ret.first_classes[static_cast<size_t>(gid)] = cls;
+				}
+			}
 
+			ret.second_classes.resize(classes2.first_glyph + classes2.classes.size(), 0);
+			for(size_t i = 0; i < classes2.classes.size(); i++)
+			{
+				auto cls = classes2.classes[i];
+				ret.second_classes[classes2.first_glyph + i] = (cls < num_cls2) ? cls : CompiledPairSubtable::NO_CLASS;
+			}
 
-	using PosLookupRecord = ContextualLookupRecord;
-	static std::optional<AdjustmentResult> apply_lookup_records(const GPosTable& gpos,
-		const std::pair<std::vector<PosLookupRecord>, size_t>& records, zst::span<GlyphId> glyphs, size_t position)
-	{
-		// ok, we matched this one.
-		std::map<size_t, GlyphAdjustment> adjustments {};
-		for(auto [glyph_idx, lookup_idx] : records.first)
-		{
-			assert(lookup_idx < gpos.lookups.size());
-			auto& nested_lookup = gpos.lookups[lookup_idx];
+			ret.num_second_classes = num_cls2;
+			ret.class_adjustments.reserve(static_cast<size_t>(num_cls1) * num_cls2);
 
-			auto new_adjs = lookupForGlyphSequence(gpos, nested_lookup, glyphs, /* pos: */ position + glyph_idx);
-			for(auto& [idx, adj] : new_adjs)
-				combine_adjustments(adjustments[idx], adj);
+			for(size_t i = 0; i < static_cast<size_t>(num_cls1) * num_cls2; i++)
+				ret.class_adjustments.push_back(read_adjustments(subtable));
 		}
 
-		AdjustmentResult result {};
-		result.adjustments = std::move(adjustments);
-		result.input_consumed = records.second;
-
-		return result;
+		return ret;
 	}
 
-	std::optional<AdjustmentResult> lookupContextualPositioning(const GPosTable& gpos, const LookupTable& lookup,
-		zst::span<GlyphId> glyphs)
+	CompiledPosLookup compileLookup(ClassDefCache& classdefs, const LookupTable& lookup)
 	{
-		assert(lookup.type == LOOKUP_CONTEXTUAL);
-		for(auto subtable : lookup.subtables)
+		CompiledPosLookup compiled {};
+		if(lookup.type == LOOKUP_CONTEXTUAL || lookup.type == LOOKUP_CHAINING_CONTEXT)
 		{
-			if(auto records = performContextualLookup(subtable, glyphs); records.has_value())
-				return apply_lookup_records(gpos, *records, glyphs, /* pos: */ 0);
+			for(auto subtable : lookup.subtables)
+			{
+				auto chained = (lookup.type == LOOKUP_CHAINING_CONTEXT);
+				if(auto ctx = compileContextSubtable(classdefs, subtable, chained); ctx.has_value())
+					compiled.contexts.push_back(std::move(*ctx));
+			}
 		}
 
-		return std::nullopt;
-	}
-
-	std::optional<AdjustmentResult> lookupChainedContextPositioning(const GPosTable& gpos, const LookupTable& lookup,
-		zst::span<GlyphId> glyphs, size_t position)
-	{
-		assert(position < glyphs.size());
-		assert(lookup.type == LOOKUP_CHAINING_CONTEXT);
+		if(lookup.type != LOOKUP_PAIR)
+			return compiled;
 
 		for(auto subtable : lookup.subtables)
 		{
-			if(auto records = performChainedContextLookup(subtable, glyphs, position); records.has_value())
-				return apply_lookup_records(gpos, *records, glyphs, /* pos: */ position);
+			if(auto pair = compile_pair_subtable(classdefs, subtable); pair.has_value())
+				compiled.pair_subtables.push_back(std::move(*pair));
 		}
 
-		return std::nullopt;
+		return compiled;
 	}
 }
 
 
 namespace font::off
 {
-	std::map<size_t, GlyphAdjustment> getPositioningAdjustmentsForGlyphSequence(FontFile* font, zst::span<GlyphId> glyphs,
-		const FeatureSet& features)
+	void performPositioningForGlyphSequence(FontFile* font, GlyphBuffer& buffer, const ShapePlan& plan)
 	{
-		auto gpos = font->gpos_table;
+		auto& gpos = font->gpos_table;
 
 		/*
 		    OFF 1.9, page 217
@@ -369,20 +404,19 @@ namespace font::off
 		    TL;DR: for(lookups) { for(glyphs) { ... } }, and *NOT* the transposed.
 		*/
 
-		std::map<size_t, GlyphAdjustment> adjustments {};
-		auto lookups = getLookupTablesForFeatures(font->gpos_table, features);
+		// positioning doesn't change the glyphs, so the digest of the run only needs to be computed once.
+		GlyphSetDigest run_digest {};
+		for(auto g : buffer.glyphs)
+			run_digest.add(g);
 
-		for(auto& lookup_idx : lookups)
+		for(auto& lookup_idx : plan.gpos_lookups)
 		{
 			assert(lookup_idx < gpos.lookups.size());
-			auto& lookup = gpos.lookups[lookup_idx];
+			if(!gpos.lookups[lookup_idx].digest.mayIntersect(run_digest))
+				continue;
 
 			// in this case, we want to lookup the entire sequence, so start at position 0.
-			auto new_adjs = gpos::lookupForGlyphSequence(gpos, lookup, glyphs, /* position: */ 0);
-			for(auto& [idx, adj] : new_adjs)
-				gpos::combine_adjustments(adjustments[idx], adj);
+			gpos::apply_lookup(gpos, font->gdef_table, lookup_idx, buffer, /* position: */ 0);
 		}
-
-		return adjustments;
 	}
 }
@@ -0,0 +1,214 @@
+// gsub_compile.cpp
+// Copyright (c) 2022, zhiayang
+// SPDX-License-Identifier: Apache-2.0
+
+#include "error.h"
+
+#include "font/font.h"
+#include "font/features.h"
+
+namespace font::off::gsub
+{
+	static std::vector<uint16_t> consume_values(zst::byte_span& buf, size_t count)
+	{
+		return consume_u16_array(buf, count).decode();
+	}
+
+	static void compile_ligatures(CompiledSubstLookup& compiled, const LookupTable& lookup)
+	{
+		// ligatures are numbered in the order that they would be tried, across all subtables.
+		uint32_t priority = 0;
+
+		auto& nodes = compiled.ligature_nodes;
+		auto find_or_add_child = [&nodes](uint32_t node, GlyphId gid) -> uint32_t {
+			for(auto& [child_gid, child] : nodes[node].children)
+			{
+				if(child_gid == gid)
+					return child;
+			}
+
+			auto child = static_cast<uint32_t>(nodes.size());
+			nodes.emplace_back();
+			nodes[node].children.emplace_back(gid, child);
+
+			return child;
+		};
+
+		for(auto subtable : lookup.subtables)
+		{
+			auto subtable_start = subtable;
+			auto format = consume_u16(subtable);
+
+			if(format != 1)
+			{
+				sap::warn("font/gsub", "unknown subtable format '{}' in GSUB/Ligature", format);
+				continue;
+			}
+
+			auto coverage = parseCoverageTable(subtable_start.drop(consume_u16(subtable)));
+
+			auto num_sets = consume_u16(subtable);
+			auto set_offsets = consume_values(subtable, num_sets);
+
+			for(auto& [cov_idx, first_gid] : coverage)
+			{
+				if(static_cast<size_t>(cov_idx) >= num_sets)
+					continue;
+
+				auto ligature_set = subtable_start.drop(set_offsets[cov_idx]);
+				auto ligature_set_start = ligature_set;
+
+				uint32_t root = 0;
+				if(auto it = compiled.ligature_roots.find(first_gid); it != compiled.ligature_roots.end())
+				{
+					root = it->second;
+				}
+				else
+				{
+					root = static_cast<uint32_t>(nodes.size());
+					nodes.emplace_back();
+					compiled.ligature_roots[first_gid] = root;
+				}
+
+				auto num_ligatures = consume_u16(ligature_set);
+				for(auto ofs : consume_values(ligature_set, num_ligatures))
+				{
+					auto ligature = ligature_set_start.drop(ofs);
+
+					auto output_gid = GlyphId { consume_u16(ligature) };
+					auto num_components = consume_u16(ligature);
+					if(num_components == 0)
+						continue;
+
+					auto node = root;
+					for(auto component : consume_values(ligature, num_components - 1u))
+						node = find_or_add_child(node, GlyphId { component });
+
+					// if an earlier ligature had the same components, it always wins.
+					auto this_priority = priority++;
+					if(nodes[node].priority == LigatureTrieNode::NO_LIGATURE)
+					{
+						nodes[node].ligature = output_gid;
+						nodes[node].priority = this_priority;
+					}
+				}
+			}
+		}
+	}
+
+	static void compile_single(CompiledSubstLookup& compiled, const LookupTable& lookup)
+	{
+		for(auto subtable : lookup.subtables)
+		{
+			auto subtable_start = subtable;
+			auto format = consume_u16(subtable);
+
+			if(format != 1 && format != 2)
+			{
+				sap::warn("font/gsub", "unknown subtable format '{}' in GSUB/Single", format);
+				continue;
+			}
+
+			auto coverage = parseCoverageTable(subtable_start.drop(consume_u16(subtable)));
+			if(format == 1)
+			{
+				// fixed delta for all covered glyphs; the addition is modulo 65536.
+				auto delta = consume_u16(subtable);
+				for(auto& [cov_idx, gid] : coverage)
+					compiled.single.emplace(gid, GlyphId { static_cast<uint16_t>(static_cast<uint32_t>(gid) + delta) });
+			}
+			else
+			{
+				auto num_glyphs = consume_u16(subtable);
+				auto substitutes = consume_values(subtable, num_glyphs);
+
+				// emplace does not replace existing entries, so earlier subtables take precedence.
+				for(auto& [cov_idx, gid] : coverage)
+				{
+					if(static_cast<size_t>(cov_idx) < num_glyphs)
+						compiled.single.emplace(gid, GlyphId { substitutes[cov_idx] });
+				}
+			}
+		}
+	}
+
+	static void compile_multiple(CompiledSubstLookup& compiled, const LookupTable& lookup)
+	{
+		for(auto subtable : lookup.subtables)
+		{
+			auto subtable_start = subtable;
+			auto format = consume_u16(subtable);
+
+			if(format != 1)
+			{
+				sap::warn("font/gsub", "unknown subtable format '{}' in GSUB/Multiple", format);
+				continue;
+			}
+
+			auto coverage = parseCoverageTable(subtable_start.drop(consume_u16(subtable)));
+
+			auto num_sequences = consume_u16(subtable);
+			auto sequence_offsets = consume_values(subtable, num_sequences);
+
+			for(auto& [cov_idx, gid] : coverage)
+			{
+				if(static_cast<size_t>(cov_idx) >= num_sequences || compiled.multiple.contains(gid))
+					continue;
+
+				/*
+				    spec:
+
+				    The use of multiple substitution for deletion of an input glyph is prohibited.
+				    The glyphCount value should always be greater than 0.
+				*/
+				auto sequence = subtable_start.drop(sequence_offsets[cov_idx]);
+				auto num_glyphs = consume_u16(sequence);
+				if(num_glyphs == 0)
+					continue;
+
+				std::vector<GlyphId> subst {};
+				for(auto g : consume_values(sequence, num_glyphs))
+					subst.push_back(GlyphId { g });
+
+				compiled.multiple[gid] = std::move(subst);
+			}
+		}
+	}
+
+	CompiledSubstLookup compileLookup(ClassDefCache& classdefs, const LookupTable& lookup)
+	{
+		CompiledSubstLookup compiled {};
+		compiled.type = lookup.type;
+
+		switch(lookup.type)
+		{
+			case LOOKUP_SINGLE:
+				compile_single(compiled, lookup);
+				break;
+
+			case LOOKUP_MULTIPLE:
+				compile_multiple(compiled, lookup);
+				break;
+
+			case LOOKUP_LIGATURE:
+				compile_ligatures(compiled, lookup);
+				break;
+
+			case LOOKUP_CONTEXTUAL:
+			case LOOKUP_CHAINING_CONTEXT:
+				for(auto subtable : lookup.subtables)
+				{
+					auto chained = (lookup.type == LOOKUP_CHAINING_CONTEXT);
+					if(auto ctx = compileContextSubtable(classdefs, subtable, chained); ctx.has_value())
+						compiled.contexts.push_back(std::move(*ctx));
+				}
+				break;
+
+			default:
+				// unsupported lookups are complained about when (if) they are used.
+				break;
+		}
+
+		return compiled;
+	}
+}
@@ -2,7 +2,6 @@
 // Copyright (c) 2021, zhiayang
 // SPDX-License-Identifier: Apache-2.0
 
-#include "util.h"
 #include "error.h"
 
 #include "font/cff.h"
@@ -13,7 +12,7 @@ namespace font
 {
 	GlyphMetrics FontFile::getGlyphMetrics(GlyphId glyph_id) const
 	{
-		auto u16_array = this->hmtx_table.cast<uint16_t>();
+		auto& hmtx = this->hmtx_values;
 
 		GlyphMetrics ret {};
 		auto gid32 = static_cast<uint32_t>(glyph_id);
@@ -22,18 +21,17 @@ namespace font
 		if(gid32 >= this->num_hmetrics)
 		{
 			// the remaining glyphs not in the array use the last value.
-			ret.horz_advance = util::convertBEU16(u16_array[(this->num_hmetrics - 1) * 2]);
+			ret.horz_advance = hmtx[(this->num_hmetrics - 1) * 2];
 
 			// there is an array of lsbs for glyph_ids > num_hmetrics
-			auto lsb_array = this->hmtx_table.drop(2 * this->num_hmetrics);
-			auto tmp = lsb_array[gid32 - this->num_hmetrics];
-
-			ret.left_side_bearing = (int16_t) util::convertBEU16(tmp);
+			auto lsb_idx = 2 * this->num_hmetrics + (gid32 - this->num_hmetrics);
+			if(lsb_idx < hmtx.size())
+				ret.left_side_bearing = (int16_t) hmtx[lsb_idx];
 		}
 		else
 		{
-			ret.horz_advance = util::convertBEU16(u16_array[gid32 * 2]);
-			ret.left_side_bearing = (int16_t) util::convertBEU16(u16_array[gid32 * 2 + 1]);
+			ret.horz_advance = hmtx[gid32 * 2];
+			ret.left_side_bearing = (int16_t) hmtx[gid32 * 2 + 1];
 		}
 
 		// now, figure out xmin and xmax
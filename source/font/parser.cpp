@@ -6,6 +6,12 @@
 #include <cstring>
 #include <cassert>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 #include "pool.h"
 #include "util.h"
 #include "error.h"
@@ -13,6 +19,7 @@
 #include "font/cff.h"
 #include "font/font.h"
 #include "font/truetype.h"
+#include "font/discovery.h"
 
 namespace font
 {
@@ -62,6 +69,77 @@ namespace font
 		return ret;
 	}
 
+	void decode_u16_array(uint16_t* dst, zst::byte_span src, size_t count)
+	{
+		assert(src.size() >= count * sizeof(uint16_t));
+
+		size_t i = 0;
+		auto ptr = src.data();
+
+#if defined(__SSE2__)
+		for(; i + 8 <= count; i += 8)
+		{
+			auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 2 * i));
+			x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), x);
+		}
+#elif defined(__ARM_NEON)
+		for(; i + 8 <= count; i += 8)
+			vst1q_u8(reinterpret_cast<uint8_t*>(dst + i), vrev16q_u8(vld1q_u8(ptr + 2 * i)));
+#endif
+
+		for(; i < count; i++)
+			dst[i] = ((uint16_t) ptr[2 * i] << 8) | ((uint16_t) ptr[2 * i + 1] << 0);
+	}
+
+	void decode_u32_array(uint32_t* dst, zst::byte_span src, size_t count)
+	{
+		assert(src.size() >= count * sizeof(uint32_t));
+
+		size_t i = 0;
+		auto ptr = src.data();
+
+#if defined(__SSE2__)
+		for(; i + 4 <= count; i += 4)
+		{
+			// swap the bytes in each 16-bit half, then swap the halves.
+			auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 4 * i));
+			x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+			x = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), x);
+		}
+#elif defined(__ARM_NEON)
+		for(; i + 4 <= count; i += 4)
+			vst1q_u8(reinterpret_cast<uint8_t*>(dst + i), vrev32q_u8(vld1q_u8(ptr + 4 * i)));
+#endif
+
+		for(; i < count; i++)
+		{
+			dst[i] = ((uint32_t) ptr[4 * i] << 24) | ((uint32_t) ptr[4 * i + 1] << 16) | ((uint32_t) ptr[4 * i + 2] << 8)
+			       | ((uint32_t) ptr[4 * i + 3] << 0);
+		}
+	}
+
+	BigEndianArray<uint16_t> consume_u16_array(zst::byte_span& s, size_t count)
+	{
+		if(s.size() < count * sizeof(uint16_t))
+			sap::error("font/off", "unexpected end of data (array of {} u16s, but only {} bytes)", count, s.size());
+
+		auto ret = BigEndianArray<uint16_t>(s.data(), count);
+		s.remove_prefix(count * sizeof(uint16_t));
+		return ret;
+	}
+
+	BigEndianArray<uint32_t> consume_u32_array(zst::byte_span& s, size_t count)
+	{
+		if(s.size() < count * sizeof(uint32_t))
+			sap::error("font/off", "unexpected end of data (array of {} u32s, but only {} bytes)", count, s.size());
+
+		auto ret = BigEndianArray<uint32_t>(s.data(), count);
+		s.remove_prefix(count * sizeof(uint32_t));
+		return ret;
+	}
+
 	static void parse_name_table(FontFile* font, const Table& name_table)
 	{
 		auto buf = zst::byte_span(font->file_bytes, font->file_size);
@@ -171,6 +249,10 @@ namespace font
 		}
 	}
 
+	// the cmap subtables that we can use, as (platform id, encoding id), in order of preference.
+	static constexpr std::pair<uint16_t, uint16_t> PREFERRED_CMAP_SUBTABLES[] = { { 0, 6 }, { 0, 4 }, { 0, 3 }, { 3, 10 },
+		{ 3, 1 }, { 1, 0 } };
+
 	static void parse_cmap_table(FontFile* font, const Table& cmap_table)
 	{
 		auto buf = zst::byte_span(font->file_bytes, font->file_size);
@@ -214,9 +296,7 @@ namespace font
 
 		bool found = false;
 		CMapTable chosen_table {};
-		int asdf[][2] = { { 0, 6 }, { 0, 4 }, { 0, 3 }, { 3, 10 }, { 3, 1 }, { 1, 0 } };
-
-		for(auto& [p, e] : asdf)
+		for(auto& [p, e] : PREFERRED_CMAP_SUBTABLES)
 		{
 			for(auto& tbl : subtables)
 			{
@@ -238,6 +318,10 @@ namespace font
 		auto foo = table_start.drop(chosen_table.offset);
 		font->character_mapping = readCMapTable(foo);
 
+		font->coverage = {};
+		for(auto& [cp, gid] : font->character_mapping.forward)
+			font->coverage.add(cp);
+
 		// zpr::println("found cmap: pid {}, eid {}, format {}", chosen_table.platform_id,
 		//	chosen_table.encoding_id, chosen_table.format);
 	}
@@ -350,7 +434,13 @@ namespace font
 		assert(font->num_hmetrics > 0);
 		font->hmtx_table = zst::byte_span(font->file_bytes, font->file_size).drop(hmtx_table.offset).take(hmtx_table.length);
 
-		// deferred processing -- we only take the glyph data when it is requested.
+		// the table is small (4 bytes per glyph at most), so just decode the whole thing in one go.
+		auto buf = font->hmtx_table;
+		font->hmtx_values = consume_u16_array(buf, font->hmtx_table.size() / sizeof(uint16_t)).decode();
+
+		if(font->hmtx_values.size() < 2 * font->num_hmetrics)
+			sap::error("font/off", "hmtx table too short ({} bytes for {} hmetrics)", font->hmtx_table.size(),
+				font->num_hmetrics);
 	}
 
 	static void parse_maxp_table(FontFile* font, const Table& maxp_table)
@@ -394,9 +484,22 @@ namespace font
 		if(font->outline_type != FontFile::OUTLINES_CFF)
 			sap::internal_error("found 'CFF' table in file with non-CFF outlines");
 
-		auto cff_data = zst::byte_span(font->file_bytes, font->file_size).drop(cff_table.offset).take(cff_table.length);
+		// faces in a collection can share the same CFF table.
+		if(font->collection != nullptr)
+		{
+			auto& shared = font->collection->shared_cff_data;
+			if(auto it = shared.find(cff_table.offset); it != shared.end())
+			{
+				font->cff_data = it->second;
+				return;
+			}
+		}
 
+		auto cff_data = zst::byte_span(font->file_bytes, font->file_size).drop(cff_table.offset).take(cff_table.length);
 		font->cff_data = cff::parseCFFData(font, cff_data);
+
+		if(font->collection != nullptr)
+			font->collection->shared_cff_data[cff_table.offset] = font->cff_data;
 	}
 
 
@@ -426,12 +529,20 @@ namespace font
 		return table;
 	}
 
-	static FontFile* parseOTF(zst::byte_span buf)
+	// `file` is the entire file, and `dir_offset` is the offset of the table directory. for single fonts this is 0,
+	// but for collections each face has its own directory (and all table offsets are from the start of the file).
+	static FontFile* parseOTF(zst::byte_span file, size_t dir_offset, FontCollection* collection)
 	{
-		// this is perfectly fine, because we own the data referred to by 'buf'.
+		// this is perfectly fine, because we own the data referred to by 'file'.
 		auto font = util::make<FontFile>();
-		font->file_bytes = const_cast<uint8_t*>(buf.data());
-		font->file_size = buf.size();
+		font->file_bytes = const_cast<uint8_t*>(file.data());
+		font->file_size = file.size();
+		font->collection = collection;
+
+		if(dir_offset + 12 > file.size())
+			sap::internal_error("unexpected end of file (while parsing table directory)");
+
+		auto buf = file.drop(dir_offset);
 
 		// first get the version.
 		auto sfnt_version = Tag(consume_u32(buf));
@@ -467,18 +578,55 @@ namespace font
 
 		// there is an order that we want to use:
 		constexpr Tag table_processing_order[] = { Tag("head"), Tag("name"), Tag("hhea"), Tag("hmtx"), Tag("maxp"), Tag("post"),
-			Tag("CFF "), Tag("CFF2"), Tag("glyf"), Tag("loca"), Tag("cmap"), Tag("GPOS"), Tag("GSUB"), Tag("OS/2") };
+			Tag("CFF "), Tag("CFF2"), Tag("glyf"), Tag("loca"), Tag("cmap"), Tag("GDEF"), Tag("GPOS"), Tag("GSUB"), Tag("OS/2") };
 
 		// CFF makes its own data (since everything is self-contained in the CFF table)
 		// but for TrueType, it's split across several tables, so just make one here.
+		bool shared_glyf = false;
 		if(font->outline_type == FontFile::OUTLINES_TRUETYPE)
-			font->truetype_data = util::make<truetype::TTData>();
+		{
+			// faces in a collection that use the same glyf and loca tables can share the decoded glyphs.
+			auto glyf = parsed_tables.find(Tag("glyf"));
+			auto loca = parsed_tables.find(Tag("loca"));
+			auto head = parsed_tables.find(Tag("head"));
+			auto maxp = parsed_tables.find(Tag("maxp"));
+
+			if(collection != nullptr && glyf != parsed_tables.end() && loca != parsed_tables.end()
+				&& head != parsed_tables.end() && maxp != parsed_tables.end())
+			{
+				auto key = FontCollection::TrueTypeDataKey {
+					.glyf_offset = glyf->second.offset,
+					.loca_offset = loca->second.offset,
+					.loca_format = peek_u16(file.drop(head->second.offset + 50)), // indexToLocFormat
+					.num_glyphs = peek_u16(file.drop(maxp->second.offset + 4)),
+				};
+
+				auto& shared = collection->shared_truetype_data;
+				if(auto it = shared.find(key); it != shared.end())
+				{
+					font->truetype_data = it->second;
+					shared_glyf = true;
+				}
+				else
+				{
+					font->truetype_data = util::make<truetype::TTData>();
+					shared[key] = font->truetype_data;
+				}
+			}
+			else
+			{
+				font->truetype_data = util::make<truetype::TTData>();
+			}
+		}
 
 		for(auto tag : table_processing_order)
 		{
 			if(auto it = parsed_tables.find(tag); it != parsed_tables.end())
 			{
 				auto& tbl = it->second;
+				if(shared_glyf && (tag == Tag("glyf") || tag == Tag("loca")))
+					continue;
+
 				if(tag == Tag("CFF "))
 					parse_cff_table(font, tbl);
 				else if(tag == Tag("CFF2"))
@@ -487,6 +635,8 @@ namespace font
 					off::parseGPos(font, tbl);
 				else if(tag == Tag("GSUB"))
 					off::parseGSub(font, tbl);
+				else if(tag == Tag("GDEF"))
+					off::parseGDef(font, tbl);
 				else if(tag == Tag("OS/2"))
 					parse_os2_table(font, tbl);
 				else if(tag == Tag("cmap"))
@@ -515,17 +665,436 @@ namespace font
 
 
 
-	FontFile* FontFile::parseFromFile(const std::string& path)
+	static bool is_sfnt_header(const uint8_t* buf)
+	{
+		return memcmp(buf, "OTTO", 4) == 0 || memcmp(buf, "true", 4) == 0 || memcmp(buf, "\x00\x01\x00\x00", 4) == 0;
+	}
+
+	static FontCollection* parse_collection(const std::string& path, uint8_t* buf, size_t len)
+	{
+		auto collection = util::make<FontCollection>();
+		collection->path = path;
+		collection->file_bytes = buf;
+		collection->file_size = len;
+
+		auto span = zst::byte_span(buf, len);
+		if(span.size() < 12)
+			sap::internal_error("font collection too short");
+
+		auto tag = Tag(consume_u32(span));
+		assert(tag == Tag("ttcf"));
+
+		// the DSIG fields in version 2 come after the offsets, so we don't care about the version.
+		consume_u16(span);
+		consume_u16(span);
+
+		auto num_fonts = consume_u32(span);
+		collection->face_offsets = consume_u32_array(span, num_fonts).decode();
+		collection->faces.resize(num_fonts, nullptr);
+
+		for(auto ofs : collection->face_offsets)
+		{
+			if(ofs + 4 > len || !is_sfnt_header(buf + ofs))
+				sap::internal_error("font collection '{}' has an invalid face offset {}", path, ofs);
+		}
+
+		return collection;
+	}
+
+	// collections are kept around by path, so that requesting several faces from the same
+	// file (via FontFile::parseFromFile) still only maps and decodes the shared parts once.
+	static std::unordered_map<std::string, FontCollection*> g_loaded_collections {};
+
+	// `utf8FromUtf16BigEndianBytes` treats broken surrogate pairs as fatal errors, so check for them first.
+	static bool is_valid_utf16_be(zst::byte_span bytes)
+	{
+		if(bytes.size() % 2 != 0)
+			return false;
+
+		for(size_t i = 0; i < bytes.size(); i += 2)
+		{
+			auto unit = peek_u16(bytes.drop(i));
+			if(unit < 0xD800 || unit > 0xDFFF)
+				continue;
+
+			if(unit > 0xDBFF || i + 4 > bytes.size())
+				return false;
+
+			auto next = peek_u16(bytes.drop(i + 2));
+			if(next < 0xDC00 || next > 0xDFFF)
+				return false;
+
+			i += 2;
+		}
+
+		return true;
+	}
+
+	/*
+	    Read the family, subfamily and postscript names from a name table, like `parse_name_table` (but only
+	    from the UTF-16 records). That one trusts the counts and offsets in the table; this checks all of them
+	    (and the strings themselves), and returns false if anything is out of bounds or malformed.
+	*/
+	static bool read_face_names(zst::byte_span table, FontFaceInfo& info)
+	{
+		constexpr size_t HEADER_SIZE = 3 * sizeof(uint16_t);
+		constexpr size_t RECORD_SIZE = 6 * sizeof(uint16_t);
+
+		if(table.size() < HEADER_SIZE)
+			return false;
+
+		auto num_records = peek_u16(table.drop(2));
+		auto storage_offset = peek_u16(table.drop(4));
+		if(HEADER_SIZE + num_records * RECORD_SIZE > table.size() || storage_offset > table.size())
+			return false;
+
+		auto storage = table.drop(storage_offset);
+
+		std::string family_compat {};
+		std::string subfamily_compat {};
+		std::string unique_name {};
+
+		for(size_t i = 0; i < num_records; i++)
+		{
+			auto record = table.drop(HEADER_SIZE + i * RECORD_SIZE);
+			auto platform_id = peek_u16(record.drop(0));
+			auto encoding_id = peek_u16(record.drop(2));
+			auto name_id = peek_u16(record.drop(6));
+			auto length = peek_u16(record.drop(8));
+			auto offset = peek_u16(record.drop(10));
+
+			// only the unicode (0) and windows unicode BMP (3, 1) records are in UTF-16; the others (eg. MacRoman)
+			// would be garbage anyway, and would be overwritten by the windows ones.
+			if(platform_id != 0 && !(platform_id == 3 && encoding_id == 1))
+				continue;
+
+			if(name_id != 1 && name_id != 2 && name_id != 3 && name_id != 6 && name_id != 16 && name_id != 17)
+				continue;
+
+			if(offset + length > storage.size())
+				return false;
+
+			auto u16 = storage.drop(offset).take(length);
+			if(!is_valid_utf16_be(u16))
+				return false;
+
+			auto text = unicode::utf8FromUtf16BigEndianBytes(u16);
+			if(name_id == 1)
+				family_compat = std::move(text);
+			else if(name_id == 2)
+				subfamily_compat = std::move(text);
+			else if(name_id == 3)
+				unique_name = std::move(text);
+			else if(name_id == 6)
+				info.postscript_name = std::move(text);
+			else if(name_id == 16)
+				info.family = std::move(text);
+			else if(name_id == 17)
+				info.subfamily = std::move(text);
+		}
+
+		if(info.family.empty())
+			info.family = std::move(family_compat);
+
+		if(info.subfamily.empty())
+			info.subfamily = std::move(subfamily_compat);
+
+		if(info.postscript_name.empty())
+			info.postscript_name = std::move(unique_name);
+
+		return true;
+	}
+
+	/*
+	    Summarise the coverage of the face from its cmap table. This picks the same subtable as `parse_cmap_table`,
+	    but only reads the ranges of codepoints (checking every offset and count against the table), since errors
+	    in the full parser are fatal. Returns false if the table is malformed, or if none of the subtables can be used.
+	*/
+	static bool read_face_coverage(zst::byte_span table, CoverageSummary& coverage)
+	{
+		constexpr size_t HEADER_SIZE = 2 * sizeof(uint16_t);
+		constexpr size_t RECORD_SIZE = 2 * sizeof(uint16_t) + sizeof(uint32_t);
+
+		if(table.size() < HEADER_SIZE)
+			return false;
+
+		auto num_records = peek_u16(table.drop(2));
+		if(HEADER_SIZE + num_records * RECORD_SIZE > table.size())
+			return false;
+
+		std::optional<zst::byte_span> subtable {};
+		for(auto& [platform_id, encoding_id] : PREFERRED_CMAP_SUBTABLES)
+		{
+			for(size_t i = 0; i < num_records && !subtable.has_value(); i++)
+			{
+				auto record = table.drop(HEADER_SIZE + i * RECORD_SIZE);
+				if(peek_u16(record) != platform_id || peek_u16(record.drop(2)) != encoding_id)
+					continue;
+
+				auto offset = peek_u32(record.drop(4));
+				if((uint64_t) offset + sizeof(uint16_t) > table.size())
+					return false;
+
+				subtable = table.drop(offset);
+			}
+
+			if(subtable.has_value())
+				break;
+		}
+
+		if(!subtable.has_value())
+			return false;
+
+		// the summary only needs to rule fonts out, so a range counts as covered even if some of it maps to .notdef.
+		auto add_range = [&coverage](uint64_t first, uint64_t last) {
+			constexpr auto PAGE_SIZE = CoverageSummary::PAGE_SIZE;
+
+			last = std::min(last, uint64_t(0x10FFFF));
+			for(auto page = first / PAGE_SIZE; first <= last && page <= last / PAGE_SIZE; page++)
+				coverage.add(Codepoint { static_cast<uint32_t>(page * PAGE_SIZE) });
+		};
+
+		auto sub = *subtable;
+		switch(peek_u16(sub))
+		{
+			case 0: {
+				if(sub.size() < 6 + 256)
+					return false;
+
+				for(uint32_t cp = 0; cp < 256; cp++)
+				{
+					if(sub[6 + cp] != 0)
+						coverage.add(Codepoint { cp });
+				}
+				break;
+			}
+
+			case 4: {
+				if(sub.size() < 14)
+					return false;
+
+				// endCode[segCount], reservedPad, startCode[segCount], then idDelta and idRangeOffset.
+				size_t seg_count = peek_u16(sub.drop(6)) / 2u;
+				if(16 + 8 * seg_count > sub.size())
+					return false;
+
+				for(size_t i = 0; i < seg_count; i++)
+				{
+					auto end = peek_u16(sub.drop(14 + 2 * i));
+					auto start = peek_u16(sub.drop(16 + 2 * seg_count + 2 * i));
+
+					// the last segment (0xFFFF) is just a terminator that maps to .notdef
+					if(start != 0xFFFF)
+						add_range(start, end);
+				}
+				break;
+			}
+
+			case 6: {
+				if(sub.size() < 10)
+					return false;
+
+				uint64_t first = peek_u16(sub.drop(6));
+				uint64_t count = peek_u16(sub.drop(8));
+				if(10 + 2 * count > sub.size())
+					return false;
+
+				if(count > 0)
+					add_range(first, first + count - 1);
+				break;
+			}
+
+			case 10: {
+				if(sub.size() < 20)
+					return false;
+
+				uint64_t first = peek_u32(sub.drop(12));
+				uint64_t count = peek_u32(sub.drop(16));
+				if(20 + 2 * count > sub.size())
+					return false;
+
+				if(count > 0)
+					add_range(first, first + count - 1);
+				break;
+			}
+
+			case 12:
+			case 13: {
+				if(sub.size() < 16)
+					return false;
+
+				uint64_t num_groups = peek_u32(sub.drop(12));
+				if(16 + 12 * num_groups > sub.size())
+					return false;
+
+				for(size_t i = 0; i < num_groups; i++)
+				{
+					auto group = sub.drop(16 + 12 * i);
+					add_range(peek_u32(group), peek_u32(group.drop(4)));
+				}
+				break;
+			}
+
+			default:
+				// the full parser doesn't read other formats either, so the font has no glyphs for any codepoint.
+				break;
+		}
+
+		return true;
+	}
+
+	std::vector<FontFaceInfo> readFontFaceInfo(const std::string& path, zst::byte_span file)
+	{
+		if(file.size() < 12)
+			return {};
+
+		std::vector<uint32_t> dir_offsets {};
+		if(memcmp(file.data(), "ttcf", 4) == 0)
+		{
+			auto buf = file.drop(8);
+			auto num_fonts = consume_u32(buf);
+			if(buf.size() < num_fonts * sizeof(uint32_t))
+				return {};
+
+			dir_offsets = consume_u32_array(buf, num_fonts).decode();
+		}
+		else
+		{
+			dir_offsets.push_back(0);
+		}
+
+		std::vector<FontFaceInfo> faces {};
+		for(size_t face_idx = 0; face_idx < dir_offsets.size(); face_idx++)
+		{
+			// we are scanning arbitrary files here, so be a little more careful than the full parser, since
+			// errors are fatal; skip anything whose table directory doesn't fit in the file.
+			if(dir_offsets[face_idx] + 12 > file.size() || !is_sfnt_header(file.data() + dir_offsets[face_idx]))
+				continue;
+
+			auto buf = file.drop(dir_offsets[face_idx] + 4);
+			auto num_tables = consume_u16(buf);
+			buf.remove_prefix(6);
+
+			if(buf.size() < num_tables * 16u)
+				continue;
+
+			std::map<Tag, Table> tables {};
+			bool valid = true;
+			for(size_t i = 0; i < num_tables; i++)
+			{
+				auto tbl = parse_table(buf);
+				if((uint64_t) tbl.offset + tbl.length > file.size())
+					valid = false;
+
+				tables[tbl.tag] = tbl;
+			}
+
+			if(!valid || tables.find(Tag("name")) == tables.end())
+				continue;
+
+			FontFaceInfo info {};
+			info.path = path;
+			info.face_index = face_idx;
+
+			auto& name_table = tables[Tag("name")];
+			if(!read_face_names(file.drop(name_table.offset).take(name_table.length), info))
+			{
+				sap::warn("font/index", "skipping '{}' (face {}): malformed name table", path, face_idx);
+				continue;
+			}
+
+			if(auto os2 = tables.find(Tag("OS/2")); os2 != tables.end() && os2->second.length >= 64)
+			{
+				auto os2_data = file.drop(os2->second.offset);
+				info.weight = peek_u16(os2_data.drop(4));
+
+				// fsSelection: bit 0 is ITALIC, bit 9 is OBLIQUE
+				auto fs_selection = peek_u16(os2_data.drop(62));
+				info.italic = (fs_selection & 0x0001) || (fs_selection & 0x0200);
+			}
+			else if(auto head = tables.find(Tag("head")); head != tables.end() && head->second.length >= 46)
+			{
+				// macStyle: bit 0 is bold, bit 1 is italic
+				auto mac_style = peek_u16(file.drop(head->second.offset + 44));
+				info.weight = (mac_style & 0x1) ? 700 : 400;
+				info.italic = (mac_style & 0x2);
+			}
+
+			// the full parser refuses a cmap without a usable subtable (eg. a symbol font with only (3, 0)), so the
+			// face could never be loaded anyway.
+			if(auto cmap = tables.find(Tag("cmap")); cmap != tables.end())
+			{
+				if(!read_face_coverage(file.drop(cmap->second.offset).take(cmap->second.length), info.coverage))
+				{
+					sap::warn("font/index", "skipping '{}' (face {}): no usable cmap table", path, face_idx);
+					continue;
+				}
+			}
+
+			faces.push_back(std::move(info));
+		}
+
+		return faces;
+	}
+
+	FontFile* FontCollection::getFace(size_t face_index)
+	{
+		if(face_index >= this->faces.size())
+			sap::error("font/off", "face index {} out of range for '{}' ({} faces)", face_index, this->path, this->faces.size());
+
+		if(this->faces[face_index] == nullptr)
+		{
+			auto face = parseOTF(zst::byte_span(this->file_bytes, this->file_size), this->face_offsets[face_index], this);
+			face->face_index = face_index;
+
+			this->faces[face_index] = face;
+		}
+
+		return this->faces[face_index];
+	}
+
+	FontCollection* FontCollection::parseFromFile(const std::string& path)
 	{
+		if(auto it = g_loaded_collections.find(path); it != g_loaded_collections.end())
+			return it->second;
+
+		auto [buf, len] = util::readEntireFile(path);
+		if(len < 4 || memcmp(buf, "ttcf", 4) != 0)
+			sap::internal_error("'{}' is not a font collection", path);
+
+		auto collection = parse_collection(path, buf, len);
+		g_loaded_collections[path] = collection;
+
+		return collection;
+	}
+
+	FontFile* FontFile::parseFromFile(const std::string& path, size_t face_index)
+	{
+		if(auto it = g_loaded_collections.find(path); it != g_loaded_collections.end())
+			return it->second->getFace(face_index);
+
 		// zpr::println("read {}", path);
 		auto [buf, len] = util::readEntireFile(path);
 		if(len < 4)
 			sap::internal_error("font file too short");
 
-		if(memcmp(buf, "OTTO", 4) == 0 || memcmp(buf, "true", 4) == 0 || memcmp(buf, "\x00\x01\x00\x00", 4) == 0)
-			return parseOTF(zst::byte_span(buf, len));
+		if(memcmp(buf, "ttcf", 4) == 0)
+		{
+			auto collection = parse_collection(path, buf, len);
+			g_loaded_collections[path] = collection;
 
+			return collection->getFace(face_index);
+		}
+		else if(is_sfnt_header(buf))
+		{
+			if(face_index != 0)
+				sap::error("font/off", "'{}' is not a font collection, but face {} was requested", path, face_index);
+
+			return parseOTF(zst::byte_span(buf, len), /* dir_offset: */ 0, /* collection: */ nullptr);
+		}
 		else
+		{
 			sap::internal_error("unsupported font file; unknown header bytes '{}'", zst::str_view((char*) buf, 4));
+		}
 	}
 }
@@ -0,0 +1,147 @@
+// sfnt.cpp
+// Copyright (c) 2022, zhiayang
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstring>
+#include <optional>
+#include <algorithm>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "util.h"
+#include "error.h"
+
+#include "font/sfnt.h"
+
+namespace font
+{
+	static void write_u32_at(zst::byte_buffer& buf, size_t offset, uint32_t value)
+	{
+		auto be = util::convertBEU32(value);
+		memcpy(buf.data() + offset, &be, sizeof(uint32_t));
+	}
+
+	uint32_t computeChecksum(zst::byte_span data)
+	{
+		auto ptr = data.data();
+		auto num_words = data.size() / sizeof(uint32_t);
+
+		size_t i = 0;
+		uint32_t sum = 0;
+
+		// the sum wraps around, so it can be done as 4 separate sums (one in each lane) that are added at the end.
+#if defined(__SSE2__)
+		auto acc = _mm_setzero_si128();
+		for(; i + 4 <= num_words; i += 4)
+		{
+			// same byte swap as `decode_u32_array`.
+			auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 4 * i));
+			x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+			x = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+			acc = _mm_add_epi32(acc, x);
+		}
+
+		uint32_t lanes[4];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+		sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(__ARM_NEON)
+		auto acc = vdupq_n_u32(0);
+		for(; i + 4 <= num_words; i += 4)
+			acc = vaddq_u32(acc, vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(ptr + 4 * i))));
+
+		sum = vgetq_lane_u32(acc, 0) + vgetq_lane_u32(acc, 1) + vgetq_lane_u32(acc, 2) + vgetq_lane_u32(acc, 3);
+#endif
+
+		for(; i < num_words; i++)
+		{
+			sum += ((uint32_t) ptr[4 * i] << 24) | ((uint32_t) ptr[4 * i + 1] << 16) | ((uint32_t) ptr[4 * i + 2] << 8)
+			     | ((uint32_t) ptr[4 * i + 3] << 0);
+		}
+
+		// the last (partial) word is padded with zeroes.
+		for(size_t k = num_words * sizeof(uint32_t); k < data.size(); k++)
+			sum += (uint32_t) ptr[k] << (24 - 8 * (k % sizeof(uint32_t)));
+
+		return sum;
+	}
+
+	void SfntWriter::addTable(const Tag& tag, zst::byte_span contents)
+	{
+		m_tables.emplace_back(tag, contents);
+	}
+
+	zst::byte_buffer SfntWriter::write() const
+	{
+		constexpr size_t HEADER_SIZE = sizeof(uint32_t) + 4 * sizeof(uint16_t);
+		constexpr size_t TABLE_RECORD_SIZE = 4 * sizeof(uint32_t);
+
+		// checkSumAdjustment is the third u32 in the head table.
+		constexpr size_t CHECKSUM_ADJUSTMENT_OFFSET = 8;
+		constexpr uint32_t CHECKSUM_MAGIC = 0xB1B0AFBA;
+
+		// the table records must be sorted by tag.
+		auto tables = m_tables;
+		std::stable_sort(tables.begin(), tables.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+		auto num_tables = static_cast<uint16_t>(tables.size());
+
+		// searchRange is (the largest power of 2 <= numTables) * 16, and entrySelector is log2 of that power of 2.
+		uint16_t entry_selector = 0;
+		while((2u << entry_selector) <= num_tables)
+			entry_selector++;
+
+		auto search_range = static_cast<uint16_t>(num_tables > 0 ? 16 * (1u << entry_selector) : 0);
+
+		zst::byte_buffer out {};
+		out.append_bytes(util::convertBEU32(m_sfnt_version));
+		out.append_bytes(util::convertBEU16(num_tables));
+		out.append_bytes(util::convertBEU16(search_range));
+		out.append_bytes(util::convertBEU16(entry_selector));
+		out.append_bytes(util::convertBEU16(static_cast<uint16_t>(16 * num_tables - search_range)));
+
+		// the records are filled in once the tables are written; the header is already a multiple of 4 bytes.
+		for(size_t i = 0; i < tables.size() * TABLE_RECORD_SIZE / sizeof(uint32_t); i++)
+			out.append_bytes(uint32_t(0));
+
+		std::vector<size_t> offsets {};
+		std::optional<size_t> head_offset {};
+		for(auto& [tag, contents] : tables)
+		{
+			offsets.push_back(out.size());
+			out.append(contents.data(), contents.size());
+
+			while(out.size() % sizeof(uint32_t) != 0)
+				out.append(static_cast<uint8_t>(0));
+
+			// the checksum of the head table (and of the whole file) is computed with the adjustment set to 0.
+			if(tag == Tag("head"))
+			{
+				if(contents.size() < CHECKSUM_ADJUSTMENT_OFFSET + sizeof(uint32_t))
+					sap::error("font/sfnt", "head table too short ({} bytes)", contents.size());
+
+				head_offset = offsets.back();
+				write_u32_at(out, *head_offset + CHECKSUM_ADJUSTMENT_OFFSET, 0);
+			}
+		}
+
+		for(size_t i = 0; i < tables.size(); i++)
+		{
+			auto& [tag, contents] = tables[i];
+			auto record = HEADER_SIZE + i * TABLE_RECORD_SIZE;
+
+			write_u32_at(out, record + 0, tag.value);
+			write_u32_at(out, record + 4, computeChecksum(out.span().drop(offsets[i]).take(contents.size())));
+			write_u32_at(out, record + 8, static_cast<uint32_t>(offsets[i]));
+			write_u32_at(out, record + 12, static_cast<uint32_t>(contents.size()));
+		}
+
+		if(head_offset.has_value())
+			write_u32_at(out, *head_offset + CHECKSUM_ADJUSTMENT_OFFSET, CHECKSUM_MAGIC - computeChecksum(out.span()));
+
+		return out;
+	}
+}
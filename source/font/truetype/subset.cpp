@@ -3,56 +3,256 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "util.h"
+#include "error.h"
 
 #include "font/font.h"
 #include "font/truetype.h"
 
 namespace font::truetype
 {
-	TTSubset createTTSubset(FontFile* font, const std::unordered_set<GlyphId>& used_glyphs)
+	static zst::byte_span get_table(FontFile* font, const Tag& tag)
+	{
+		auto it = font->tables.find(tag);
+		if(it == font->tables.end())
+			sap::error("font/ttf", "missing '{}' table", tag.str());
+
+		return zst::byte_span(font->file_bytes, font->file_size).drop(it->second.offset).take(it->second.length);
+	}
+
+	static void write_u16_at(zst::byte_buffer& buf, size_t offset, uint16_t value)
+	{
+		if(offset + sizeof(uint16_t) > buf.size())
+			sap::error("font/ttf", "table too short ({} bytes)", buf.size());
+
+		auto be = util::convertBEU16(value);
+		memcpy(buf.data() + offset, &be, sizeof(uint16_t));
+	}
+
+	/*
+	    Rewrite the glyph ids of the components in a composite glyph. The layout of the component records
+	    is the same as what `parse_glyph_components` reads.
+	*/
+	static zst::byte_buffer renumber_components(zst::byte_span glyph_data, const std::map<uint16_t, uint16_t>& new_gids)
+	{
+		zst::byte_buffer ret {};
+		ret.append(glyph_data);
+
+		auto data = glyph_data;
+		if(data.size() == 0 || static_cast<int16_t>(consume_u16(data)) >= 0)
+			return ret;
+
+		data.remove_prefix(2 * 4);
+		while(data.size() > 0)
+		{
+			auto flags = consume_u16(data);
+
+			auto gid_offset = glyph_data.size() - data.size();
+			write_u16_at(ret, gid_offset, new_gids.at(consume_u16(data)));
+
+			if(flags & 0x0001)
+				data.remove_prefix(2 * 2);
+			else
+				data.remove_prefix(2 * 1);
+
+			if(flags & 0x0008)
+				data.remove_prefix(2 * 1);
+			else if(flags & 0x0040)
+				data.remove_prefix(2 * 2);
+			else if(flags & 0x0080)
+				data.remove_prefix(2 * 4);
+
+			if(!(flags & 0x20))
+				break;
+		}
+
+		return ret;
+	}
+
+	/*
+	    The name table of the original font can be quite large (eg. with the whole license text); only keep the
+	    names that identify the font, as Windows (platform 3) + Unicode BMP (encoding 1) + US English records.
+	*/
+	static zst::byte_buffer create_name_table(FontFile* font)
+	{
+		std::vector<std::pair<uint16_t, zst::byte_buffer>> names {};
+		auto add_name = [&names](uint16_t name_id, const std::string& text) {
+			if(text.empty())
+				return;
+
+			zst::byte_buffer utf16 {};
+			auto utf8 = zst::byte_span(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+			while(utf8.size() > 0)
+			{
+				auto cp = unicode::consumeCodepointFromUtf8(utf8);
+				if(static_cast<uint32_t>(cp) > 0xFFFF)
+				{
+					auto [high, low] = unicode::codepointToSurrogatePair(cp);
+					utf16.append_bytes(util::convertBEU16(high));
+					utf16.append_bytes(util::convertBEU16(low));
+				}
+				else
+				{
+					utf16.append_bytes(util::convertBEU16(static_cast<uint16_t>(static_cast<uint32_t>(cp))));
+				}
+			}
+
+			names.emplace_back(name_id, std::move(utf16));
+		};
+
+		// the records must be sorted by name id.
+		add_name(1, font->family_compat);
+		add_name(2, font->subfamily_compat);
+		add_name(3, font->unique_name);
+		add_name(4, font->full_name);
+		add_name(6, font->postscript_name);
+
+		constexpr size_t HEADER_SIZE = 3 * sizeof(uint16_t);
+		constexpr size_t RECORD_SIZE = 6 * sizeof(uint16_t);
+
+		zst::byte_buffer table {};
+		table.append_bytes(util::convertBEU16(0));
+		table.append_bytes(util::convertBEU16(static_cast<uint16_t>(names.size())));
+		table.append_bytes(util::convertBEU16(static_cast<uint16_t>(HEADER_SIZE + names.size() * RECORD_SIZE)));
+
+		size_t offset = 0;
+		for(auto& [name_id, utf16] : names)
+		{
+			for(uint16_t x : { 3, 1, 0x409 })
+				table.append_bytes(util::convertBEU16(x));
+
+			table.append_bytes(util::convertBEU16(name_id));
+			table.append_bytes(util::convertBEU16(static_cast<uint16_t>(utf16.size())));
+			table.append_bytes(util::convertBEU16(static_cast<uint16_t>(offset)));
+
+			offset += utf16.size();
+		}
+
+		for(auto& [name_id, utf16] : names)
+			table.append(utf16.span());
+
+		return table;
+	}
+
+	TTSubset createTTSubset(FontFile* font, const GlyphSet& used_glyphs, bool compact)
 	{
 		auto tt = font->truetype_data;
 		assert(tt != nullptr);
 
-		// needs to be sorted. always insert 0.
-		std::set<uint16_t> used_gids {};
-		used_gids.insert(0);
-		used_gids.insert(tt->glyphs[0].component_gids.begin(), tt->glyphs[0].component_gids.end());
+		// always include 0. components can themselves be composite glyphs, so keep going until we have all of them.
+		GlyphSet used_gids { tt->glyphs.size() };
+		std::vector<uint16_t> pending { 0 };
+		for(auto gid : used_glyphs)
+			pending.push_back(static_cast<uint16_t>(static_cast<uint32_t>(gid)));
 
-		for(auto& gid : used_glyphs)
+		while(not pending.empty())
 		{
-			auto gid32 = static_cast<uint32_t>(gid);
-			auto& comps = tt->glyphs[gid32].component_gids;
+			auto gid = pending.back();
+			pending.pop_back();
+
+			if(gid >= tt->glyphs.size() || used_gids.contains(GlyphId { gid }))
+				continue;
+
+			used_gids.add(GlyphId { gid });
 
-			used_gids.insert(gid32);
-			used_gids.insert(comps.begin(), comps.end());
+			auto& comps = tt->glyphs[gid].component_gids;
+			pending.insert(pending.end(), comps.begin(), comps.end());
 		}
 
+		// the set is iterated in order of glyph id.
+		std::vector<uint16_t> sorted_gids {};
+		for(auto gid : used_gids)
+			sorted_gids.push_back(static_cast<uint16_t>(static_cast<uint32_t>(gid)));
+
 		TTSubset subset {};
+		bool half = tt->loca_bytes_per_entry == 2;
+
+		// the used glyphs are numbered in order, so the notdef glyph stays at 0.
+		for(auto gid : sorted_gids)
+			subset.new_glyph_ids.emplace(gid, compact ? static_cast<uint16_t>(subset.new_glyph_ids.size()) : gid);
+
+		zst::byte_buffer loca {};
+		zst::byte_buffer glyf {};
+
+		// note: there is one more entry than there are glyphs, which gives the end of the last glyph.
+		auto add_loca_entry = [&]() {
+			if(half)
+				loca.append_bytes(util::convertBEU16(glyf.size() / 2));
+			else
+				loca.append_bytes(util::convertBEU32(glyf.size()));
+		};
 
-		// the loca table must contain an entry for every glyph id in the font. since we're not
-		// changing the glyph ids themselves, we must iterate over every glyph id.
+		// these don't depend on the glyph ids
+		subset.name_table = create_name_table(font);
+		subset.cmap_table = createCMapSubset(font, subset.new_glyph_ids);
+
+		/*
+		    post: a version 2 table has the glyph names, indexed by glyph id. the names aren't needed in an
+		    embedded font, so just keep the header as a version 3 table (which has no glyph names).
+		*/
+		if(font->tables.contains(Tag("post")))
 		{
-			bool half = tt->loca_bytes_per_entry == 2;
+			constexpr size_t POST_HEADER_SIZE = 32;
+			subset.post_table.append(get_table(font, Tag("post")).take(POST_HEADER_SIZE));
 
-			zst::byte_buffer loca {};
-			zst::byte_buffer glyf {};
+			write_u16_at(subset.post_table, 0, 3);
+			write_u16_at(subset.post_table, 2, 0);
+		}
 
+		if(not compact)
+		{
+			// the loca table must contain an entry for every glyph id in the font. since we're not
+			// changing the glyph ids themselves, we must iterate over every glyph id.
 			for(size_t gid = 0; gid < font->num_glyphs; gid++)
 			{
-				if(half)
-					loca.append_bytes(util::convertBEU16(glyf.size() / 2));
-				else
-					loca.append_bytes(util::convertBEU32(glyf.size()));
-
-				if(used_gids.find(gid) != used_gids.end())
+				add_loca_entry();
+				if(used_gids.contains(GlyphId { static_cast<uint32_t>(gid) }))
 					glyf.append(tt->glyphs[gid].glyph_data);
 			}
 
+			add_loca_entry();
+
 			subset.loca_table = std::move(loca);
 			subset.glyf_table = std::move(glyf);
+			return subset;
+		}
+
+		std::vector<GlyphMetrics> metrics {};
+		for(auto gid : sorted_gids)
+		{
+			add_loca_entry();
+			glyf.append(renumber_components(tt->glyphs[gid].glyph_data, subset.new_glyph_ids).span());
+
+			metrics.push_back(font->getGlyphMetrics(GlyphId { gid }));
 		}
 
+		add_loca_entry();
+
+		// hmtx: glyphs at the end with the same advance only need their lsb.
+		size_t num_hmetrics = metrics.size();
+		while(num_hmetrics > 1 && metrics[num_hmetrics - 1].horz_advance == metrics[num_hmetrics - 2].horz_advance)
+			num_hmetrics--;
+
+		zst::byte_buffer hmtx {};
+		for(size_t i = 0; i < metrics.size(); i++)
+		{
+			if(i < num_hmetrics)
+				hmtx.append_bytes(util::convertBEU16(static_cast<uint16_t>(metrics[i].horz_advance)));
+
+			hmtx.append_bytes(util::convertBEU16(static_cast<uint16_t>(metrics[i].left_side_bearing)));
+		}
+
+		// maxp: numGlyphs comes right after the version.
+		subset.maxp_table.append(get_table(font, Tag("maxp")));
+		write_u16_at(subset.maxp_table, 4, static_cast<uint16_t>(sorted_gids.size()));
+
+		// hhea: numberOfHMetrics is the last field.
+		subset.hhea_table.append(get_table(font, Tag("hhea")));
+		write_u16_at(subset.hhea_table, 34, static_cast<uint16_t>(num_hmetrics));
+
+		subset.loca_table = std::move(loca);
+		subset.glyf_table = std::move(glyf);
+		subset.hmtx_table = std::move(hmtx);
+
 		return subset;
 	}
 }
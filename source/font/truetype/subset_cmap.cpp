@@ -0,0 +1,157 @@
+// subset_cmap.cpp
+// Copyright (c) 2022, zhiayang
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+
+#include "util.h"
+
+#include "font/font.h"
+#include "font/truetype.h"
+
+namespace font::truetype
+{
+	// a run of consecutive codepoints that map to consecutive glyph ids.
+	struct MappingGroup
+	{
+		uint32_t start_codepoint;
+		uint32_t end_codepoint;
+		uint16_t start_gid;
+	};
+
+	static void append16(zst::byte_buffer& buf, uint16_t x)
+	{
+		buf.append_bytes(util::convertBEU16(x));
+	}
+
+	static void append32(zst::byte_buffer& buf, uint32_t x)
+	{
+		buf.append_bytes(util::convertBEU32(x));
+	}
+
+	// the length of a format 4 subtable is 16 bits, so it can only have this many segments (including the last one)
+	static constexpr size_t MAX_FORMAT4_SEGMENTS = (0xFFFF - 8 * 2) / (4 * 2);
+
+	static zst::byte_buffer make_format4_subtable(const std::vector<MappingGroup>& groups)
+	{
+		std::vector<MappingGroup> segments {};
+		for(auto& group : groups)
+		{
+			// the last segment must be 0xFFFF -> 0xFFFF, which maps to notdef; everything past that needs format 12.
+			if(group.start_codepoint >= 0xFFFF || segments.size() + 1 == MAX_FORMAT4_SEGMENTS)
+				break;
+
+			segments.push_back(group);
+			segments.back().end_codepoint = std::min(group.end_codepoint, 0xFFFEu);
+		}
+
+		segments.push_back(MappingGroup { 0xFFFF, 0xFFFF, 0 });
+
+		auto seg_count = static_cast<uint16_t>(segments.size());
+
+		uint16_t entry_selector = 0;
+		while((2u << entry_selector) <= seg_count)
+			entry_selector++;
+
+		auto search_range = static_cast<uint16_t>(2 * (1 << entry_selector));
+
+		zst::byte_buffer subtable {};
+		append16(subtable, 4);
+		append16(subtable, static_cast<uint16_t>(8 * 2 + 4 * 2 * seg_count));
+		append16(subtable, 0);
+		append16(subtable, 2 * seg_count);
+		append16(subtable, search_range);
+		append16(subtable, entry_selector);
+		append16(subtable, 2 * seg_count - search_range);
+
+		for(auto& seg : segments)
+			append16(subtable, static_cast<uint16_t>(seg.end_codepoint));
+
+		append16(subtable, 0);
+		for(auto& seg : segments)
+			append16(subtable, static_cast<uint16_t>(seg.start_codepoint));
+
+		// glyph = codepoint + delta (modulo 65536); the last segment maps 0xFFFF to 0.
+		for(auto& seg : segments)
+			append16(subtable, static_cast<uint16_t>(seg.start_gid - seg.start_codepoint));
+
+		for(size_t i = 0; i < segments.size(); i++)
+			append16(subtable, 0);
+
+		return subtable;
+	}
+
+	static zst::byte_buffer make_format12_subtable(const std::vector<MappingGroup>& groups)
+	{
+		zst::byte_buffer subtable {};
+		append16(subtable, 12);
+		append16(subtable, 0);
+		append32(subtable, static_cast<uint32_t>(16 + 12 * groups.size()));
+		append32(subtable, 0);
+		append32(subtable, static_cast<uint32_t>(groups.size()));
+
+		for(auto& group : groups)
+		{
+			append32(subtable, group.start_codepoint);
+			append32(subtable, group.end_codepoint);
+			append32(subtable, group.start_gid);
+		}
+
+		return subtable;
+	}
+
+	zst::byte_buffer createCMapSubset(FontFile* font, const std::map<uint16_t, uint16_t>& new_glyph_ids)
+	{
+		std::vector<std::pair<uint32_t, uint16_t>> mapping {};
+		for(auto& [cp, gid] : font->character_mapping.forward)
+		{
+			auto gid16 = static_cast<uint16_t>(static_cast<uint32_t>(gid));
+			if(auto it = new_glyph_ids.find(gid16); gid16 != 0 && it != new_glyph_ids.end())
+				mapping.emplace_back(static_cast<uint32_t>(cp), it->second);
+		}
+
+		std::sort(mapping.begin(), mapping.end());
+
+		std::vector<MappingGroup> groups {};
+		for(auto& [cp, gid] : mapping)
+		{
+			if(not groups.empty())
+			{
+				auto& last = groups.back();
+				if(last.end_codepoint + 1 == cp && last.start_gid + (cp - last.start_codepoint) == gid)
+				{
+					last.end_codepoint = cp;
+					continue;
+				}
+			}
+
+			groups.push_back(MappingGroup { cp, cp, gid });
+		}
+
+		// a format 4 (BMP-only) subtable is always there for compatibility; format 12 only if it's needed.
+		std::vector<std::pair<uint16_t, zst::byte_buffer>> subtables {};
+		subtables.emplace_back(1, make_format4_subtable(groups));
+
+		if((not mapping.empty() && mapping.back().first >= 0xFFFF) || groups.size() + 1 > MAX_FORMAT4_SEGMENTS)
+			subtables.emplace_back(10, make_format12_subtable(groups));
+
+		zst::byte_buffer cmap {};
+		append16(cmap, 0);
+		append16(cmap, static_cast<uint16_t>(subtables.size()));
+
+		// all the subtables are for the windows platform (3), with either the BMP (1) or full (10) encoding.
+		uint32_t offset = static_cast<uint32_t>(4 + 8 * subtables.size());
+		for(auto& [encoding, subtable] : subtables)
+		{
+			append16(cmap, 3);
+			append16(cmap, encoding);
+			append32(cmap, offset);
+			offset += static_cast<uint32_t>(subtable.size());
+		}
+
+		for(auto& [encoding, subtable] : subtables)
+			cmap.append(subtable.span());
+
+		return cmap;
+	}
+}
@@ -61,28 +61,34 @@ namespace font::truetype
 		// the loca table should come after the glyph table!
 		assert(tt->glyf_data.size() > 0);
 
-		bool half = tt->loca_bytes_per_entry == 2;
-		auto get_ofs = [&]() -> uint32_t {
-			if(half)
-				return 2 * consume_u16(loca_table);
-			else
-				return 1 * consume_u32(loca_table);
-		};
+		// there are num_glyphs+1 entries, since the last one gives the size of the last glyph.
+		auto num_entries = font->num_glyphs + 1;
 
-		auto peek_ofs = [&]() -> uint32_t {
-			if(half)
-				return 2 * peek_u16(loca_table);
-			else
-				return 1 * peek_u32(loca_table);
-		};
+		std::vector<uint32_t> offsets(num_entries);
+		if(tt->loca_bytes_per_entry == 2)
+		{
+			// the short format stores offset/2.
+			std::vector<uint16_t> half_offsets(num_entries);
+			consume_u16_array(loca_table, num_entries).decodeInto(half_offsets.data());
+
+			for(size_t i = 0; i < num_entries; i++)
+				offsets[i] = 2 * (uint32_t) half_offsets[i];
+		}
+		else
+		{
+			consume_u32_array(loca_table, num_entries).decodeInto(offsets.data());
+		}
 
+		tt->glyphs.reserve(font->num_glyphs);
 		for(size_t i = 0; i < font->num_glyphs; i++)
 		{
 			Glyph glyph {};
 			glyph.gid = i;
 
-			auto offset = get_ofs();
-			auto next = peek_ofs();
+			auto offset = offsets[i];
+			auto next = offsets[i + 1];
+			if(next < offset || next > tt->glyf_data.size())
+				sap::error("font/ttf", "invalid loca entry for glyph {} ({} - {})", i, offset, next);
 
 			glyph.glyph_data = tt->glyf_data.drop(offset).take(next - offset);
 
@@ -12,9 +12,11 @@
 
 #include <vector>
 #include <optional>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "types.h"
+#include "font/glyph_set.h"
 
 namespace font
 {
@@ -24,24 +26,37 @@ namespace font
 
 namespace font::cff
 {
-	// these are all 32-bit, because that's the maximum size it's specified to be.
-	// no reason to use larger types than we'll ever need.
+	/*
+	    The offsets are not decoded up front (the CharStrings INDEX can have tens of thousands of them); they are
+	    read from the offset array in the font file when an item is needed.
+	*/
 	struct IndexTable
 	{
 		uint16_t count;
 		uint8_t offset_bytes;
 
-		// of course, since we don't know beforehand the offset size, just use the largest (4 bytes)
-		std::vector<uint32_t> offsets;
+		// `count + 1` offsets, each `offset_bytes` long
+		zst::byte_span offset_array;
 
 		zst::byte_span data;
 
+		// the offsets in the file are from the byte before the data, so subtract 1 to get the offset into `data`.
+		inline uint32_t get_offset(size_t idx) const
+		{
+			uint32_t ofs = 0;
+			for(size_t k = 0; k < this->offset_bytes; k++)
+				ofs = (ofs << 8) | this->offset_array[idx * this->offset_bytes + k];
+
+			return ofs - 1;
+		}
+
 		inline zst::byte_span get_item(size_t idx) const
 		{
 			if(idx >= this->count)
 				return {};
 
-			return data.drop(offsets[idx]).take(offsets[idx + 1] - offsets[idx]);
+			auto start = this->get_offset(idx);
+			return data.drop(start).take(this->get_offset(idx + 1) - start);
 		}
 	};
 
@@ -122,8 +137,8 @@ namespace font::cff
 	{
 		uint16_t gid;
 
+		// only for CID fonts
 		uint16_t cid;
-		zst::str_view glyph_name;
 		zst::byte_span charstring;
 
 		// which Font DICT to use, for CID fonts.
@@ -135,6 +150,9 @@ namespace font::cff
 		Dictionary dict {};
 		Dictionary private_dict {};
 		std::vector<Subroutine> local_subrs {};
+
+		// the bias for `callsubr`, computed once from the number of local subrs
+		int32_t local_subrs_bias = 0;
 	};
 
 	/*
@@ -161,11 +179,13 @@ namespace font::cff
 
 		Dictionary top_dict {};
 		std::vector<Subroutine> global_subrs {};
+		int32_t global_subrs_bias = 0;
 
+		// this is only filled in when subsetting; see `readGlyphs`.
 		std::vector<Glyph> glyphs {};
 
 		std::vector<std::string> string_ids {};
-		std::map<std::string, uint16_t> known_strings {};
+		std::unordered_map<std::string, uint16_t> known_strings {};
 
 		// Font DICTs referenced in the FDArray for CID fonts. For non-CID fonts, there is always
 		// one FD in here, referencing the top-level Private and local_subrs data.
@@ -177,10 +197,17 @@ namespace font::cff
 
 
 	/*
-	    Parse CFF data from the given buffer
+	    Parse CFF data from the given buffer. Nothing is read for each glyph, so this does not depend on the
+	    number of glyphs in the font.
 	*/
 	CFFData* parseCFFData(FontFile* font, zst::byte_span cff_data);
 
+	/*
+	    Read the list of glyphs with their charstrings in order of glyph id. For CID fonts, this also reads
+	    their CIDs (from the charset) and Font DICTs (from the FDSelect).
+	*/
+	std::vector<Glyph> readGlyphs(const CFFData* cff);
+
 	/*
 	    Read a number from a *Type 2* CharString. For the 5-byte encoding which represents a
 	    16.16 fixed point, the high 16 bits of the i32 are the integer part, and the low 16 bits
@@ -227,29 +254,57 @@ namespace font::cff
 	std::optional<std::vector<Operand>> getDefaultValueForDictKey(DictKey key);
 
 	/*
-	    Read the charset from the buffer, returning a mapping from glyph IDs to glyph names (SIDs) or CIDs
+	    Read the charset from the buffer, returning the glyph name (SID) or CID for each glyph ID.
 	*/
-	std::map<uint16_t, uint16_t> readCharsetTable(size_t num_glyphs, zst::byte_span dict);
+	std::vector<uint16_t> readCharsetTable(size_t num_glyphs, zst::byte_span dict);
 
 	/*
-	    Create the cmap corresponding to the subset CFF file. Don't call this directly.
+	    Read the FDSelect from the buffer, returning the index of the Font DICT for each glyph ID.
 	*/
-	zst::byte_buffer createCMapForCFFSubset(FontFile* file);
+	std::vector<uint8_t> readFDSelect(size_t num_glyphs, zst::byte_span buffer);
 
 	/*
-	    Get one of the predefined charsets, returning the mapping from glyph ID to SIDs.
+	    Create the cmap corresponding to the subset CFF data (after glyph pruning). Don't call this directly.
+	*/
+	zst::byte_buffer createCMapForCFFSubset(CFFData* cff);
+
+	/*
+	    Get one of the predefined charsets, returning the SID for each glyph ID (but no more than `num_glyphs`).
 
 	    0 = ISOAdobe
 	    1 = Expert
 	    2 = ExpertSubset
 	*/
-	std::map<uint16_t, uint16_t> getPredefinedCharset(int num);
+	std::vector<uint16_t> getPredefinedCharset(int num, size_t num_glyphs);
+
+	/*
+	    Get the bias that is added to subroutine numbers for `callsubr` and `callgsubr`, given the
+	    number of subroutines in the INDEX.
+	*/
+	int32_t computeSubrBias(size_t num_subrs);
 
 	/*
-	    Interpret the given charstring, and mark any used subroutines.
+	    Interpret the given charstring (which uses the given Font DICT), and mark any used subroutines.
+	*/
+	void interpretCharStringAndMarkSubrs(zst::byte_span charstring, CFFData* cff, FontDict& font_dict);
+
+	/*
+	    Interpret the given charstring, inlining all its subroutine calls. Returns the instructions (an operand, or
+	    an operator with its mask bytes), or nothing if the charstring uses arithmetic or computes the subr numbers,
+	    since those can't be inlined.
+	*/
+	std::optional<std::vector<zst::byte_span>> desubroutiniseCharString(zst::byte_span charstring, CFFData* cff,
+		FontDict& font_dict);
+
+	/*
+	    The subrs in the font are made for the entire glyph set, so they are not very useful for a subset. This
+	    inlines the subrs in the (already pruned) glyphs, then finds the sequences of instructions that repeat
+	    in the subset, and makes them the new global subrs; the local subrs are removed.
+
+	    The new charstrings and subrs are written to `storage`, which must outlive the CFFData. Returns false
+	    (and leaves the CFFData unchanged) if some charstring can't be inlined, or if it wouldn't be smaller.
 	*/
-	void interpretCharStringAndMarkSubrs(zst::byte_span charstring, std::vector<Subroutine>& global_subrs,
-		std::vector<Subroutine>& local_subrs);
+	bool resubroutiniseCharStrings(CFFData* cff, zst::byte_buffer& storage);
 }
 
 namespace font::cff
@@ -263,9 +318,11 @@ namespace font::cff
 
 	/*
 	    Subset the CFF font (given in `file`), including only the used_glyphs. Returns a new CFF and cmap table
-	    for embedding into the OTF font.
+	    for embedding into the OTF font. If `resubroutinise` is true, the subrs are rebuilt for the subset
+	    (see `resubroutiniseCharStrings`); this is slower, but usually makes the subset smaller.
 	*/
-	CFFSubset createCFFSubset(FontFile* file, zst::str_view subset_name, const std::unordered_set<GlyphId>& used_glyphs);
+	CFFSubset createCFFSubset(FontFile* file, zst::str_view subset_name, const GlyphSet& used_glyphs,
+		bool resubroutinise);
 
 
 	/*
@@ -0,0 +1,78 @@
+// discovery.h
+// Copyright (c) 2022, zhiayang
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <zst.h>
+
+#include "defs.h"
+#include "types.h"
+#include "font/font.h"
+
+namespace font
+{
+	/*
+	    The descriptive information about a single face in a font file: enough to pick the face by
+	    family and style, without having to parse the whole font.
+	*/
+	struct FontFaceInfo
+	{
+		std::string path;
+		size_t face_index = 0;
+
+		// these follow the same rules as the fields in FontFile (typographic names if present, otherwise
+		// the legacy names 1 and 2)
+		std::string family;
+		std::string subfamily;
+		std::string postscript_name;
+
+		int weight = 400; // OS/2 usWeightClass
+		bool italic = false;
+
+		CoverageSummary coverage {};
+	};
+
+	/*
+	    Read the face information for every face in the given font file (which can be a collection).
+	    Only the name, OS/2, head and cmap tables are looked at.
+	*/
+	std::vector<FontFaceInfo> readFontFaceInfo(const std::string& path, zst::byte_span file);
+
+	/*
+	    An index of all the fonts in a set of directories, so that fonts can be found by family and
+	    style. Scanning and parsing every font file is slow, so the index is saved to a cache file;
+	    on the next load, only files (and directories) whose mtime changed are looked at again.
+	*/
+	struct FontIndex
+	{
+		static FontIndex* load(const std::vector<std::string>& directories, const std::string& cache_path);
+
+		static std::string defaultCachePath();
+		static std::vector<std::string> defaultSearchDirectories();
+
+		// find by the exact (case-insensitive) family and subfamily names, eg. ("Source Serif 4", "Bold Italic")
+		const FontFaceInfo* findFace(zst::str_view family, zst::str_view subfamily) const;
+
+		// find the face in the family that best matches the given weight and slant.
+		const FontFaceInfo* findFace(zst::str_view family, int weight, bool italic) const;
+
+		const FontFaceInfo* findFaceByPostscriptName(zst::str_view name) const;
+
+		FontFile* loadFace(const FontFaceInfo* face) const;
+
+		const std::vector<FontFaceInfo>& faces() const { return m_faces; }
+
+	private:
+		void add_face(FontFaceInfo face);
+
+		std::vector<FontFaceInfo> m_faces {};
+
+		// both are keyed by lowercased names, and map to indices into m_faces.
+		util::hashmap<std::string, std::vector<size_t>> m_families {};
+		util::hashmap<std::string, size_t> m_postscript_names {};
+	};
+}
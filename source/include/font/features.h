@@ -5,7 +5,11 @@
 #pragma once
 
 #include <map>
+#include <vector>
 #include <utility>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "types.h"
 #include "font/tag.h"
@@ -22,6 +26,48 @@ namespace font
 		int16_t horz_advance;
 		int16_t vert_advance;
 	};
+
+	/*
+	    The glyphs of a run of text while it is being shaped, as parallel arrays. GSUB edits the buffer in place,
+	    and GPOS adds its adjustments (to the advances and offsets) in place. The buffer is meant to be reused for
+	    every run, via `reset`; once its arrays have grown large enough, shaping a run does no allocation.
+
+	    `clusters[i]` is the index (into `input`) of the input glyph that glyphs[i] came from. Substitutions keep
+	    the clusters in order: the glyphs of a multiple substitution all take the cluster of the glyph they
+	    replace, and a ligature merges the clusters of its components. So, glyphs[i] came from the input glyphs
+	    from clusters[i] up to (but excluding) the next different cluster; see `inputRange`.
+	*/
+	struct GlyphBuffer
+	{
+		// set on glyphs that were substituted by GSUB, and on glyphs that were formed by a ligature.
+		static constexpr uint8_t PROP_SUBSTITUTED = 0x1;
+		static constexpr uint8_t PROP_LIGATED = 0x2;
+
+		std::vector<GlyphId> input;
+
+		std::vector<GlyphId> glyphs;
+		std::vector<uint32_t> clusters;
+		std::vector<uint8_t> props;
+		std::vector<GlyphAdjustment> adjustments;
+
+		size_t size() const { return glyphs.size(); }
+
+		// clear the buffer, and fill it with the input glyphs (each in its own cluster) with no adjustments.
+		void reset(zst::span<GlyphId> input_glyphs);
+
+		// replace `count` glyphs starting at `start` with `replacement`, merging their clusters; the new glyphs
+		// get the props of the first replaced glyph, plus `new_props`.
+		void replace(size_t start, size_t count, zst::span<GlyphId> replacement, uint8_t new_props);
+
+		// remove the glyph at `i`. Its cluster should be merged with a neighbour's first, so no input is lost.
+		void remove(size_t i);
+
+		// put the glyphs from `start` up to (but excluding) `end` into the cluster of the first one.
+		void mergeClusters(size_t start, size_t end);
+
+		// the range [first, second) of input glyphs that glyphs[i] came from.
+		std::pair<size_t, size_t> inputRange(size_t i) const;
+	};
 }
 
 namespace font::off
@@ -64,12 +110,301 @@ namespace font::off
 		std::vector<uint16_t> lookups;
 	};
 
+	/*
+	    A conservative summary of a set of glyph ids, used to quickly rule out lookups that cannot possibly
+	    apply to a glyph (or to any glyph in a run). It's three 64-bit bloom-style masks, each indexed by a
+	    different group of bits of the glyph id; if any mask doesn't have the bit for a glyph, then the glyph
+	    is definitely not in the set. False positives are fine, false negatives are not.
+	*/
+	struct GlyphSetDigest
+	{
+		static constexpr size_t NUM_MASKS = 3;
+		static constexpr uint32_t SHIFTS[NUM_MASKS] = { 0, 4, 9 };
+
+		uint64_t masks[NUM_MASKS] {};
+
+		inline void add(GlyphId gid)
+		{
+			for(size_t i = 0; i < NUM_MASKS; i++)
+				masks[i] |= bit_for(gid, SHIFTS[i]);
+		}
+
+		inline void addAll()
+		{
+			for(auto& mask : masks)
+				mask = ~0ull;
+		}
+
+		inline bool mayHave(GlyphId gid) const
+		{
+			for(size_t i = 0; i < NUM_MASKS; i++)
+			{
+				if(!(masks[i] & bit_for(gid, SHIFTS[i])))
+					return false;
+			}
+
+			return true;
+		}
+
+		inline bool mayIntersect(const GlyphSetDigest& other) const
+		{
+			for(size_t i = 0; i < NUM_MASKS; i++)
+			{
+				if(!(masks[i] & other.masks[i]))
+					return false;
+			}
+
+			return true;
+		}
+
+	private:
+		static inline uint64_t bit_for(GlyphId gid, uint32_t shift)
+		{
+			return 1ull << ((static_cast<uint32_t>(gid) >> shift) & 63);
+		}
+	};
+
 	struct LookupTable
 	{
 		uint16_t type;
 		uint16_t flags;
 		uint16_t mark_filtering_set;
 		std::vector<zst::byte_span> subtables;
+
+		// all the glyphs that this lookup could possibly start matching at (ie. the union of the first-glyph
+		// coverage tables of its subtables). computed when the font is loaded.
+		GlyphSetDigest digest;
+	};
+
+	/*
+	    Lookup flags (OFF 1.9, page 137). The IGNORE_* flags use the same bits as the glyph classes in
+	    `GDefTable::glyph_props`, so checking whether a lookup ignores a glyph's class is just a bitwise and.
+	*/
+	constexpr uint16_t LOOKUP_FLAG_RIGHT_TO_LEFT = 0x0001;
+	constexpr uint16_t LOOKUP_FLAG_IGNORE_BASE_GLYPHS = 0x0002;
+	constexpr uint16_t LOOKUP_FLAG_IGNORE_LIGATURES = 0x0004;
+	constexpr uint16_t LOOKUP_FLAG_IGNORE_MARKS = 0x0008;
+	constexpr uint16_t LOOKUP_FLAG_USE_MARK_FILTERING_SET = 0x0010;
+	constexpr uint16_t LOOKUP_FLAG_MARK_ATTACHMENT_TYPE = 0xFF00;
+
+	/*
+	    The glyph properties from the GDEF table, decoded when the font is loaded. Lookups look at these for
+	    every glyph they step over, so they're kept in flat arrays indexed by glyph id.
+	*/
+	struct GDefTable
+	{
+		static constexpr uint16_t GLYPH_BASE = 0x02;
+		static constexpr uint16_t GLYPH_LIGATURE = 0x04;
+		static constexpr uint16_t GLYPH_MARK = 0x08;
+		static constexpr uint16_t GLYPH_COMPONENT = 0x10;
+
+		// the glyph class (one of the GLYPH_* bits) in the low byte, and the mark attachment class in the
+		// high byte. glyphs that the GDEF table doesn't mention are 0.
+		std::vector<uint16_t> glyph_props;
+
+		// for each mark glyph set, whether each glyph is in it.
+		std::vector<std::vector<bool>> mark_glyph_sets;
+
+		inline uint16_t propsOf(GlyphId gid) const
+		{
+			auto idx = static_cast<size_t>(gid);
+			return idx < glyph_props.size() ? glyph_props[idx] : 0;
+		}
+	};
+
+	/*
+	    Steps through a glyphstring on behalf of a lookup, skipping the glyphs that the lookup's flags say to
+	    ignore -- eg. so that a ligature or a contextual rule can match across marks. Whether a glyph is skipped
+	    only depends on its props in the GDEF table, so each decision is just a few array accesses.
+	*/
+	struct SkippyIterator
+	{
+		SkippyIterator(const GDefTable& gdef, const LookupTable& lookup);
+
+		inline bool skip(GlyphId gid) const
+		{
+			if(!m_active)
+				return false;
+
+			auto props = m_gdef->propsOf(gid);
+			if(props & m_flags & (LOOKUP_FLAG_IGNORE_BASE_GLYPHS | LOOKUP_FLAG_IGNORE_LIGATURES | LOOKUP_FLAG_IGNORE_MARKS))
+				return true;
+
+			if(!(props & GDefTable::GLYPH_MARK))
+				return false;
+
+			// the mark filtering set takes precedence over the mark attachment type.
+			if(m_mark_set != nullptr)
+				return static_cast<size_t>(gid) >= m_mark_set->size() || !(*m_mark_set)[static_cast<size_t>(gid)];
+
+			auto mark_class = (m_flags & LOOKUP_FLAG_MARK_ATTACHMENT_TYPE) >> 8;
+			return mark_class != 0 && mark_class != (props >> 8);
+		}
+
+		// the index of the first glyph after (or the last glyph before) glyphs[i] that isn't skipped, if any.
+		std::optional<size_t> next(zst::span<GlyphId> glyphs, size_t i) const;
+		std::optional<size_t> prev(zst::span<GlyphId> glyphs, size_t i) const;
+
+	private:
+		const GDefTable* m_gdef;
+		const std::vector<bool>* m_mark_set;
+		uint16_t m_flags;
+		bool m_active;
+	};
+
+	/*
+	    A decoded ClassDef table. The classes of all glyphs from `first_glyph` up to the last glyph mentioned by the
+	    table are stored in a flat array, so finding the class of a glyph is just an array access. Glyphs outside
+	    the array are in class 0, the default class.
+	*/
+	struct ClassDef
+	{
+		uint16_t first_glyph = 0;
+		std::vector<uint16_t> classes;
+
+		inline uint16_t classOf(GlyphId gid) const
+		{
+			auto idx = static_cast<uint32_t>(gid) - first_glyph;
+			if(static_cast<uint32_t>(gid) < first_glyph || idx >= classes.size())
+				return 0;
+
+			return classes[idx];
+		}
+	};
+
+	/*
+	    The decoded ClassDef tables in a GPOS or GSUB table, keyed by their offset from the start of that table.
+	    Lookups frequently share ClassDefs (eg. all the kerning subtables might use the same one), so each table
+	    is only decoded once. Everything is decoded when the font is loaded, so after that the cache is only read.
+
+	    Decoded tables never move once they are in the cache, so it's safe to keep pointers to them.
+	*/
+	struct ClassDefCache
+	{
+		const uint8_t* table_start = nullptr;
+		std::unordered_map<size_t, ClassDef> tables;
+
+		// decode the given ClassDef table (or return the cached one)
+		const ClassDef& decode(zst::byte_span classdef_table);
+
+		// returns null if the table was not decoded yet.
+		const ClassDef* find(zst::byte_span classdef_table) const;
+	};
+
+	struct ContextualLookupRecord
+	{
+		uint16_t glyph_idx;
+		uint16_t lookup_idx;
+	};
+
+	/*
+	    GSUB lookups (and GPOS contextual lookups), compiled into native datastructures when the font is loaded.
+	    Walking the raw subtables (re-reading coverage formats and offsets) for every glyph of every word is slow,
+	    so it's done once here. Like the rest of the font, these are never modified after loading.
+
+	    Within a lookup, the subtables are tried in order and the first one that matches wins; the compiled
+	    forms preserve this order.
+	*/
+	struct CompiledContextRule
+	{
+		// glyph ids (format 1) or class ids (format 2). `input` includes the first glyph, and the lookbehind
+		// is in the same (reversed) order as in the font, so lookbehind[0] is the glyph just before the input.
+		std::vector<uint16_t> lookbehind;
+		std::vector<uint16_t> input;
+		std::vector<uint16_t> lookahead;
+
+		std::vector<ContextualLookupRecord> records;
+	};
+
+	struct CompiledContextSubtable
+	{
+		uint16_t format = 0;
+
+		// formats 1 and 2: the rules to try, keyed by the first glyph id (format 1) or its class (format 2).
+		std::unordered_map<uint16_t, std::vector<CompiledContextRule>> rule_sets;
+
+		// format 2 only: the first glyph must also be covered. The ClassDefs point into the table's
+		// ClassDefCache, and are null if the font didn't have one (then every glyph is in class 0).
+		std::unordered_set<GlyphId> coverage;
+		const ClassDef* lookbehind_classes = nullptr;
+		const ClassDef* input_classes = nullptr;
+		const ClassDef* lookahead_classes = nullptr;
+
+		// format 3 only: there's exactly one rule, where each glyph must be in the corresponding coverage table.
+		std::vector<std::unordered_set<GlyphId>> lookbehind_coverage;
+		std::vector<std::unordered_set<GlyphId>> input_coverage;
+		std::vector<std::unordered_set<GlyphId>> lookahead_coverage;
+		std::vector<ContextualLookupRecord> records;
+	};
+
+	/*
+	    Ligatures are stored as a trie keyed by the first glyph (one trie for each first glyph). Since the
+	    first ligature in the font's order wins (not the longest one), each ligature also records its position
+	    in that order; all the ligatures that could match lie on the path we walk, so we just pick the one with
+	    the lowest priority.
+	*/
+	struct LigatureTrieNode
+	{
+		static constexpr uint32_t NO_LIGATURE = UINT32_MAX;
+
+		std::vector<std::pair<GlyphId, uint32_t>> children;
+
+		GlyphId ligature = GlyphId::notdef;
+		uint32_t priority = NO_LIGATURE;
+	};
+
+	struct CompiledSubstLookup
+	{
+		uint16_t type = 0;
+
+		// LOOKUP_SINGLE and LOOKUP_MULTIPLE
+		std::unordered_map<GlyphId, GlyphId> single;
+		std::unordered_map<GlyphId, std::vector<GlyphId>> multiple;
+
+		// LOOKUP_LIGATURE; the roots are indices into `ligature_nodes`.
+		std::unordered_map<GlyphId, uint32_t> ligature_roots;
+		std::vector<LigatureTrieNode> ligature_nodes;
+
+		// LOOKUP_CONTEXTUAL and LOOKUP_CHAINING_CONTEXT
+		std::vector<CompiledContextSubtable> contexts;
+	};
+
+	/*
+	    GPOS pair adjustment (kerning) lookups are by far the most frequently used, so they are also compiled
+	    when the font is loaded. Format 2 (class-based) subtables become a glyph -> class array for each glyph
+	    of the pair, and a dense class x class matrix of adjustments, so a lookup is just a few array loads.
+	    Format 1 (glyph pair) subtables become a sparse map keyed by the glyph pair.
+	*/
+	struct CompiledPairSubtable
+	{
+		static constexpr uint16_t NO_CLASS = 0xFFFF;
+
+		uint16_t format = 0;
+
+		// the adjustment for the first (or second) glyph is only present if its ValueFormat is non-zero.
+		bool has_first_adjustment = false;
+		bool has_second_adjustment = false;
+
+		// format 1: (first << 16) | second -> adjustments, for every pair in the subtable.
+		std::unordered_map<uint32_t, std::pair<GlyphAdjustment, GlyphAdjustment>> pairs;
+
+		// format 2: indexed by glyph id. First glyphs that are not covered (or whose class is out of range) are
+		// NO_CLASS, as are second glyphs with out of range classes; glyphs past the end of the array are class 0.
+		std::vector<uint16_t> first_classes;
+		std::vector<uint16_t> second_classes;
+
+		// format 2: indexed by [first_class * num_second_classes + second_class]
+		uint16_t num_second_classes = 0;
+		std::vector<std::pair<GlyphAdjustment, GlyphAdjustment>> class_adjustments;
+	};
+
+	struct CompiledPosLookup
+	{
+		// LOOKUP_PAIR
+		std::vector<CompiledPairSubtable> pair_subtables;
+
+		// LOOKUP_CONTEXTUAL and LOOKUP_CHAINING_CONTEXT; these are compiled the same way as the GSUB ones.
+		std::vector<CompiledContextSubtable> contexts;
 	};
 
 	struct GPosTable
@@ -78,6 +413,10 @@ namespace font::off
 		std::map<Tag, Script> scripts;
 		std::vector<LookupTable> lookups;
 
+		// one for each entry in `lookups`
+		std::vector<CompiledPosLookup> compiled_lookups;
+		ClassDefCache classdefs;
+
 		std::optional<zst::byte_span> feature_variations_table;
 	};
 
@@ -88,6 +427,10 @@ namespace font::off
 		std::map<Tag, Script> scripts;
 		std::vector<LookupTable> lookups;
 
+		// one for each entry in `lookups`
+		std::vector<CompiledSubstLookup> compiled_lookups;
+		ClassDefCache classdefs;
+
 		std::optional<zst::byte_span> feature_variations_table;
 	};
 
@@ -100,69 +443,66 @@ namespace font::off
 		Tag script;
 		Tag language;
 		std::set<Tag> enabled_features {};
-	};
 
-	/*
-	    Using the GPOS table, try to look for positioning adjustments for the input glyph
-	    sequence, using the enabled features in the `feature_set`.
+		bool operator==(const FeatureSet&) const = default;
+	};
 
-	    The return type is a map of glyph index (of the input sequence) to a GlyphAdjustment,
-	    if that particular glyph needs to be adjusted. Only glyphs that need to be adjusted
-	    will be part of the map.
-	*/
-	std::map<size_t, GlyphAdjustment> getPositioningAdjustmentsForGlyphSequence(FontFile* font, zst::span<GlyphId> glyphs,
-		const FeatureSet& features);
+	struct FeatureSetHasher
+	{
+		size_t operator()(const FeatureSet& features) const
+		{
+			// FNV-1a, one tag at a time; the set is ordered, so equal sets hash the same.
+			uint64_t hash = 0xcbf29ce484222325;
+			auto mix = [&hash](Tag tag) {
+				hash = (hash ^ tag.value) * 0x100000001b3;
+			};
+
+			mix(features.script);
+			mix(features.language);
+			for(auto tag : features.enabled_features)
+				mix(tag);
+
+			return static_cast<size_t>(hash);
+		}
+	};
 
 	/*
-	    The result of performing (all required) glyph substitutions on a glyph string; contains
-	    the list of output glyph ids.
-
-	    There are also 3 maps present. For all of them, the key is always the *output* glyph, and
-	    the value is the *input* glyph.
-
-	    1. replacements -- a simple one->one mapping from output glyph to the original input glyph.
-	    2. contractions -- a one->many mapping from output glyph to the original input glyphs (ligatures)
-	    3. extra_glyphs -- see the long comment below on the one-to-many case.
-
-	    The intent of this is so that we can map the correct unicode codepoints to any substituted glyphs. For
-	    one-to-one mappings it's simple -- the output glyph has the same codepoint as the input glyph.
-
-	    For many-to-one it's also simple -- the output glyph is logically composed of the given list of inputs, so
-	    it represents a list of codepoints.
-
-	    The one-to-many case is tricky. For now, we make the assumption that the output glyphs are all present
-	    in the font's cmap. Otherwise, there is no way for us to know how to decompose a single glyph's codepoint
-	    into multiple codepoints. To account for this (ie. ensure that the cmap is emitted), we the last list
-	    is just a list of extra glyph ids to include.
+	    The GSUB and GPOS lookups to apply, in order, for one script, language and set of enabled features.
+	    Working these out means walking the script, language and feature lists of both tables, so plans are
+	    cached in the font (see `getShapePlan`); shaping a run then only needs one hash lookup to find its plan.
 	*/
-	struct SubstitutionMapping
+	struct ShapePlan
 	{
-		std::set<GlyphId> extra_glyphs;
-		std::map<GlyphId, GlyphId> replacements;
-		std::map<GlyphId, std::vector<GlyphId>> contractions;
+		std::vector<uint16_t> gsub_lookups;
+		std::vector<uint16_t> gpos_lookups;
 	};
 
-	struct SubstitutedGlyphString
-	{
-		std::vector<GlyphId> glyphs;
-		SubstitutionMapping mapping;
-	};
+	/*
+	    Get the shape plan for the feature set, creating (and caching) it if this is the first time the font
+	    is used with that feature set. The returned reference remains valid for the lifetime of the font.
+	    This is safe to call from multiple threads.
+	*/
+	const ShapePlan& getShapePlan(FontFile* font, const FeatureSet& features);
 
 	/*
-	    Using the GSUB table, perform glyph substitutions using the enabled features in the feature set.
+	    Using the GSUB table, perform glyph substitutions on the glyphs in the buffer, using the GSUB lookups
+	    in the shape plan. The buffer is modified in place.
+	*/
+	void performSubstitutionsForGlyphSequence(FontFile* font, GlyphBuffer& buffer, const ShapePlan& plan);
 
-	    For simplicity of use, this API returns a vector of glyphs, which *wholesale* replace the
-	    input glyph sequence -- even if no substitutions took place.
+	/*
+	    Using the GPOS table, apply the GPOS lookups in the shape plan to the glyphs in the buffer; the positioning
+	    adjustments are added to `buffer.adjustments`. This should be done after substitution.
 	*/
-	SubstitutedGlyphString performSubstitutionsForGlyphSequence(FontFile* font, zst::span<GlyphId> glyphs,
-		const FeatureSet& features);
+	void performPositioningForGlyphSequence(FontFile* font, GlyphBuffer& buffer, const ShapePlan& plan);
 
 
 	/*
-	    Parse the GPOS and GSUB tables from the OTF top-level Table.
+	    Parse the GPOS, GSUB and GDEF tables from the OTF top-level Table.
 	*/
 	void parseGPos(FontFile* font, const Table& gpos_table);
 	void parseGSub(FontFile* font, const Table& gsub_table);
+	void parseGDef(FontFile* font, const Table& gdef_table);
 
 
 
@@ -199,6 +539,12 @@ namespace font::off
 	*/
 	std::vector<LookupTable> parseLookupList(zst::byte_span buf);
 
+	/*
+	    Compute the digest of the glyphs that the lookup can start matching at. The offset of the coverage table
+	    depends on the lookup type, which means different things for GPOS and GSUB, hence `is_gsub`.
+	*/
+	GlyphSetDigest computeLookupDigest(const LookupTable& lookup, bool is_gsub);
+
 	/*
 	    Parse a "Tagged List" -- with the following layout:
 
@@ -238,6 +584,11 @@ namespace font::off
 	*/
 	std::map<GlyphId, int> parseGlyphToClassMapping(zst::byte_span classdef_table);
 
+	/*
+	    Decode the ClassDef table into a flat array; prefer using a ClassDefCache (which calls this) instead.
+	*/
+	ClassDef decodeClassDef(zst::byte_span classdef_table);
+
 	/*
 	    Returns the coverage index for the given glyphid within the given coverage table. Unlike classes,
 	    there is no "default" coverage index -- you just skip the lookup if the glyph is not in the
@@ -250,32 +601,26 @@ namespace font::off
 	*/
 	std::map<int, GlyphId> parseCoverageTable(zst::byte_span coverage_table);
 
-	struct ContextualLookupRecord
-	{
-		uint16_t glyph_idx;
-		uint16_t lookup_idx;
-	};
+	/*
+	    Compile a contextual (GPOS type 7, GSUB type 5) or chaining context (GPOS type 8, GSUB type 6) subtable;
+	    the data layouts for GPOS and GSUB are identical, so this is a common implementation. Any ClassDefs that
+	    the subtable uses are decoded into `classdefs`.
+	*/
+	std::optional<CompiledContextSubtable> compileContextSubtable(ClassDefCache& classdefs, zst::byte_span subtable,
+		bool chained);
 
 	/*
-	    Parse and match the input glyphstring with the lookup *subtable* provided. Again, this should be a
-	    lookup *subtable*, not the LookupTable itself.
+	    Match the glyphstring (where the current glyph is at glyphs[position]) against a compiled context subtable.
+	    For chained subtables, glyphs before `position` are the lookbehind, and the lookahead must fit in `glyphs`.
+	    Glyphs that `iter` skips are not matched against anything.
 
 	    Returns value:
 	        (first)  the list of lookup records, PosLookupRecord / SubstLookupRecord
-	        (second) the number of glyphs in the input glyphstring that were matched
-
-	    The data layouts for GPOS and GSUB are identical, so this is a common implementation. Use for GPOS type 7
-	    and GSUB type 5.
-	*/
-	std::optional<std::pair<std::vector<ContextualLookupRecord>, size_t>> performContextualLookup(zst::byte_span subtable,
-		zst::span<GlyphId> glyphs);
-
-	/*
-	    Parse and match the input glyphstring (where the current glyph is at glyphs[position], using the provided *subtable*.
-	    The same caveats apply as for `performContextualLookup`. Use for GPOS type 8 and GSUB type 6.
+	        (second) the number of glyphs spanned by the matched input sequence, including skipped glyphs
 	*/
-	std::optional<std::pair<std::vector<ContextualLookupRecord>, size_t>> performChainedContextLookup(zst::byte_span subtable,
-		zst::span<GlyphId> glyphs, size_t position);
+	std::optional<std::pair<const std::vector<ContextualLookupRecord>*, size_t>> matchContextSubtable(
+		const CompiledContextSubtable& subtable, bool chained, zst::span<GlyphId> glyphs, size_t position,
+		const SkippyIterator& iter);
 }
 
 
@@ -311,36 +656,13 @@ namespace font::off::gpos
 
 	    So, instead of returning an optional of pair, we return a pair of optionals.
 	*/
-	std::pair<OptionalGA, OptionalGA> lookupPairAdjustment(const LookupTable& lookup, GlyphId gid1, GlyphId gid2);
-
-
-	struct AdjustmentResult
-	{
-		size_t input_consumed;
-		std::map<size_t, GlyphAdjustment> adjustments;
-	};
-
-	/*
-	    Lookup contextual glyph adjustments (type 7, LOOKUP_CONTEXTUAL).
-
-	    This one needs to "recursively" perform lookups, so it needs the GPOS table as well. Returns a mapping
-	    from the index in the given sequence to the adjustment.
-	*/
-	std::optional<AdjustmentResult> lookupContextualPositioning(const GPosTable& gpos, const LookupTable& lookup,
-		zst::span<GlyphId> glyphs);
+	std::pair<OptionalGA, OptionalGA> lookupPairAdjustment(const CompiledPosLookup& lookup, GlyphId gid1, GlyphId gid2);
 
 	/*
-	    Lookup chained-context glyph adjustments (type 8, LOOKUP_CHAINING_CONTEXT).
-
-	    This one also needs to recursively perform lookups. Additionally, this requires both lookahead and lookbehind,
-	    so we take the *entire glyphstring*, as well as an index which is the position in the glyphstring that the
-	    'current' glyph is actually at.
-
-	    Again, similar to `lookupForGlyphSequence` (whose behaviour is actually motivated by this lookup type...),
-	    return[0] adjusts glyphs[position], return[1] adjsts glyphs[position + 1], etc.
+	    Compile a GPOS lookup (see CompiledPosLookup). This is done for every lookup when the font is loaded.
+	    Any ClassDefs that the lookup uses are decoded into `classdefs`.
 	*/
-	std::optional<AdjustmentResult> lookupChainedContextPositioning(const GPosTable& gpos, const LookupTable& lookup,
-		zst::span<GlyphId> glyphs, size_t position);
+	CompiledPosLookup compileLookup(ClassDefCache& classdefs, const LookupTable& lookup);
 }
 
 // declares GSUB-specific lookup functions
@@ -356,58 +678,34 @@ namespace font::off::gsub
 	constexpr uint16_t LOOKUP_REVERSE_CHAIN = 8;
 	constexpr uint16_t LOOKUP_MAX = 9;
 
+	/*
+	    Compile a GSUB lookup (see CompiledSubstLookup). This is done for every lookup when the font is loaded.
+	    Any ClassDefs that the lookup uses are decoded into `classdefs`.
+	*/
+	CompiledSubstLookup compileLookup(ClassDefCache& classdefs, const LookupTable& lookup);
+
 	/*
 	    Lookup a single substitution (type 1, LOOKUP_SINGLE); replaces one input glyph with one output glyph.
 	*/
-	std::optional<GlyphId> lookupSingleSubstitution(const LookupTable& lookup, GlyphId glyph);
+	std::optional<GlyphId> lookupSingleSubstitution(const CompiledSubstLookup& lookup, GlyphId glyph);
 
 	/*
 	    Lookup a multiple glyph substitution (type 2, LOOKUP_MULTIPLE). Replaces one input glyph with
 	    multiple output glyphs.
 	*/
-	std::optional<std::vector<GlyphId>> lookupMultipleSubstitution(const LookupTable& lookup, GlyphId glyph);
+	std::optional<zst::span<GlyphId>> lookupMultipleSubstitution(const CompiledSubstLookup& lookup, GlyphId glyph);
 
 	/*
 	    Lookup a ligature substitution (type 4, LOOKUP_LIGATURE). Replaces multiple input glyphs with
 	    a single output glyph.
 
-	    The given input stream should be from the current glyph till the end of the glyphstring.
-	    The return value is
+	    The given input stream should be from the current glyph till the end of the glyphstring. The components
+	    need not be adjacent; glyphs that `iter` skips can come between them. The return value is
 	        (first) the output glyph id
-	        (second) the number of input glyphs consumed.
-	*/
-	std::optional<std::pair<GlyphId, size_t>> lookupLigatureSubstitution(const LookupTable& lookup, zst::span<GlyphId> glyphs);
-
-
-	struct GlyphReplacement
-	{
-		size_t input_start;
-		size_t input_consumed;
-
-		std::vector<GlyphId> glyphs;
-		SubstitutionMapping mapping;
-	};
-
-	/*
-	    Lookup a contextual substitution (type 5, LOOKUP_CONTEXTUAL). Same semantics as GPOS contextual positioning.
-
-	    The returned result replaces glyphs from `glyphs[input_start]` to `glyphs[input_consumed - 1]`
-	    inclusive, with `result.glyphs`.
-	*/
-	std::optional<GlyphReplacement> lookupContextualSubstitution(const GSubTable& gsub, const LookupTable& lookup,
-		zst::span<GlyphId> glyphs);
-
-	/*
-	    Lookup a chaining context substitution (type 6, LOOKUP_CHAINING_CONTEXT). Same semantics as GPOS chaining-context
-	    positioning wrt. the `glyphs` and `position` values.
-
-	    The returned result (if it exists) replaces glyphs from
-	        `glyphs[input_start + position]` to `glyphs[input_start + position + input_consumed - 1]`
-
-	    inclusive, with `result.glyphs`.
+	        (second) the number of input glyphs spanned by the components, including skipped glyphs.
 	*/
-	std::optional<GlyphReplacement> lookupChainedContextSubstitution(const GSubTable& gsub, const LookupTable& lookup,
-		zst::span<GlyphId> glyphs, size_t position);
+	std::optional<std::pair<GlyphId, size_t>> lookupLigatureSubstitution(const CompiledSubstLookup& lookup,
+		zst::span<GlyphId> glyphs, const SkippyIterator& iter);
 }
 
 
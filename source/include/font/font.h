@@ -17,6 +17,7 @@
 
 #include "font/tag.h"
 #include "font/features.h"
+#include "font/glyph_set.h"
 
 namespace pdf
 {
@@ -91,12 +92,42 @@ namespace font
 		std::unordered_map<GlyphId, Codepoint> reverse;
 	};
 
+	/*
+	    A coarse summary of the codepoints that a font covers, with one bit for each "page" of 256
+	    codepoints (so 4352 bits for all of unicode). This is enough to quickly rule out fonts that
+	    definitely cannot render a codepoint, without touching the font's cmap.
+	*/
+	struct CoverageSummary
+	{
+		static constexpr size_t PAGE_SIZE = 256;
+		static constexpr size_t NUM_PAGES = 0x110000 / PAGE_SIZE;
+		static constexpr size_t NUM_WORDS = NUM_PAGES / 64;
+
+		uint64_t words[NUM_WORDS] {};
+
+		inline void add(Codepoint cp)
+		{
+			auto page = static_cast<uint32_t>(cp) / PAGE_SIZE;
+			if(page < NUM_PAGES)
+				words[page / 64] |= (1ull << (page % 64));
+		}
+
+		inline bool mayContain(Codepoint cp) const
+		{
+			auto page = static_cast<uint32_t>(cp) / PAGE_SIZE;
+			return page < NUM_PAGES && (words[page / 64] & (1ull << (page % 64)));
+		}
+	};
+
 	using KerningPair = std::pair<GlyphAdjustment, GlyphAdjustment>;
 
+	struct FontCollection;
+
 	// TODO: clean up this entire struct
 	struct FontFile
 	{
-		static FontFile* parseFromFile(const std::string& path);
+		// for font collections (ttc/otc), `face_index` selects the face; it must be 0 for single fonts.
+		static FontFile* parseFromFile(const std::string& path, size_t face_index = 0);
 
 		GlyphId getGlyphIndexForCodepoint(Codepoint codepoint) const;
 		GlyphMetrics getGlyphMetrics(GlyphId glyphId) const;
@@ -123,10 +154,18 @@ namespace font
 		size_t num_hmetrics = 0;
 		zst::byte_span hmtx_table {};
 
+		// the hmtx table decoded to native endianness: `num_hmetrics` pairs of (advance, lsb),
+		// followed by the lsbs for the remaining glyphs.
+		std::vector<uint16_t> hmtx_values {};
+
 		size_t num_glyphs = 0;
 
 		off::GPosTable gpos_table {};
 		off::GSubTable gsub_table {};
+		off::GDefTable gdef_table {};
+
+		// shape plans for every feature set that this font was used with; see `off::getShapePlan`.
+		std::unordered_map<off::FeatureSet, off::ShapePlan, off::FeatureSetHasher> shape_plans {};
 
 
 		int font_type = 0;
@@ -137,6 +176,9 @@ namespace font
 
 		CharacterMapping character_mapping {};
 
+		// which pages of unicode the cmap has any glyphs for; filled in together with `character_mapping`.
+		CoverageSummary coverage {};
+
 		FontMetrics metrics {};
 
 		// only valid if outline_type == OUTLINES_TRUETYPE
@@ -149,14 +191,64 @@ namespace font
 		uint8_t* file_bytes = nullptr;
 		size_t file_size = 0;
 
+		// if this font came from a collection; file_bytes then refers to the entire collection file.
+		FontCollection* collection = nullptr;
+		size_t face_index = 0;
+
 		static constexpr int TYPE_OPEN_FONT = 1;
 
 		static constexpr int OUTLINES_TRUETYPE = 1;
 		static constexpr int OUTLINES_CFF = 2;
 	};
 
+	/*
+	    A TrueType/OpenType font collection (ttc/otc). All faces share one mapping of the file, and faces are
+	    only parsed when they are first requested. Tables that are shared between faces (usually the glyf/loca
+	    or CFF outlines, which make up most of the file) are only decoded once.
+	*/
+	struct FontCollection
+	{
+		static FontCollection* parseFromFile(const std::string& path);
+
+		size_t numFaces() const { return face_offsets.size(); }
+		FontFile* getFace(size_t face_index);
+
+		std::string path;
+
+		uint8_t* file_bytes = nullptr;
+		size_t file_size = 0;
+
+		// offsets of the table directory for each face
+		std::vector<uint32_t> face_offsets {};
+		std::vector<FontFile*> faces {};
+
+		/*
+		    TrueType glyphs are decoded from both the `glyf` and `loca` tables, so faces can only share them if they
+		    use the same two tables, with the same loca format and number of glyphs.
+		*/
+		struct TrueTypeDataKey
+		{
+			uint32_t glyf_offset;
+			uint32_t loca_offset;
+			uint16_t loca_format;
+			uint16_t num_glyphs;
+
+			auto operator<=>(const TrueTypeDataKey&) const = default;
+		};
+
+		// decoded outline data; the CFF data is keyed by the file offset of the `CFF ` table.
+		std::map<TrueTypeDataKey, truetype::TTData*> shared_truetype_data {};
+		std::unordered_map<uint32_t, cff::CFFData*> shared_cff_data {};
+	};
+
+	/*
+	    Write a subset of the font, containing only the `used_glyphs`, to the stream. If `cid_to_gid_map` is
+	    given (and the font has TrueType outlines), the glyphs are renumbered so that the subset only contains
+	    the glyphs that are used; the original glyph ids are the CIDs, so the mapping from them to the new
+	    glyph ids is written to `cid_to_gid_map` as the contents of a /CIDToGIDMap stream.
+	*/
 	void writeFontSubset(FontFile* font, zst::str_view subset_name, pdf::Stream* stream,
-		const std::unordered_set<GlyphId>& used_glyphs);
+		const GlyphSet& used_glyphs, pdf::Stream* cid_to_gid_map = nullptr);
 
 	CharacterMapping readCMapTable(zst::byte_span table);
 
@@ -169,4 +261,64 @@ namespace font
 	int16_t consume_i16(zst::byte_span& s);
 	uint32_t consume_u24(zst::byte_span& s);
 	uint32_t consume_u32(zst::byte_span& s);
+
+	/*
+	    Decode `count` big-endian integers from `src` into the native array `dst`. The byte swapping
+	    is done in bulk (vectorised where possible), so prefer this over calling `consume_u16` in a loop.
+	    `src` must contain at least `count` elements.
+	*/
+	void decode_u16_array(uint16_t* dst, zst::byte_span src, size_t count);
+	void decode_u32_array(uint32_t* dst, zst::byte_span src, size_t count);
+
+	/*
+	    A view over an array of big-endian integers in the font file. The length is checked once, when the
+	    view is created with `consume_u16_array` or `consume_u32_array`, so element accesses are not checked.
+	*/
+	template <typename T>
+	struct BigEndianArray
+	{
+		static_assert(sizeof(T) == 2 || sizeof(T) == 4);
+
+		BigEndianArray() = default;
+		BigEndianArray(const uint8_t* ptr, size_t count) : m_ptr(ptr), m_count(count) { }
+
+		size_t size() const { return m_count; }
+		zst::byte_span bytes() const { return zst::byte_span(m_ptr, m_count * sizeof(T)); }
+
+		T operator[](size_t idx) const
+		{
+			T value;
+			__builtin_memcpy(&value, m_ptr + idx * sizeof(T), sizeof(T));
+
+			if constexpr (sizeof(T) == 2)
+				return static_cast<T>(__builtin_bswap16(value));
+			else
+				return static_cast<T>(__builtin_bswap32(value));
+		}
+
+		void decodeInto(T* dst) const
+		{
+			if constexpr (sizeof(T) == 2)
+				decode_u16_array(reinterpret_cast<uint16_t*>(dst), this->bytes(), m_count);
+			else
+				decode_u32_array(reinterpret_cast<uint32_t*>(dst), this->bytes(), m_count);
+		}
+
+		std::vector<T> decode() const
+		{
+			std::vector<T> ret(m_count);
+			this->decodeInto(ret.data());
+			return ret;
+		}
+
+	private:
+		const uint8_t* m_ptr = nullptr;
+		size_t m_count = 0;
+	};
+
+	/*
+	    Consume `count` elements from the span as a checked view; errors out if the span is too short.
+	*/
+	BigEndianArray<uint16_t> consume_u16_array(zst::byte_span& s, size_t count);
+	BigEndianArray<uint32_t> consume_u32_array(zst::byte_span& s, size_t count);
 }
@@ -0,0 +1,111 @@
+// glyph_set.h
+// Copyright (c) 2022, zhiayang
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <bit>
+#include <atomic>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "types.h"
+
+namespace font
+{
+	/*
+	    A set of glyph ids in one font, as a bitset with one bit for each glyph in the font. This is used to
+	    keep track of the glyphs that are used (and so need to be in the subset); glyphs are added as text is
+	    shaped, possibly from several threads at once, so adding is atomic (and lock-free). Reading the set
+	    (iterating, `contains`) while glyphs are still being added is allowed, but might not see the new ones.
+
+	    Iterating gives the glyph ids in increasing order. The bits are stored from the lowest glyph id in the
+	    least significant bit of the first word.
+	*/
+	struct GlyphSet
+	{
+		static constexpr size_t BITS_PER_WORD = 64;
+
+		GlyphSet() = default;
+		explicit GlyphSet(size_t num_glyphs)
+			: m_num_glyphs(num_glyphs), m_words((num_glyphs + BITS_PER_WORD - 1) / BITS_PER_WORD)
+		{
+		}
+
+		inline void add(GlyphId gid)
+		{
+			auto idx = static_cast<uint32_t>(gid);
+			if(idx < m_num_glyphs)
+				m_words[idx / BITS_PER_WORD].fetch_or(uint64_t(1) << (idx % BITS_PER_WORD), std::memory_order_relaxed);
+		}
+
+		inline bool contains(GlyphId gid) const
+		{
+			auto idx = static_cast<uint32_t>(gid);
+			if(idx >= m_num_glyphs)
+				return false;
+
+			return m_words[idx / BITS_PER_WORD].load(std::memory_order_relaxed) & (uint64_t(1) << (idx % BITS_PER_WORD));
+		}
+
+		inline size_t size() const
+		{
+			size_t count = 0;
+			for(auto& word : m_words)
+				count += static_cast<size_t>(std::popcount(word.load(std::memory_order_relaxed)));
+
+			return count;
+		}
+
+		// the number of glyphs in the font, ie. one more than the largest glyph id that can be in the set.
+		inline size_t capacity() const { return m_num_glyphs; }
+
+		inline size_t numWords() const { return m_words.size(); }
+		inline uint64_t word(size_t i) const { return m_words[i].load(std::memory_order_relaxed); }
+
+		struct iterator
+		{
+			inline GlyphId operator*() const { return GlyphId { static_cast<uint32_t>(m_idx) }; }
+			inline bool operator==(const iterator& other) const { return m_idx == other.m_idx; }
+
+			inline iterator& operator++()
+			{
+				m_idx = m_set->find_next(m_idx + 1);
+				return *this;
+			}
+
+		private:
+			inline iterator(const GlyphSet* set, size_t idx) : m_set(set), m_idx(idx) { }
+
+			const GlyphSet* m_set;
+			size_t m_idx;
+
+			friend struct GlyphSet;
+		};
+
+		inline iterator begin() const { return iterator(this, this->find_next(0)); }
+		inline iterator end() const { return iterator(this, m_num_glyphs); }
+
+	private:
+		// the first glyph id >= `idx` that is in the set, or `m_num_glyphs` if there is none.
+		inline size_t find_next(size_t idx) const
+		{
+			for(size_t w = idx / BITS_PER_WORD; w < m_words.size(); w++)
+			{
+				auto bits = m_words[w].load(std::memory_order_relaxed);
+				if(w == idx / BITS_PER_WORD)
+					bits &= ~uint64_t(0) << (idx % BITS_PER_WORD);
+
+				if(bits != 0)
+					return w * BITS_PER_WORD + static_cast<size_t>(std::countr_zero(bits));
+			}
+
+			return m_num_glyphs;
+		}
+
+		size_t m_num_glyphs = 0;
+		std::vector<std::atomic<uint64_t>> m_words {};
+	};
+}
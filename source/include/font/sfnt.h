@@ -0,0 +1,40 @@
+// sfnt.h
+// Copyright (c) 2022, zhiayang
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <vector>
+#include <utility>
+
+#include <zst.h>
+
+#include "font/tag.h"
+
+namespace font
+{
+	/*
+	    Writes an OpenType (sfnt) font file from a list of tables: the table directory, then the tables themselves,
+	    each starting on a 4-byte boundary and padded with zeroes. The checksums in the directory are computed from
+	    the table contents, and if there is a `head` table, its checkSumAdjustment is recomputed for the new file.
+	*/
+	struct SfntWriter
+	{
+		static constexpr uint32_t VERSION_TRUETYPE = 0x00010000;
+		static constexpr uint32_t VERSION_CFF = 0x4F54544F; // 'OTTO'
+
+		explicit SfntWriter(uint32_t sfnt_version) : m_sfnt_version(sfnt_version) { }
+
+		// the contents are not copied until `write` is called, so they must outlive the writer.
+		void addTable(const Tag& tag, zst::byte_span contents);
+
+		zst::byte_buffer write() const;
+
+	private:
+		uint32_t m_sfnt_version;
+		std::vector<std::pair<Tag, zst::byte_span>> m_tables {};
+	};
+
+	// the sum of the big-endian u32s in `data`, as if it were padded with zeroes to a multiple of 4 bytes.
+	uint32_t computeChecksum(zst::byte_span data);
+}
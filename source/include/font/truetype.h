@@ -5,9 +5,12 @@
 #pragma once
 
 #include <zst.h>
+#include <map>
 #include <utility>
 #include <unordered_set>
 
+#include "font/glyph_set.h"
+
 namespace font
 {
 	struct FontFile;
@@ -44,6 +47,18 @@ namespace font::truetype
 	{
 		zst::byte_buffer loca_table {};
 		zst::byte_buffer glyf_table {};
+		zst::byte_buffer cmap_table {};
+		zst::byte_buffer name_table {};
+		zst::byte_buffer post_table {};
+
+		// these are only filled in for compact subsets; otherwise, the original tables can be used as-is.
+		zst::byte_buffer hmtx_table {};
+		zst::byte_buffer hhea_table {};
+		zst::byte_buffer maxp_table {};
+
+		// the glyph id of each glyph in the subset, keyed by the original glyph id. unless the subset is
+		// compact, these are the same.
+		std::map<uint16_t, uint16_t> new_glyph_ids {};
 	};
 
 	/*
@@ -62,7 +77,22 @@ namespace font::truetype
 	BoundingBox getGlyphBoundingBox(TTData* tt, GlyphId glyph_id);
 
 	/*
-	    Subset the glyphs in the original loca/glyf tables based on the provided `used_glyphs`.
+	    Subset the glyphs in the original loca/glyf tables based on the provided `used_glyphs` (and the
+	    components of any composite glyphs among them).
+
+	    Normally the glyph ids are kept, so the loca table still has an entry for every glyph in the font. If
+	    `compact` is true, the glyphs in the subset are renumbered densely (in their original order, so .notdef
+	    stays at 0), and the composite glyphs are rewritten to refer to the new ids. The tables that have an
+	    entry for each glyph (hmtx) or the number of glyphs (hhea, maxp) are rewritten to match.
+
+	    In both cases, the cmap only maps to glyphs in the subset, the glyph names in post are dropped, and
+	    only the names that identify the font are kept.
+	*/
+	TTSubset createTTSubset(FontFile* font, const GlyphSet& used_glyphs, bool compact);
+
+	/*
+	    Create a cmap table with a Windows format 4 subtable (and a format 12 one if needed) that maps the
+	    codepoints of the glyphs in `new_glyph_ids` (keyed by the original glyph id) to their new glyph ids.
 	*/
-	TTSubset createTTSubset(FontFile* font, const std::unordered_set<GlyphId>& used_glyphs);
+	zst::byte_buffer createCMapSubset(FontFile* font, const std::map<uint16_t, uint16_t>& new_glyph_ids);
 }
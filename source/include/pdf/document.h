@@ -42,6 +42,8 @@ namespace pdf
 
 		size_t current_font_number = 0;
 		Dictionary* createPageTree();
+
+		void finaliseFonts();
 	};
 
 
@@ -6,6 +6,7 @@
 
 #include <set>
 #include <map>
+#include <mutex>
 #include <unordered_set>
 
 #include <zst.h>
@@ -14,24 +15,41 @@
 
 #include "pdf/units.h"
 #include "font/font.h"
+#include "font/glyph_set.h"
 
 namespace pdf
 {
-	struct Array;
 	struct Stream;
 	struct Document;
+	struct RawObject;
 	struct Dictionary;
 
+	namespace standard_fonts
+	{
+		struct FontMetrics;
+	}
+
 	// PDF 1.7: 9.2.4 Glyph Positioning and Metrics
 	// ... the units of glyph space are one-thousandth of a unit of text space ...
 	static constexpr double GLYPH_SPACE_UNITS = 1000.0;
 
 	struct Font
 	{
+		// this only returns the (indirect) font dictionary, so it is called for every page that uses the font.
 		Dictionary* serialise(Document* doc) const;
 
+		/*
+		    Write the parts of an embedded font that depend on the glyphs that were used -- the widths, the subset,
+		    the ToUnicode cmap, and the CIDSet. This must be called once, after all the pages are serialised. The
+		    Document finalises all of its fonts concurrently, so this only fills in streams that already exist.
+		*/
+		void finalise(Document* doc) const;
+
 		GlyphId getGlyphIdFromCodepoint(Codepoint codepoint) const;
 
+		// unlike getGlyphIdFromCodepoint, this does not warn (or mark anything as used)
+		bool hasGlyphForCodepoint(Codepoint codepoint) const;
+
 		void markGlyphAsUsed(GlyphId glyph) const;
 
 		font::GlyphMetrics getMetricsForGlyph(GlyphId glyph) const;
@@ -54,13 +72,13 @@ namespace pdf
 		Scalar scaleMetricForPDFTextSpace(double metric) const;
 
 		/*
-		    A very thin wrapper around the identically-named methods taking a FontFile
+		    A very thin wrapper around the identically-named methods taking a FontFile. Get the plan once
+		    (for each run of text) with `getShapePlan`, and use it for both substitution and positioning.
 		*/
-		std::map<size_t, font::GlyphAdjustment> getPositioningAdjustmentsForGlyphSequence(zst::span<GlyphId> glyphs,
-			const font::off::FeatureSet& features) const;
+		const font::off::ShapePlan& getShapePlan(const font::off::FeatureSet& features) const;
 
-		std::vector<GlyphId> performSubstitutionsForGlyphSequence(zst::span<GlyphId> glyphs,
-			const font::off::FeatureSet& features) const;
+		void performSubstitutionsForGlyphSequence(font::GlyphBuffer& buffer, const font::off::ShapePlan& plan) const;
+		void performPositioningForGlyphSequence(font::GlyphBuffer& buffer, const font::off::ShapePlan& plan) const;
 
 
 		int font_type = 0;
@@ -83,28 +101,78 @@ namespace pdf
 
 		void writeUnicodeCMap(Document* doc) const;
 		void writeCIDSet(Document* doc) const;
+		void writeGlyphWidths(Document* doc) const;
+
+		// glyphs are marked as used all the time while shaping, so this is a bitset that can be added to atomically.
+		mutable font::GlyphSet m_used_glyphs {};
+
+		/*
+		    Words are shaped concurrently before layout (see `LayoutObject::prepareLayout`), so the state below
+		    is guarded by `m_mutex` while shaping. Serialising the font happens after all of that is done, so it
+		    reads these without locking.
+		*/
+		mutable std::mutex m_mutex {};
 
-		mutable std::unordered_set<GlyphId> m_used_glyphs {};
 		mutable std::map<GlyphId, font::GlyphMetrics> m_glyph_metrics {};
 		mutable std::map<GlyphId, std::vector<Codepoint>> m_extra_unicode_mappings {};
 
+		// codepoints that we already warned about, so that we only warn once for each.
+		mutable std::unordered_set<Codepoint> m_missing_codepoints {};
+
 		// the name that goes into the Resource << >> dict in a page. This is a unique name
 		// that we get from the Document when the font is created.
 		std::string font_resource_name {};
 
+		// only used for the builtin (standard 14) fonts
+		const standard_fonts::FontMetrics* builtin_metrics = 0;
+
 		// only used for embedded fonts
 		font::FontFile* source_file = 0;
-		Array* glyph_widths_array = 0;
+		RawObject* glyph_widths_array = 0;
 
 		Stream* embedded_contents = 0;
 		Stream* unicode_cmap = 0;
 		Stream* cidset = 0;
 
+		// only for truetype fonts; their subsets are compacted, so CIDs (the original glyph ids) need to be mapped.
+		Stream* cid_to_gid_map = 0;
+
 		// what goes in BaseName. for subsets, this includes the ABCDEF+ part.
 		std::string pdf_font_name;
 
+		// the font stack builds its coverage index straight from the cmap
+		friend struct FontStack;
+
 		// pool needs to be a friend because it needs the constructor
 		template <typename>
 		friend struct util::Pool;
 	};
+
+
+	/*
+	    A list of fonts, in order of preference, used for fallback when a font does not have a glyph for some
+	    codepoint. Since we need to ask "which is the first font that can render U+XXXX" for (potentially) every
+	    character, the answer is precomputed for all codepoints that any of the fonts cover.
+
+	    The index is two-level, like the unicode property tables: a page directory with one entry for each page
+	    of 256 codepoints, pointing to a block of 256 font indices. Pages that no font covers share a single
+	    empty block, so the whole thing is only as large as the number of distinct pages the fonts cover.
+	*/
+	struct FontStack
+	{
+		explicit FontStack(std::vector<const Font*> fonts);
+
+		// returns the first font in the stack that has a glyph for the codepoint, or null if none of them do.
+		const Font* fontForCodepoint(Codepoint codepoint) const;
+
+		const std::vector<const Font*>& fonts() const { return m_fonts; }
+
+	private:
+		static constexpr uint8_t NO_FONT = 0xFF;
+
+		std::vector<const Font*> m_fonts {};
+
+		std::vector<uint16_t> m_page_directory {};
+		std::vector<uint8_t> m_blocks {};
+	};
 }
@@ -169,6 +169,10 @@ namespace pdf
 
 		void setCompressed(bool compressed);
 
+		/*
+		    For a compressed stream, every append flushes the compressor (TDEFL_SYNC_FLUSH), which is slow and makes
+		    the output bigger. Build up data that is written in many small pieces first, and append it all at once.
+		*/
 		void append(zst::str_view xs);
 		void append(zst::byte_span xs);
 		void append(const uint8_t* arr, size_t num);
@@ -219,6 +223,22 @@ namespace pdf
 		static Null* get();
 	};
 
+	/*
+	    An object that was already serialised to text, which is written out as-is. This is for big objects (eg. the
+	    widths array of a font) where creating an Object for every element would be a waste.
+	*/
+	struct RawObject : Object
+	{
+		explicit RawObject(std::string contents) : contents(std::move(contents)) { }
+
+		virtual void writeFull(Writer* w) const override;
+
+		static RawObject* create(std::string contents);
+		static RawObject* createIndirect(Document* doc, std::string contents);
+
+		std::string contents;
+	};
+
 
 
 
@@ -22,6 +22,7 @@ namespace pdf
 		Dictionary* serialise(Document* doc) const;
 
 		void useFont(const Font* font) const;
+		const std::vector<const Font*>& usedFonts() const { return this->fonts; }
 		void addObject(PageObject* obj);
 
 		Size2d size() const;
@@ -0,0 +1,65 @@
+// standard_fonts.h
+// Copyright (c) 2022, zhiayang
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <zst.h>
+
+namespace pdf::standard_fonts
+{
+	// in font units (1000 per em), like the AFM files.
+	struct GlyphMetrics
+	{
+		int16_t advance;
+		int16_t xmin;
+		int16_t ymin;
+		int16_t xmax;
+		int16_t ymax;
+	};
+
+	struct KerningPair
+	{
+		uint8_t left;
+		uint8_t right;
+		int16_t kern;
+	};
+
+	/*
+	    The metrics of one of the 14 standard fonts (PDF 1.7: 9.6.2.2 Standard Type 1 Fonts), which viewers must
+	    provide themselves. These are compiled in (see standard_fonts.cpp), so using the fonts doesn't need any
+	    font files. The glyphs (and kerning pairs) are indexed by WinAnsiEncoding code.
+	*/
+	struct FontMetrics
+	{
+		const char* name;
+
+		int16_t xmin;
+		int16_t ymin;
+		int16_t xmax;
+		int16_t ymax;
+
+		int16_t ascent;
+		int16_t descent;
+		int16_t cap_height;
+		int16_t x_height;
+
+		double italic_angle;
+		bool is_monospaced;
+
+		// always 256 entries
+		const GlyphMetrics* glyphs;
+
+		// sorted by (left, right)
+		const KerningPair* kerning_pairs = nullptr;
+		size_t num_kerning_pairs = 0;
+
+		int16_t getKerning(uint8_t left, uint8_t right) const;
+	};
+
+	// returns null if `name` is not one of the standard fonts.
+	const FontMetrics* find(zst::str_view name);
+}
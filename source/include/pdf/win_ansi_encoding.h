@@ -4,52 +4,90 @@
 
 #pragma once
 
-#include <map>
+#include <array>
 
 #include "types.h"
 
 namespace pdf::encoding
 {
-	static inline uint8_t WIN_ANSI(Codepoint cp)
+	namespace detail
 	{
-		static std::map<Codepoint, uint8_t> cmap;
-		if(cmap.empty())
+		struct WinAnsiEntry
 		{
-			for(uint32_t i = 0; i < 128; i++)
-				cmap[Codepoint { i }] = i;
-
-			cmap[0x20ac_codepoint] = 128;
-			cmap[0x201a_codepoint] = 130;
-			cmap[0x0192_codepoint] = 131;
-			cmap[0x201e_codepoint] = 132;
-			cmap[0x2026_codepoint] = 133;
-			cmap[0x2020_codepoint] = 134;
-			cmap[0x2021_codepoint] = 135;
-			cmap[0x02c6_codepoint] = 136;
-			cmap[0x2030_codepoint] = 137;
-			cmap[0x0160_codepoint] = 138;
-			cmap[0x2039_codepoint] = 139;
-			cmap[0x0152_codepoint] = 140;
-			cmap[0x017d_codepoint] = 142;
-			cmap[0x2018_codepoint] = 145;
-			cmap[0x2019_codepoint] = 146;
-			cmap[0x201c_codepoint] = 147;
-			cmap[0x201d_codepoint] = 148;
-			cmap[0x2022_codepoint] = 149;
-			cmap[0x2013_codepoint] = 150;
-			cmap[0x2014_codepoint] = 151;
-			cmap[0x02dc_codepoint] = 152;
-			cmap[0x2122_codepoint] = 153;
-			cmap[0x0161_codepoint] = 154;
-			cmap[0x203a_codepoint] = 155;
-			cmap[0x0153_codepoint] = 156;
-			cmap[0x017e_codepoint] = 158;
-			cmap[0x0178_codepoint] = 159;
-
-			for(uint32_t i = 0xa0; i <= 0xff; i++)
-				cmap[Codepoint { i }] = i;
+			uint32_t codepoint;
+			uint8_t code;
+		};
+
+		// everything in ASCII and in 0xA0-0xFF maps to itself; these are the codes in 0x80-0x9F.
+		constexpr WinAnsiEntry WIN_ANSI_EXTRA_CODES[] = {
+			{ 0x20ac, 128 }, { 0x201a, 130 }, { 0x0192, 131 }, { 0x201e, 132 }, { 0x2026, 133 }, { 0x2020, 134 },
+			{ 0x2021, 135 }, { 0x02c6, 136 }, { 0x2030, 137 }, { 0x0160, 138 }, { 0x2039, 139 }, { 0x0152, 140 },
+			{ 0x017d, 142 }, { 0x2018, 145 }, { 0x2019, 146 }, { 0x201c, 147 }, { 0x201d, 148 }, { 0x2022, 149 },
+			{ 0x2013, 150 }, { 0x2014, 151 }, { 0x02dc, 152 }, { 0x2122, 153 }, { 0x0161, 154 }, { 0x203a, 155 },
+			{ 0x0153, 156 }, { 0x017e, 158 }, { 0x0178, 159 },
+		};
+
+		/*
+		    A perfect hash for the codepoints above: the top bits of (codepoint * multiplier), for a multiplier
+		    where none of them collide. The multiplier is found (and the table is built) at compile time.
+		*/
+		constexpr size_t WIN_ANSI_HASH_BITS = 6;
+
+		constexpr size_t win_ansi_hash(uint32_t codepoint, uint32_t multiplier)
+		{
+			return static_cast<uint32_t>(codepoint * multiplier) >> (32 - WIN_ANSI_HASH_BITS);
 		}
 
-		return cmap[cp];
+		constexpr uint32_t find_win_ansi_multiplier()
+		{
+			for(uint32_t k = 1; k < 1000; k++)
+			{
+				// multiples of the golden ratio (in 32-bit fixed point) spread the bits well.
+				auto multiplier = static_cast<uint32_t>(k * 0x9E3779B9u);
+
+				bool used[1 << WIN_ANSI_HASH_BITS] {};
+				bool collided = false;
+				for(auto& entry : WIN_ANSI_EXTRA_CODES)
+				{
+					auto slot = win_ansi_hash(entry.codepoint, multiplier);
+					collided |= used[slot];
+					used[slot] = true;
+				}
+
+				if(not collided)
+					return multiplier;
+			}
+
+			return 0;
+		}
+
+		constexpr uint32_t WIN_ANSI_MULTIPLIER = find_win_ansi_multiplier();
+		static_assert(WIN_ANSI_MULTIPLIER != 0, "no perfect hash for the WinAnsi codepoints");
+
+		constexpr auto WIN_ANSI_HASH_TABLE = []() {
+			// empty slots have codepoint 0, which never reaches the table.
+			std::array<WinAnsiEntry, (1 << WIN_ANSI_HASH_BITS)> table {};
+			for(auto& entry : WIN_ANSI_EXTRA_CODES)
+				table[win_ansi_hash(entry.codepoint, WIN_ANSI_MULTIPLIER)] = entry;
+
+			return table;
+		}();
+	}
+
+	// returns 0 if the codepoint is not in WinAnsiEncoding.
+	constexpr uint8_t WIN_ANSI(Codepoint cp)
+	{
+		auto x = static_cast<uint32_t>(cp);
+		if(x < 0x80 || (0xA0 <= x && x <= 0xFF))
+			return static_cast<uint8_t>(x);
+
+		auto& entry = detail::WIN_ANSI_HASH_TABLE[detail::win_ansi_hash(x, detail::WIN_ANSI_MULTIPLIER)];
+		return entry.codepoint == x ? entry.code : 0;
 	}
+
+	static_assert(WIN_ANSI(Codepoint { 'A' }) == 'A');
+	static_assert(WIN_ANSI(0x20ac_codepoint) == 128);
+	static_assert(WIN_ANSI(0x0178_codepoint) == 159);
+	static_assert(WIN_ANSI(0x0080_codepoint) == 0);
+	static_assert(WIN_ANSI(0x4e00_codepoint) == 0);
 }
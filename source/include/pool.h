@@ -8,6 +8,8 @@
 #include <cstdlib>
 #include <cstddef>
 
+#include <mutex>
+
 #include "error.h"
 
 namespace util
@@ -62,6 +64,21 @@ namespace util
 
 		template <typename... Args>
 		T* allocate(Args&&... args)
+		{
+			// objects are allocated from the worker threads during layout, so bumping the region needs a lock.
+			// the object itself can be constructed outside of it.
+			uint8_t* mem = nullptr;
+			{
+				std::lock_guard lock(this->mutex);
+				mem = this->allocate_memory();
+			}
+
+			return new(mem) T(static_cast<Args&&>(args)...);
+		}
+
+
+	private:
+		uint8_t* allocate_memory()
 		{
 			if(!this->region)
 				this->region = new Region(REGION_SIZE, nullptr);
@@ -79,12 +96,11 @@ namespace util
 			auto mem = head->memory + head->consumed;
 			head->consumed += sizeof(T);
 
-			return new(mem) T(static_cast<Args&&>(args)...);
+			return mem;
 		}
 
-
-	private:
 		Region* region = 0;
+		std::mutex mutex {};
 	};
 
 	template <typename T, typename... Args>
@@ -105,6 +105,16 @@ namespace sap::layout
 
 		inline void setParent(LayoutObject* parent) { m_parent = parent; }
 
+		/*
+		    Do the part of the layout that does not depend on where the object is placed (eg. shaping and
+		    measuring text), using the `parent_style` as a fallback style. The document calls this on all its
+		    objects *concurrently*, before laying them out one by one; so this must only touch the object itself,
+		    and shared state that is thread-safe (eg. fonts).
+
+		    This is optional; `layout()` must still work if it was not called.
+		*/
+		virtual void prepareLayout(const Style* parent_style) { }
+
 		/*
 		    Place (lay out) the object into the given region, using the `parent_style` as a fallback style
 		    if necessary during the layout process.
@@ -209,8 +219,15 @@ namespace sap::layout
 		inline Word(int kind, zst::str_view sv) : Word(kind, sv.str()) { }
 		inline Word(int kind, std::string str) : kind(kind), text(std::move(str)) { }
 
-		// this fills in the `size` and the `glyphs`
-		void computeMetrics(const Style* parent_style);
+		/*
+		    resolve the styles of the words (forwarding `parent_style` down to them), and shape them. Consecutive
+		    words with the same fonts and font size are shaped together as one run of text (with spaces between
+		    them), so that kerning between the words and the spaces is accounted for.
+		*/
+		static void shapeWords(std::vector<Word>& words, const Style* parent_style);
+
+		// this fills in the `size`; the word must already have been shaped with `shapeWords`.
+		void computeMetrics();
 
 		/*
 		    this assumes that the container (typically a paragraph) has already moved the PDF cursor (ie. wrote
@@ -220,8 +237,9 @@ namespace sap::layout
 		void render(pdf::Text* text) const;
 
 		/*
-		    returns the width of a space in the font used by this word. This information is only available
-		    after `computeMetrics()` is called. Otherwise, it returns 0.
+		    returns the width of the space after this word (in the font used by this word), including any kerning
+		    with the glyphs around it. This information is only available after `computeMetrics()` is called.
+		    Otherwise, it returns 0.
 		*/
 		Scalar spaceWidth() const;
 
@@ -245,11 +263,32 @@ namespace sap::layout
 			font::GlyphAdjustment adjustments;
 		};
 
+		// a run of consecutive glyphs that all come from the same font; a word only has more than one run
+		// if some of its characters had to use a fallback font.
+		struct FontRun
+		{
+			const pdf::Font* font;
+			size_t num_glyphs;
+		};
+
+		/*
+		    the result of shaping the text of a word. Shaped runs of words are cached (see layout/word.cpp),
+		    so this is shared between identical words in identical runs, and never modified after shaping.
+		*/
+		struct ShapedText
+		{
+			std::vector<GlyphInfo> glyphs;
+			std::vector<FontRun> font_runs;
+
+			// the adjustment (in font units of the word's font) to the width of the space after the word, from
+			// kerning with the glyphs on either side of it.
+			double space_adjustment = 0;
+		};
+
 	private:
 		const Paragraph* m_paragraph = nullptr;
 
-		// first element is the glyph id, second one is the adjustment to make for kerning (0 if none)
-		std::vector<GlyphInfo> m_glyphs {};
+		std::shared_ptr<const ShapedText> m_shaped {};
 
 		// stuff set by the containing Paragraph during layout and used during rendering.
 		Position m_position {};
@@ -262,11 +301,26 @@ namespace sap::layout
 	};
 
 
+	/*
+	    Statistics for the cache of shaped runs of words, since the start of the program.
+	*/
+	struct ShapingCacheStats
+	{
+		size_t lookups;
+		size_t hits;
+		size_t evictions;
+		size_t entries;
+	};
+
+	ShapingCacheStats getShapingCacheStats();
+
+
 	// for now we are not concerned with lines.
 	struct Paragraph : LayoutObject
 	{
 		void add(Word word);
 
+		virtual void prepareLayout(const Style* parent_style) override;
 		virtual zst::Result<std::optional<LayoutObject*>, int> layout(interp::Interpreter* cs, LayoutRegion* region,
 			const Style* parent_style) override;
 		virtual void render(interp::Interpreter* cs, const LayoutRegion* region, Position position,
@@ -274,6 +328,9 @@ namespace sap::layout
 
 	private:
 		std::vector<Word> m_words {};
+
+		// whether the words were shaped and measured already
+		bool m_prepared = false;
 	};
 
 
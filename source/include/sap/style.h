@@ -13,6 +13,7 @@
 namespace pdf
 {
 	struct Font;
+	struct FontStack;
 }
 
 namespace sap
@@ -59,6 +60,25 @@ namespace sap
 				return defaultStyle().font();
 		}
 
+		// the fonts to fall back to (in order) for codepoints that `font()` does not have; can be null.
+		inline const pdf::FontStack* fallback_fonts(const Style* default_parent = nullptr) const
+		{
+			if(default_parent == this)
+				default_parent = nullptr;
+			auto par = (m_parent == this) ? nullptr : m_parent;
+
+			if(m_fallback_fonts)
+				return m_fallback_fonts;
+			else if(m_parent)
+				return par->fallback_fonts(default_parent);
+			else if(default_parent)
+				return default_parent->fallback_fonts();
+			else if(&defaultStyle() != this)
+				return defaultStyle().fallback_fonts();
+			else
+				return nullptr;
+		}
+
 		DEFINE_ACCESSOR(Scalar, m_font_size, font_size);
 		DEFINE_ACCESSOR(Scalar, m_line_spacing, line_spacing);
 		DEFINE_ACCESSOR(Scalar, m_pre_para_spacing, pre_paragraph_spacing);
@@ -73,6 +93,7 @@ namespace sap
 	}
 
 		DEFINE_SETTER(const pdf::Font*, m_font, set_font);
+		DEFINE_SETTER(const pdf::FontStack*, m_fallback_fonts, set_fallback_fonts);
 		DEFINE_SETTER(Scalar, m_font_size, set_font_size);
 		DEFINE_SETTER(Scalar, m_line_spacing, set_line_spacing);
 		DEFINE_SETTER(Scalar, m_pre_para_spacing, set_pre_paragraph_spacing);
@@ -107,6 +128,7 @@ namespace sap
 
 			auto style = util::make<Style>();
 			style->set_font(main->font(backup))
+				.set_fallback_fonts(main->fallback_fonts(backup))
 				.set_font_size(main->font_size(backup))
 				.set_line_spacing(main->line_spacing(backup))
 				.set_pre_paragraph_spacing(main->pre_paragraph_spacing(backup))
@@ -118,6 +140,7 @@ namespace sap
 
 	private:
 		const pdf::Font* m_font = nullptr;
+		const pdf::FontStack* m_fallback_fonts = nullptr;
 		std::optional<Scalar> m_font_size;
 		std::optional<Scalar> m_line_spacing;
 		std::optional<Scalar> m_pre_para_spacing;
@@ -6,6 +6,7 @@
 
 #include <string>
 #include <utility>
+#include <functional>
 
 #include <zst.h>
 
@@ -17,6 +18,14 @@ namespace util
 
 	uint16_t convertBEU16(uint16_t x);
 	uint32_t convertBEU32(uint32_t x);
+
+	/*
+	    Call `fn` with each index in [0, count), spread across up to one thread per core, and wait for all of them
+	    to finish. The indices are handed out in order, but the calls can finish in any order, so `fn` must be safe
+	    to call concurrently. The threads are started anew for every call (there is no pool), so this is meant for
+	    a few coarse pieces of work, and should not be nested.
+	*/
+	void parallelFor(size_t count, const std::function<void(size_t)>& fn);
 }
 
 
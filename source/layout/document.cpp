@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "sap.h"
+#include "util.h"
 #include "pdf/page.h"
 #include "pdf/document.h"
 
@@ -32,6 +33,12 @@ namespace sap::layout
 		if(m_objects.empty())
 			return;
 
+		// shaping and measuring doesn't depend on the page, so do it for all the objects at once, in parallel.
+		// only the placement onto pages needs to be sequential.
+		util::parallelFor(m_objects.size(), [this](size_t i) {
+			m_objects[i]->prepareLayout(m_style);
+		});
+
 		LayoutObject* overflow = nullptr;
 		for(size_t i = 0; i < m_objects.size();)
 		{
@@ -56,6 +63,13 @@ namespace sap::layout
 				i++;
 			}
 		}
+
+		if(auto stats = getShapingCacheStats(); stats.lookups > 0)
+		{
+			sap::log("layout", "word shaping cache: {} lookups, {.1f}% hits, {} evictions, {} entries", stats.lookups,
+				100.0 * static_cast<double>(stats.hits) / static_cast<double>(stats.lookups), stats.evictions,
+				stats.entries);
+		}
 	}
 
 	pdf::Document& Document::render(interp::Interpreter* cs)
@@ -17,13 +17,23 @@ namespace sap::layout
 		m_words.push_back(std::move(word));
 	}
 
-	zst::Result<std::optional<LayoutObject*>, int> Paragraph::layout(interp::Interpreter* cs, LayoutRegion* region,
-		const Style* parent_style)
+	void Paragraph::prepareLayout(const Style* parent_style)
 	{
-		// first, all words need their metrics computed. forward the default style down to them.
+		// all words need to be shaped and their metrics computed. forward the default style down to them.
 		auto combined = Style::combine(m_style, parent_style);
+		Word::shapeWords(m_words, combined);
+
 		for(auto& word : m_words)
-			word.computeMetrics(combined);
+			word.computeMetrics();
+
+		m_prepared = true;
+	}
+
+	zst::Result<std::optional<LayoutObject*>, int> Paragraph::layout(interp::Interpreter* cs, LayoutRegion* region,
+		const Style* parent_style)
+	{
+		if(!m_prepared)
+			this->prepareLayout(parent_style);
 
 		/*
 		    now, start placing words. we take linespacing into account, but for words where the height
@@ -112,6 +122,9 @@ namespace sap::layout
 					for(auto& w : overflow->m_words)
 						w.m_paragraph = overflow;
 
+					// the words are already shaped and styled, no need to do it again.
+					overflow->m_prepared = true;
+
 					break;
 				}
 
@@ -176,18 +189,6 @@ namespace sap::layout
 			return zst::Ok(std::optional(overflow));
 		else
 			return zst::Ok(std::nullopt);
-
-		/*
-		    TODO: This algorithm is actually wrong
-
-		    it doesn't account for kerning between
-		    (a) the last glyph of a word and the proceeding space
-		    (b) the space before a word, and its first glyph
-
-		    the difference is usually small, but we should strive to follow the font whenever possible.
-		    we probably want to do the computation here, at layout time, so we can accurately compute
-		    the *real* width of the line, after all the adjustments.
-		*/
 	}
 
 
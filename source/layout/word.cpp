@@ -2,6 +2,10 @@
 // Copyright (c) 2021, zhiayang
 // SPDX-License-Identifier: Apache-2.0
 
+#include <map>
+#include <list>
+#include <mutex>
+
 #include "sap.h"
 #include "util.h"
 
@@ -14,99 +18,503 @@
 
 namespace sap::layout
 {
-	// TODO: this needs to handle unicode composing/decomposing also, which is a massive pain
-	static GlyphId read_one_glyphid(const pdf::Font* font, zst::byte_span& utf8)
+	/*
+	    pick the font for a codepoint: the word's own font if it has a glyph, otherwise the first fallback font
+	    that does. if none of them have it, stay with the word's font, which will give us .notdef (and a warning).
+	*/
+	static const pdf::Font* font_for_codepoint(const pdf::Font* font, const pdf::FontStack* fallbacks, Codepoint cp)
 	{
-		assert(utf8.size() > 0);
+		if(fallbacks == nullptr || font->hasGlyphForCodepoint(cp))
+			return font;
+
+		if(auto fallback = fallbacks->fontForCodepoint(cp); fallback != nullptr)
+			return fallback;
 
-		auto cp = unicode::consumeCodepointFromUtf8(utf8);
-		return font->getGlyphIdFromCodepoint(cp);
+		return font;
 	}
 
+	using font::Tag;
+	static const font::off::FeatureSet g_wordFeatures {
+		.script = Tag("cyrl"),
+		.language = Tag("BGR "),
+		.enabled_features = { Tag("kern"), Tag("liga"), Tag("locl") },
+	};
 
-	static std::vector<Word::GlyphInfo> convert_to_glyphs(const pdf::Font* font, zst::str_view text)
+	static void shape_run(const pdf::Font* font, zst::span<GlyphId> glyphs, std::vector<Word::GlyphInfo>& glyph_infos)
 	{
-		auto utf8 = text.bytes();
+		// the buffer is reused for every run, so that shaping doesn't allocate once it has grown large enough.
+		static thread_local font::GlyphBuffer buffer {};
+		buffer.reset(glyphs);
 
-		// first, convert all codepoints to glyphs
-		std::vector<GlyphId> glyphs {};
-		while(utf8.size() > 0)
-			glyphs.push_back(read_one_glyphid(font, utf8));
+		// the plan (ie. which lookups to apply) is cached in the font, so this is just a hash lookup.
+		auto& plan = font->getShapePlan(g_wordFeatures);
 
-		using font::Tag;
-		font::off::FeatureSet features {};
-		features.script = Tag("cyrl");
-		features.language = Tag("BGR ");
-		features.enabled_features = { Tag("kern"), Tag("liga"), Tag("locl") };
+		// first, use GSUB to perform substitutions; then, use GPOS to position the substituted glyphs.
+		font->performSubstitutionsForGlyphSequence(buffer, plan);
+		font->performPositioningForGlyphSequence(buffer, plan);
 
-		auto span = [](auto& foo) {
-			return zst::span<GlyphId>(foo.data(), foo.size());
+		for(size_t i = 0; i < buffer.size(); i++)
+		{
+			Word::GlyphInfo info {};
+			info.gid = buffer.glyphs[i];
+			info.metrics = font->getMetricsForGlyph(info.gid);
+			info.adjustments = buffer.adjustments[i];
+			glyph_infos.push_back(std::move(info));
+		}
+	}
+
+	/*
+	    The horizontal advance adjustment of the last glyph in `glyphs` (which are already substituted) when they are
+	    positioned on their own; this is the part of its adjustment that doesn't come from the glyph after it.
+	*/
+	static int16_t last_advance_adjustment(const pdf::Font* font, zst::span<GlyphId> glyphs)
+	{
+		static thread_local font::GlyphBuffer buffer {};
+		buffer.reset(glyphs);
+
+		font->performPositioningForGlyphSequence(buffer, font->getShapePlan(g_wordFeatures));
+		return buffer.adjustments.back().horz_advance;
+	}
+
+	/*
+	    Shape the words as one run of text, with a space between each of them. This way, the font can kern (or
+	    otherwise position) glyphs against the spaces, and the fixed costs of shaping are only paid once per run
+	    instead of once per word.
+
+	    Afterwards, the glyphs are split back into words at the space glyphs; spaces always come from the main font.
+	    The adjustment of a space (and the part of the advance adjustment of the glyph just before it that comes
+	    from kerning with the space) becomes the `space_adjustment` of the word before it; this way, it disappears if the line
+	    breaks after that word. If the glyphs can't be split (eg. a word has a character that uses the space glyph,
+	    or the font substituted away a space), this returns nothing, and the words must be shaped separately.
+
+	    TODO: this needs to handle unicode composing/decomposing also, which is a massive pain
+	*/
+	static std::optional<std::vector<Word::ShapedText>> shape_words(const pdf::Font* font, const pdf::FontStack* fallbacks,
+		const std::vector<zst::str_view>& words)
+	{
+		std::vector<Word::ShapedText> shaped(words.size());
+
+		bool has_spaces = words.size() > 1;
+		auto space_gid = has_spaces ? font->getGlyphIdFromCodepoint(Codepoint { ' ' }) : GlyphId::notdef;
+
+		// the word that the next shaped glyph belongs to
+		size_t word_idx = 0;
+		bool split_failed = false;
+
+		/*
+		    split the text into runs of codepoints that use the same font; each run is shaped separately, since
+		    substitutions and positioning obviously can't work across fonts. only runs in the main font can span
+		    more than one word, since the spaces are in the main font.
+		*/
+		const pdf::Font* run_font = nullptr;
+		std::vector<GlyphId> run_glyphs {};
+		size_t run_spaces = 0;
+
+		auto add_glyph = [&](Word::ShapedText& word, Word::GlyphInfo info) {
+			if(word.font_runs.empty() || word.font_runs.back().font != run_font)
+				word.font_runs.push_back({ run_font, 0 });
+
+			word.font_runs.back().num_glyphs++;
+			word.glyphs.push_back(std::move(info));
 		};
 
-		// next, use GSUB to perform substitutions.
-		glyphs = font->performSubstitutionsForGlyphSequence(span(glyphs), features);
+		auto finish_run = [&]() {
+			if(run_glyphs.empty())
+				return;
 
-		// next, get base metrics for each glyph.
-		std::vector<Word::GlyphInfo> glyph_infos {};
-		for(auto g : glyphs)
+			std::vector<Word::GlyphInfo> glyph_infos {};
+			shape_run(run_font, zst::span<GlyphId>(run_glyphs.data(), run_glyphs.size()), glyph_infos);
+			run_glyphs.clear();
+
+			// where the glyphs of the current word in this run start
+			size_t segment_start = shaped[word_idx].glyphs.size();
+
+			size_t spaces_seen = 0;
+			for(auto& info : glyph_infos)
+			{
+				if(!has_spaces || run_font != font || info.gid != space_gid)
+				{
+					add_glyph(shaped[word_idx], std::move(info));
+					continue;
+				}
+
+				if(++spaces_seen > run_spaces)
+					break;
+
+				// the space ends the current word.
+				auto& word = shaped[word_idx++];
+				word.space_adjustment = info.adjustments.horz_advance;
+
+				/*
+				    if the word has glyphs in this run, its last one was right before the space. only the part of
+				    its adjustment that comes from the space moves; the rest (eg. from kerning with the glyph
+				    before it) stays, since it is still there if the line breaks after this word.
+				*/
+				if(segment_start < word.glyphs.size() && word.glyphs.back().adjustments.horz_advance != 0)
+				{
+					auto& last = word.glyphs.back();
+
+					std::vector<GlyphId> segment {};
+					for(size_t i = segment_start; i < word.glyphs.size(); i++)
+						segment.push_back(word.glyphs[i].gid);
+
+					auto own = last_advance_adjustment(font, zst::span<GlyphId>(segment.data(), segment.size()));
+
+					word.space_adjustment += last.adjustments.horz_advance - own;
+					last.adjustments.horz_advance = own;
+				}
+
+				segment_start = 0;
+			}
+
+			split_failed |= (spaces_seen != run_spaces);
+			run_spaces = 0;
+		};
+
+		for(size_t i = 0; i < words.size() && !split_failed; i++)
 		{
-			Word::GlyphInfo info {};
-			info.gid = g;
-			info.metrics = font->getMetricsForGlyph(g);
-			glyph_infos.push_back(std::move(info));
+			if(i > 0)
+			{
+				if(run_font != font)
+					finish_run();
+
+				run_font = font;
+				run_glyphs.push_back(space_gid);
+				run_spaces++;
+			}
+
+			auto utf8 = words[i].bytes();
+			while(utf8.size() > 0)
+			{
+				auto cp = unicode::consumeCodepointFromUtf8(utf8);
+				auto cp_font = font_for_codepoint(font, fallbacks, cp);
+
+				if(cp_font != run_font)
+					finish_run();
+
+				run_font = cp_font;
+				run_glyphs.push_back(cp_font->getGlyphIdFromCodepoint(cp));
+
+				// we couldn't tell this apart from the spaces between words
+				if(has_spaces && cp_font == font && run_glyphs.back() == space_gid)
+					return std::nullopt;
+			}
 		}
 
-		// finally, use GPOS
-		auto adjustment_map = font->getPositioningAdjustmentsForGlyphSequence(span(glyphs), features);
-		for(auto& [i, adj] : adjustment_map)
+		finish_run();
+		if(split_failed)
+			return std::nullopt;
+
+		return shaped;
+	}
+
+
+	/*
+	    Shaping (cmap lookups, GSUB, GPOS, fetching metrics) is the most expensive part of laying out text, and the
+	    same words appear over and over again, so shaped words are kept in a bounded LRU cache.
+
+	    The key is the text of the word, the fonts (including the fallbacks), the shape plan that was used, and
+	    the context that the space on either side of the word contributes: if the font substitutes or positions
+	    the space against the first glyph of the next word, that codepoint is part of the key (it changes the
+	    `space_adjustment`), and likewise whether this word comes after such a space. Fonts rarely do anything
+	    with spaces, so usually the context is empty and the same word always hits. The font size is not part of
+	    the key, because the glyph metrics and adjustments are in font units.
+
+	    Skipping the shaping on a hit is fine even though shaping has side effects on the pdf::Font (marking glyphs
+	    as used, adding unicode mappings), since those were already done the first time, for the same font.
+	    Paragraphs are shaped concurrently, so the cache is guarded by a mutex; it is not held while shaping.
+	*/
+	using ShapedWord = std::shared_ptr<const Word::ShapedText>;
+
+	struct ShapingCacheKey
+	{
+		// this points to the `text` of the cache entry (or to the word being looked up)
+		std::string_view text;
+
+		// the first codepoint of the next word if the space before it matters, or 0.
+		Codepoint next;
+		bool after_space;
+
+		const pdf::Font* font;
+		const pdf::FontStack* fallbacks;
+		const font::off::ShapePlan* plan;
+
+		bool operator==(const ShapingCacheKey&) const = default;
+	};
+
+	struct ShapingCacheKeyHasher
+	{
+		size_t operator()(const ShapingCacheKey& key) const
 		{
-			auto& info = glyph_infos[i];
-			info.adjustments.horz_advance += adj.horz_advance;
-			info.adjustments.vert_advance += adj.vert_advance;
-			info.adjustments.horz_placement += adj.horz_placement;
-			info.adjustments.vert_placement += adj.vert_placement;
+			auto hash = std::hash<std::string_view> {}(key.text);
+			hash = (hash ^ static_cast<uint32_t>(key.next)) * 0x100000001b3;
+			hash = (hash ^ key.after_space) * 0x100000001b3;
+
+			for(auto ptr : { (const void*) key.font, (const void*) key.fallbacks, (const void*) key.plan })
+				hash = (hash ^ std::hash<const void*> {}(ptr)) * 0x100000001b3;
+
+			return hash;
 		}
+	};
+
+	struct ShapingCacheEntry
+	{
+		std::string text;
+		ShapingCacheKey key;
+		ShapedWord shaped;
+	};
+
+	struct ShapingCache
+	{
+		static constexpr size_t MAX_ENTRIES = 16384;
 
-		return glyph_infos;
+		// most recently used first. list nodes don't move, so the keys in `index` can point into them.
+		std::list<ShapingCacheEntry> entries {};
+		std::unordered_map<ShapingCacheKey, std::list<ShapingCacheEntry>::iterator, ShapingCacheKeyHasher> index {};
+
+		// for each (font, codepoint): whether the font does anything with a space followed by that codepoint.
+		std::map<std::pair<const pdf::Font*, uint32_t>, bool> space_contexts {};
+
+		ShapingCacheStats stats {};
+		std::mutex mutex {};
+	};
+
+	static ShapingCache g_shapingCache {};
+
+	static Codepoint first_codepoint(zst::str_view word)
+	{
+		auto utf8 = word.bytes();
+		return utf8.size() > 0 ? unicode::consumeCodepointFromUtf8(utf8) : Codepoint { 0 };
 	}
 
+	/*
+	    Whether the space in front of a word starting with `cp` is substituted or positioned against it. This is
+	    found out by shaping just the two glyphs, once per font and codepoint. Lookups with more context than
+	    that (ie. the glyph before the space) are not considered.
+	*/
+	static bool space_has_context(const pdf::Font* font, const pdf::FontStack* fallbacks, Codepoint cp)
+	{
+		// the space can only interact with glyphs in the same run, which must be in the same font.
+		if(font_for_codepoint(font, fallbacks, cp) != font)
+			return false;
+
+		auto& cache = g_shapingCache;
+		auto key = std::make_pair(font, static_cast<uint32_t>(cp));
+		{
+			std::lock_guard lock(cache.mutex);
+			if(auto it = cache.space_contexts.find(key); it != cache.space_contexts.end())
+				return it->second;
+		}
 
+		GlyphId input[] = { font->getGlyphIdFromCodepoint(Codepoint { ' ' }), font->getGlyphIdFromCodepoint(cp) };
 
+		static thread_local font::GlyphBuffer buffer {};
+		buffer.reset(zst::span<GlyphId>(input, 2));
 
+		auto& plan = font->getShapePlan(g_wordFeatures);
+		font->performSubstitutionsForGlyphSequence(buffer, plan);
+		font->performPositioningForGlyphSequence(buffer, plan);
 
+		bool has_context = buffer.size() != 2 || buffer.glyphs[0] != input[0] || buffer.glyphs[1] != input[1];
+		for(auto& adj : buffer.adjustments)
+			has_context |= (adj.horz_placement != 0 || adj.vert_placement != 0 || adj.horz_advance != 0 || adj.vert_advance != 0);
 
+		std::lock_guard lock(cache.mutex);
+		cache.space_contexts.emplace(key, has_context);
+		return has_context;
+	}
 
-	void Word::computeMetrics(const Style* parent_style)
+	/*
+	    Shape a run of words (with the same fonts), using the cache for each word. The words that are missing
+	    are shaped together, in groups of consecutive misses; if the spaces on either side of a group matter,
+	    the neighbouring words are shaped along with it (and then thrown away), so that the results are the
+	    same as if the whole run was shaped at once.
+	*/
+	static std::vector<ShapedWord> shape_words_cached(const pdf::Font* font, const pdf::FontStack* fallbacks,
+		const std::vector<zst::str_view>& words)
 	{
-		auto style = Style::combine(m_style, parent_style);
-		this->setStyle(style);
+		auto& cache = g_shapingCache;
+		auto plan = &font->getShapePlan(g_wordFeatures);
+
+		// whether the space before each word matters
+		std::vector<bool> has_context(words.size());
+		for(size_t i = 1; i < words.size(); i++)
+			has_context[i] = space_has_context(font, fallbacks, first_codepoint(words[i]));
+
+		std::vector<ShapingCacheKey> keys {};
+		for(size_t i = 0; i < words.size(); i++)
+		{
+			auto next = (i + 1 < words.size() && has_context[i + 1]) ? first_codepoint(words[i + 1]) : Codepoint { 0 };
+			keys.push_back(ShapingCacheKey { words[i].sv(), next, has_context[i], font, fallbacks, plan });
+		}
 
-		auto font = style->font();
-		auto font_size = style->font_size();
+		std::vector<ShapedWord> shaped(words.size());
 
-		m_glyphs = convert_to_glyphs(font, this->text);
+		// words that missed, but appear earlier in the run (and will be shaped there); maps to the earlier index.
+		std::unordered_map<size_t, size_t> repeats {};
+		{
+			std::unordered_map<ShapingCacheKey, size_t, ShapingCacheKeyHasher> missed {};
+
+			std::lock_guard lock(cache.mutex);
+			for(size_t i = 0; i < words.size(); i++)
+			{
+				cache.stats.lookups++;
+				if(auto it = cache.index.find(keys[i]); it != cache.index.end())
+				{
+					cache.stats.hits++;
+					cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+					shaped[i] = it->second->shaped;
+				}
+				else if(auto [it2, inserted] = missed.emplace(keys[i], i); !inserted)
+				{
+					cache.stats.hits++;
+					repeats.emplace(i, it2->second);
+				}
+			}
+		}
+
+		auto needs_shaping = [&](size_t i) { return shaped[i] == nullptr && not repeats.contains(i); };
+
+		std::vector<size_t> misses {};
+		for(size_t start = 0; start < words.size();)
+		{
+			if(not needs_shaping(start))
+			{
+				start++;
+				continue;
+			}
+
+			auto end = start;
+			while(end < words.size() && needs_shaping(end))
+				misses.push_back(end++);
+
+			auto group_start = has_context[start] ? start - 1 : start;
+			auto group_end = (end < words.size() && has_context[end]) ? end + 1 : end;
+			auto group = std::vector<zst::str_view>(words.begin() + group_start, words.begin() + group_end);
+
+			if(auto run = shape_words(font, fallbacks, group); run.has_value())
+			{
+				for(auto i = start; i < end; i++)
+					shaped[i] = std::make_shared<const Word::ShapedText>(std::move((*run)[i - group_start]));
+			}
+			else
+			{
+				// a single word can always be shaped
+				for(auto i = start; i < end; i++)
+				{
+					auto single = shape_words(font, fallbacks, { words[i] });
+					shaped[i] = std::make_shared<const Word::ShapedText>(std::move(single->at(0)));
+				}
+			}
+
+			start = end;
+		}
+
+		for(auto [i, first] : repeats)
+			shaped[i] = shaped[first];
+
+		std::lock_guard lock(cache.mutex);
+		for(auto i : misses)
+		{
+			// another thread might have shaped the same word in the meantime; the results are the same.
+			if(auto it = cache.index.find(keys[i]); it != cache.index.end())
+			{
+				cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+				continue;
+			}
+
+			if(cache.index.size() >= ShapingCache::MAX_ENTRIES)
+			{
+				cache.index.erase(cache.entries.back().key);
+				cache.entries.pop_back();
+				cache.stats.evictions++;
+			}
+
+			auto& entry = cache.entries.emplace_front(ShapingCacheEntry { std::string(words[i].sv()), keys[i], shaped[i] });
+			entry.key.text = entry.text;
+
+			cache.index.emplace(entry.key, cache.entries.begin());
+		}
+
+		return shaped;
+	}
+
+	ShapingCacheStats getShapingCacheStats()
+	{
+		std::lock_guard lock(g_shapingCache.mutex);
+
+		auto stats = g_shapingCache.stats;
+		stats.entries = g_shapingCache.index.size();
+
+		return stats;
+	}
+
+
+	void Word::shapeWords(std::vector<Word>& words, const Style* parent_style)
+	{
+		for(auto& word : words)
+			word.setStyle(Style::combine(word.m_style, parent_style));
+
+		// consecutive words can only be shaped together if they have the same fonts and font size.
+		auto same_run = [](const Style* a, const Style* b) {
+			return a->font() == b->font() && a->fallback_fonts() == b->fallback_fonts() && a->font_size() == b->font_size();
+		};
+
+		for(size_t i = 0; i < words.size();)
+		{
+			auto style = words[i].m_style;
+
+			size_t end = i + 1;
+			while(end < words.size() && same_run(style, words[end].m_style))
+				end++;
+
+			std::vector<zst::str_view> texts {};
+			for(size_t k = i; k < end; k++)
+				texts.push_back(words[k].text);
+
+			auto shaped = shape_words_cached(style->font(), style->fallback_fonts(), texts);
+			for(size_t k = i; k < end; k++)
+				words[k].m_shaped = std::move(shaped[k - i]);
+
+			i = end;
+		}
+	}
+
+	void Word::computeMetrics()
+	{
+		assert(m_shaped != nullptr);
+
+		auto font = m_style->font();
+		auto font_size = m_style->font_size();
 
 		// we shouldn't have 0 glyphs in a word... right?
-		assert(m_glyphs.size() > 0);
+		assert(m_shaped->glyphs.size() > 0);
 
 		// size is in sap units, which is in mm; metrics are in typographic units, so 72dpi;
 		// calculate the scale accordingly.
-		const auto font_metrics = font->getFontMetrics();
 		auto font_size_tpu = font_size.into(dim::units::pdf_typographic_unit {});
 
 		// TODO: what is this complicated formula???
 		this->size = { 0, 0 };
-		this->size.y() = font->scaleMetricForFontSize(font_metrics.default_line_spacing, font_size_tpu).into(sap::Scalar {});
 
-		for(auto& glyph : m_glyphs)
+		size_t glyph_idx = 0;
+		for(auto& run : m_shaped->font_runs)
 		{
-			auto width = glyph.metrics.horz_advance + glyph.adjustments.horz_advance;
-			this->size.x() += font->scaleMetricForFontSize(width, font_size_tpu).into(sap::Scalar {});
+			const auto font_metrics = run.font->getFontMetrics();
+			auto line_spacing = run.font->scaleMetricForFontSize(font_metrics.default_line_spacing, font_size_tpu);
+			this->size.y() = dim::max(this->size.y(), line_spacing.into(sap::Scalar {}));
+
+			for(size_t i = 0; i < run.num_glyphs; i++)
+			{
+				auto& glyph = m_shaped->glyphs[glyph_idx++];
+				auto width = glyph.metrics.horz_advance + glyph.adjustments.horz_advance;
+				this->size.x() += run.font->scaleMetricForFontSize(width, font_size_tpu).into(sap::Scalar {});
+			}
 		}
 
 		{
 			auto space_gid = font->getGlyphIdFromCodepoint(Codepoint { ' ' });
-			auto space_adv = font->getMetricsForGlyph(space_gid).horz_advance;
+			auto space_adv = font->getMetricsForGlyph(space_gid).horz_advance + m_shaped->space_adjustment;
 			auto space_width = font->scaleMetricForFontSize(space_adv, font_size_tpu);
 
 			m_space_width = space_width.into(sap::Scalar {});
@@ -122,41 +530,45 @@ namespace sap::layout
 	{
 		const auto font = m_style->font();
 		const auto font_size = m_style->font_size();
-		text->setFont(font, font_size.into(pdf::Scalar {}));
 
-		auto add_gid = [&font, text](GlyphId gid) {
+		auto add_gid = [text](const pdf::Font* font, GlyphId gid) {
 			if(font->encoding_kind == pdf::Font::ENCODING_CID)
 				text->addEncoded(2, static_cast<uint32_t>(gid));
 			else
 				text->addEncoded(1, static_cast<uint32_t>(gid));
 		};
 
-		for(auto& glyph : m_glyphs)
+		size_t glyph_idx = 0;
+		for(auto& run : m_shaped->font_runs)
 		{
-			add_gid(glyph.gid);
+			text->setFont(run.font, font_size.into(pdf::Scalar {}));
+			for(size_t i = 0; i < run.num_glyphs; i++)
+			{
+				auto& glyph = m_shaped->glyphs[glyph_idx++];
+				add_gid(run.font, glyph.gid);
 
-			// TODO: handle placement as well
-			text->offset(font->scaleMetricForPDFTextSpace(glyph.adjustments.horz_advance));
+				// TODO: handle placement as well
+				text->offset(run.font->scaleMetricForPDFTextSpace(glyph.adjustments.horz_advance));
+			}
 		}
 
 		if(!m_linebreak_after && m_next_word != nullptr)
 		{
-			auto space_gid = font->getGlyphIdFromCodepoint(Codepoint { ' ' });
-			add_gid(space_gid);
-
-			if(m_post_space_ratio != 1.0)
-			{
-				auto space_adv = font->getMetricsForGlyph(space_gid).horz_advance;
+			// the space always comes from the word's main font, even if the word ended with a fallback font.
+			text->setFont(font, font_size.into(pdf::Scalar {}));
 
-				// ratio > 1 = expand, < 1 = shrink
-				auto extra = font->scaleMetricForPDFTextSpace(space_adv) * (m_post_space_ratio - 1.0);
-				text->offset(extra);
-			}
+			auto space_gid = font->getGlyphIdFromCodepoint(Codepoint { ' ' });
+			add_gid(font, space_gid);
 
 			/*
-			    TODO: here, we also want to handle kerning between the space and the start of the next word
-			    (see the longer explanation in layout/paragraph.cpp)
+			    the space glyph only advances by its width in the font; make up the difference to the kerned width
+			    of the space, stretched (ratio > 1) or squeezed (ratio < 1) to justify the line.
 			*/
+			auto space_adv = font->getMetricsForGlyph(space_gid).horz_advance;
+			auto kerned_adv = space_adv + m_shaped->space_adjustment;
+
+			if(auto extra = kerned_adv * m_post_space_ratio - space_adv; extra != 0)
+				text->offset(font->scaleMetricForPDFTextSpace(extra));
 		}
 	}
 }
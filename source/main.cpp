@@ -14,6 +14,7 @@
 #include "pdf/text.h"
 
 #include "font/font.h"
+#include "font/discovery.h"
 
 #include "sap/frontend.h"
 
@@ -47,12 +48,32 @@ int main(int argc, char** argv)
 	auto interpreter = sap::interp::Interpreter();
 
 	auto layout_doc = sap::layout::createDocumentLayout(&interpreter, document);
-	auto font =
-		pdf::Font::fromFontFile(&layout_doc.pdfDocument(), font::FontFile::parseFromFile("fonts/SourceSerif4-Regular.otf"));
+
+	auto font_index = font::FontIndex::load(font::FontIndex::defaultSearchDirectories(), font::FontIndex::defaultCachePath());
+
+	auto font_file = [&]() {
+		if(auto face = font_index->findFace("Source Serif 4", 400, /* italic: */ false); face != nullptr)
+			return font_index->loadFace(face);
+
+		return font::FontFile::parseFromFile("fonts/SourceSerif4-Regular.otf");
+	}();
+
+	auto font = pdf::Font::fromFontFile(&layout_doc.pdfDocument(), font_file);
 
 	auto style = sap::Style {};
 	style.set_font(font).set_font_size(pdf::Scalar(12).into(sap::Scalar {}));
 
+	// for characters that the main font doesn't have, use the first of these (that is installed) which does.
+	std::vector<const pdf::Font*> fallback_fonts {};
+	for(auto family : { "Noto Sans", "DejaVu Sans", "Noto Sans CJK SC" })
+	{
+		if(auto face = font_index->findFace(family, 400, /* italic: */ false); face != nullptr)
+			fallback_fonts.push_back(pdf::Font::fromFontFile(&layout_doc.pdfDocument(), font_index->loadFace(face)));
+	}
+
+	if(not fallback_fonts.empty())
+		style.set_fallback_fonts(util::make<pdf::FontStack>(std::move(fallback_fonts)));
+
 	auto default_style = sap::Style()
 	                         .set_font(pdf::Font::fromBuiltin(&layout_doc.pdfDocument(), "Times-Roman"))
 	                         .set_font_size(pdf::Scalar(12.0).into(sap::Scalar {}))
@@ -9,6 +9,10 @@
 
 #include <cerrno>
 
+#include <atomic>
+#include <algorithm>
+#include <thread>
+
 #include "util.h"
 #include "error.h"
 
@@ -41,4 +45,31 @@ namespace util
 	{
 		return ((x & 0x000000ff) << 24) | ((x & 0x0000ff00) << 8) | ((x & 0x00ff0000) >> 8) | ((x & 0xff000000) >> 24);
 	}
+
+	void parallelFor(size_t count, const std::function<void(size_t)>& fn)
+	{
+		auto num_threads = std::min(static_cast<size_t>(std::thread::hardware_concurrency()), count);
+		if(num_threads <= 1)
+		{
+			for(size_t i = 0; i < count; i++)
+				fn(i);
+
+			return;
+		}
+
+		std::atomic<size_t> next_index = 0;
+		auto worker = [&]() {
+			for(auto i = next_index++; i < count; i = next_index++)
+				fn(i);
+		};
+
+		// the current thread does its share of the work too.
+		std::vector<std::thread> threads {};
+		for(size_t i = 1; i < num_threads; i++)
+			threads.emplace_back(worker);
+
+		worker();
+		for(auto& thread : threads)
+			thread.join();
+	}
 }
@@ -2,6 +2,11 @@
 // Copyright (c) 2021, zhiayang
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
+
+#include "util.h"
+
+#include "pdf/font.h"
 #include "pdf/page.h"
 #include "pdf/misc.h"
 #include "pdf/writer.h"
@@ -22,6 +27,9 @@ namespace pdf
 		auto pagetree = this->createPageTree();
 		auto root = Dictionary::createIndirect(this, names::Catalog, { { names::Pages, IndirectRef::create(pagetree) } });
 
+		// this must come after the pages, since serialising them marks the glyphs that are used.
+		this->finaliseFonts();
+
 		// write all the objects.
 		for(auto [_, obj] : this->objects)
 			obj->writeFull(w);
@@ -82,6 +90,24 @@ namespace pdf
 		return pagetree;
 	}
 
+	void Document::finaliseFonts()
+	{
+		// collect the fonts in the order that the pages use them, so the output doesn't depend on the scheduling.
+		std::vector<const Font*> fonts {};
+		for(auto page : this->pages)
+		{
+			for(auto font : page->usedFonts())
+			{
+				if(std::find(fonts.begin(), fonts.end(), font) == fonts.end())
+					fonts.push_back(font);
+			}
+		}
+
+		// subsetting is the slow part of writing the document. the objects (and their ids) were all created
+		// with the fonts, and each font only writes to its own streams, so they can be done concurrently.
+		util::parallelFor(fonts.size(), [&](size_t i) { fonts[i]->finalise(this); });
+	}
+
 
 
 
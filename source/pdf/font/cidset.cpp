@@ -7,32 +7,30 @@
 
 namespace pdf
 {
+	// the CIDSet has the first glyph in the high bit of each byte, but the glyph set has it in the low bit.
+	static uint8_t reverse_bits(uint8_t x)
+	{
+		x = static_cast<uint8_t>(((x & 0xF0) >> 4) | ((x & 0x0F) << 4));
+		x = static_cast<uint8_t>(((x & 0xCC) >> 2) | ((x & 0x33) << 2));
+		x = static_cast<uint8_t>(((x & 0xAA) >> 1) | ((x & 0x55) << 1));
+		return x;
+	}
+
 	void Font::writeCIDSet(Document* doc) const
 	{
 		auto stream = this->cidset;
 		assert(this->source_file != nullptr);
 
-		int num_bits = 0;
-		uint8_t current = 0;
-		for(uint32_t gid = 0; gid < this->source_file->num_glyphs; gid++)
-		{
-			bool bit = m_used_glyphs.find(GlyphId { gid }) != m_used_glyphs.end();
-			current <<= 1;
-			current |= (bit ? 1 : 0);
-			num_bits++;
+		auto num_bytes = (this->source_file->num_glyphs + 7) / 8;
 
-			if(num_bits == 8)
-			{
-				stream->append(&current, 1);
-				num_bits = 0;
-				current = 0;
-			}
-		}
-
-		if(num_bits > 0)
+		zst::byte_buffer bytes {};
+		for(size_t w = 0; w < m_used_glyphs.numWords() && bytes.size() < num_bytes; w++)
 		{
-			current <<= (8 - num_bits);
-			stream->append(&current, 1);
+			auto word = m_used_glyphs.word(w);
+			for(size_t i = 0; i < sizeof(uint64_t) && bytes.size() < num_bytes; i++)
+				bytes.append(reverse_bits(static_cast<uint8_t>(word >> (8 * i))));
 		}
+
+		stream->append(bytes.data(), bytes.size());
 	}
 }
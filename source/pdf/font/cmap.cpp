@@ -5,6 +5,8 @@
 // i know it's bad form to keep having two font.hs and two cmap.cpps and whatever
 // but they are literally called cmaps
 
+#include <algorithm>
+
 #include "util.h"
 #include "pdf/font.h"
 #include "pdf/object.h"
@@ -14,65 +16,146 @@ namespace pdf
 	static void write_cmap_header(Stream* stream, zst::str_view font_name);
 	static void write_cmap_footer(Stream* stream);
 
+	// a CMap can have at most 100 entries between each begin/end pair.
+	static constexpr size_t MAX_ENTRIES_PER_BLOCK = 100;
+
+	struct ToUnicodeEntry
+	{
+		uint32_t gid;
+		std::vector<uint16_t> utf16;
+	};
+
+	static void append_utf16(std::vector<uint16_t>& utf16, Codepoint cp)
+	{
+		if(cp <= 0xFFFF_codepoint)
+		{
+			utf16.push_back(static_cast<uint16_t>(static_cast<uint32_t>(cp)));
+		}
+		else
+		{
+			auto [high, low] = unicode::codepointToSurrogatePair(cp);
+			utf16.push_back(high);
+			utf16.push_back(low);
+		}
+	}
+
+	static void append_hex_string(std::string& out, const std::vector<uint16_t>& utf16)
+	{
+		out += '<';
+		for(auto x : utf16)
+			out += zpr::sprint("{04x}", x);
+		out += '>';
+	}
+
+	/*
+	    Whether `b` can be in the same bfrange as `a` (which comes just before it). In a bfrange, only the last
+	    byte of the source code changes, and the destination is incremented in its last byte; so the glyph ids
+	    must be consecutive without crossing a multiple of 256, and the same goes for the last utf-16 unit
+	    of the destinations (all the others must be the same).
+	*/
+	static bool continues_range(const ToUnicodeEntry& a, const ToUnicodeEntry& b)
+	{
+		if(b.gid != a.gid + 1 || (b.gid >> 8) != (a.gid >> 8) || a.utf16.size() != b.utf16.size())
+			return false;
+
+		auto n = a.utf16.size();
+		if(!std::equal(a.utf16.begin(), a.utf16.begin() + (n - 1), b.utf16.begin()))
+			return false;
+
+		return b.utf16[n - 1] == a.utf16[n - 1] + 1 && (a.utf16[n - 1] & 0xFF) != 0xFF;
+	}
+
 	void Font::writeUnicodeCMap(Document* doc) const
 	{
 		auto cmap = this->unicode_cmap;
 		write_cmap_header(cmap, this->pdf_font_name);
 
-		cmap->append("1 begincodespacerange\n"
-					 "<0000> <FFFF>\n"
-					 "endcodespacerange\n");
-
 		assert(this->source_file != nullptr);
-		auto& mapping = this->source_file->character_mapping.forward;
+		auto& reverse_mapping = this->source_file->character_mapping.reverse;
 
-		// TODO: this is not very optimal. ideally we want to make ranges whenever we can,
-		// but that requires a whole bunch of extra work.
-		cmap->append(zpr::sprint("{} beginbfchar\n", mapping.size()));
+		/*
+		    only the used glyphs need a mapping. the extra mappings (for ligatures and other substitutions) take
+		    precedence over the cmap, since they say what the glyph actually stands for in this document.
+		*/
+		std::vector<ToUnicodeEntry> entries {};
+		entries.reserve(m_used_glyphs.size());
 
-		for(auto& [cp, glyph] : mapping)
+		for(auto gid : m_used_glyphs)
 		{
-			if(m_used_glyphs.find(glyph) == m_used_glyphs.end())
-				continue;
-
-			auto codepoint = static_cast<uint32_t>(cp);
-			if(codepoint <= 0xFFFF)
+			auto entry = ToUnicodeEntry { static_cast<uint32_t>(gid), {} };
+			if(auto it = m_extra_unicode_mappings.find(gid); it != m_extra_unicode_mappings.end())
 			{
-				cmap->append(zpr::sprint("<{04x}> <{04x}>\n", glyph, codepoint));
+				for(auto cp : it->second)
+					append_utf16(entry.utf16, cp);
 			}
-			else
+			else if(auto it = reverse_mapping.find(gid); it != reverse_mapping.end())
 			{
-				auto [high, low] = unicode::codepointToSurrogatePair(cp);
-				cmap->append(zpr::sprint("<{04x}> <{04x}{04x}>\n", glyph, high, low));
+				append_utf16(entry.utf16, it->second);
 			}
+
+			if(!entry.utf16.empty())
+				entries.push_back(std::move(entry));
 		}
 
-		cmap->append("endbfchar\n");
+		// note: the glyph set is iterated in order, so the entries are already sorted by glyph id.
+		// split the entries into runs that can be a bfrange, and single ones that go into a bfchar.
+		std::vector<std::pair<size_t, size_t>> ranges {};
+		std::vector<size_t> singles {};
+
+		for(size_t i = 0; i < entries.size();)
+		{
+			size_t k = i + 1;
+			while(k < entries.size() && continues_range(entries[k - 1], entries[k]))
+				k++;
+
+			if(k - i > 1)
+				ranges.emplace_back(i, k);
+			else
+				singles.push_back(i);
+
+			i = k;
+		}
 
+		std::string out {};
+		out += "1 begincodespacerange\n"
+		       "<0000> <FFFF>\n"
+		       "endcodespacerange\n";
 
-		// now for the ligatures.
-		cmap->append(zpr::sprint("{} beginbfchar\n", m_extra_unicode_mappings.size()));
-		for(auto& [gid, cps] : m_extra_unicode_mappings)
+		for(size_t i = 0; i < singles.size(); i += MAX_ENTRIES_PER_BLOCK)
 		{
-			cmap->append(zpr::sprint("<{04x}> <", gid));
-			for(auto cp : cps)
+			auto count = std::min(MAX_ENTRIES_PER_BLOCK, singles.size() - i);
+			out += zpr::sprint("{} beginbfchar\n", count);
+
+			for(size_t k = i; k < i + count; k++)
 			{
-				if(cp <= 0xFFFF_codepoint)
-				{
-					cmap->append(zpr::sprint("{04x}", cp));
-				}
-				else
-				{
-					auto [high, low] = unicode::codepointToSurrogatePair(cp);
-					cmap->append(zpr::sprint("{04x}{04x}", high, low));
-				}
+				auto& entry = entries[singles[k]];
+				out += zpr::sprint("<{04x}> ", entry.gid);
+				append_hex_string(out, entry.utf16);
+				out += '\n';
 			}
 
-			cmap->append(">\n");
+			out += "endbfchar\n";
 		}
-		cmap->append("endbfchar\n");
 
+		for(size_t i = 0; i < ranges.size(); i += MAX_ENTRIES_PER_BLOCK)
+		{
+			auto count = std::min(MAX_ENTRIES_PER_BLOCK, ranges.size() - i);
+			out += zpr::sprint("{} beginbfrange\n", count);
+
+			for(size_t k = i; k < i + count; k++)
+			{
+				auto& first = entries[ranges[k].first];
+				auto& last = entries[ranges[k].second - 1];
+
+				out += zpr::sprint("<{04x}> <{04x}> ", first.gid, last.gid);
+				append_hex_string(out, first.utf16);
+				out += '\n';
+			}
+
+			out += "endbfrange\n";
+		}
 
+		cmap->append(out);
 		write_cmap_footer(cmap);
 	}
 
@@ -8,6 +8,7 @@
 #include "pdf/misc.h"
 #include "pdf/object.h"
 #include "pdf/document.h"
+#include "pdf/standard_fonts.h"
 #include "pdf/win_ansi_encoding.h"
 
 #include "font/font.h"
@@ -31,27 +32,67 @@ namespace pdf
 
 	font::FontMetrics Font::getFontMetrics() const
 	{
-		// TODO: metrics for the 14 built-in fonts
-		// see https://stackoverflow.com/questions/6383511/
-		assert(this->source_file);
+		if(auto builtin = this->builtin_metrics; builtin != nullptr)
+		{
+			font::FontMetrics ret {};
+			ret.xmin = builtin->xmin;
+			ret.ymin = builtin->ymin;
+			ret.xmax = builtin->xmax;
+			ret.ymax = builtin->ymax;
+			ret.units_per_em = 1000;
+			ret.x_height = builtin->x_height;
+			ret.cap_height = builtin->cap_height;
+			ret.is_monospaced = builtin->is_monospaced;
+			ret.italic_angle = builtin->italic_angle;
+
+			// AFM files don't have a line gap, so use whatever is left of the bounding box.
+			ret.hhea_ascent = ret.typo_ascent = builtin->ascent;
+			ret.hhea_descent = ret.typo_descent = builtin->descent;
+			ret.hhea_linegap = ret.typo_linegap = std::max(0, (ret.ymax - ret.ymin) - (ret.typo_ascent - ret.typo_descent));
+
+			ret.default_line_spacing = ret.typo_ascent - ret.typo_descent + ret.typo_linegap;
+			return ret;
+		}
 
+		assert(this->source_file);
 		return this->source_file->metrics;
 	}
 
 	void Font::markGlyphAsUsed(GlyphId glyph) const
 	{
-		m_used_glyphs.insert(glyph);
+		m_used_glyphs.add(glyph);
 	}
 
 
 	font::GlyphMetrics Font::getMetricsForGlyph(GlyphId glyph) const
 	{
-		this->markGlyphAsUsed(glyph);
+		m_used_glyphs.add(glyph);
+
+		if(auto builtin = this->builtin_metrics; builtin != nullptr)
+		{
+			// the glyph ids are the WinAnsi codes.
+			auto code = static_cast<uint32_t>(glyph);
+			if(code >= 256)
+				return {};
+
+			auto& gm = builtin->glyphs[code];
+
+			font::GlyphMetrics ret {};
+			ret.horz_advance = gm.advance;
+			ret.xmin = gm.xmin;
+			ret.ymin = gm.ymin;
+			ret.xmax = gm.xmax;
+			ret.ymax = gm.ymax;
+			ret.left_side_bearing = gm.xmin;
+			ret.right_side_bearing = gm.advance - gm.xmax;
+			return ret;
+		}
 
 		if(!this->source_file)
 			return {};
 
-		else if(auto it = m_glyph_metrics.find(glyph); it != m_glyph_metrics.end())
+		std::lock_guard lock(m_mutex);
+		if(auto it = m_glyph_metrics.find(glyph); it != m_glyph_metrics.end())
 			return it->second;
 
 		auto metrics = this->source_file->getGlyphMetrics(glyph);
@@ -75,7 +116,11 @@ namespace pdf
 			this->markGlyphAsUsed(gid);
 
 			if(gid == GlyphId::notdef)
-				sap::warn("font", "glyph for codepoint U+{04x} not found in font", codepoint);
+			{
+				std::lock_guard lock(m_mutex);
+				if(m_missing_codepoints.insert(codepoint).second)
+					sap::warn("font", "glyph for codepoint U+{04x} not found in font", codepoint);
+			}
 
 			return gid;
 		}
@@ -85,8 +130,25 @@ namespace pdf
 		}
 	}
 
+	bool Font::hasGlyphForCodepoint(Codepoint codepoint) const
+	{
+		if(this->encoding_kind == ENCODING_WIN_ANSI)
+		{
+			return codepoint == Codepoint { 0 } || encoding::WIN_ANSI(codepoint) != 0;
+		}
+		else
+		{
+			assert(this->source_file != nullptr);
+			if(!this->source_file->coverage.mayContain(codepoint))
+				return false;
+
+			return this->source_file->getGlyphIndexForCodepoint(codepoint) != GlyphId::notdef;
+		}
+	}
+
 	void Font::addGlyphUnicodeMapping(GlyphId glyph, std::vector<Codepoint> codepoints) const
 	{
+		std::lock_guard lock(m_mutex);
 		if(auto it = m_extra_unicode_mappings.find(glyph); it != m_extra_unicode_mappings.end() && it->second != codepoints)
 		{
 			sap::warn("font", "conflicting unicode mapping for glyph '{}' (existing: {}, new: {})", glyph, it->second,
@@ -97,85 +159,93 @@ namespace pdf
 	}
 
 
-	std::map<size_t, font::GlyphAdjustment> Font::getPositioningAdjustmentsForGlyphSequence(zst::span<GlyphId> glyphs,
-		const font::off::FeatureSet& features) const
+	const font::off::ShapePlan& Font::getShapePlan(const font::off::FeatureSet& features) const
 	{
+		// builtin fonts don't have any lookups
+		static const font::off::ShapePlan empty_plan {};
 		if(!this->source_file)
-			return {};
+			return empty_plan;
 
-		return font::off::getPositioningAdjustmentsForGlyphSequence(this->source_file, glyphs, features);
+		return font::off::getShapePlan(this->source_file, features);
 	}
 
-	std::vector<GlyphId> Font::performSubstitutionsForGlyphSequence(zst::span<GlyphId> glyphs,
-		const font::off::FeatureSet& features) const
+	void Font::performPositioningForGlyphSequence(font::GlyphBuffer& buffer, const font::off::ShapePlan& plan) const
 	{
-		if(!this->source_file)
-			return std::vector<GlyphId>(glyphs.begin(), glyphs.end());
-
-		auto subst = font::off::performSubstitutionsForGlyphSequence(this->source_file, glyphs, features);
-
-		auto& cmap = this->source_file->character_mapping;
-		for(auto& [out, in] : subst.mapping.replacements)
+		if(this->source_file)
 		{
-			this->markGlyphAsUsed(out);
-
-			// if the out is mapped, then we actually don't need to do anything special
-			if(auto m = cmap.reverse.find(out); m == cmap.reverse.end())
+			font::off::performPositioningForGlyphSequence(this->source_file, buffer, plan);
+		}
+		else if(auto builtin = this->builtin_metrics; builtin != nullptr && builtin->num_kerning_pairs > 0)
+		{
+			// the builtin fonts only have pair kerning, which (like GPOS) adjusts the advance of the first glyph.
+			for(size_t i = 0; i + 1 < buffer.size(); i++)
 			{
-				// get the codepoint for the input
-				if(auto it = cmap.reverse.find(in); it == cmap.reverse.end())
-				{
-					sap::warn("font/off", "could not find unicode codepoint for {}", in);
-					continue;
-				}
-				else
+				auto left = static_cast<uint32_t>(buffer.glyphs[i]);
+				auto right = static_cast<uint32_t>(buffer.glyphs[i + 1]);
+				if(left < 256 && right < 256)
 				{
-					auto in_cp = it->second;
-					this->addGlyphUnicodeMapping(out, { in_cp });
+					auto kern = builtin->getKerning(static_cast<uint8_t>(left), static_cast<uint8_t>(right));
+					buffer.adjustments[i].horz_advance = static_cast<int16_t>(buffer.adjustments[i].horz_advance + kern);
 				}
 			}
 		}
+	}
+
+	void Font::performSubstitutionsForGlyphSequence(font::GlyphBuffer& buffer, const font::off::ShapePlan& plan) const
+	{
+		if(!this->source_file)
+			return;
 
+		font::off::performSubstitutionsForGlyphSequence(this->source_file, buffer, plan);
+
+		auto& cmap = this->source_file->character_mapping;
 		auto find_codepoint_for_gid = [&cmap, this](GlyphId gid) -> std::vector<Codepoint> {
-			// if it is in the reverse cmap, all is well. if it is not, then we hope that
-			// it was a single-replacement (eg. a ligature of replaced glyphs). otherwise,
-			// that's a big oof.
 			if(auto x = cmap.reverse.find(gid); x != cmap.reverse.end())
-			{
 				return { x->second };
-			}
-			else if(auto x = m_extra_unicode_mappings.find(gid); x != m_extra_unicode_mappings.end())
-			{
-				return x->second;
-			}
-			else
+
 			{
-				sap::warn("font", "could not find unicode codepoint for {}", gid);
-				return { Codepoint { '?' } };
+				std::lock_guard lock(m_mutex);
+				if(auto x = m_extra_unicode_mappings.find(gid); x != m_extra_unicode_mappings.end())
+					return x->second;
 			}
+
+			sap::warn("font", "could not find unicode codepoint for {}", gid);
+			return { Codepoint { '?' } };
 		};
 
-		for(auto& [out, ins] : subst.mapping.contractions)
-		{
-			this->markGlyphAsUsed(out);
-			std::vector<Codepoint> in_cps {};
-			for(auto& in_gid : ins)
-			{
-				auto tmp = find_codepoint_for_gid(in_gid);
-				in_cps.insert(in_cps.end(), tmp.begin(), tmp.end());
-			}
+		/*
+		    the substituted glyphs need to be marked as used, and they need to map to the right codepoints. For
+		    that, we use the clusters: a glyph represents the codepoints of the input glyphs in its cluster.
 
-			this->addGlyphUnicodeMapping(out, std::move(in_cps));
-		}
+		    If the glyph is in the cmap, we don't need to do anything special -- except for ligatures, which should
+		    always map to their components (eg. 'ﬁ' is in the cmap, but it should be copied out as 'f', 'i').
 
-		for(auto& g : subst.mapping.extra_glyphs)
+		    For one-to-many substitutions, there's no way to know how to split the codepoints among the output
+		    glyphs, so the first glyph of the cluster gets all of them, and the others get nothing.
+		*/
+		for(size_t i = 0; i < buffer.size(); i++)
 		{
-			this->markGlyphAsUsed(g);
+			if(!(buffer.props[i] & font::GlyphBuffer::PROP_SUBSTITUTED))
+				continue;
 
-			if(cmap.reverse.find(g) == cmap.reverse.end())
-				this->addGlyphUnicodeMapping(g, find_codepoint_for_gid(g));
-		}
+			auto gid = buffer.glyphs[i];
+			this->markGlyphAsUsed(gid);
 
-		return subst.glyphs;
+			if(i > 0 && buffer.clusters[i - 1] == buffer.clusters[i])
+				continue;
+
+			if(!(buffer.props[i] & font::GlyphBuffer::PROP_LIGATED) && cmap.reverse.contains(gid))
+				continue;
+
+			std::vector<Codepoint> codepoints {};
+			auto [input_begin, input_end] = buffer.inputRange(i);
+			for(size_t k = input_begin; k < input_end; k++)
+			{
+				auto tmp = find_codepoint_for_gid(buffer.input[k]);
+				codepoints.insert(codepoints.end(), tmp.begin(), tmp.end());
+			}
+
+			this->addGlyphUnicodeMapping(gid, std::move(codepoints));
+		}
 	}
 }
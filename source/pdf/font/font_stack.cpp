@@ -0,0 +1,77 @@
+// font_stack.cpp
+// Copyright (c) 2022, zhiayang
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+
+#include "pdf/font.h"
+#include "pdf/misc.h"
+
+namespace pdf
+{
+	static constexpr size_t PAGE_SIZE = font::CoverageSummary::PAGE_SIZE;
+	static constexpr size_t NUM_PAGES = font::CoverageSummary::NUM_PAGES;
+
+	// the builtin fonts use WinAnsiEncoding, which doesn't go past the General Punctuation block.
+	static constexpr uint32_t WIN_ANSI_MAX_CODEPOINT = 0x2200;
+
+	FontStack::FontStack(std::vector<const Font*> fonts) : m_fonts(std::move(fonts))
+	{
+		if(m_fonts.size() >= NO_FONT)
+			pdf::error("too many fonts in font stack ({}, max {})", m_fonts.size(), NO_FONT - 1);
+
+		// block 0 is the empty block, which is shared by all the pages that no font covers.
+		m_page_directory.resize(NUM_PAGES, 0);
+		m_blocks.resize(PAGE_SIZE, NO_FONT);
+
+		auto add_codepoint = [this](Codepoint cp, size_t font_idx) {
+			auto page = static_cast<uint32_t>(cp) / PAGE_SIZE;
+			if(page >= NUM_PAGES)
+				return;
+
+			if(m_page_directory[page] == 0)
+			{
+				m_page_directory[page] = static_cast<uint16_t>(m_blocks.size() / PAGE_SIZE);
+				m_blocks.resize(m_blocks.size() + PAGE_SIZE, NO_FONT);
+			}
+
+			// fonts earlier in the stack take precedence, so keep the smaller index.
+			auto& slot = m_blocks[m_page_directory[page] * PAGE_SIZE + static_cast<uint32_t>(cp) % PAGE_SIZE];
+			slot = std::min(slot, static_cast<uint8_t>(font_idx));
+		};
+
+		for(size_t i = 0; i < m_fonts.size(); i++)
+		{
+			auto font = m_fonts[i];
+			if(font->encoding_kind == Font::ENCODING_CID)
+			{
+				for(auto& [cp, gid] : font->source_file->character_mapping.forward)
+				{
+					if(gid != GlyphId::notdef)
+						add_codepoint(cp, i);
+				}
+			}
+			else
+			{
+				for(uint32_t cp = 0; cp < WIN_ANSI_MAX_CODEPOINT; cp++)
+				{
+					if(font->hasGlyphForCodepoint(Codepoint { cp }))
+						add_codepoint(Codepoint { cp }, i);
+				}
+			}
+		}
+	}
+
+	const Font* FontStack::fontForCodepoint(Codepoint codepoint) const
+	{
+		auto cp = static_cast<uint32_t>(codepoint);
+		if(cp / PAGE_SIZE >= NUM_PAGES)
+			return nullptr;
+
+		auto idx = m_blocks[m_page_directory[cp / PAGE_SIZE] * PAGE_SIZE + cp % PAGE_SIZE];
+		if(idx == NO_FONT)
+			return nullptr;
+
+		return m_fonts[idx];
+	}
+}
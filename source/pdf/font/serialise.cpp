@@ -2,12 +2,11 @@
 // Copyright (c) 2022, zhiayang
 // SPDX-License-Identifier: Apache-2.0
 
-#include <algorithm>
-
 #include "pdf/font.h"
 #include "pdf/misc.h"
 #include "pdf/object.h"
 #include "pdf/document.h"
+#include "pdf/standard_fonts.h"
 #include "pdf/win_ansi_encoding.h"
 
 #include "font/font.h"
@@ -24,50 +23,20 @@ namespace pdf
 		if(!this->font_dictionary->is_indirect)
 			this->font_dictionary->makeIndirect(doc);
 
+		return this->font_dictionary;
+	}
+
+	void Font::finalise(Document* doc) const
+	{
 		// we need to write out the widths.
 		if(this->source_file && this->glyph_widths_array)
-		{
-			std::vector<std::pair<GlyphId, double>> widths {};
-			for(auto& gid : m_used_glyphs)
-			{
-				auto width = this->getMetricsForGlyph(gid).horz_advance;
-				widths.emplace_back(gid, this->scaleMetricForPDFTextSpace(width).value());
-			}
-
-			std::sort(widths.begin(), widths.end(), [](const auto& a, const auto& b) -> bool {
-				return a.first < b.first;
-			});
-
-			std::vector<std::pair<Integer*, std::vector<Object*>>> widths2;
-			for(size_t i = 0; i < widths.size(); i++)
-			{
-				if(widths2.empty())
-				{
-				foo:
-					widths2.emplace_back(Integer::create(static_cast<uint32_t>(widths[i].first)),
-						std::vector<Object*> { Integer::create(widths[i].second) });
-				}
-				else
-				{
-					auto& prev = widths2.back();
-					if(prev.first->value + prev.second.size() == static_cast<uint32_t>(widths[i].first))
-						prev.second.push_back(Integer::create(static_cast<uint32_t>(widths[i].second)));
-					else
-						goto foo;
-				}
-			}
-
-			for(auto& [gid, ws] : widths2)
-			{
-				this->glyph_widths_array->values.push_back(gid);
-				this->glyph_widths_array->values.push_back(Array::create(std::move(ws)));
-			}
-		}
+			this->writeGlyphWidths(doc);
 
 		// finally, make a font subset based on the glyphs that we use.
 		if(this->source_file && this->embedded_contents)
 		{
-			writeFontSubset(this->source_file, this->pdf_font_name, this->embedded_contents, m_used_glyphs);
+			writeFontSubset(this->source_file, this->pdf_font_name, this->embedded_contents, m_used_glyphs,
+				this->cid_to_gid_map);
 
 			// write the cmap we'll use for /ToUnicode.
 			this->writeUnicodeCMap(doc);
@@ -75,14 +44,13 @@ namespace pdf
 			// and the cidset
 			this->writeCIDSet(doc);
 		}
-
-		return this->font_dictionary;
 	}
 
 	Font* Font::fromFontFile(Document* doc, font::FontFile* font_file)
 	{
 		auto ret = util::make<Font>();
 		ret->source_file = font_file;
+		ret->m_used_glyphs = font::GlyphSet(font_file->num_glyphs);
 
 		/*
 		    this is the general structure for composite fonts (which we always create, for now):
@@ -119,12 +87,19 @@ namespace pdf
 
 		bool truetype_outlines = (font_file->outline_type == font::FontFile::OUTLINES_TRUETYPE);
 
-		ret->glyph_widths_array = Array::createIndirect(doc, {});
+		ret->glyph_widths_array = RawObject::createIndirect(doc, "[ ]");
 		cidfont_dict->add(names::W, IndirectRef::create(ret->glyph_widths_array));
 
 		if(truetype_outlines)
 		{
-			cidfont_dict->add(names::CIDToGIDMap, names::Identity.ptr());
+			/*
+			    the text uses the original glyph ids (as CIDs), but the glyphs are renumbered in the subset
+			    so that it only has to contain the used glyphs. the map is filled in when writing the subset.
+			*/
+			ret->cid_to_gid_map = Stream::create(doc, {});
+			ret->cid_to_gid_map->setCompressed(true);
+
+			cidfont_dict->add(names::CIDToGIDMap, IndirectRef::create(ret->cid_to_gid_map));
 			cidfont_dict->add(names::Subtype, names::CIDFontType2.ptr());
 		}
 		else
@@ -225,32 +200,16 @@ namespace pdf
 
 	Font* Font::fromBuiltin(Document* doc, zst::str_view name)
 	{
-		const char* known_fonts[] = {
-			"Times-Roman",
-			"Times-Italic",
-			"Times-Bold",
-			"Times-BoldItalic",
-			"Helvetica",
-			"Helvetica-Oblique",
-			"Helvetica-Bold",
-			"Helvetica-BoldOblique",
-			"Courier",
-			"Courier-Oblique",
-			"Courier-Bold",
-			"Courier-BoldOblique",
-			"Symbol",
-			"ZapfDingbats",
-		};
-
-		auto it = std::find_if(std::begin(known_fonts), std::end(known_fonts), [&name](auto& n) {
-			return zst::str_view(n) == name;
-		});
-
-		if(it == std::end(known_fonts))
+		auto metrics = standard_fonts::find(name);
+		if(metrics == nullptr)
 			pdf::error("'{}' is not a PDF builtin font", name);
 
 		auto font = util::make<Font>();
 		font->font_type = FONT_TYPE1;
+		font->builtin_metrics = metrics;
+
+		// for the builtin fonts, the "glyph ids" are the WinAnsi codes.
+		font->m_used_glyphs = font::GlyphSet(256);
 
 		auto dict = font->font_dictionary;
 		dict->add(names::Subtype, names::Type1.ptr());
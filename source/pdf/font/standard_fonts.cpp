@@ -0,0 +1,3056 @@
+// standard_fonts.cpp
+// Copyright (c) 2022, zhiayang
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+
+#include "pdf/standard_fonts.h"
+
+/*
+    The metrics of the 14 standard fonts, from Adobe's Core14 AFM files:
+    Copyright (c) 1985, 1987, 1989, 1990, 1991, 1992, 1993, 1997 Adobe Systems Incorporated. All Rights Reserved.
+
+    The glyphs are indexed by their code in WinAnsiEncoding (which is what the fonts are used with), so glyphs that
+    aren't in the encoding are left out, as are kerning pairs involving them. Codes with no glyph have zero metrics.
+*/
+namespace pdf::standard_fonts
+{
+	static constexpr GlyphMetrics TIMES_ROMAN_GLYPHS[256] = {
+		/* 00 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 03 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 06 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 09 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0f */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 12 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 15 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 18 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1b */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 250, 0, 0, 0, 0 },
+		/* 21 */ { 333, 130, -9, 238, 676 }, { 408, 77, 431, 331, 676 }, { 500, 5, 0, 496, 662 },
+		/* 24 */ { 500, 44, -87, 457, 727 }, { 833, 61, -13, 772, 676 }, { 778, 42, -13, 750, 676 },
+		/* 27 */ { 180, 48, 431, 133, 676 }, { 333, 48, -177, 304, 676 }, { 333, 29, -177, 285, 676 },
+		/* 2a */ { 500, 69, 265, 432, 676 }, { 564, 30, 0, 534, 506 }, { 250, 56, -141, 195, 102 },
+		/* 2d */ { 333, 39, 194, 285, 257 }, { 250, 70, -11, 181, 100 }, { 278, -9, -14, 287, 676 },
+		/* 30 */ { 500, 24, -14, 476, 676 }, { 500, 111, 0, 394, 676 }, { 500, 30, 0, 475, 676 },
+		/* 33 */ { 500, 43, -14, 431, 676 }, { 500, 12, 0, 472, 676 }, { 500, 32, -14, 438, 688 },
+		/* 36 */ { 500, 34, -14, 468, 684 }, { 500, 20, -8, 449, 662 }, { 500, 56, -14, 445, 676 },
+		/* 39 */ { 500, 30, -22, 459, 676 }, { 278, 81, -11, 192, 459 }, { 278, 80, -141, 219, 459 },
+		/* 3c */ { 564, 28, -8, 536, 514 }, { 564, 30, 120, 534, 386 }, { 564, 28, -8, 536, 514 },
+		/* 3f */ { 444, 68, -8, 414, 676 }, { 921, 116, -14, 809, 676 }, { 722, 15, 0, 706, 674 },
+		/* 42 */ { 667, 17, 0, 593, 662 }, { 667, 28, -14, 633, 676 }, { 722, 16, 0, 685, 662 },
+		/* 45 */ { 611, 12, 0, 597, 662 }, { 556, 12, 0, 546, 662 }, { 722, 32, -14, 709, 676 },
+		/* 48 */ { 722, 19, 0, 702, 662 }, { 333, 18, 0, 315, 662 }, { 389, 10, -14, 370, 662 },
+		/* 4b */ { 722, 34, 0, 723, 662 }, { 611, 12, 0, 598, 662 }, { 889, 12, 0, 863, 662 },
+		/* 4e */ { 722, 12, -11, 707, 662 }, { 722, 34, -14, 688, 676 }, { 556, 16, 0, 542, 662 },
+		/* 51 */ { 722, 34, -178, 701, 676 }, { 667, 17, 0, 659, 662 }, { 556, 42, -14, 491, 676 },
+		/* 54 */ { 611, 17, 0, 593, 662 }, { 722, 14, -14, 705, 662 }, { 722, 16, -11, 697, 662 },
+		/* 57 */ { 944, 5, -11, 932, 662 }, { 722, 10, 0, 704, 662 }, { 722, 22, 0, 703, 662 },
+		/* 5a */ { 611, 9, 0, 597, 662 }, { 333, 88, -156, 299, 662 }, { 278, -9, -14, 287, 676 },
+		/* 5d */ { 333, 34, -156, 245, 662 }, { 469, 24, 297, 446, 662 }, { 500, 0, -125, 500, -75 },
+		/* 60 */ { 333, 19, 507, 242, 678 }, { 444, 37, -10, 442, 460 }, { 500, 3, -10, 468, 683 },
+		/* 63 */ { 444, 25, -10, 412, 460 }, { 500, 27, -10, 491, 683 }, { 444, 25, -10, 424, 460 },
+		/* 66 */ { 333, 20, 0, 383, 683 }, { 500, 28, -218, 470, 460 }, { 500, 9, 0, 487, 683 },
+		/* 69 */ { 278, 16, 0, 253, 683 }, { 278, -70, -218, 194, 683 }, { 500, 7, 0, 505, 683 },
+		/* 6c */ { 278, 19, 0, 257, 683 }, { 778, 16, 0, 775, 460 }, { 500, 16, 0, 485, 460 },
+		/* 6f */ { 500, 29, -10, 470, 460 }, { 500, 5, -217, 470, 460 }, { 500, 24, -217, 488, 460 },
+		/* 72 */ { 333, 5, 0, 335, 460 }, { 389, 51, -10, 348, 460 }, { 278, 13, -10, 279, 579 },
+		/* 75 */ { 500, 9, -10, 479, 450 }, { 500, 19, -14, 477, 450 }, { 722, 21, -14, 694, 450 },
+		/* 78 */ { 500, 17, 0, 479, 450 }, { 500, 14, -218, 475, 450 }, { 444, 27, 0, 418, 450 },
+		/* 7b */ { 480, 100, -181, 350, 680 }, { 200, 67, -218, 133, 782 }, { 480, 130, -181, 380, 680 },
+		/* 7e */ { 541, 40, 183, 502, 323 }, { 0, 0, 0, 0, 0 }, { 500, 0, 0, 0, 0 },
+		/* 81 */ { 0, 0, 0, 0, 0 }, { 333, 79, -141, 218, 102 }, { 500, 7, -189, 490, 676 },
+		/* 84 */ { 444, 45, -141, 416, 102 }, { 1000, 111, -11, 888, 100 }, { 500, 59, -149, 442, 676 },
+		/* 87 */ { 500, 58, -153, 442, 676 }, { 333, 11, 507, 322, 674 }, { 1000, 7, -19, 994, 706 },
+		/* 8a */ { 556, 42, -14, 491, 886 }, { 333, 63, 33, 285, 416 }, { 889, 30, -6, 885, 668 },
+		/* 8d */ { 0, 0, 0, 0, 0 }, { 611, 9, 0, 597, 886 }, { 0, 0, 0, 0, 0 },
+		/* 90 */ { 0, 0, 0, 0, 0 }, { 333, 115, 433, 254, 676 }, { 333, 79, 433, 218, 676 },
+		/* 93 */ { 444, 43, 433, 414, 676 }, { 444, 30, 433, 401, 676 }, { 350, 40, 196, 310, 466 },
+		/* 96 */ { 500, 0, 201, 500, 250 }, { 1000, 0, 201, 1000, 250 }, { 333, 1, 532, 331, 638 },
+		/* 99 */ { 980, 30, 256, 957, 662 }, { 389, 39, -10, 350, 674 }, { 333, 48, 33, 270, 416 },
+		/* 9c */ { 722, 30, -10, 690, 460 }, { 0, 0, 0, 0, 0 }, { 444, 27, 0, 418, 674 },
+		/* 9f */ { 722, 22, 0, 703, 835 }, { 250, 0, 0, 0, 0 }, { 333, 97, -218, 205, 467 },
+		/* a2 */ { 500, 53, -138, 448, 579 }, { 500, 12, -8, 490, 676 }, { 500, -22, 58, 522, 602 },
+		/* a5 */ { 500, -53, 0, 512, 662 }, { 200, 67, -143, 133, 707 }, { 500, 70, -148, 426, 676 },
+		/* a8 */ { 333, 18, 581, 315, 681 }, { 760, 38, -14, 722, 676 }, { 276, 4, 394, 270, 676 },
+		/* ab */ { 500, 42, 33, 456, 416 }, { 564, 30, 108, 534, 386 }, { 333, 39, 194, 285, 257 },
+		/* ae */ { 760, 38, -14, 722, 676 }, { 333, 11, 547, 322, 601 }, { 400, 57, 390, 343, 676 },
+		/* b1 */ { 564, 30, 0, 534, 506 }, { 300, 1, 270, 296, 676 }, { 300, 15, 262, 291, 676 },
+		/* b4 */ { 333, 93, 507, 317, 678 }, { 500, 36, -218, 512, 450 }, { 453, -22, -154, 450, 662 },
+		/* b7 */ { 250, 70, 199, 181, 310 }, { 333, 52, -215, 261, 0 }, { 300, 57, 270, 248, 676 },
+		/* ba */ { 310, 6, 394, 304, 676 }, { 500, 44, 33, 458, 416 }, { 750, 37, -14, 718, 676 },
+		/* bd */ { 750, 31, -14, 746, 676 }, { 750, 15, -14, 718, 676 }, { 444, 30, -218, 376, 466 },
+		/* c0 */ { 722, 15, 0, 706, 890 }, { 722, 15, 0, 706, 890 }, { 722, 15, 0, 706, 886 },
+		/* c3 */ { 722, 15, 0, 706, 850 }, { 722, 15, 0, 706, 835 }, { 722, 15, 0, 706, 898 },
+		/* c6 */ { 889, 0, 0, 863, 662 }, { 667, 28, -215, 633, 676 }, { 611, 12, 0, 597, 890 },
+		/* c9 */ { 611, 12, 0, 597, 890 }, { 611, 12, 0, 597, 886 }, { 611, 12, 0, 597, 835 },
+		/* cc */ { 333, 18, 0, 315, 890 }, { 333, 18, 0, 317, 890 }, { 333, 11, 0, 322, 886 },
+		/* cf */ { 333, 18, 0, 315, 835 }, { 722, 16, 0, 685, 662 }, { 722, 12, -11, 707, 850 },
+		/* d2 */ { 722, 34, -14, 688, 890 }, { 722, 34, -14, 688, 890 }, { 722, 34, -14, 688, 886 },
+		/* d5 */ { 722, 34, -14, 688, 850 }, { 722, 34, -14, 688, 835 }, { 564, 38, 8, 527, 497 },
+		/* d8 */ { 722, 34, -80, 688, 734 }, { 722, 14, -14, 705, 890 }, { 722, 14, -14, 705, 890 },
+		/* db */ { 722, 14, -14, 705, 886 }, { 722, 14, -14, 705, 835 }, { 722, 22, 0, 703, 890 },
+		/* de */ { 556, 16, 0, 542, 662 }, { 500, 12, -9, 468, 683 }, { 444, 37, -10, 442, 678 },
+		/* e1 */ { 444, 37, -10, 442, 678 }, { 444, 37, -10, 442, 674 }, { 444, 37, -10, 442, 638 },
+		/* e4 */ { 444, 37, -10, 442, 623 }, { 444, 37, -10, 442, 711 }, { 667, 38, -10, 632, 460 },
+		/* e7 */ { 444, 25, -215, 412, 460 }, { 444, 25, -10, 424, 678 }, { 444, 25, -10, 424, 678 },
+		/* ea */ { 444, 25, -10, 424, 674 }, { 444, 25, -10, 424, 623 }, { 278, -8, 0, 253, 678 },
+		/* ed */ { 278, 16, 0, 290, 678 }, { 278, -16, 0, 295, 674 }, { 278, -9, 0, 288, 623 },
+		/* f0 */ { 500, 29, -10, 471, 686 }, { 500, 16, 0, 485, 638 }, { 500, 29, -10, 470, 678 },
+		/* f3 */ { 500, 29, -10, 470, 678 }, { 500, 29, -10, 470, 674 }, { 500, 29, -10, 470, 638 },
+		/* f6 */ { 500, 29, -10, 470, 623 }, { 564, 30, -10, 534, 516 }, { 500, 29, -112, 470, 551 },
+		/* f9 */ { 500, 9, -10, 479, 678 }, { 500, 9, -10, 479, 678 }, { 500, 9, -10, 479, 674 },
+		/* fc */ { 500, 9, -10, 479, 623 }, { 500, 14, -218, 475, 678 }, { 500, 5, -217, 470, 683 },
+		/* ff */ { 500, 14, -218, 475, 623 },
+	};
+
+	static constexpr KerningPair TIMES_ROMAN_KERNING[] = {
+		{ 32, 65, -55 }, { 32, 84, -18 }, { 32, 86, -50 }, { 32, 87, -30 }, { 32, 89, -90 }, { 32, 159, -90 },
+		{ 32, 192, -55 }, { 32, 193, -55 }, { 32, 194, -55 }, { 32, 195, -55 }, { 32, 196, -55 }, { 32, 197, -55 },
+		{ 32, 221, -90 }, { 44, 146, -70 }, { 44, 148, -70 }, { 46, 146, -70 }, { 46, 148, -70 }, { 65, 67, -40 },
+		{ 65, 71, -40 }, { 65, 79, -55 }, { 65, 81, -55 }, { 65, 84, -111 }, { 65, 85, -55 }, { 65, 86, -135 },
+		{ 65, 87, -90 }, { 65, 89, -105 }, { 65, 118, -74 }, { 65, 119, -92 }, { 65, 121, -92 }, { 65, 146, -111 },
+		{ 65, 159, -105 }, { 65, 199, -40 }, { 65, 210, -55 }, { 65, 211, -55 }, { 65, 212, -55 }, { 65, 213, -55 },
+		{ 65, 214, -55 }, { 65, 216, -55 }, { 65, 217, -55 }, { 65, 218, -55 }, { 65, 219, -55 }, { 65, 220, -55 },
+		{ 65, 221, -105 }, { 65, 253, -92 }, { 65, 255, -92 }, { 66, 65, -35 }, { 66, 85, -10 }, { 66, 192, -35 },
+		{ 66, 193, -35 }, { 66, 194, -35 }, { 66, 195, -35 }, { 66, 196, -35 }, { 66, 197, -35 }, { 66, 217, -10 },
+		{ 66, 218, -10 }, { 66, 219, -10 }, { 66, 220, -10 }, { 68, 65, -40 }, { 68, 86, -40 }, { 68, 87, -30 },
+		{ 68, 89, -55 }, { 68, 159, -55 }, { 68, 192, -40 }, { 68, 193, -40 }, { 68, 194, -40 }, { 68, 195, -40 },
+		{ 68, 196, -40 }, { 68, 197, -40 }, { 68, 221, -55 }, { 70, 44, -80 }, { 70, 46, -80 }, { 70, 65, -74 },
+		{ 70, 97, -15 }, { 70, 111, -15 }, { 70, 192, -74 }, { 70, 193, -74 }, { 70, 194, -74 }, { 70, 195, -74 },
+		{ 70, 196, -74 }, { 70, 197, -74 }, { 70, 224, -15 }, { 70, 225, -15 }, { 70, 226, -15 }, { 70, 227, -15 },
+		{ 70, 228, -15 }, { 70, 229, -15 }, { 70, 242, -15 }, { 70, 243, -15 }, { 70, 244, -15 }, { 70, 245, -15 },
+		{ 70, 246, -15 }, { 70, 248, -15 }, { 74, 65, -60 }, { 74, 192, -60 }, { 74, 193, -60 }, { 74, 194, -60 },
+		{ 74, 195, -60 }, { 74, 196, -60 }, { 74, 197, -60 }, { 75, 79, -30 }, { 75, 101, -25 }, { 75, 111, -35 },
+		{ 75, 117, -15 }, { 75, 121, -25 }, { 75, 210, -30 }, { 75, 211, -30 }, { 75, 212, -30 }, { 75, 213, -30 },
+		{ 75, 214, -30 }, { 75, 216, -30 }, { 75, 232, -25 }, { 75, 233, -25 }, { 75, 234, -25 }, { 75, 235, -25 },
+		{ 75, 242, -35 }, { 75, 243, -35 }, { 75, 244, -35 }, { 75, 245, -35 }, { 75, 246, -35 }, { 75, 248, -35 },
+		{ 75, 249, -15 }, { 75, 250, -15 }, { 75, 251, -15 }, { 75, 252, -15 }, { 75, 253, -25 }, { 75, 255, -25 },
+		{ 76, 84, -92 }, { 76, 86, -100 }, { 76, 87, -74 }, { 76, 89, -100 }, { 76, 121, -55 }, { 76, 146, -92 },
+		{ 76, 159, -100 }, { 76, 221, -100 }, { 76, 253, -55 }, { 76, 255, -55 }, { 78, 65, -35 }, { 78, 192, -35 },
+		{ 78, 193, -35 }, { 78, 194, -35 }, { 78, 195, -35 }, { 78, 196, -35 }, { 78, 197, -35 }, { 79, 65, -35 },
+		{ 79, 84, -40 }, { 79, 86, -50 }, { 79, 87, -35 }, { 79, 88, -40 }, { 79, 89, -50 }, { 79, 159, -50 },
+		{ 79, 192, -35 }, { 79, 193, -35 }, { 79, 194, -35 }, { 79, 195, -35 }, { 79, 196, -35 }, { 79, 197, -35 },
+		{ 79, 221, -50 }, { 80, 44, -111 }, { 80, 46, -111 }, { 80, 65, -92 }, { 80, 97, -15 }, { 80, 192, -92 },
+		{ 80, 193, -92 }, { 80, 194, -92 }, { 80, 195, -92 }, { 80, 196, -92 }, { 80, 197, -92 }, { 80, 224, -15 },
+		{ 80, 225, -15 }, { 80, 226, -15 }, { 80, 227, -15 }, { 80, 228, -15 }, { 80, 229, -15 }, { 81, 85, -10 },
+		{ 81, 217, -10 }, { 81, 218, -10 }, { 81, 219, -10 }, { 81, 220, -10 }, { 82, 79, -40 }, { 82, 84, -60 },
+		{ 82, 85, -40 }, { 82, 86, -80 }, { 82, 87, -55 }, { 82, 89, -65 }, { 82, 159, -65 }, { 82, 210, -40 },
+		{ 82, 211, -40 }, { 82, 212, -40 }, { 82, 213, -40 }, { 82, 214, -40 }, { 82, 216, -40 }, { 82, 217, -40 },
+		{ 82, 218, -40 }, { 82, 219, -40 }, { 82, 220, -40 }, { 82, 221, -65 }, { 84, 44, -74 }, { 84, 45, -92 },
+		{ 84, 46, -74 }, { 84, 58, -50 }, { 84, 59, -55 }, { 84, 65, -93 }, { 84, 79, -18 }, { 84, 97, -80 },
+		{ 84, 101, -70 }, { 84, 105, -35 }, { 84, 111, -80 }, { 84, 114, -35 }, { 84, 117, -45 }, { 84, 119, -80 },
+		{ 84, 121, -80 }, { 84, 173, -92 }, { 84, 192, -93 }, { 84, 193, -93 }, { 84, 194, -93 }, { 84, 195, -93 },
+		{ 84, 196, -93 }, { 84, 197, -93 }, { 84, 210, -18 }, { 84, 211, -18 }, { 84, 212, -18 }, { 84, 213, -18 },
+		{ 84, 214, -18 }, { 84, 216, -18 }, { 84, 224, -40 }, { 84, 225, -80 }, { 84, 226, -80 }, { 84, 227, -40 },
+		{ 84, 228, -40 }, { 84, 229, -80 }, { 84, 232, -70 }, { 84, 233, -70 }, { 84, 234, -70 }, { 84, 235, -30 },
+		{ 84, 237, -35 }, { 84, 242, -80 }, { 84, 243, -80 }, { 84, 244, -80 }, { 84, 245, -80 }, { 84, 246, -80 },
+		{ 84, 248, -80 }, { 84, 249, -45 }, { 84, 250, -45 }, { 84, 251, -45 }, { 84, 252, -45 }, { 84, 253, -80 },
+		{ 84, 255, -80 }, { 85, 65, -40 }, { 85, 192, -40 }, { 85, 193, -40 }, { 85, 194, -40 }, { 85, 195, -40 },
+		{ 85, 196, -40 }, { 85, 197, -40 }, { 86, 44, -129 }, { 86, 45, -100 }, { 86, 46, -129 }, { 86, 58, -74 },
+		{ 86, 59, -74 }, { 86, 65, -135 }, { 86, 71, -15 }, { 86, 79, -40 }, { 86, 97, -111 }, { 86, 101, -111 },
+		{ 86, 105, -60 }, { 86, 111, -129 }, { 86, 117, -75 }, { 86, 173, -100 }, { 86, 192, -135 }, { 86, 193, -135 },
+		{ 86, 194, -135 }, { 86, 195, -135 }, { 86, 196, -135 }, { 86, 197, -135 }, { 86, 210, -40 }, { 86, 211, -40 },
+		{ 86, 212, -40 }, { 86, 213, -40 }, { 86, 214, -40 }, { 86, 216, -40 }, { 86, 224, -71 }, { 86, 225, -111 },
+		{ 86, 226, -71 }, { 86, 227, -71 }, { 86, 228, -71 }, { 86, 229, -111 }, { 86, 232, -71 }, { 86, 233, -111 },
+		{ 86, 234, -71 }, { 86, 235, -71 }, { 86, 236, -20 }, { 86, 237, -60 }, { 86, 238, -20 }, { 86, 239, -20 },
+		{ 86, 242, -89 }, { 86, 243, -129 }, { 86, 244, -129 }, { 86, 245, -89 }, { 86, 246, -89 }, { 86, 248, -129 },
+		{ 86, 249, -75 }, { 86, 250, -75 }, { 86, 251, -75 }, { 86, 252, -75 }, { 87, 44, -92 }, { 87, 45, -65 },
+		{ 87, 46, -92 }, { 87, 58, -37 }, { 87, 59, -37 }, { 87, 65, -120 }, { 87, 79, -10 }, { 87, 97, -80 },
+		{ 87, 101, -80 }, { 87, 105, -40 }, { 87, 111, -80 }, { 87, 117, -50 }, { 87, 121, -73 }, { 87, 173, -65 },
+		{ 87, 192, -120 }, { 87, 193, -120 }, { 87, 194, -120 }, { 87, 195, -120 }, { 87, 196, -120 }, { 87, 197, -120 },
+		{ 87, 210, -10 }, { 87, 211, -10 }, { 87, 212, -10 }, { 87, 213, -10 }, { 87, 214, -10 }, { 87, 216, -10 },
+		{ 87, 224, -80 }, { 87, 225, -80 }, { 87, 226, -80 }, { 87, 227, -80 }, { 87, 228, -80 }, { 87, 229, -80 },
+		{ 87, 232, -40 }, { 87, 233, -80 }, { 87, 234, -80 }, { 87, 235, -40 }, { 87, 237, -40 }, { 87, 242, -80 },
+		{ 87, 243, -80 }, { 87, 244, -80 }, { 87, 245, -80 }, { 87, 246, -80 }, { 87, 248, -80 }, { 87, 249, -50 },
+		{ 87, 250, -50 }, { 87, 251, -50 }, { 87, 252, -50 }, { 87, 253, -73 }, { 87, 255, -73 }, { 89, 44, -129 },
+		{ 89, 45, -111 }, { 89, 46, -129 }, { 89, 58, -92 }, { 89, 59, -92 }, { 89, 65, -120 }, { 89, 79, -30 },
+		{ 89, 97, -100 }, { 89, 101, -100 }, { 89, 105, -55 }, { 89, 111, -110 }, { 89, 117, -111 }, { 89, 173, -111 },
+		{ 89, 192, -120 }, { 89, 193, -120 }, { 89, 194, -120 }, { 89, 195, -120 }, { 89, 196, -120 }, { 89, 197, -120 },
+		{ 89, 210, -30 }, { 89, 211, -30 }, { 89, 212, -30 }, { 89, 213, -30 }, { 89, 214, -30 }, { 89, 216, -30 },
+		{ 89, 224, -60 }, { 89, 225, -100 }, { 89, 226, -100 }, { 89, 227, -60 }, { 89, 228, -60 }, { 89, 229, -100 },
+		{ 89, 232, -60 }, { 89, 233, -100 }, { 89, 234, -100 }, { 89, 235, -60 }, { 89, 237, -55 }, { 89, 242, -70 },
+		{ 89, 243, -110 }, { 89, 244, -110 }, { 89, 245, -70 }, { 89, 246, -70 }, { 89, 248, -110 }, { 89, 249, -71 },
+		{ 89, 250, -111 }, { 89, 251, -111 }, { 89, 252, -71 }, { 97, 118, -20 }, { 97, 119, -15 }, { 98, 46, -40 },
+		{ 98, 117, -20 }, { 98, 118, -15 }, { 98, 249, -20 }, { 98, 250, -20 }, { 98, 251, -20 }, { 98, 252, -20 },
+		{ 99, 121, -15 }, { 99, 253, -15 }, { 99, 255, -15 }, { 101, 103, -15 }, { 101, 118, -25 }, { 101, 119, -25 },
+		{ 101, 120, -15 }, { 101, 121, -15 }, { 101, 253, -15 }, { 101, 255, -15 }, { 102, 97, -10 }, { 102, 102, -25 },
+		{ 102, 105, -20 }, { 102, 146, 55 }, { 102, 224, -10 }, { 102, 225, -10 }, { 102, 226, -10 }, { 102, 227, -10 },
+		{ 102, 228, -10 }, { 102, 229, -10 }, { 102, 237, -20 }, { 103, 97, -5 }, { 103, 224, -5 }, { 103, 225, -5 },
+		{ 103, 226, -5 }, { 103, 227, -5 }, { 103, 228, -5 }, { 103, 229, -5 }, { 104, 121, -5 }, { 104, 253, -5 },
+		{ 104, 255, -5 }, { 105, 118, -25 }, { 107, 101, -10 }, { 107, 111, -10 }, { 107, 121, -15 }, { 107, 232, -10 },
+		{ 107, 233, -10 }, { 107, 234, -10 }, { 107, 235, -10 }, { 107, 242, -10 }, { 107, 243, -10 }, { 107, 244, -10 },
+		{ 107, 245, -10 }, { 107, 246, -10 }, { 107, 248, -10 }, { 107, 253, -15 }, { 107, 255, -15 }, { 108, 119, -10 },
+		{ 110, 118, -40 }, { 110, 121, -15 }, { 110, 253, -15 }, { 110, 255, -15 }, { 111, 118, -15 }, { 111, 119, -25 },
+		{ 111, 121, -10 }, { 111, 253, -10 }, { 111, 255, -10 }, { 112, 121, -10 }, { 112, 253, -10 }, { 112, 255, -10 },
+		{ 114, 44, -40 }, { 114, 45, -20 }, { 114, 46, -55 }, { 114, 103, -18 }, { 114, 173, -20 }, { 118, 44, -65 },
+		{ 118, 46, -65 }, { 118, 97, -25 }, { 118, 101, -15 }, { 118, 111, -20 }, { 118, 224, -25 }, { 118, 225, -25 },
+		{ 118, 226, -25 }, { 118, 227, -25 }, { 118, 228, -25 }, { 118, 229, -25 }, { 118, 232, -15 }, { 118, 233, -15 },
+		{ 118, 234, -15 }, { 118, 235, -15 }, { 118, 242, -20 }, { 118, 243, -20 }, { 118, 244, -20 }, { 118, 245, -20 },
+		{ 118, 246, -20 }, { 118, 248, -20 }, { 119, 44, -65 }, { 119, 46, -65 }, { 119, 97, -10 }, { 119, 111, -10 },
+		{ 119, 224, -10 }, { 119, 225, -10 }, { 119, 226, -10 }, { 119, 227, -10 }, { 119, 228, -10 }, { 119, 229, -10 },
+		{ 119, 242, -10 }, { 119, 243, -10 }, { 119, 244, -10 }, { 119, 245, -10 }, { 119, 246, -10 }, { 119, 248, -10 },
+		{ 120, 101, -15 }, { 120, 232, -15 }, { 120, 233, -15 }, { 120, 234, -15 }, { 120, 235, -15 }, { 121, 44, -65 },
+		{ 121, 46, -65 }, { 145, 65, -80 }, { 145, 145, -74 }, { 145, 192, -80 }, { 145, 193, -80 }, { 145, 194, -80 },
+		{ 145, 195, -80 }, { 145, 196, -80 }, { 145, 197, -80 }, { 146, 32, -74 }, { 146, 100, -50 }, { 146, 108, -10 },
+		{ 146, 114, -50 }, { 146, 115, -55 }, { 146, 116, -18 }, { 146, 118, -50 }, { 146, 146, -74 }, { 146, 154, -55 },
+		{ 146, 160, -74 }, { 147, 65, -80 }, { 147, 192, -80 }, { 147, 193, -80 }, { 147, 194, -80 }, { 147, 195, -80 },
+		{ 147, 196, -80 }, { 147, 197, -80 }, { 159, 44, -129 }, { 159, 45, -111 }, { 159, 46, -129 }, { 159, 58, -92 },
+		{ 159, 59, -92 }, { 159, 65, -120 }, { 159, 79, -30 }, { 159, 97, -100 }, { 159, 101, -100 }, { 159, 105, -55 },
+		{ 159, 111, -110 }, { 159, 117, -111 }, { 159, 173, -111 }, { 159, 192, -120 }, { 159, 193, -120 }, { 159, 194, -120 },
+		{ 159, 195, -120 }, { 159, 196, -120 }, { 159, 197, -120 }, { 159, 210, -30 }, { 159, 211, -30 }, { 159, 212, -30 },
+		{ 159, 213, -30 }, { 159, 214, -30 }, { 159, 216, -30 }, { 159, 224, -60 }, { 159, 225, -100 }, { 159, 226, -100 },
+		{ 159, 227, -100 }, { 159, 228, -60 }, { 159, 229, -100 }, { 159, 232, -60 }, { 159, 233, -100 }, { 159, 234, -100 },
+		{ 159, 235, -60 }, { 159, 237, -55 }, { 159, 242, -70 }, { 159, 243, -110 }, { 159, 244, -110 }, { 159, 245, -70 },
+		{ 159, 246, -70 }, { 159, 248, -110 }, { 159, 249, -71 }, { 159, 250, -111 }, { 159, 251, -111 }, { 159, 252, -71 },
+		{ 160, 65, -55 }, { 160, 84, -18 }, { 160, 86, -50 }, { 160, 87, -30 }, { 160, 89, -90 }, { 160, 159, -90 },
+		{ 160, 192, -55 }, { 160, 193, -55 }, { 160, 194, -55 }, { 160, 195, -55 }, { 160, 196, -55 }, { 160, 197, -55 },
+		{ 160, 221, -90 }, { 192, 67, -40 }, { 192, 71, -40 }, { 192, 79, -55 }, { 192, 81, -55 }, { 192, 84, -111 },
+		{ 192, 85, -55 }, { 192, 86, -135 }, { 192, 87, -90 }, { 192, 89, -105 }, { 192, 118, -74 }, { 192, 119, -92 },
+		{ 192, 121, -92 }, { 192, 146, -111 }, { 192, 159, -105 }, { 192, 199, -40 }, { 192, 210, -55 }, { 192, 211, -55 },
+		{ 192, 212, -55 }, { 192, 213, -55 }, { 192, 214, -55 }, { 192, 216, -55 }, { 192, 217, -55 }, { 192, 218, -55 },
+		{ 192, 219, -55 }, { 192, 220, -55 }, { 192, 221, -105 }, { 192, 253, -92 }, { 192, 255, -92 }, { 193, 67, -40 },
+		{ 193, 71, -40 }, { 193, 79, -55 }, { 193, 81, -55 }, { 193, 84, -111 }, { 193, 85, -55 }, { 193, 86, -135 },
+		{ 193, 87, -90 }, { 193, 89, -105 }, { 193, 118, -74 }, { 193, 119, -92 }, { 193, 121, -92 }, { 193, 146, -111 },
+		{ 193, 159, -105 }, { 193, 199, -40 }, { 193, 210, -55 }, { 193, 211, -55 }, { 193, 212, -55 }, { 193, 213, -55 },
+		{ 193, 214, -55 }, { 193, 216, -55 }, { 193, 217, -55 }, { 193, 218, -55 }, { 193, 219, -55 }, { 193, 220, -55 },
+		{ 193, 221, -105 }, { 193, 253, -92 }, { 193, 255, -92 }, { 194, 67, -40 }, { 194, 71, -40 }, { 194, 79, -55 },
+		{ 194, 81, -55 }, { 194, 84, -111 }, { 194, 85, -55 }, { 194, 86, -135 }, { 194, 87, -90 }, { 194, 89, -105 },
+		{ 194, 118, -74 }, { 194, 119, -92 }, { 194, 121, -92 }, { 194, 146, -111 }, { 194, 159, -105 }, { 194, 199, -40 },
+		{ 194, 210, -55 }, { 194, 211, -55 }, { 194, 212, -55 }, { 194, 213, -55 }, { 194, 214, -55 }, { 194, 216, -55 },
+		{ 194, 217, -55 }, { 194, 218, -55 }, { 194, 219, -55 }, { 194, 220, -55 }, { 194, 221, -105 }, { 194, 253, -92 },
+		{ 194, 255, -92 }, { 195, 67, -40 }, { 195, 71, -40 }, { 195, 79, -55 }, { 195, 81, -55 }, { 195, 84, -111 },
+		{ 195, 85, -55 }, { 195, 86, -135 }, { 195, 87, -90 }, { 195, 89, -105 }, { 195, 118, -74 }, { 195, 119, -92 },
+		{ 195, 121, -92 }, { 195, 146, -111 }, { 195, 159, -105 }, { 195, 199, -40 }, { 195, 210, -55 }, { 195, 211, -55 },
+		{ 195, 212, -55 }, { 195, 213, -55 }, { 195, 214, -55 }, { 195, 216, -55 }, { 195, 217, -55 }, { 195, 218, -55 },
+		{ 195, 219, -55 }, { 195, 220, -55 }, { 195, 221, -105 }, { 195, 253, -92 }, { 195, 255, -92 }, { 196, 67, -40 },
+		{ 196, 71, -40 }, { 196, 79, -55 }, { 196, 81, -55 }, { 196, 84, -111 }, { 196, 85, -55 }, { 196, 86, -135 },
+		{ 196, 87, -90 }, { 196, 89, -105 }, { 196, 118, -74 }, { 196, 119, -92 }, { 196, 121, -92 }, { 196, 146, -111 },
+		{ 196, 159, -105 }, { 196, 199, -40 }, { 196, 210, -55 }, { 196, 211, -55 }, { 196, 212, -55 }, { 196, 213, -55 },
+		{ 196, 214, -55 }, { 196, 216, -55 }, { 196, 217, -55 }, { 196, 218, -55 }, { 196, 219, -55 }, { 196, 220, -55 },
+		{ 196, 221, -105 }, { 196, 253, -92 }, { 196, 255, -92 }, { 197, 67, -40 }, { 197, 71, -40 }, { 197, 79, -55 },
+		{ 197, 81, -55 }, { 197, 84, -111 }, { 197, 85, -55 }, { 197, 86, -135 }, { 197, 87, -90 }, { 197, 89, -105 },
+		{ 197, 118, -74 }, { 197, 119, -92 }, { 197, 121, -92 }, { 197, 146, -111 }, { 197, 159, -105 }, { 197, 199, -40 },
+		{ 197, 210, -55 }, { 197, 211, -55 }, { 197, 212, -55 }, { 197, 213, -55 }, { 197, 214, -55 }, { 197, 216, -55 },
+		{ 197, 217, -55 }, { 197, 218, -55 }, { 197, 219, -55 }, { 197, 220, -55 }, { 197, 221, -105 }, { 197, 253, -92 },
+		{ 197, 255, -92 }, { 209, 65, -35 }, { 209, 192, -35 }, { 209, 193, -35 }, { 209, 194, -35 }, { 209, 195, -35 },
+		{ 209, 196, -35 }, { 209, 197, -35 }, { 210, 65, -35 }, { 210, 84, -40 }, { 210, 86, -50 }, { 210, 87, -35 },
+		{ 210, 88, -40 }, { 210, 89, -50 }, { 210, 159, -50 }, { 210, 192, -35 }, { 210, 193, -35 }, { 210, 194, -35 },
+		{ 210, 195, -35 }, { 210, 196, -35 }, { 210, 197, -35 }, { 210, 221, -50 }, { 211, 65, -35 }, { 211, 84, -40 },
+		{ 211, 86, -50 }, { 211, 87, -35 }, { 211, 88, -40 }, { 211, 89, -50 }, { 211, 159, -50 }, { 211, 192, -35 },
+		{ 211, 193, -35 }, { 211, 194, -35 }, { 211, 195, -35 }, { 211, 196, -35 }, { 211, 197, -35 }, { 211, 221, -50 },
+		{ 212, 65, -35 }, { 212, 84, -40 }, { 212, 86, -50 }, { 212, 87, -35 }, { 212, 88, -40 }, { 212, 89, -50 },
+		{ 212, 159, -50 }, { 212, 192, -35 }, { 212, 193, -35 }, { 212, 194, -35 }, { 212, 195, -35 }, { 212, 196, -35 },
+		{ 212, 197, -35 }, { 212, 221, -50 }, { 213, 65, -35 }, { 213, 84, -40 }, { 213, 86, -50 }, { 213, 87, -35 },
+		{ 213, 88, -40 }, { 213, 89, -50 }, { 213, 159, -50 }, { 213, 192, -35 }, { 213, 193, -35 }, { 213, 194, -35 },
+		{ 213, 195, -35 }, { 213, 196, -35 }, { 213, 197, -35 }, { 213, 221, -50 }, { 214, 65, -35 }, { 214, 84, -40 },
+		{ 214, 86, -50 }, { 214, 87, -35 }, { 214, 88, -40 }, { 214, 89, -50 }, { 214, 159, -50 }, { 214, 192, -35 },
+		{ 214, 193, -35 }, { 214, 194, -35 }, { 214, 195, -35 }, { 214, 196, -35 }, { 214, 197, -35 }, { 214, 221, -50 },
+		{ 216, 65, -35 }, { 216, 84, -40 }, { 216, 86, -50 }, { 216, 87, -35 }, { 216, 88, -40 }, { 216, 89, -50 },
+		{ 216, 159, -50 }, { 216, 192, -35 }, { 216, 193, -35 }, { 216, 194, -35 }, { 216, 195, -35 }, { 216, 196, -35 },
+		{ 216, 197, -35 }, { 216, 221, -50 }, { 217, 65, -40 }, { 217, 192, -40 }, { 217, 193, -40 }, { 217, 194, -40 },
+		{ 217, 195, -40 }, { 217, 196, -40 }, { 217, 197, -40 }, { 218, 65, -40 }, { 218, 192, -40 }, { 218, 193, -40 },
+		{ 218, 194, -40 }, { 218, 195, -40 }, { 218, 196, -40 }, { 218, 197, -40 }, { 219, 65, -40 }, { 219, 192, -40 },
+		{ 219, 193, -40 }, { 219, 194, -40 }, { 219, 195, -40 }, { 219, 196, -40 }, { 219, 197, -40 }, { 220, 65, -40 },
+		{ 220, 192, -40 }, { 220, 193, -40 }, { 220, 194, -40 }, { 220, 195, -40 }, { 220, 196, -40 }, { 220, 197, -40 },
+		{ 221, 44, -129 }, { 221, 45, -111 }, { 221, 46, -129 }, { 221, 58, -92 }, { 221, 59, -92 }, { 221, 65, -120 },
+		{ 221, 79, -30 }, { 221, 97, -100 }, { 221, 101, -100 }, { 221, 105, -55 }, { 221, 111, -110 }, { 221, 117, -111 },
+		{ 221, 173, -111 }, { 221, 192, -120 }, { 221, 193, -120 }, { 221, 194, -120 }, { 221, 195, -120 }, { 221, 196, -120 },
+		{ 221, 197, -120 }, { 221, 210, -30 }, { 221, 211, -30 }, { 221, 212, -30 }, { 221, 213, -30 }, { 221, 214, -30 },
+		{ 221, 216, -30 }, { 221, 224, -60 }, { 221, 225, -100 }, { 221, 226, -100 }, { 221, 227, -60 }, { 221, 228, -60 },
+		{ 221, 229, -100 }, { 221, 232, -60 }, { 221, 233, -100 }, { 221, 234, -100 }, { 221, 235, -60 }, { 221, 237, -55 },
+		{ 221, 242, -70 }, { 221, 243, -110 }, { 221, 244, -110 }, { 221, 245, -70 }, { 221, 246, -70 }, { 221, 248, -110 },
+		{ 221, 249, -71 }, { 221, 250, -111 }, { 221, 251, -111 }, { 221, 252, -71 }, { 224, 118, -20 }, { 224, 119, -15 },
+		{ 225, 118, -20 }, { 225, 119, -15 }, { 226, 118, -20 }, { 226, 119, -15 }, { 227, 118, -20 }, { 227, 119, -15 },
+		{ 228, 118, -20 }, { 228, 119, -15 }, { 229, 118, -20 }, { 229, 119, -15 }, { 231, 121, -15 }, { 231, 253, -15 },
+		{ 231, 255, -15 }, { 232, 103, -15 }, { 232, 118, -25 }, { 232, 119, -25 }, { 232, 120, -15 }, { 232, 121, -15 },
+		{ 232, 253, -15 }, { 232, 255, -15 }, { 233, 103, -15 }, { 233, 118, -25 }, { 233, 119, -25 }, { 233, 120, -15 },
+		{ 233, 121, -15 }, { 233, 253, -15 }, { 233, 255, -15 }, { 234, 103, -15 }, { 234, 118, -25 }, { 234, 119, -25 },
+		{ 234, 120, -15 }, { 234, 121, -15 }, { 234, 253, -15 }, { 234, 255, -15 }, { 235, 103, -15 }, { 235, 118, -25 },
+		{ 235, 119, -25 }, { 235, 120, -15 }, { 235, 121, -15 }, { 235, 253, -15 }, { 235, 255, -15 }, { 236, 118, -25 },
+		{ 237, 118, -25 }, { 238, 118, -25 }, { 239, 118, -25 }, { 241, 118, -40 }, { 241, 121, -15 }, { 241, 253, -15 },
+		{ 241, 255, -15 }, { 242, 118, -15 }, { 242, 119, -25 }, { 242, 121, -10 }, { 242, 253, -10 }, { 242, 255, -10 },
+		{ 243, 118, -15 }, { 243, 119, -25 }, { 243, 121, -10 }, { 243, 253, -10 }, { 243, 255, -10 }, { 244, 118, -15 },
+		{ 244, 119, -25 }, { 244, 121, -10 }, { 244, 253, -10 }, { 244, 255, -10 }, { 245, 118, -15 }, { 245, 119, -25 },
+		{ 245, 121, -10 }, { 245, 253, -10 }, { 245, 255, -10 }, { 246, 118, -15 }, { 246, 119, -25 }, { 246, 121, -10 },
+		{ 246, 253, -10 }, { 246, 255, -10 }, { 248, 118, -15 }, { 248, 119, -25 }, { 248, 121, -10 }, { 248, 253, -10 },
+		{ 248, 255, -10 }, { 253, 44, -65 }, { 253, 46, -65 }, { 255, 44, -65 }, { 255, 46, -65 },
+	};
+
+	static constexpr GlyphMetrics TIMES_ITALIC_GLYPHS[256] = {
+		/* 00 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 03 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 06 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 09 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0f */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 12 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 15 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 18 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1b */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 250, 0, 0, 0, 0 },
+		/* 21 */ { 333, 39, -11, 302, 667 }, { 420, 144, 421, 432, 666 }, { 500, 2, 0, 540, 676 },
+		/* 24 */ { 500, 31, -89, 497, 731 }, { 833, 79, -13, 790, 676 }, { 778, 76, -18, 723, 666 },
+		/* 27 */ { 214, 132, 421, 241, 666 }, { 333, 42, -181, 315, 669 }, { 333, 16, -180, 289, 669 },
+		/* 2a */ { 500, 128, 255, 492, 666 }, { 675, 86, 0, 590, 506 }, { 250, -4, -129, 135, 101 },
+		/* 2d */ { 333, 49, 192, 282, 255 }, { 250, 27, -11, 138, 100 }, { 278, -65, -18, 386, 666 },
+		/* 30 */ { 500, 32, -7, 497, 676 }, { 500, 49, 0, 409, 676 }, { 500, 12, 0, 452, 676 },
+		/* 33 */ { 500, 15, -7, 465, 676 }, { 500, 1, 0, 479, 676 }, { 500, 15, -7, 491, 666 },
+		/* 36 */ { 500, 30, -7, 521, 686 }, { 500, 75, -8, 537, 666 }, { 500, 30, -7, 493, 676 },
+		/* 39 */ { 500, 23, -17, 492, 676 }, { 333, 50, -11, 261, 441 }, { 333, 27, -129, 261, 441 },
+		/* 3c */ { 675, 84, -8, 592, 514 }, { 675, 86, 120, 590, 386 }, { 675, 84, -8, 592, 514 },
+		/* 3f */ { 500, 132, -12, 472, 664 }, { 920, 118, -18, 806, 666 }, { 611, -51, 0, 564, 668 },
+		/* 42 */ { 611, -8, 0, 588, 653 }, { 667, 66, -18, 689, 666 }, { 722, -8, 0, 700, 653 },
+		/* 45 */ { 611, -1, 0, 634, 653 }, { 611, 8, 0, 645, 653 }, { 722, 52, -18, 722, 666 },
+		/* 48 */ { 722, -8, 0, 767, 653 }, { 333, -8, 0, 384, 653 }, { 444, -6, -18, 491, 653 },
+		/* 4b */ { 667, 7, 0, 722, 653 }, { 556, -8, 0, 559, 653 }, { 833, -18, 0, 873, 653 },
+		/* 4e */ { 667, -20, -15, 727, 653 }, { 722, 60, -18, 699, 666 }, { 611, 0, 0, 605, 653 },
+		/* 51 */ { 722, 59, -182, 699, 666 }, { 611, -13, 0, 588, 653 }, { 500, 17, -18, 508, 667 },
+		/* 54 */ { 556, 59, 0, 633, 653 }, { 722, 102, -18, 765, 653 }, { 611, 76, -18, 688, 653 },
+		/* 57 */ { 833, 71, -18, 906, 653 }, { 611, -29, 0, 655, 653 }, { 556, 78, 0, 633, 653 },
+		/* 5a */ { 556, -6, 0, 606, 653 }, { 389, 21, -153, 391, 663 }, { 278, -41, -18, 319, 666 },
+		/* 5d */ { 389, 12, -153, 382, 663 }, { 422, 0, 301, 422, 666 }, { 500, 0, -125, 500, -75 },
+		/* 60 */ { 333, 121, 492, 311, 664 }, { 500, 17, -11, 476, 441 }, { 500, 23, -11, 473, 683 },
+		/* 63 */ { 444, 30, -11, 425, 441 }, { 500, 15, -13, 527, 683 }, { 444, 31, -11, 412, 441 },
+		/* 66 */ { 278, -147, -207, 424, 678 }, { 500, 8, -206, 472, 441 }, { 500, 19, -9, 478, 683 },
+		/* 69 */ { 278, 49, -11, 264, 654 }, { 278, -124, -207, 276, 654 }, { 444, 14, -11, 461, 683 },
+		/* 6c */ { 278, 41, -11, 279, 683 }, { 722, 12, -9, 704, 441 }, { 500, 14, -9, 474, 441 },
+		/* 6f */ { 500, 27, -11, 468, 441 }, { 500, -75, -205, 469, 441 }, { 500, 25, -209, 483, 441 },
+		/* 72 */ { 389, 45, 0, 412, 441 }, { 389, 16, -13, 366, 442 }, { 278, 37, -11, 296, 546 },
+		/* 75 */ { 500, 42, -11, 475, 441 }, { 444, 21, -18, 426, 441 }, { 667, 16, -18, 648, 441 },
+		/* 78 */ { 444, -27, -11, 447, 441 }, { 444, -24, -206, 426, 441 }, { 389, -2, -81, 380, 428 },
+		/* 7b */ { 400, 51, -177, 407, 687 }, { 275, 105, -217, 171, 783 }, { 400, -7, -177, 349, 687 },
+		/* 7e */ { 541, 40, 183, 502, 323 }, { 0, 0, 0, 0, 0 }, { 500, 0, 0, 0, 0 },
+		/* 81 */ { 0, 0, 0, 0, 0 }, { 333, 44, -129, 183, 101 }, { 500, 25, -182, 507, 682 },
+		/* 84 */ { 556, 57, -129, 405, 101 }, { 889, 57, -11, 762, 100 }, { 500, 101, -159, 488, 666 },
+		/* 87 */ { 500, 22, -143, 491, 666 }, { 333, 91, 492, 385, 661 }, { 1000, 25, -19, 1010, 706 },
+		/* 8a */ { 500, 17, -18, 520, 873 }, { 333, 51, 37, 281, 403 }, { 944, 49, -8, 964, 666 },
+		/* 8d */ { 0, 0, 0, 0, 0 }, { 556, -6, 0, 606, 873 }, { 0, 0, 0, 0, 0 },
+		/* 90 */ { 0, 0, 0, 0, 0 }, { 333, 171, 436, 310, 666 }, { 333, 151, 436, 290, 666 },
+		/* 93 */ { 556, 166, 436, 514, 666 }, { 556, 151, 436, 499, 666 }, { 350, 40, 191, 310, 461 },
+		/* 96 */ { 500, -6, 197, 505, 243 }, { 889, -6, 197, 894, 243 }, { 333, 100, 517, 427, 624 },
+		/* 99 */ { 980, 30, 247, 957, 653 }, { 389, 16, -13, 454, 661 }, { 333, 52, 37, 282, 403 },
+		/* 9c */ { 667, 20, -12, 646, 441 }, { 0, 0, 0, 0, 0 }, { 389, -2, -81, 434, 661 },
+		/* 9f */ { 556, 78, 0, 633, 818 }, { 250, 0, 0, 0, 0 }, { 389, 59, -205, 322, 473 },
+		/* a2 */ { 500, 77, -143, 472, 560 }, { 500, 10, -6, 517, 670 }, { 500, -22, 53, 522, 597 },
+		/* a5 */ { 500, 27, 0, 603, 653 }, { 275, 105, -142, 171, 708 }, { 500, 53, -162, 461, 666 },
+		/* a8 */ { 333, 107, 548, 405, 646 }, { 760, 41, -18, 719, 666 }, { 276, 42, 406, 352, 676 },
+		/* ab */ { 500, 53, 37, 445, 403 }, { 675, 86, 108, 590, 386 }, { 333, 49, 192, 282, 255 },
+		/* ae */ { 760, 41, -18, 719, 666 }, { 333, 99, 532, 411, 583 }, { 400, 101, 390, 387, 676 },
+		/* b1 */ { 675, 86, 0, 590, 506 }, { 300, 33, 271, 324, 676 }, { 300, 43, 268, 339, 676 },
+		/* b4 */ { 333, 180, 494, 403, 664 }, { 500, -30, -209, 497, 428 }, { 523, 55, -123, 616, 653 },
+		/* b7 */ { 250, 70, 199, 181, 310 }, { 333, -30, -217, 182, 0 }, { 300, 43, 271, 284, 676 },
+		/* ba */ { 310, 67, 406, 362, 676 }, { 500, 55, 37, 447, 403 }, { 750, 33, -10, 736, 676 },
+		/* bd */ { 750, 34, -10, 749, 676 }, { 750, 23, -10, 736, 676 }, { 500, 28, -205, 368, 471 },
+		/* c0 */ { 611, -51, 0, 564, 876 }, { 611, -51, 0, 564, 876 }, { 611, -51, 0, 564, 873 },
+		/* c3 */ { 611, -51, 0, 566, 836 }, { 611, -51, 0, 564, 818 }, { 611, -51, 0, 564, 883 },
+		/* c6 */ { 889, -27, 0, 911, 653 }, { 667, 66, -217, 689, 666 }, { 611, -1, 0, 634, 876 },
+		/* c9 */ { 611, -1, 0, 634, 876 }, { 611, -1, 0, 634, 873 }, { 611, -1, 0, 634, 818 },
+		/* cc */ { 333, -8, 0, 384, 876 }, { 333, -8, 0, 433, 876 }, { 333, -8, 0, 425, 873 },
+		/* cf */ { 333, -8, 0, 435, 818 }, { 722, -8, 0, 700, 653 }, { 667, -20, -15, 727, 836 },
+		/* d2 */ { 722, 60, -18, 699, 876 }, { 722, 60, -18, 699, 876 }, { 722, 60, -18, 699, 873 },
+		/* d5 */ { 722, 60, -18, 699, 836 }, { 722, 60, -18, 699, 818 }, { 675, 93, 8, 582, 497 },
+		/* d8 */ { 722, 60, -105, 699, 722 }, { 722, 102, -18, 765, 876 }, { 722, 102, -18, 765, 876 },
+		/* db */ { 722, 102, -18, 765, 873 }, { 722, 102, -18, 765, 818 }, { 556, 78, 0, 633, 876 },
+		/* de */ { 611, 0, 0, 569, 653 }, { 500, -168, -207, 493, 679 }, { 500, 17, -11, 476, 664 },
+		/* e1 */ { 500, 17, -11, 487, 664 }, { 500, 17, -11, 476, 661 }, { 500, 17, -11, 511, 624 },
+		/* e4 */ { 500, 17, -11, 489, 606 }, { 500, 17, -11, 476, 691 }, { 667, 23, -11, 640, 441 },
+		/* e7 */ { 444, 30, -217, 425, 441 }, { 444, 31, -11, 412, 664 }, { 444, 31, -11, 459, 664 },
+		/* ea */ { 444, 31, -11, 441, 661 }, { 444, 31, -11, 451, 606 }, { 278, 49, -11, 284, 664 },
+		/* ed */ { 278, 49, -11, 355, 664 }, { 278, 33, -11, 327, 661 }, { 278, 49, -11, 352, 606 },
+		/* f0 */ { 500, 27, -11, 482, 683 }, { 500, 14, -9, 476, 624 }, { 500, 27, -11, 468, 664 },
+		/* f3 */ { 500, 27, -11, 487, 664 }, { 500, 27, -11, 468, 661 }, { 500, 27, -11, 496, 624 },
+		/* f6 */ { 500, 27, -11, 489, 606 }, { 675, 86, -11, 590, 517 }, { 500, 28, -135, 469, 554 },
+		/* f9 */ { 500, 42, -11, 475, 664 }, { 500, 42, -11, 477, 664 }, { 500, 42, -11, 475, 661 },
+		/* fc */ { 500, 42, -11, 479, 606 }, { 444, -24, -206, 459, 664 }, { 500, -75, -205, 469, 683 },
+		/* ff */ { 444, -24, -206, 441, 606 },
+	};
+
+	static constexpr KerningPair TIMES_ITALIC_KERNING[] = {
+		{ 32, 65, -18 }, { 32, 84, -18 }, { 32, 86, -35 }, { 32, 87, -40 }, { 32, 89, -75 }, { 32, 159, -75 },
+		{ 32, 192, -18 }, { 32, 193, -18 }, { 32, 194, -18 }, { 32, 195, -18 }, { 32, 196, -18 }, { 32, 197, -18 },
+		{ 32, 221, -75 }, { 44, 146, -140 }, { 44, 148, -140 }, { 46, 146, -140 }, { 46, 148, -140 }, { 65, 67, -30 },
+		{ 65, 71, -35 }, { 65, 79, -40 }, { 65, 81, -40 }, { 65, 84, -37 }, { 65, 85, -50 }, { 65, 86, -105 },
+		{ 65, 87, -95 }, { 65, 89, -55 }, { 65, 117, -20 }, { 65, 118, -55 }, { 65, 119, -55 }, { 65, 121, -55 },
+		{ 65, 146, -37 }, { 65, 159, -55 }, { 65, 199, -30 }, { 65, 210, -40 }, { 65, 211, -40 }, { 65, 212, -40 },
+		{ 65, 213, -40 }, { 65, 214, -40 }, { 65, 216, -40 }, { 65, 217, -50 }, { 65, 218, -50 }, { 65, 219, -50 },
+		{ 65, 220, -50 }, { 65, 221, -55 }, { 65, 249, -20 }, { 65, 250, -20 }, { 65, 251, -20 }, { 65, 252, -20 },
+		{ 65, 253, -55 }, { 65, 255, -55 }, { 66, 65, -25 }, { 66, 85, -10 }, { 66, 192, -25 }, { 66, 193, -25 },
+		{ 66, 194, -25 }, { 66, 195, -25 }, { 66, 196, -25 }, { 66, 197, -25 }, { 66, 217, -10 }, { 66, 218, -10 },
+		{ 66, 219, -10 }, { 66, 220, -10 }, { 68, 65, -35 }, { 68, 86, -40 }, { 68, 87, -40 }, { 68, 89, -40 },
+		{ 68, 159, -40 }, { 68, 192, -35 }, { 68, 193, -35 }, { 68, 194, -35 }, { 68, 195, -35 }, { 68, 196, -35 },
+		{ 68, 197, -35 }, { 68, 221, -40 }, { 70, 44, -135 }, { 70, 46, -135 }, { 70, 65, -115 }, { 70, 97, -75 },
+		{ 70, 101, -75 }, { 70, 105, -45 }, { 70, 111, -105 }, { 70, 114, -55 }, { 70, 192, -115 }, { 70, 193, -115 },
+		{ 70, 194, -115 }, { 70, 195, -115 }, { 70, 196, -115 }, { 70, 197, -115 }, { 70, 224, -75 }, { 70, 225, -75 },
+		{ 70, 226, -75 }, { 70, 227, -75 }, { 70, 228, -75 }, { 70, 229, -75 }, { 70, 232, -75 }, { 70, 233, -75 },
+		{ 70, 234, -75 }, { 70, 235, -75 }, { 70, 236, -45 }, { 70, 237, -45 }, { 70, 238, -45 }, { 70, 239, -45 },
+		{ 70, 242, -105 }, { 70, 243, -105 }, { 70, 244, -105 }, { 70, 245, -105 }, { 70, 246, -105 }, { 70, 248, -105 },
+		{ 74, 44, -25 }, { 74, 46, -25 }, { 74, 65, -40 }, { 74, 97, -35 }, { 74, 101, -25 }, { 74, 111, -25 },
+		{ 74, 117, -35 }, { 74, 192, -40 }, { 74, 193, -40 }, { 74, 194, -40 }, { 74, 195, -40 }, { 74, 196, -40 },
+		{ 74, 197, -40 }, { 74, 224, -35 }, { 74, 225, -35 }, { 74, 226, -35 }, { 74, 227, -35 }, { 74, 228, -35 },
+		{ 74, 229, -35 }, { 74, 232, -25 }, { 74, 233, -25 }, { 74, 234, -25 }, { 74, 235, -25 }, { 74, 242, -25 },
+		{ 74, 243, -25 }, { 74, 244, -25 }, { 74, 245, -25 }, { 74, 246, -25 }, { 74, 248, -25 }, { 74, 249, -35 },
+		{ 74, 250, -35 }, { 74, 251, -35 }, { 74, 252, -35 }, { 75, 79, -50 }, { 75, 101, -35 }, { 75, 111, -40 },
+		{ 75, 117, -40 }, { 75, 121, -40 }, { 75, 210, -50 }, { 75, 211, -50 }, { 75, 212, -50 }, { 75, 213, -50 },
+		{ 75, 214, -50 }, { 75, 216, -50 }, { 75, 232, -35 }, { 75, 233, -35 }, { 75, 234, -35 }, { 75, 235, -35 },
+		{ 75, 242, -40 }, { 75, 243, -40 }, { 75, 244, -40 }, { 75, 245, -40 }, { 75, 246, -40 }, { 75, 248, -40 },
+		{ 75, 249, -40 }, { 75, 250, -40 }, { 75, 251, -40 }, { 75, 252, -40 }, { 75, 253, -40 }, { 75, 255, -40 },
+		{ 76, 84, -20 }, { 76, 86, -55 }, { 76, 87, -55 }, { 76, 89, -20 }, { 76, 121, -30 }, { 76, 146, -37 },
+		{ 76, 159, -20 }, { 76, 221, -20 }, { 76, 253, -30 }, { 76, 255, -30 }, { 78, 65, -27 }, { 78, 192, -27 },
+		{ 78, 193, -27 }, { 78, 194, -27 }, { 78, 195, -27 }, { 78, 196, -27 }, { 78, 197, -27 }, { 79, 65, -55 },
+		{ 79, 84, -40 }, { 79, 86, -50 }, { 79, 87, -50 }, { 79, 88, -40 }, { 79, 89, -50 }, { 79, 159, -50 },
+		{ 79, 192, -55 }, { 79, 193, -55 }, { 79, 194, -55 }, { 79, 195, -55 }, { 79, 196, -55 }, { 79, 197, -55 },
+		{ 79, 221, -50 }, { 80, 44, -135 }, { 80, 46, -135 }, { 80, 65, -90 }, { 80, 97, -80 }, { 80, 101, -80 },
+		{ 80, 111, -80 }, { 80, 192, -90 }, { 80, 193, -90 }, { 80, 194, -90 }, { 80, 195, -90 }, { 80, 196, -90 },
+		{ 80, 197, -90 }, { 80, 224, -80 }, { 80, 225, -80 }, { 80, 226, -80 }, { 80, 227, -80 }, { 80, 228, -80 },
+		{ 80, 229, -80 }, { 80, 232, -80 }, { 80, 233, -80 }, { 80, 234, -80 }, { 80, 235, -80 }, { 80, 242, -80 },
+		{ 80, 243, -80 }, { 80, 244, -80 }, { 80, 245, -80 }, { 80, 246, -80 }, { 80, 248, -80 }, { 81, 85, -10 },
+		{ 81, 217, -10 }, { 81, 218, -10 }, { 81, 219, -10 }, { 81, 220, -10 }, { 82, 79, -40 }, { 82, 85, -40 },
+		{ 82, 86, -18 }, { 82, 87, -18 }, { 82, 89, -18 }, { 82, 159, -18 }, { 82, 210, -40 }, { 82, 211, -40 },
+		{ 82, 212, -40 }, { 82, 213, -40 }, { 82, 214, -40 }, { 82, 216, -40 }, { 82, 217, -40 }, { 82, 218, -40 },
+		{ 82, 219, -40 }, { 82, 220, -40 }, { 82, 221, -18 }, { 84, 44, -74 }, { 84, 45, -74 }, { 84, 46, -74 },
+		{ 84, 58, -55 }, { 84, 59, -65 }, { 84, 65, -50 }, { 84, 79, -18 }, { 84, 97, -92 }, { 84, 101, -92 },
+		{ 84, 105, -55 }, { 84, 111, -92 }, { 84, 114, -55 }, { 84, 117, -55 }, { 84, 119, -74 }, { 84, 121, -74 },
+		{ 84, 173, -74 }, { 84, 192, -50 }, { 84, 193, -50 }, { 84, 194, -50 }, { 84, 195, -50 }, { 84, 196, -50 },
+		{ 84, 197, -50 }, { 84, 210, -18 }, { 84, 211, -18 }, { 84, 212, -18 }, { 84, 213, -18 }, { 84, 214, -18 },
+		{ 84, 216, -18 }, { 84, 224, -92 }, { 84, 225, -92 }, { 84, 226, -92 }, { 84, 227, -92 }, { 84, 228, -92 },
+		{ 84, 229, -92 }, { 84, 232, -52 }, { 84, 233, -92 }, { 84, 234, -52 }, { 84, 235, -52 }, { 84, 237, -55 },
+		{ 84, 242, -92 }, { 84, 243, -92 }, { 84, 244, -92 }, { 84, 245, -92 }, { 84, 246, -92 }, { 84, 248, -92 },
+		{ 84, 249, -55 }, { 84, 250, -55 }, { 84, 251, -55 }, { 84, 252, -55 }, { 84, 253, -74 }, { 84, 255, -34 },
+		{ 85, 44, -25 }, { 85, 46, -25 }, { 85, 65, -40 }, { 85, 192, -40 }, { 85, 193, -40 }, { 85, 194, -40 },
+		{ 85, 195, -40 }, { 85, 196, -40 }, { 85, 197, -40 }, { 86, 44, -129 }, { 86, 45, -55 }, { 86, 46, -129 },
+		{ 86, 58, -65 }, { 86, 59, -74 }, { 86, 65, -60 }, { 86, 79, -30 }, { 86, 97, -111 }, { 86, 101, -111 },
+		{ 86, 105, -74 }, { 86, 111, -111 }, { 86, 117, -74 }, { 86, 173, -55 }, { 86, 192, -60 }, { 86, 193, -60 },
+		{ 86, 194, -60 }, { 86, 195, -60 }, { 86, 196, -60 }, { 86, 197, -60 }, { 86, 210, -30 }, { 86, 211, -30 },
+		{ 86, 212, -30 }, { 86, 213, -30 }, { 86, 214, -30 }, { 86, 216, -30 }, { 86, 224, -111 }, { 86, 225, -111 },
+		{ 86, 226, -111 }, { 86, 227, -111 }, { 86, 228, -111 }, { 86, 229, -111 }, { 86, 232, -71 }, { 86, 233, -111 },
+		{ 86, 234, -111 }, { 86, 235, -71 }, { 86, 236, -34 }, { 86, 237, -74 }, { 86, 238, -34 }, { 86, 239, -34 },
+		{ 86, 242, -111 }, { 86, 243, -111 }, { 86, 244, -111 }, { 86, 245, -111 }, { 86, 246, -111 }, { 86, 248, -111 },
+		{ 86, 249, -74 }, { 86, 250, -74 }, { 86, 251, -74 }, { 86, 252, -74 }, { 87, 44, -92 }, { 87, 45, -37 },
+		{ 87, 46, -92 }, { 87, 58, -65 }, { 87, 59, -65 }, { 87, 65, -60 }, { 87, 79, -25 }, { 87, 97, -92 },
+		{ 87, 101, -92 }, { 87, 105, -55 }, { 87, 111, -92 }, { 87, 117, -55 }, { 87, 121, -70 }, { 87, 173, -37 },
+		{ 87, 192, -60 }, { 87, 193, -60 }, { 87, 194, -60 }, { 87, 195, -60 }, { 87, 196, -60 }, { 87, 197, -60 },
+		{ 87, 210, -25 }, { 87, 211, -25 }, { 87, 212, -25 }, { 87, 213, -25 }, { 87, 214, -25 }, { 87, 216, -25 },
+		{ 87, 224, -92 }, { 87, 225, -92 }, { 87, 226, -92 }, { 87, 227, -92 }, { 87, 228, -92 }, { 87, 229, -92 },
+		{ 87, 232, -52 }, { 87, 233, -92 }, { 87, 234, -92 }, { 87, 235, -52 }, { 87, 237, -55 }, { 87, 242, -92 },
+		{ 87, 243, -92 }, { 87, 244, -92 }, { 87, 245, -92 }, { 87, 246, -92 }, { 87, 248, -92 }, { 87, 249, -55 },
+		{ 87, 250, -55 }, { 87, 251, -55 }, { 87, 252, -55 }, { 87, 253, -70 }, { 87, 255, -70 }, { 89, 44, -92 },
+		{ 89, 45, -74 }, { 89, 46, -92 }, { 89, 58, -65 }, { 89, 59, -65 }, { 89, 65, -50 }, { 89, 79, -15 },
+		{ 89, 97, -92 }, { 89, 101, -92 }, { 89, 105, -74 }, { 89, 111, -92 }, { 89, 117, -92 }, { 89, 173, -74 },
+		{ 89, 192, -50 }, { 89, 193, -50 }, { 89, 194, -50 }, { 89, 195, -50 }, { 89, 196, -50 }, { 89, 197, -50 },
+		{ 89, 210, -15 }, { 89, 211, -15 }, { 89, 212, -15 }, { 89, 213, -15 }, { 89, 214, -15 }, { 89, 216, -15 },
+		{ 89, 224, -92 }, { 89, 225, -92 }, { 89, 226, -92 }, { 89, 227, -92 }, { 89, 228, -92 }, { 89, 229, -92 },
+		{ 89, 232, -52 }, { 89, 233, -92 }, { 89, 234, -92 }, { 89, 235, -52 }, { 89, 236, -34 }, { 89, 237, -74 },
+		{ 89, 238, -34 }, { 89, 239, -34 }, { 89, 242, -92 }, { 89, 243, -92 }, { 89, 244, -92 }, { 89, 245, -92 },
+		{ 89, 246, -92 }, { 89, 248, -92 }, { 89, 249, -92 }, { 89, 250, -92 }, { 89, 251, -92 }, { 89, 252, -92 },
+		{ 97, 103, -10 }, { 98, 46, -40 }, { 98, 117, -20 }, { 98, 249, -20 }, { 98, 250, -20 }, { 98, 251, -20 },
+		{ 98, 252, -20 }, { 99, 104, -15 }, { 99, 107, -20 }, { 101, 44, -10 }, { 101, 46, -15 }, { 101, 103, -40 },
+		{ 101, 118, -15 }, { 101, 119, -15 }, { 101, 120, -20 }, { 101, 121, -30 }, { 101, 253, -30 }, { 101, 255, -30 },
+		{ 102, 44, -10 }, { 102, 46, -15 }, { 102, 102, -18 }, { 102, 105, -20 }, { 102, 146, 92 }, { 103, 44, -10 },
+		{ 103, 46, -15 }, { 103, 101, -10 }, { 103, 103, -10 }, { 103, 232, -10 }, { 103, 233, -10 }, { 103, 234, -10 },
+		{ 103, 235, -10 }, { 107, 101, -10 }, { 107, 111, -10 }, { 107, 121, -10 }, { 107, 232, -10 }, { 107, 233, -10 },
+		{ 107, 234, -10 }, { 107, 235, -10 }, { 107, 242, -10 }, { 107, 243, -10 }, { 107, 244, -10 }, { 107, 245, -10 },
+		{ 107, 246, -10 }, { 107, 248, -10 }, { 107, 253, -10 }, { 107, 255, -10 }, { 110, 118, -40 }, { 111, 103, -10 },
+		{ 111, 118, -10 }, { 114, 44, -111 }, { 114, 45, -20 }, { 114, 46, -111 }, { 114, 97, -15 }, { 114, 99, -37 },
+		{ 114, 100, -37 }, { 114, 101, -37 }, { 114, 103, -37 }, { 114, 111, -45 }, { 114, 113, -37 }, { 114, 115, -10 },
+		{ 114, 154, -10 }, { 114, 173, -20 }, { 114, 224, -15 }, { 114, 225, -15 }, { 114, 226, -15 }, { 114, 227, -15 },
+		{ 114, 228, -15 }, { 114, 229, -15 }, { 114, 231, -37 }, { 114, 232, -37 }, { 114, 233, -37 }, { 114, 234, -37 },
+		{ 114, 235, -37 }, { 114, 242, -45 }, { 114, 243, -45 }, { 114, 244, -45 }, { 114, 245, -45 }, { 114, 246, -45 },
+		{ 114, 248, -45 }, { 118, 44, -74 }, { 118, 46, -74 }, { 119, 44, -74 }, { 119, 46, -74 }, { 121, 44, -55 },
+		{ 121, 46, -55 }, { 145, 145, -111 }, { 146, 32, -111 }, { 146, 100, -25 }, { 146, 114, -25 }, { 146, 115, -40 },
+		{ 146, 116, -30 }, { 146, 118, -10 }, { 146, 146, -111 }, { 146, 154, -40 }, { 146, 160, -111 }, { 159, 44, -92 },
+		{ 159, 45, -74 }, { 159, 46, -92 }, { 159, 58, -65 }, { 159, 59, -65 }, { 159, 65, -50 }, { 159, 79, -15 },
+		{ 159, 97, -92 }, { 159, 101, -92 }, { 159, 105, -74 }, { 159, 111, -92 }, { 159, 117, -92 }, { 159, 173, -74 },
+		{ 159, 192, -50 }, { 159, 193, -50 }, { 159, 194, -50 }, { 159, 195, -50 }, { 159, 196, -50 }, { 159, 197, -50 },
+		{ 159, 210, -15 }, { 159, 211, -15 }, { 159, 212, -15 }, { 159, 213, -15 }, { 159, 214, -15 }, { 159, 216, -15 },
+		{ 159, 224, -92 }, { 159, 225, -92 }, { 159, 226, -92 }, { 159, 227, -92 }, { 159, 228, -92 }, { 159, 229, -92 },
+		{ 159, 232, -52 }, { 159, 233, -92 }, { 159, 234, -92 }, { 159, 235, -52 }, { 159, 236, -34 }, { 159, 237, -74 },
+		{ 159, 238, -34 }, { 159, 239, -34 }, { 159, 242, -92 }, { 159, 243, -92 }, { 159, 244, -92 }, { 159, 245, -92 },
+		{ 159, 246, -92 }, { 159, 248, -92 }, { 159, 249, -92 }, { 159, 250, -92 }, { 159, 251, -92 }, { 159, 252, -92 },
+		{ 160, 65, -18 }, { 160, 84, -18 }, { 160, 86, -35 }, { 160, 87, -40 }, { 160, 89, -75 }, { 160, 159, -75 },
+		{ 160, 192, -18 }, { 160, 193, -18 }, { 160, 194, -18 }, { 160, 195, -18 }, { 160, 196, -18 }, { 160, 197, -18 },
+		{ 160, 221, -75 }, { 192, 67, -30 }, { 192, 71, -35 }, { 192, 79, -40 }, { 192, 81, -40 }, { 192, 84, -37 },
+		{ 192, 85, -50 }, { 192, 86, -105 }, { 192, 87, -95 }, { 192, 89, -55 }, { 192, 117, -20 }, { 192, 118, -55 },
+		{ 192, 119, -55 }, { 192, 121, -55 }, { 192, 146, -37 }, { 192, 159, -55 }, { 192, 199, -30 }, { 192, 210, -40 },
+		{ 192, 211, -40 }, { 192, 212, -40 }, { 192, 213, -40 }, { 192, 214, -40 }, { 192, 216, -40 }, { 192, 217, -50 },
+		{ 192, 218, -50 }, { 192, 219, -50 }, { 192, 220, -50 }, { 192, 221, -55 }, { 192, 249, -20 }, { 192, 250, -20 },
+		{ 192, 251, -20 }, { 192, 252, -20 }, { 192, 253, -55 }, { 192, 255, -55 }, { 193, 67, -30 }, { 193, 71, -35 },
+		{ 193, 79, -40 }, { 193, 81, -40 }, { 193, 84, -37 }, { 193, 85, -50 }, { 193, 86, -105 }, { 193, 87, -95 },
+		{ 193, 89, -55 }, { 193, 117, -20 }, { 193, 118, -55 }, { 193, 119, -55 }, { 193, 121, -55 }, { 193, 146, -37 },
+		{ 193, 159, -55 }, { 193, 199, -30 }, { 193, 210, -40 }, { 193, 211, -40 }, { 193, 212, -40 }, { 193, 213, -40 },
+		{ 193, 214, -40 }, { 193, 216, -40 }, { 193, 217, -50 }, { 193, 218, -50 }, { 193, 219, -50 }, { 193, 220, -50 },
+		{ 193, 221, -55 }, { 193, 249, -20 }, { 193, 250, -20 }, { 193, 251, -20 }, { 193, 252, -20 }, { 193, 253, -55 },
+		{ 193, 255, -55 }, { 194, 67, -30 }, { 194, 71, -35 }, { 194, 79, -40 }, { 194, 81, -40 }, { 194, 84, -37 },
+		{ 194, 85, -50 }, { 194, 86, -105 }, { 194, 87, -95 }, { 194, 89, -55 }, { 194, 117, -20 }, { 194, 118, -55 },
+		{ 194, 119, -55 }, { 194, 121, -55 }, { 194, 146, -37 }, { 194, 159, -55 }, { 194, 199, -30 }, { 194, 210, -40 },
+		{ 194, 211, -40 }, { 194, 212, -40 }, { 194, 213, -40 }, { 194, 214, -40 }, { 194, 216, -40 }, { 194, 217, -50 },
+		{ 194, 218, -50 }, { 194, 219, -50 }, { 194, 220, -50 }, { 194, 221, -55 }, { 194, 249, -20 }, { 194, 250, -20 },
+		{ 194, 251, -20 }, { 194, 252, -20 }, { 194, 253, -55 }, { 194, 255, -55 }, { 195, 67, -30 }, { 195, 71, -35 },
+		{ 195, 79, -40 }, { 195, 81, -40 }, { 195, 84, -37 }, { 195, 85, -50 }, { 195, 86, -105 }, { 195, 87, -95 },
+		{ 195, 89, -55 }, { 195, 117, -20 }, { 195, 118, -55 }, { 195, 119, -55 }, { 195, 121, -55 }, { 195, 146, -37 },
+		{ 195, 159, -55 }, { 195, 199, -30 }, { 195, 210, -40 }, { 195, 211, -40 }, { 195, 212, -40 }, { 195, 213, -40 },
+		{ 195, 214, -40 }, { 195, 216, -40 }, { 195, 217, -50 }, { 195, 218, -50 }, { 195, 219, -50 }, { 195, 220, -50 },
+		{ 195, 221, -55 }, { 195, 249, -20 }, { 195, 250, -20 }, { 195, 251, -20 }, { 195, 252, -20 }, { 195, 253, -55 },
+		{ 195, 255, -55 }, { 196, 67, -30 }, { 196, 71, -35 }, { 196, 79, -40 }, { 196, 81, -40 }, { 196, 84, -37 },
+		{ 196, 85, -50 }, { 196, 86, -105 }, { 196, 87, -95 }, { 196, 89, -55 }, { 196, 117, -20 }, { 196, 118, -55 },
+		{ 196, 119, -55 }, { 196, 121, -55 }, { 196, 146, -37 }, { 196, 159, -55 }, { 196, 199, -30 }, { 196, 210, -40 },
+		{ 196, 211, -40 }, { 196, 212, -40 }, { 196, 213, -40 }, { 196, 214, -40 }, { 196, 216, -40 }, { 196, 217, -50 },
+		{ 196, 218, -50 }, { 196, 219, -50 }, { 196, 220, -50 }, { 196, 221, -55 }, { 196, 249, -20 }, { 196, 250, -20 },
+		{ 196, 251, -20 }, { 196, 252, -20 }, { 196, 253, -55 }, { 196, 255, -55 }, { 197, 67, -30 }, { 197, 71, -35 },
+		{ 197, 79, -40 }, { 197, 81, -40 }, { 197, 84, -37 }, { 197, 85, -50 }, { 197, 86, -105 }, { 197, 87, -95 },
+		{ 197, 89, -55 }, { 197, 117, -20 }, { 197, 118, -55 }, { 197, 119, -55 }, { 197, 121, -55 }, { 197, 146, -37 },
+		{ 197, 159, -55 }, { 197, 199, -30 }, { 197, 210, -40 }, { 197, 211, -40 }, { 197, 212, -40 }, { 197, 213, -40 },
+		{ 197, 214, -40 }, { 197, 216, -40 }, { 197, 217, -50 }, { 197, 218, -50 }, { 197, 219, -50 }, { 197, 220, -50 },
+		{ 197, 221, -55 }, { 197, 249, -20 }, { 197, 250, -20 }, { 197, 251, -20 }, { 197, 252, -20 }, { 197, 253, -55 },
+		{ 197, 255, -55 }, { 209, 65, -27 }, { 209, 192, -27 }, { 209, 193, -27 }, { 209, 194, -27 }, { 209, 195, -27 },
+		{ 209, 196, -27 }, { 209, 197, -27 }, { 210, 65, -55 }, { 210, 84, -40 }, { 210, 86, -50 }, { 210, 87, -50 },
+		{ 210, 88, -40 }, { 210, 89, -50 }, { 210, 159, -50 }, { 210, 192, -55 }, { 210, 193, -55 }, { 210, 194, -55 },
+		{ 210, 195, -55 }, { 210, 196, -55 }, { 210, 197, -55 }, { 210, 221, -50 }, { 211, 65, -55 }, { 211, 84, -40 },
+		{ 211, 86, -50 }, { 211, 87, -50 }, { 211, 88, -40 }, { 211, 89, -50 }, { 211, 159, -50 }, { 211, 192, -55 },
+		{ 211, 193, -55 }, { 211, 194, -55 }, { 211, 195, -55 }, { 211, 196, -55 }, { 211, 197, -55 }, { 211, 221, -50 },
+		{ 212, 65, -55 }, { 212, 84, -40 }, { 212, 86, -50 }, { 212, 87, -50 }, { 212, 88, -40 }, { 212, 89, -50 },
+		{ 212, 159, -50 }, { 212, 192, -55 }, { 212, 193, -55 }, { 212, 194, -55 }, { 212, 195, -55 }, { 212, 196, -55 },
+		{ 212, 197, -55 }, { 212, 221, -50 }, { 213, 65, -55 }, { 213, 84, -40 }, { 213, 86, -50 }, { 213, 87, -50 },
+		{ 213, 88, -40 }, { 213, 89, -50 }, { 213, 159, -50 }, { 213, 192, -55 }, { 213, 193, -55 }, { 213, 194, -55 },
+		{ 213, 195, -55 }, { 213, 196, -55 }, { 213, 197, -55 }, { 213, 221, -50 }, { 214, 65, -55 }, { 214, 84, -40 },
+		{ 214, 86, -50 }, { 214, 87, -50 }, { 214, 88, -40 }, { 214, 89, -50 }, { 214, 159, -50 }, { 214, 192, -55 },
+		{ 214, 193, -55 }, { 214, 194, -55 }, { 214, 195, -55 }, { 214, 196, -55 }, { 214, 197, -55 }, { 214, 221, -50 },
+		{ 216, 65, -55 }, { 216, 84, -40 }, { 216, 86, -50 }, { 216, 87, -50 }, { 216, 88, -40 }, { 216, 89, -50 },
+		{ 216, 159, -50 }, { 216, 192, -55 }, { 216, 193, -55 }, { 216, 194, -55 }, { 216, 195, -55 }, { 216, 196, -55 },
+		{ 216, 197, -55 }, { 216, 221, -50 }, { 217, 44, -25 }, { 217, 46, -25 }, { 217, 65, -40 }, { 217, 192, -40 },
+		{ 217, 193, -40 }, { 217, 194, -40 }, { 217, 195, -40 }, { 217, 196, -40 }, { 217, 197, -40 }, { 218, 44, -25 },
+		{ 218, 46, -25 }, { 218, 65, -40 }, { 218, 192, -40 }, { 218, 193, -40 }, { 218, 194, -40 }, { 218, 195, -40 },
+		{ 218, 196, -40 }, { 218, 197, -40 }, { 219, 44, -25 }, { 219, 46, -25 }, { 219, 65, -40 }, { 219, 192, -40 },
+		{ 219, 193, -40 }, { 219, 194, -40 }, { 219, 195, -40 }, { 219, 196, -40 }, { 219, 197, -40 }, { 220, 44, -25 },
+		{ 220, 46, -25 }, { 220, 65, -40 }, { 220, 192, -40 }, { 220, 193, -40 }, { 220, 194, -40 }, { 220, 195, -40 },
+		{ 220, 196, -40 }, { 220, 197, -40 }, { 221, 44, -92 }, { 221, 45, -74 }, { 221, 46, -92 }, { 221, 58, -65 },
+		{ 221, 59, -65 }, { 221, 65, -50 }, { 221, 79, -15 }, { 221, 97, -92 }, { 221, 101, -92 }, { 221, 105, -74 },
+		{ 221, 111, -92 }, { 221, 117, -92 }, { 221, 173, -74 }, { 221, 192, -50 }, { 221, 193, -50 }, { 221, 194, -50 },
+		{ 221, 195, -50 }, { 221, 196, -50 }, { 221, 197, -50 }, { 221, 210, -15 }, { 221, 211, -15 }, { 221, 212, -15 },
+		{ 221, 213, -15 }, { 221, 214, -15 }, { 221, 216, -15 }, { 221, 224, -92 }, { 221, 225, -92 }, { 221, 226, -92 },
+		{ 221, 227, -92 }, { 221, 228, -92 }, { 221, 229, -92 }, { 221, 232, -52 }, { 221, 233, -92 }, { 221, 234, -92 },
+		{ 221, 235, -52 }, { 221, 236, -34 }, { 221, 237, -74 }, { 221, 238, -34 }, { 221, 239, -34 }, { 221, 242, -92 },
+		{ 221, 243, -92 }, { 221, 244, -92 }, { 221, 245, -92 }, { 221, 246, -92 }, { 221, 248, -92 }, { 221, 249, -92 },
+		{ 221, 250, -92 }, { 221, 251, -92 }, { 221, 252, -92 }, { 224, 103, -10 }, { 225, 103, -10 }, { 226, 103, -10 },
+		{ 227, 103, -10 }, { 228, 103, -10 }, { 229, 103, -10 }, { 231, 104, -15 }, { 231, 107, -20 }, { 232, 44, -10 },
+		{ 232, 46, -15 }, { 232, 103, -40 }, { 232, 118, -15 }, { 232, 119, -15 }, { 232, 120, -20 }, { 232, 121, -30 },
+		{ 232, 253, -30 }, { 232, 255, -30 }, { 233, 44, -10 }, { 233, 46, -15 }, { 233, 103, -40 }, { 233, 118, -15 },
+		{ 233, 119, -15 }, { 233, 120, -20 }, { 233, 121, -30 }, { 233, 253, -30 }, { 233, 255, -30 }, { 234, 44, -10 },
+		{ 234, 46, -15 }, { 234, 103, -40 }, { 234, 118, -15 }, { 234, 119, -15 }, { 234, 120, -20 }, { 234, 121, -30 },
+		{ 234, 253, -30 }, { 234, 255, -30 }, { 235, 44, -10 }, { 235, 46, -15 }, { 235, 103, -40 }, { 235, 118, -15 },
+		{ 235, 119, -15 }, { 235, 120, -20 }, { 235, 121, -30 }, { 235, 253, -30 }, { 235, 255, -30 }, { 241, 118, -40 },
+		{ 242, 103, -10 }, { 242, 118, -10 }, { 243, 103, -10 }, { 243, 118, -10 }, { 244, 103, -10 }, { 244, 118, -10 },
+		{ 245, 103, -10 }, { 245, 118, -10 }, { 246, 103, -10 }, { 246, 118, -10 }, { 248, 103, -10 }, { 248, 118, -10 },
+		{ 253, 44, -55 }, { 253, 46, -55 }, { 255, 44, -55 }, { 255, 46, -55 },
+	};
+
+	static constexpr GlyphMetrics TIMES_BOLD_GLYPHS[256] = {
+		/* 00 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 03 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 06 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 09 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0f */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 12 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 15 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 18 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1b */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 250, 0, 0, 0, 0 },
+		/* 21 */ { 333, 81, -13, 251, 691 }, { 555, 83, 404, 472, 691 }, { 500, 4, 0, 496, 700 },
+		/* 24 */ { 500, 29, -99, 472, 750 }, { 1000, 124, -14, 877, 692 }, { 833, 62, -16, 787, 691 },
+		/* 27 */ { 278, 75, 404, 204, 691 }, { 333, 46, -168, 306, 694 }, { 333, 27, -168, 287, 694 },
+		/* 2a */ { 500, 56, 255, 447, 691 }, { 570, 33, 0, 537, 506 }, { 250, 39, -180, 223, 155 },
+		/* 2d */ { 333, 44, 171, 287, 287 }, { 250, 41, -13, 210, 156 }, { 278, -24, -19, 302, 691 },
+		/* 30 */ { 500, 24, -13, 476, 688 }, { 500, 65, 0, 442, 688 }, { 500, 17, 0, 478, 688 },
+		/* 33 */ { 500, 16, -14, 468, 688 }, { 500, 19, 0, 475, 688 }, { 500, 22, -8, 470, 676 },
+		/* 36 */ { 500, 28, -13, 475, 688 }, { 500, 17, 0, 477, 676 }, { 500, 28, -13, 472, 688 },
+		/* 39 */ { 500, 26, -13, 473, 688 }, { 333, 82, -13, 251, 472 }, { 333, 82, -180, 266, 472 },
+		/* 3c */ { 570, 31, -8, 539, 514 }, { 570, 33, 107, 537, 399 }, { 570, 31, -8, 539, 514 },
+		/* 3f */ { 500, 57, -13, 445, 689 }, { 930, 108, -19, 822, 691 }, { 722, 9, 0, 689, 690 },
+		/* 42 */ { 667, 16, 0, 619, 676 }, { 722, 49, -19, 687, 691 }, { 722, 14, 0, 690, 676 },
+		/* 45 */ { 667, 16, 0, 641, 676 }, { 611, 16, 0, 583, 676 }, { 778, 37, -19, 755, 691 },
+		/* 48 */ { 778, 21, 0, 759, 676 }, { 389, 20, 0, 370, 676 }, { 500, 3, -96, 479, 676 },
+		/* 4b */ { 778, 30, 0, 769, 676 }, { 667, 19, 0, 638, 676 }, { 944, 14, 0, 921, 676 },
+		/* 4e */ { 722, 16, -18, 701, 676 }, { 778, 35, -19, 743, 691 }, { 611, 16, 0, 600, 676 },
+		/* 51 */ { 778, 35, -176, 743, 691 }, { 722, 26, 0, 715, 676 }, { 556, 35, -19, 513, 692 },
+		/* 54 */ { 667, 31, 0, 636, 676 }, { 722, 16, -19, 701, 676 }, { 722, 16, -18, 701, 676 },
+		/* 57 */ { 1000, 19, -15, 981, 676 }, { 722, 16, 0, 699, 676 }, { 722, 15, 0, 699, 676 },
+		/* 5a */ { 667, 28, 0, 634, 676 }, { 333, 67, -149, 301, 678 }, { 278, -25, -19, 303, 691 },
+		/* 5d */ { 333, 32, -149, 266, 678 }, { 581, 73, 311, 509, 676 }, { 500, 0, -125, 500, -75 },
+		/* 60 */ { 333, 8, 528, 246, 713 }, { 500, 25, -14, 488, 473 }, { 556, 17, -14, 521, 676 },
+		/* 63 */ { 444, 25, -14, 430, 473 }, { 556, 25, -14, 534, 676 }, { 444, 25, -14, 426, 473 },
+		/* 66 */ { 333, 14, 0, 389, 691 }, { 500, 28, -206, 483, 473 }, { 556, 16, 0, 534, 676 },
+		/* 69 */ { 278, 16, 0, 255, 691 }, { 333, -57, -203, 263, 691 }, { 556, 22, 0, 543, 676 },
+		/* 6c */ { 278, 16, 0, 255, 676 }, { 833, 16, 0, 814, 473 }, { 556, 21, 0, 539, 473 },
+		/* 6f */ { 500, 25, -14, 476, 473 }, { 556, 19, -205, 524, 473 }, { 556, 34, -205, 536, 473 },
+		/* 72 */ { 444, 29, 0, 434, 473 }, { 389, 25, -14, 361, 473 }, { 333, 20, -12, 332, 630 },
+		/* 75 */ { 556, 16, -14, 537, 461 }, { 500, 21, -14, 485, 461 }, { 722, 23, -14, 707, 461 },
+		/* 78 */ { 500, 12, 0, 484, 461 }, { 500, 16, -205, 480, 461 }, { 444, 21, 0, 420, 461 },
+		/* 7b */ { 394, 22, -175, 340, 698 }, { 220, 66, -218, 154, 782 }, { 394, 54, -175, 372, 698 },
+		/* 7e */ { 520, 29, 173, 491, 333 }, { 0, 0, 0, 0, 0 }, { 500, 0, 0, 0, 0 },
+		/* 81 */ { 0, 0, 0, 0, 0 }, { 333, 79, -180, 263, 155 }, { 500, 0, -155, 498, 706 },
+		/* 84 */ { 500, 14, -180, 468, 155 }, { 1000, 82, -13, 917, 156 }, { 500, 47, -134, 453, 691 },
+		/* 87 */ { 500, 45, -132, 456, 691 }, { 333, -2, 528, 335, 704 }, { 1000, 7, -29, 995, 706 },
+		/* 8a */ { 556, 35, -19, 513, 914 }, { 333, 51, 36, 305, 415 }, { 1000, 22, -5, 981, 684 },
+		/* 8d */ { 0, 0, 0, 0, 0 }, { 667, 28, 0, 634, 914 }, { 0, 0, 0, 0, 0 },
+		/* 90 */ { 0, 0, 0, 0, 0 }, { 333, 70, 356, 254, 691 }, { 333, 79, 356, 263, 691 },
+		/* 93 */ { 500, 32, 356, 486, 691 }, { 500, 14, 356, 468, 691 }, { 350, 35, 198, 315, 478 },
+		/* 96 */ { 500, 0, 181, 500, 271 }, { 1000, 0, 181, 1000, 271 }, { 333, -16, 547, 349, 674 },
+		/* 99 */ { 1000, 24, 271, 977, 676 }, { 389, 25, -14, 363, 704 }, { 333, 28, 36, 282, 415 },
+		/* 9c */ { 722, 22, -14, 696, 473 }, { 0, 0, 0, 0, 0 }, { 444, 21, 0, 420, 704 },
+		/* 9f */ { 722, 15, 0, 699, 877 }, { 250, 0, 0, 0, 0 }, { 333, 82, -203, 252, 501 },
+		/* a2 */ { 500, 53, -140, 458, 588 }, { 500, 21, -14, 477, 684 }, { 500, -26, 61, 526, 613 },
+		/* a5 */ { 500, -64, 0, 547, 676 }, { 220, 66, -143, 154, 707 }, { 500, 57, -132, 443, 691 },
+		/* a8 */ { 333, -2, 537, 335, 667 }, { 747, 26, -19, 721, 691 }, { 300, -1, 397, 301, 688 },
+		/* ab */ { 500, 23, 36, 473, 415 }, { 570, 33, 108, 537, 399 }, { 333, 44, 171, 287, 287 },
+		/* ae */ { 747, 26, -19, 721, 691 }, { 333, 1, 565, 331, 637 }, { 400, 57, 402, 343, 688 },
+		/* b1 */ { 570, 33, 0, 537, 506 }, { 300, 0, 275, 300, 688 }, { 300, 3, 268, 297, 688 },
+		/* b4 */ { 333, 86, 528, 324, 713 }, { 556, 33, -206, 536, 461 }, { 540, 0, -186, 519, 676 },
+		/* b7 */ { 250, 41, 248, 210, 417 }, { 333, 68, -218, 294, 0 }, { 300, 28, 275, 273, 688 },
+		/* ba */ { 330, 18, 397, 312, 688 }, { 500, 27, 36, 477, 415 }, { 750, 28, -12, 743, 688 },
+		/* bd */ { 750, -7, -12, 775, 688 }, { 750, 23, -12, 733, 688 }, { 500, 55, -201, 443, 501 },
+		/* c0 */ { 722, 9, 0, 689, 923 }, { 722, 9, 0, 689, 923 }, { 722, 9, 0, 689, 914 },
+		/* c3 */ { 722, 9, 0, 689, 884 }, { 722, 9, 0, 689, 877 }, { 722, 9, 0, 689, 935 },
+		/* c6 */ { 1000, 4, 0, 951, 676 }, { 722, 49, -218, 687, 691 }, { 667, 16, 0, 641, 923 },
+		/* c9 */ { 667, 16, 0, 641, 923 }, { 667, 16, 0, 641, 914 }, { 667, 16, 0, 641, 877 },
+		/* cc */ { 389, 20, 0, 370, 923 }, { 389, 20, 0, 370, 923 }, { 389, 20, 0, 370, 914 },
+		/* cf */ { 389, 20, 0, 370, 877 }, { 722, 6, 0, 690, 676 }, { 722, 16, -18, 701, 884 },
+		/* d2 */ { 778, 35, -19, 743, 923 }, { 778, 35, -19, 743, 923 }, { 778, 35, -19, 743, 914 },
+		/* d5 */ { 778, 35, -19, 743, 884 }, { 778, 35, -19, 743, 877 }, { 570, 48, 16, 522, 490 },
+		/* d8 */ { 778, 35, -74, 743, 737 }, { 722, 16, -19, 701, 923 }, { 722, 16, -19, 701, 923 },
+		/* db */ { 722, 16, -19, 701, 914 }, { 722, 16, -19, 701, 877 }, { 722, 15, 0, 699, 923 },
+		/* de */ { 611, 16, 0, 600, 676 }, { 556, 19, -12, 517, 691 }, { 500, 25, -14, 488, 713 },
+		/* e1 */ { 500, 25, -14, 488, 713 }, { 500, 25, -14, 488, 704 }, { 500, 25, -14, 488, 674 },
+		/* e4 */ { 500, 25, -14, 488, 667 }, { 500, 25, -14, 488, 740 }, { 722, 33, -14, 693, 473 },
+		/* e7 */ { 444, 25, -218, 430, 473 }, { 444, 25, -14, 426, 713 }, { 444, 25, -14, 426, 713 },
+		/* ea */ { 444, 25, -14, 426, 704 }, { 444, 25, -14, 426, 667 }, { 278, -27, 0, 255, 713 },
+		/* ed */ { 278, 16, 0, 289, 713 }, { 278, -37, 0, 300, 704 }, { 278, -37, 0, 300, 667 },
+		/* f0 */ { 500, 25, -14, 476, 691 }, { 556, 21, 0, 539, 674 }, { 500, 25, -14, 476, 713 },
+		/* f3 */ { 500, 25, -14, 476, 713 }, { 500, 25, -14, 476, 704 }, { 500, 25, -14, 476, 674 },
+		/* f6 */ { 500, 25, -14, 476, 667 }, { 570, 33, -31, 537, 537 }, { 500, 25, -92, 476, 549 },
+		/* f9 */ { 556, 16, -14, 537, 713 }, { 556, 16, -14, 537, 713 }, { 556, 16, -14, 537, 704 },
+		/* fc */ { 556, 16, -14, 537, 667 }, { 500, 16, -205, 480, 713 }, { 556, 19, -205, 524, 676 },
+		/* ff */ { 500, 16, -205, 480, 667 },
+	};
+
+	static constexpr KerningPair TIMES_BOLD_KERNING[] = {
+		{ 32, 65, -55 }, { 32, 84, -30 }, { 32, 86, -45 }, { 32, 87, -30 }, { 32, 89, -55 }, { 32, 159, -55 },
+		{ 32, 192, -55 }, { 32, 193, -55 }, { 32, 194, -55 }, { 32, 195, -55 }, { 32, 196, -55 }, { 32, 197, -55 },
+		{ 32, 221, -55 }, { 44, 146, -55 }, { 44, 148, -45 }, { 46, 146, -55 }, { 46, 148, -55 }, { 65, 67, -55 },
+		{ 65, 71, -55 }, { 65, 79, -45 }, { 65, 81, -45 }, { 65, 84, -95 }, { 65, 85, -50 }, { 65, 86, -145 },
+		{ 65, 87, -130 }, { 65, 89, -100 }, { 65, 112, -25 }, { 65, 117, -50 }, { 65, 118, -100 }, { 65, 119, -90 },
+		{ 65, 121, -74 }, { 65, 146, -74 }, { 65, 159, -100 }, { 65, 199, -55 }, { 65, 210, -45 }, { 65, 211, -45 },
+		{ 65, 212, -45 }, { 65, 213, -45 }, { 65, 214, -45 }, { 65, 216, -45 }, { 65, 217, -50 }, { 65, 218, -50 },
+		{ 65, 219, -50 }, { 65, 220, -50 }, { 65, 221, -100 }, { 65, 249, -50 }, { 65, 250, -50 }, { 65, 251, -50 },
+		{ 65, 252, -50 }, { 65, 253, -74 }, { 65, 255, -74 }, { 66, 65, -30 }, { 66, 85, -10 }, { 66, 192, -30 },
+		{ 66, 193, -30 }, { 66, 194, -30 }, { 66, 195, -30 }, { 66, 196, -30 }, { 66, 197, -30 }, { 66, 217, -10 },
+		{ 66, 218, -10 }, { 66, 219, -10 }, { 66, 220, -10 }, { 68, 46, -20 }, { 68, 65, -35 }, { 68, 86, -40 },
+		{ 68, 87, -40 }, { 68, 89, -40 }, { 68, 159, -40 }, { 68, 192, -35 }, { 68, 193, -35 }, { 68, 194, -35 },
+		{ 68, 195, -35 }, { 68, 196, -35 }, { 68, 197, -35 }, { 68, 221, -40 }, { 70, 44, -92 }, { 70, 46, -110 },
+		{ 70, 65, -90 }, { 70, 97, -25 }, { 70, 101, -25 }, { 70, 111, -25 }, { 70, 192, -90 }, { 70, 193, -90 },
+		{ 70, 194, -90 }, { 70, 195, -90 }, { 70, 196, -90 }, { 70, 197, -90 }, { 70, 224, -25 }, { 70, 225, -25 },
+		{ 70, 226, -25 }, { 70, 227, -25 }, { 70, 228, -25 }, { 70, 229, -25 }, { 70, 232, -25 }, { 70, 233, -25 },
+		{ 70, 234, -25 }, { 70, 235, -25 }, { 70, 242, -25 }, { 70, 243, -25 }, { 70, 244, -25 }, { 70, 245, -25 },
+		{ 70, 246, -25 }, { 70, 248, -25 }, { 74, 46, -20 }, { 74, 65, -30 }, { 74, 97, -15 }, { 74, 101, -15 },
+		{ 74, 111, -15 }, { 74, 117, -15 }, { 74, 192, -30 }, { 74, 193, -30 }, { 74, 194, -30 }, { 74, 195, -30 },
+		{ 74, 196, -30 }, { 74, 197, -30 }, { 74, 224, -15 }, { 74, 225, -15 }, { 74, 226, -15 }, { 74, 227, -15 },
+		{ 74, 228, -15 }, { 74, 229, -15 }, { 74, 232, -15 }, { 74, 233, -15 }, { 74, 234, -15 }, { 74, 235, -15 },
+		{ 74, 242, -15 }, { 74, 243, -15 }, { 74, 244, -15 }, { 74, 245, -15 }, { 74, 246, -15 }, { 74, 248, -15 },
+		{ 74, 249, -15 }, { 74, 250, -15 }, { 74, 251, -15 }, { 74, 252, -15 }, { 75, 79, -30 }, { 75, 101, -25 },
+		{ 75, 111, -25 }, { 75, 117, -15 }, { 75, 121, -45 }, { 75, 210, -30 }, { 75, 211, -30 }, { 75, 212, -30 },
+		{ 75, 213, -30 }, { 75, 214, -30 }, { 75, 216, -30 }, { 75, 232, -25 }, { 75, 233, -25 }, { 75, 234, -25 },
+		{ 75, 235, -25 }, { 75, 242, -25 }, { 75, 243, -25 }, { 75, 244, -25 }, { 75, 245, -25 }, { 75, 246, -25 },
+		{ 75, 248, -25 }, { 75, 249, -15 }, { 75, 250, -15 }, { 75, 251, -15 }, { 75, 252, -15 }, { 75, 253, -45 },
+		{ 75, 255, -45 }, { 76, 84, -92 }, { 76, 86, -92 }, { 76, 87, -92 }, { 76, 89, -92 }, { 76, 121, -55 },
+		{ 76, 146, -110 }, { 76, 148, -20 }, { 76, 159, -92 }, { 76, 221, -92 }, { 76, 253, -55 }, { 76, 255, -55 },
+		{ 78, 65, -20 }, { 78, 192, -20 }, { 78, 193, -20 }, { 78, 194, -20 }, { 78, 195, -20 }, { 78, 196, -20 },
+		{ 78, 197, -20 }, { 79, 65, -40 }, { 79, 84, -40 }, { 79, 86, -50 }, { 79, 87, -50 }, { 79, 88, -40 },
+		{ 79, 89, -50 }, { 79, 159, -50 }, { 79, 192, -40 }, { 79, 193, -40 }, { 79, 194, -40 }, { 79, 195, -40 },
+		{ 79, 196, -40 }, { 79, 197, -40 }, { 79, 221, -50 }, { 80, 44, -92 }, { 80, 46, -110 }, { 80, 65, -74 },
+		{ 80, 97, -10 }, { 80, 101, -20 }, { 80, 111, -20 }, { 80, 192, -74 }, { 80, 193, -74 }, { 80, 194, -74 },
+		{ 80, 195, -74 }, { 80, 196, -74 }, { 80, 197, -74 }, { 80, 224, -10 }, { 80, 225, -10 }, { 80, 226, -10 },
+		{ 80, 227, -10 }, { 80, 228, -10 }, { 80, 229, -10 }, { 80, 232, -20 }, { 80, 233, -20 }, { 80, 234, -20 },
+		{ 80, 235, -20 }, { 80, 242, -20 }, { 80, 243, -20 }, { 80, 244, -20 }, { 80, 245, -20 }, { 80, 246, -20 },
+		{ 80, 248, -20 }, { 81, 46, -20 }, { 81, 85, -10 }, { 81, 217, -10 }, { 81, 218, -10 }, { 81, 219, -10 },
+		{ 81, 220, -10 }, { 82, 79, -30 }, { 82, 84, -40 }, { 82, 85, -30 }, { 82, 86, -55 }, { 82, 87, -35 },
+		{ 82, 89, -35 }, { 82, 159, -35 }, { 82, 210, -30 }, { 82, 211, -30 }, { 82, 212, -30 }, { 82, 213, -30 },
+		{ 82, 214, -30 }, { 82, 216, -30 }, { 82, 217, -30 }, { 82, 218, -30 }, { 82, 219, -30 }, { 82, 220, -30 },
+		{ 82, 221, -35 }, { 84, 44, -74 }, { 84, 45, -92 }, { 84, 46, -90 }, { 84, 58, -74 }, { 84, 59, -74 },
+		{ 84, 65, -90 }, { 84, 79, -18 }, { 84, 97, -92 }, { 84, 101, -92 }, { 84, 105, -18 }, { 84, 111, -92 },
+		{ 84, 114, -74 }, { 84, 117, -92 }, { 84, 119, -74 }, { 84, 121, -34 }, { 84, 173, -92 }, { 84, 192, -90 },
+		{ 84, 193, -90 }, { 84, 194, -90 }, { 84, 195, -90 }, { 84, 196, -90 }, { 84, 197, -90 }, { 84, 210, -18 },
+		{ 84, 211, -18 }, { 84, 212, -18 }, { 84, 213, -18 }, { 84, 214, -18 }, { 84, 216, -18 }, { 84, 224, -52 },
+		{ 84, 225, -92 }, { 84, 226, -52 }, { 84, 227, -52 }, { 84, 228, -52 }, { 84, 229, -92 }, { 84, 232, -52 },
+		{ 84, 233, -92 }, { 84, 234, -92 }, { 84, 235, -52 }, { 84, 237, -18 }, { 84, 242, -92 }, { 84, 243, -92 },
+		{ 84, 244, -92 }, { 84, 245, -92 }, { 84, 246, -92 }, { 84, 248, -92 }, { 84, 249, -92 }, { 84, 250, -92 },
+		{ 84, 251, -92 }, { 84, 252, -92 }, { 84, 253, -34 }, { 84, 255, -34 }, { 85, 44, -50 }, { 85, 46, -50 },
+		{ 85, 65, -60 }, { 85, 192, -60 }, { 85, 193, -60 }, { 85, 194, -60 }, { 85, 195, -60 }, { 85, 196, -60 },
+		{ 85, 197, -60 }, { 86, 44, -129 }, { 86, 45, -74 }, { 86, 46, -145 }, { 86, 58, -92 }, { 86, 59, -92 },
+		{ 86, 65, -135 }, { 86, 71, -30 }, { 86, 79, -45 }, { 86, 97, -92 }, { 86, 101, -100 }, { 86, 105, -37 },
+		{ 86, 111, -100 }, { 86, 117, -92 }, { 86, 173, -74 }, { 86, 192, -135 }, { 86, 193, -135 }, { 86, 194, -135 },
+		{ 86, 195, -135 }, { 86, 196, -135 }, { 86, 197, -135 }, { 86, 210, -45 }, { 86, 211, -45 }, { 86, 212, -45 },
+		{ 86, 213, -45 }, { 86, 214, -45 }, { 86, 216, -45 }, { 86, 224, -92 }, { 86, 225, -92 }, { 86, 226, -92 },
+		{ 86, 227, -92 }, { 86, 228, -92 }, { 86, 229, -92 }, { 86, 232, -100 }, { 86, 233, -100 }, { 86, 234, -100 },
+		{ 86, 235, -100 }, { 86, 236, -37 }, { 86, 237, -37 }, { 86, 238, -37 }, { 86, 239, -37 }, { 86, 242, -100 },
+		{ 86, 243, -100 }, { 86, 244, -100 }, { 86, 245, -100 }, { 86, 246, -100 }, { 86, 248, -100 }, { 86, 249, -92 },
+		{ 86, 250, -92 }, { 86, 251, -92 }, { 86, 252, -92 }, { 87, 44, -92 }, { 87, 45, -37 }, { 87, 46, -92 },
+		{ 87, 58, -55 }, { 87, 59, -55 }, { 87, 65, -120 }, { 87, 79, -10 }, { 87, 97, -65 }, { 87, 101, -65 },
+		{ 87, 105, -18 }, { 87, 111, -75 }, { 87, 117, -50 }, { 87, 121, -60 }, { 87, 173, -37 }, { 87, 192, -120 },
+		{ 87, 193, -120 }, { 87, 194, -120 }, { 87, 195, -120 }, { 87, 196, -120 }, { 87, 197, -120 }, { 87, 210, -10 },
+		{ 87, 211, -10 }, { 87, 212, -10 }, { 87, 213, -10 }, { 87, 214, -10 }, { 87, 216, -10 }, { 87, 224, -65 },
+		{ 87, 225, -65 }, { 87, 226, -65 }, { 87, 227, -65 }, { 87, 228, -65 }, { 87, 229, -65 }, { 87, 232, -65 },
+		{ 87, 233, -65 }, { 87, 234, -65 }, { 87, 235, -65 }, { 87, 237, -18 }, { 87, 242, -75 }, { 87, 243, -75 },
+		{ 87, 244, -75 }, { 87, 245, -75 }, { 87, 246, -75 }, { 87, 248, -75 }, { 87, 249, -50 }, { 87, 250, -50 },
+		{ 87, 251, -50 }, { 87, 252, -50 }, { 87, 253, -60 }, { 87, 255, -60 }, { 89, 44, -92 }, { 89, 45, -92 },
+		{ 89, 46, -92 }, { 89, 58, -92 }, { 89, 59, -92 }, { 89, 65, -110 }, { 89, 79, -35 }, { 89, 97, -85 },
+		{ 89, 101, -111 }, { 89, 105, -37 }, { 89, 111, -111 }, { 89, 117, -92 }, { 89, 173, -92 }, { 89, 192, -110 },
+		{ 89, 193, -110 }, { 89, 194, -110 }, { 89, 195, -110 }, { 89, 196, -110 }, { 89, 197, -110 }, { 89, 210, -35 },
+		{ 89, 211, -35 }, { 89, 212, -35 }, { 89, 213, -35 }, { 89, 214, -35 }, { 89, 216, -35 }, { 89, 224, -85 },
+		{ 89, 225, -85 }, { 89, 226, -85 }, { 89, 227, -85 }, { 89, 228, -85 }, { 89, 229, -85 }, { 89, 232, -71 },
+		{ 89, 233, -111 }, { 89, 234, -111 }, { 89, 235, -71 }, { 89, 237, -37 }, { 89, 242, -111 }, { 89, 243, -111 },
+		{ 89, 244, -111 }, { 89, 245, -111 }, { 89, 246, -111 }, { 89, 248, -111 }, { 89, 249, -92 }, { 89, 250, -92 },
+		{ 89, 251, -92 }, { 89, 252, -92 }, { 97, 118, -25 }, { 98, 46, -40 }, { 98, 98, -10 }, { 98, 117, -20 },
+		{ 98, 118, -15 }, { 98, 249, -20 }, { 98, 250, -20 }, { 98, 251, -20 }, { 98, 252, -20 }, { 100, 119, -15 },
+		{ 101, 118, -15 }, { 102, 44, -15 }, { 102, 46, -15 }, { 102, 105, -25 }, { 102, 111, -25 }, { 102, 146, 55 },
+		{ 102, 148, 50 }, { 102, 242, -25 }, { 102, 243, -25 }, { 102, 244, -25 }, { 102, 245, -25 }, { 102, 246, -25 },
+		{ 102, 248, -25 }, { 103, 46, -15 }, { 104, 121, -15 }, { 104, 253, -15 }, { 104, 255, -15 }, { 105, 118, -10 },
+		{ 107, 101, -10 }, { 107, 111, -15 }, { 107, 121, -15 }, { 107, 232, -10 }, { 107, 233, -10 }, { 107, 234, -10 },
+		{ 107, 235, -10 }, { 107, 242, -15 }, { 107, 243, -15 }, { 107, 244, -15 }, { 107, 245, -15 }, { 107, 246, -15 },
+		{ 107, 248, -15 }, { 107, 253, -15 }, { 107, 255, -15 }, { 110, 118, -40 }, { 111, 118, -10 }, { 111, 119, -10 },
+		{ 114, 44, -92 }, { 114, 45, -37 }, { 114, 46, -100 }, { 114, 99, -18 }, { 114, 101, -18 }, { 114, 103, -10 },
+		{ 114, 110, -15 }, { 114, 111, -18 }, { 114, 112, -10 }, { 114, 113, -18 }, { 114, 118, -10 }, { 114, 173, -37 },
+		{ 114, 231, -18 }, { 114, 232, -18 }, { 114, 233, -18 }, { 114, 234, -18 }, { 114, 235, -18 }, { 114, 241, -15 },
+		{ 114, 242, -18 }, { 114, 243, -18 }, { 114, 244, -18 }, { 114, 245, -18 }, { 114, 246, -18 }, { 114, 248, -18 },
+		{ 118, 44, -55 }, { 118, 46, -70 }, { 118, 97, -10 }, { 118, 101, -10 }, { 118, 111, -10 }, { 118, 224, -10 },
+		{ 118, 225, -10 }, { 118, 226, -10 }, { 118, 227, -10 }, { 118, 228, -10 }, { 118, 229, -10 }, { 118, 232, -10 },
+		{ 118, 233, -10 }, { 118, 234, -10 }, { 118, 235, -10 }, { 118, 242, -10 }, { 118, 243, -10 }, { 118, 244, -10 },
+		{ 118, 245, -10 }, { 118, 246, -10 }, { 118, 248, -10 }, { 119, 44, -55 }, { 119, 46, -70 }, { 119, 111, -10 },
+		{ 119, 242, -10 }, { 119, 243, -10 }, { 119, 244, -10 }, { 119, 245, -10 }, { 119, 246, -10 }, { 119, 248, -10 },
+		{ 121, 44, -55 }, { 121, 46, -70 }, { 121, 101, -10 }, { 121, 111, -25 }, { 121, 232, -10 }, { 121, 233, -10 },
+		{ 121, 234, -10 }, { 121, 235, -10 }, { 121, 242, -25 }, { 121, 243, -25 }, { 121, 244, -25 }, { 121, 245, -25 },
+		{ 121, 246, -25 }, { 121, 248, -25 }, { 145, 65, -10 }, { 145, 145, -63 }, { 145, 192, -10 }, { 145, 193, -10 },
+		{ 145, 194, -10 }, { 145, 195, -10 }, { 145, 196, -10 }, { 145, 197, -10 }, { 146, 32, -74 }, { 146, 100, -20 },
+		{ 146, 114, -20 }, { 146, 115, -37 }, { 146, 118, -20 }, { 146, 146, -63 }, { 146, 154, -37 }, { 146, 160, -74 },
+		{ 147, 65, -10 }, { 147, 192, -10 }, { 147, 193, -10 }, { 147, 194, -10 }, { 147, 195, -10 }, { 147, 196, -10 },
+		{ 147, 197, -10 }, { 159, 44, -92 }, { 159, 45, -92 }, { 159, 46, -92 }, { 159, 58, -92 }, { 159, 59, -92 },
+		{ 159, 65, -110 }, { 159, 79, -35 }, { 159, 97, -85 }, { 159, 101, -111 }, { 159, 105, -37 }, { 159, 111, -111 },
+		{ 159, 117, -92 }, { 159, 173, -92 }, { 159, 192, -110 }, { 159, 193, -110 }, { 159, 194, -110 }, { 159, 195, -110 },
+		{ 159, 196, -110 }, { 159, 197, -110 }, { 159, 210, -35 }, { 159, 211, -35 }, { 159, 212, -35 }, { 159, 213, -35 },
+		{ 159, 214, -35 }, { 159, 216, -35 }, { 159, 224, -85 }, { 159, 225, -85 }, { 159, 226, -85 }, { 159, 227, -85 },
+		{ 159, 228, -85 }, { 159, 229, -85 }, { 159, 232, -71 }, { 159, 233, -111 }, { 159, 234, -111 }, { 159, 235, -71 },
+		{ 159, 237, -37 }, { 159, 242, -111 }, { 159, 243, -111 }, { 159, 244, -111 }, { 159, 245, -111 }, { 159, 246, -111 },
+		{ 159, 248, -111 }, { 159, 249, -92 }, { 159, 250, -92 }, { 159, 251, -92 }, { 159, 252, -92 }, { 160, 65, -55 },
+		{ 160, 84, -30 }, { 160, 86, -45 }, { 160, 87, -30 }, { 160, 89, -55 }, { 160, 159, -55 }, { 160, 192, -55 },
+		{ 160, 193, -55 }, { 160, 194, -55 }, { 160, 195, -55 }, { 160, 196, -55 }, { 160, 197, -55 }, { 160, 221, -55 },
+		{ 192, 67, -55 }, { 192, 71, -55 }, { 192, 79, -45 }, { 192, 81, -45 }, { 192, 84, -95 }, { 192, 85, -50 },
+		{ 192, 86, -145 }, { 192, 87, -130 }, { 192, 89, -100 }, { 192, 112, -25 }, { 192, 117, -50 }, { 192, 118, -100 },
+		{ 192, 119, -90 }, { 192, 121, -74 }, { 192, 146, -74 }, { 192, 159, -100 }, { 192, 199, -55 }, { 192, 210, -45 },
+		{ 192, 211, -45 }, { 192, 212, -45 }, { 192, 213, -45 }, { 192, 214, -45 }, { 192, 216, -45 }, { 192, 217, -50 },
+		{ 192, 218, -50 }, { 192, 219, -50 }, { 192, 220, -50 }, { 192, 221, -100 }, { 192, 249, -50 }, { 192, 250, -50 },
+		{ 192, 251, -50 }, { 192, 252, -50 }, { 192, 253, -74 }, { 192, 255, -74 }, { 193, 67, -55 }, { 193, 71, -55 },
+		{ 193, 79, -45 }, { 193, 81, -45 }, { 193, 84, -95 }, { 193, 85, -50 }, { 193, 86, -145 }, { 193, 87, -130 },
+		{ 193, 89, -100 }, { 193, 112, -25 }, { 193, 117, -50 }, { 193, 118, -100 }, { 193, 119, -90 }, { 193, 121, -74 },
+		{ 193, 146, -74 }, { 193, 159, -100 }, { 193, 199, -55 }, { 193, 210, -45 }, { 193, 211, -45 }, { 193, 212, -45 },
+		{ 193, 213, -45 }, { 193, 214, -45 }, { 193, 216, -45 }, { 193, 217, -50 }, { 193, 218, -50 }, { 193, 219, -50 },
+		{ 193, 220, -50 }, { 193, 221, -100 }, { 193, 249, -50 }, { 193, 250, -50 }, { 193, 251, -50 }, { 193, 252, -50 },
+		{ 193, 253, -74 }, { 193, 255, -74 }, { 194, 67, -55 }, { 194, 71, -55 }, { 194, 79, -45 }, { 194, 81, -45 },
+		{ 194, 84, -95 }, { 194, 85, -50 }, { 194, 86, -145 }, { 194, 87, -130 }, { 194, 89, -100 }, { 194, 112, -25 },
+		{ 194, 117, -50 }, { 194, 118, -100 }, { 194, 119, -90 }, { 194, 121, -74 }, { 194, 146, -74 }, { 194, 159, -100 },
+		{ 194, 199, -55 }, { 194, 210, -45 }, { 194, 211, -45 }, { 194, 212, -45 }, { 194, 213, -45 }, { 194, 214, -45 },
+		{ 194, 216, -45 }, { 194, 217, -50 }, { 194, 218, -50 }, { 194, 219, -50 }, { 194, 220, -50 }, { 194, 221, -100 },
+		{ 194, 249, -50 }, { 194, 250, -50 }, { 194, 251, -50 }, { 194, 252, -50 }, { 194, 253, -74 }, { 194, 255, -74 },
+		{ 195, 67, -55 }, { 195, 71, -55 }, { 195, 79, -45 }, { 195, 81, -45 }, { 195, 84, -95 }, { 195, 85, -50 },
+		{ 195, 86, -145 }, { 195, 87, -130 }, { 195, 89, -100 }, { 195, 112, -25 }, { 195, 117, -50 }, { 195, 118, -100 },
+		{ 195, 119, -90 }, { 195, 121, -74 }, { 195, 146, -74 }, { 195, 159, -100 }, { 195, 199, -55 }, { 195, 210, -45 },
+		{ 195, 211, -45 }, { 195, 212, -45 }, { 195, 213, -45 }, { 195, 214, -45 }, { 195, 216, -45 }, { 195, 217, -50 },
+		{ 195, 218, -50 }, { 195, 219, -50 }, { 195, 220, -50 }, { 195, 221, -100 }, { 195, 249, -50 }, { 195, 250, -50 },
+		{ 195, 251, -50 }, { 195, 252, -50 }, { 195, 253, -74 }, { 195, 255, -74 }, { 196, 67, -55 }, { 196, 71, -55 },
+		{ 196, 79, -45 }, { 196, 81, -45 }, { 196, 84, -95 }, { 196, 85, -50 }, { 196, 86, -145 }, { 196, 87, -130 },
+		{ 196, 89, -100 }, { 196, 112, -25 }, { 196, 117, -50 }, { 196, 118, -100 }, { 196, 119, -90 }, { 196, 121, -74 },
+		{ 196, 146, -74 }, { 196, 159, -100 }, { 196, 199, -55 }, { 196, 210, -45 }, { 196, 211, -45 }, { 196, 212, -45 },
+		{ 196, 213, -45 }, { 196, 214, -45 }, { 196, 216, -45 }, { 196, 217, -50 }, { 196, 218, -50 }, { 196, 219, -50 },
+		{ 196, 220, -50 }, { 196, 221, -100 }, { 196, 249, -50 }, { 196, 250, -50 }, { 196, 251, -50 }, { 196, 252, -50 },
+		{ 196, 253, -74 }, { 196, 255, -74 }, { 197, 67, -55 }, { 197, 71, -55 }, { 197, 79, -45 }, { 197, 81, -45 },
+		{ 197, 84, -95 }, { 197, 85, -50 }, { 197, 86, -145 }, { 197, 87, -130 }, { 197, 89, -100 }, { 197, 112, -25 },
+		{ 197, 117, -50 }, { 197, 118, -100 }, { 197, 119, -90 }, { 197, 121, -74 }, { 197, 146, -74 }, { 197, 159, -100 },
+		{ 197, 199, -55 }, { 197, 210, -45 }, { 197, 211, -45 }, { 197, 212, -45 }, { 197, 213, -45 }, { 197, 214, -45 },
+		{ 197, 216, -45 }, { 197, 217, -50 }, { 197, 218, -50 }, { 197, 219, -50 }, { 197, 220, -50 }, { 197, 221, -100 },
+		{ 197, 249, -50 }, { 197, 250, -50 }, { 197, 251, -50 }, { 197, 252, -50 }, { 197, 253, -74 }, { 197, 255, -74 },
+		{ 209, 65, -20 }, { 209, 192, -20 }, { 209, 193, -20 }, { 209, 194, -20 }, { 209, 195, -20 }, { 209, 196, -20 },
+		{ 209, 197, -20 }, { 210, 65, -40 }, { 210, 84, -40 }, { 210, 86, -50 }, { 210, 87, -50 }, { 210, 88, -40 },
+		{ 210, 89, -50 }, { 210, 159, -50 }, { 210, 192, -40 }, { 210, 193, -40 }, { 210, 194, -40 }, { 210, 195, -40 },
+		{ 210, 196, -40 }, { 210, 197, -40 }, { 210, 221, -50 }, { 211, 65, -40 }, { 211, 84, -40 }, { 211, 86, -50 },
+		{ 211, 87, -50 }, { 211, 88, -40 }, { 211, 89, -50 }, { 211, 159, -50 }, { 211, 192, -40 }, { 211, 193, -40 },
+		{ 211, 194, -40 }, { 211, 195, -40 }, { 211, 196, -40 }, { 211, 197, -40 }, { 211, 221, -50 }, { 212, 65, -40 },
+		{ 212, 84, -40 }, { 212, 86, -50 }, { 212, 87, -50 }, { 212, 88, -40 }, { 212, 89, -50 }, { 212, 159, -50 },
+		{ 212, 192, -40 }, { 212, 193, -40 }, { 212, 194, -40 }, { 212, 195, -40 }, { 212, 196, -40 }, { 212, 197, -40 },
+		{ 212, 221, -50 }, { 213, 65, -40 }, { 213, 84, -40 }, { 213, 86, -50 }, { 213, 87, -50 }, { 213, 88, -40 },
+		{ 213, 89, -50 }, { 213, 159, -50 }, { 213, 192, -40 }, { 213, 193, -40 }, { 213, 194, -40 }, { 213, 195, -40 },
+		{ 213, 196, -40 }, { 213, 197, -40 }, { 213, 221, -50 }, { 214, 65, -40 }, { 214, 84, -40 }, { 214, 86, -50 },
+		{ 214, 87, -50 }, { 214, 88, -40 }, { 214, 89, -50 }, { 214, 159, -50 }, { 214, 192, -40 }, { 214, 193, -40 },
+		{ 214, 194, -40 }, { 214, 195, -40 }, { 214, 196, -40 }, { 214, 197, -40 }, { 214, 221, -50 }, { 216, 65, -40 },
+		{ 216, 84, -40 }, { 216, 86, -50 }, { 216, 87, -50 }, { 216, 88, -40 }, { 216, 89, -50 }, { 216, 159, -50 },
+		{ 216, 192, -40 }, { 216, 193, -40 }, { 216, 194, -40 }, { 216, 195, -40 }, { 216, 196, -40 }, { 216, 197, -40 },
+		{ 216, 221, -50 }, { 217, 44, -50 }, { 217, 46, -50 }, { 217, 65, -60 }, { 217, 192, -60 }, { 217, 193, -60 },
+		{ 217, 194, -60 }, { 217, 195, -60 }, { 217, 196, -60 }, { 217, 197, -60 }, { 218, 44, -50 }, { 218, 46, -50 },
+		{ 218, 65, -60 }, { 218, 192, -60 }, { 218, 193, -60 }, { 218, 194, -60 }, { 218, 195, -60 }, { 218, 196, -60 },
+		{ 218, 197, -60 }, { 219, 44, -50 }, { 219, 46, -50 }, { 219, 65, -60 }, { 219, 192, -60 }, { 219, 193, -60 },
+		{ 219, 194, -60 }, { 219, 195, -60 }, { 219, 196, -60 }, { 219, 197, -60 }, { 220, 44, -50 }, { 220, 46, -50 },
+		{ 220, 65, -60 }, { 220, 192, -60 }, { 220, 193, -60 }, { 220, 194, -60 }, { 220, 195, -60 }, { 220, 196, -60 },
+		{ 220, 197, -60 }, { 221, 44, -92 }, { 221, 45, -92 }, { 221, 46, -92 }, { 221, 58, -92 }, { 221, 59, -92 },
+		{ 221, 65, -110 }, { 221, 79, -35 }, { 221, 97, -85 }, { 221, 101, -111 }, { 221, 105, -37 }, { 221, 111, -111 },
+		{ 221, 117, -92 }, { 221, 173, -92 }, { 221, 192, -110 }, { 221, 193, -110 }, { 221, 194, -110 }, { 221, 195, -110 },
+		{ 221, 196, -110 }, { 221, 197, -110 }, { 221, 210, -35 }, { 221, 211, -35 }, { 221, 212, -35 }, { 221, 213, -35 },
+		{ 221, 214, -35 }, { 221, 216, -35 }, { 221, 224, -85 }, { 221, 225, -85 }, { 221, 226, -85 }, { 221, 227, -85 },
+		{ 221, 228, -85 }, { 221, 229, -85 }, { 221, 232, -71 }, { 221, 233, -111 }, { 221, 234, -111 }, { 221, 235, -71 },
+		{ 221, 237, -37 }, { 221, 242, -111 }, { 221, 243, -111 }, { 221, 244, -111 }, { 221, 245, -111 }, { 221, 246, -111 },
+		{ 221, 248, -111 }, { 221, 249, -92 }, { 221, 250, -92 }, { 221, 251, -92 }, { 221, 252, -92 }, { 224, 118, -25 },
+		{ 225, 118, -25 }, { 226, 118, -25 }, { 227, 118, -25 }, { 228, 118, -25 }, { 229, 118, -25 }, { 232, 118, -15 },
+		{ 233, 118, -15 }, { 234, 118, -15 }, { 235, 118, -15 }, { 236, 118, -10 }, { 237, 118, -10 }, { 238, 118, -10 },
+		{ 239, 118, -10 }, { 241, 118, -40 }, { 242, 118, -10 }, { 242, 119, -10 }, { 243, 118, -10 }, { 243, 119, -10 },
+		{ 244, 118, -10 }, { 244, 119, -10 }, { 245, 118, -10 }, { 245, 119, -10 }, { 246, 118, -10 }, { 246, 119, -10 },
+		{ 248, 118, -10 }, { 248, 119, -10 }, { 253, 44, -55 }, { 253, 46, -70 }, { 253, 101, -10 }, { 253, 111, -25 },
+		{ 253, 232, -10 }, { 253, 233, -10 }, { 253, 234, -10 }, { 253, 235, -10 }, { 253, 242, -25 }, { 253, 243, -25 },
+		{ 253, 244, -25 }, { 253, 245, -25 }, { 253, 246, -25 }, { 253, 248, -25 }, { 255, 44, -55 }, { 255, 46, -70 },
+		{ 255, 101, -10 }, { 255, 111, -25 }, { 255, 232, -10 }, { 255, 233, -10 }, { 255, 234, -10 }, { 255, 235, -10 },
+		{ 255, 242, -25 }, { 255, 243, -25 }, { 255, 244, -25 }, { 255, 245, -25 }, { 255, 246, -25 }, { 255, 248, -25 },
+	};
+
+	static constexpr GlyphMetrics TIMES_BOLDITALIC_GLYPHS[256] = {
+		/* 00 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 03 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 06 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 09 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0f */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 12 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 15 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 18 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1b */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 250, 0, 0, 0, 0 },
+		/* 21 */ { 389, 67, -13, 370, 684 }, { 555, 136, 398, 536, 685 }, { 500, -33, 0, 533, 700 },
+		/* 24 */ { 500, -20, -100, 497, 733 }, { 833, 39, -10, 793, 692 }, { 778, 5, -19, 699, 682 },
+		/* 27 */ { 278, 128, 398, 268, 685 }, { 333, 28, -179, 344, 685 }, { 333, -44, -179, 271, 685 },
+		/* 2a */ { 500, 65, 249, 456, 685 }, { 570, 33, 0, 537, 506 }, { 250, -60, -182, 144, 134 },
+		/* 2d */ { 333, 2, 166, 271, 282 }, { 250, -9, -13, 139, 135 }, { 278, -64, -18, 342, 685 },
+		/* 30 */ { 500, 17, -14, 477, 683 }, { 500, 5, 0, 419, 683 }, { 500, -27, 0, 446, 683 },
+		/* 33 */ { 500, -15, -13, 450, 683 }, { 500, -15, 0, 503, 683 }, { 500, -11, -13, 487, 669 },
+		/* 36 */ { 500, 23, -15, 509, 679 }, { 500, 52, 0, 525, 669 }, { 500, 3, -13, 476, 683 },
+		/* 39 */ { 500, -12, -10, 475, 683 }, { 333, 23, -13, 264, 459 }, { 333, -25, -183, 264, 459 },
+		/* 3c */ { 570, 31, -8, 539, 514 }, { 570, 33, 107, 537, 399 }, { 570, 31, -8, 539, 514 },
+		/* 3f */ { 500, 79, -13, 470, 684 }, { 832, 63, -18, 770, 685 }, { 667, -67, 0, 593, 683 },
+		/* 42 */ { 667, -24, 0, 624, 669 }, { 667, 32, -18, 677, 685 }, { 722, -46, 0, 685, 669 },
+		/* 45 */ { 667, -27, 0, 653, 669 }, { 667, -13, 0, 660, 669 }, { 722, 21, -18, 706, 685 },
+		/* 48 */ { 778, -24, 0, 799, 669 }, { 389, -32, 0, 406, 669 }, { 500, -46, -99, 524, 669 },
+		/* 4b */ { 667, -21, 0, 702, 669 }, { 611, -22, 0, 590, 669 }, { 889, -29, -12, 917, 669 },
+		/* 4e */ { 722, -27, -15, 748, 669 }, { 722, 27, -18, 691, 685 }, { 611, -27, 0, 613, 669 },
+		/* 51 */ { 722, 27, -208, 691, 685 }, { 667, -29, 0, 623, 669 }, { 556, 2, -18, 526, 685 },
+		/* 54 */ { 611, 50, 0, 650, 669 }, { 722, 67, -18, 744, 669 }, { 667, 65, -18, 715, 669 },
+		/* 57 */ { 889, 65, -18, 940, 669 }, { 667, -24, 0, 694, 669 }, { 611, 73, 0, 659, 669 },
+		/* 5a */ { 611, -11, 0, 590, 669 }, { 333, -37, -159, 362, 674 }, { 278, -1, -18, 279, 685 },
+		/* 5d */ { 333, -56, -157, 343, 674 }, { 570, 67, 304, 503, 669 }, { 500, 0, -125, 500, -75 },
+		/* 60 */ { 333, 85, 516, 297, 697 }, { 500, -21, -14, 455, 462 }, { 500, -14, -13, 444, 699 },
+		/* 63 */ { 444, -5, -13, 392, 462 }, { 500, -21, -13, 517, 699 }, { 444, 5, -13, 398, 462 },
+		/* 66 */ { 333, -169, -205, 446, 698 }, { 500, -52, -203, 478, 462 }, { 556, -13, -9, 498, 699 },
+		/* 69 */ { 278, 2, -9, 263, 684 }, { 278, -189, -207, 279, 684 }, { 500, -23, -8, 483, 699 },
+		/* 6c */ { 278, 2, -9, 290, 699 }, { 778, -14, -9, 722, 462 }, { 556, -6, -9, 493, 462 },
+		/* 6f */ { 500, -3, -13, 441, 462 }, { 500, -120, -205, 446, 462 }, { 500, 1, -205, 471, 462 },
+		/* 72 */ { 389, -21, 0, 389, 462 }, { 389, -19, -13, 333, 462 }, { 278, -11, -9, 281, 594 },
+		/* 75 */ { 556, 15, -9, 492, 462 }, { 444, 16, -13, 401, 462 }, { 667, 16, -13, 614, 462 },
+		/* 78 */ { 500, -46, -13, 469, 462 }, { 444, -94, -205, 392, 462 }, { 389, -43, -78, 368, 449 },
+		/* 7b */ { 348, 5, -187, 436, 686 }, { 220, 66, -218, 154, 782 }, { 348, -129, -187, 302, 686 },
+		/* 7e */ { 570, 54, 173, 516, 333 }, { 0, 0, 0, 0, 0 }, { 500, 0, 0, 0, 0 },
+		/* 81 */ { 0, 0, 0, 0, 0 }, { 333, -5, -182, 199, 134 }, { 500, -87, -156, 537, 707 },
+		/* 84 */ { 500, -57, -182, 403, 134 }, { 1000, 40, -13, 852, 135 }, { 500, 91, -145, 494, 685 },
+		/* 87 */ { 500, 10, -139, 493, 685 }, { 333, 40, 516, 367, 690 }, { 1000, 7, -29, 996, 706 },
+		/* 8a */ { 556, 2, -18, 553, 897 }, { 333, 32, 32, 303, 415 }, { 944, 23, -8, 946, 677 },
+		/* 8d */ { 0, 0, 0, 0, 0 }, { 611, -11, 0, 590, 897 }, { 0, 0, 0, 0, 0 },
+		/* 90 */ { 0, 0, 0, 0, 0 }, { 333, 128, 369, 332, 685 }, { 333, 98, 369, 302, 685 },
+		/* 93 */ { 500, 53, 369, 513, 685 }, { 500, 53, 369, 513, 685 }, { 350, 0, 175, 350, 525 },
+		/* 96 */ { 500, -40, 178, 477, 269 }, { 1000, -40, 178, 977, 269 }, { 333, 48, 536, 407, 655 },
+		/* 99 */ { 1000, 32, 263, 968, 669 }, { 389, -19, -13, 424, 690 }, { 333, 10, 32, 281, 415 },
+		/* 9c */ { 722, 6, -13, 674, 462 }, { 0, 0, 0, 0, 0 }, { 389, -43, -78, 424, 690 },
+		/* 9f */ { 611, 73, 0, 659, 862 }, { 250, 0, 0, 0, 0 }, { 389, 19, -205, 322, 492 },
+		/* a2 */ { 500, 42, -143, 439, 576 }, { 500, -32, -12, 510, 683 }, { 500, -26, 34, 526, 586 },
+		/* a5 */ { 500, 33, 0, 628, 669 }, { 220, 66, -143, 154, 707 }, { 500, 36, -143, 459, 685 },
+		/* a8 */ { 333, 55, 550, 402, 684 }, { 747, 30, -18, 718, 685 }, { 266, 16, 399, 330, 685 },
+		/* ab */ { 500, 12, 32, 468, 415 }, { 606, 51, 108, 555, 399 }, { 333, 2, 166, 271, 282 },
+		/* ae */ { 747, 30, -18, 718, 685 }, { 333, 51, 553, 393, 623 }, { 400, 83, 397, 369, 683 },
+		/* b1 */ { 570, 33, 0, 537, 506 }, { 300, 2, 274, 313, 683 }, { 300, 17, 265, 321, 683 },
+		/* b4 */ { 333, 139, 516, 379, 697 }, { 576, -60, -207, 516, 449 }, { 500, -57, -193, 562, 669 },
+		/* b7 */ { 250, 51, 257, 199, 405 }, { 333, -80, -218, 156, 5 }, { 300, 30, 274, 301, 683 },
+		/* ba */ { 300, 56, 400, 347, 685 }, { 500, 12, 32, 468, 415 }, { 750, 7, -14, 721, 683 },
+		/* bd */ { 750, -9, -14, 723, 683 }, { 750, 7, -14, 726, 683 }, { 500, 30, -205, 421, 492 },
+		/* c0 */ { 667, -67, 0, 593, 904 }, { 667, -67, 0, 593, 904 }, { 667, -67, 0, 593, 897 },
+		/* c3 */ { 667, -67, 0, 593, 862 }, { 667, -67, 0, 593, 862 }, { 667, -67, 0, 593, 921 },
+		/* c6 */ { 944, -64, 0, 918, 669 }, { 667, 32, -218, 677, 685 }, { 667, -27, 0, 653, 904 },
+		/* c9 */ { 667, -27, 0, 653, 904 }, { 667, -27, 0, 653, 897 }, { 667, -27, 0, 653, 862 },
+		/* cc */ { 389, -32, 0, 406, 904 }, { 389, -32, 0, 432, 904 }, { 389, -32, 0, 450, 897 },
+		/* cf */ { 389, -32, 0, 450, 862 }, { 722, -31, 0, 700, 669 }, { 722, -27, -15, 748, 862 },
+		/* d2 */ { 722, 27, -18, 691, 904 }, { 722, 27, -18, 691, 904 }, { 722, 27, -18, 691, 897 },
+		/* d5 */ { 722, 27, -18, 691, 862 }, { 722, 27, -18, 691, 862 }, { 570, 48, 16, 522, 490 },
+		/* d8 */ { 722, 27, -125, 691, 764 }, { 722, 67, -18, 744, 904 }, { 722, 67, -18, 744, 904 },
+		/* db */ { 722, 67, -18, 744, 897 }, { 722, 67, -18, 744, 862 }, { 611, 73, 0, 659, 904 },
+		/* de */ { 611, -27, 0, 573, 669 }, { 500, -200, -200, 473, 705 }, { 500, -21, -14, 455, 697 },
+		/* e1 */ { 500, -21, -14, 463, 697 }, { 500, -21, -14, 455, 690 }, { 500, -21, -14, 491, 655 },
+		/* e4 */ { 500, -21, -14, 476, 655 }, { 500, -21, -14, 455, 729 }, { 722, -5, -13, 673, 462 },
+		/* e7 */ { 444, -5, -218, 392, 462 }, { 444, 5, -13, 398, 697 }, { 444, 5, -13, 435, 697 },
+		/* ea */ { 444, 5, -13, 423, 690 }, { 444, 5, -13, 448, 655 }, { 278, 2, -9, 259, 697 },
+		/* ed */ { 278, 2, -9, 352, 697 }, { 278, -3, -9, 324, 690 }, { 278, 2, -9, 364, 655 },
+		/* f0 */ { 500, -3, -13, 454, 699 }, { 556, -6, -9, 504, 655 }, { 500, -3, -13, 441, 697 },
+		/* f3 */ { 500, -3, -13, 463, 697 }, { 500, -3, -13, 451, 690 }, { 500, -3, -13, 491, 655 },
+		/* f6 */ { 500, -3, -13, 471, 655 }, { 570, 33, -29, 537, 535 }, { 500, -3, -119, 441, 560 },
+		/* f9 */ { 556, 15, -9, 492, 697 }, { 556, 15, -9, 492, 697 }, { 556, 15, -9, 492, 690 },
+		/* fc */ { 556, 15, -9, 499, 655 }, { 444, -94, -205, 435, 697 }, { 500, -120, -205, 446, 699 },
+		/* ff */ { 444, -94, -205, 443, 655 },
+	};
+
+	static constexpr KerningPair TIMES_BOLDITALIC_KERNING[] = {
+		{ 32, 65, -37 }, { 32, 86, -70 }, { 32, 87, -70 }, { 32, 89, -70 }, { 32, 159, -70 }, { 32, 192, -37 },
+		{ 32, 193, -37 }, { 32, 194, -37 }, { 32, 195, -37 }, { 32, 196, -37 }, { 32, 197, -37 }, { 32, 221, -70 },
+		{ 44, 146, -95 }, { 44, 148, -95 }, { 46, 146, -95 }, { 46, 148, -95 }, { 65, 67, -65 }, { 65, 71, -60 },
+		{ 65, 79, -50 }, { 65, 81, -55 }, { 65, 84, -55 }, { 65, 85, -50 }, { 65, 86, -95 }, { 65, 87, -100 },
+		{ 65, 89, -70 }, { 65, 117, -30 }, { 65, 118, -74 }, { 65, 119, -74 }, { 65, 121, -74 }, { 65, 146, -74 },
+		{ 65, 159, -70 }, { 65, 199, -65 }, { 65, 210, -50 }, { 65, 211, -50 }, { 65, 212, -50 }, { 65, 213, -50 },
+		{ 65, 214, -50 }, { 65, 216, -50 }, { 65, 217, -50 }, { 65, 218, -50 }, { 65, 219, -50 }, { 65, 220, -50 },
+		{ 65, 221, -70 }, { 65, 249, -30 }, { 65, 250, -30 }, { 65, 251, -30 }, { 65, 252, -30 }, { 65, 253, -74 },
+		{ 65, 255, -74 }, { 66, 65, -25 }, { 66, 85, -10 }, { 66, 192, -25 }, { 66, 193, -25 }, { 66, 194, -25 },
+		{ 66, 195, -25 }, { 66, 196, -25 }, { 66, 197, -25 }, { 66, 217, -10 }, { 66, 218, -10 }, { 66, 219, -10 },
+		{ 66, 220, -10 }, { 68, 65, -25 }, { 68, 86, -50 }, { 68, 87, -40 }, { 68, 89, -50 }, { 68, 159, -50 },
+		{ 68, 192, -25 }, { 68, 193, -25 }, { 68, 194, -25 }, { 68, 195, -25 }, { 68, 196, -25 }, { 68, 197, -25 },
+		{ 68, 221, -50 }, { 70, 44, -129 }, { 70, 46, -129 }, { 70, 65, -100 }, { 70, 97, -95 }, { 70, 101, -100 },
+		{ 70, 105, -40 }, { 70, 111, -70 }, { 70, 114, -50 }, { 70, 192, -100 }, { 70, 193, -100 }, { 70, 194, -100 },
+		{ 70, 195, -100 }, { 70, 196, -100 }, { 70, 197, -100 }, { 70, 224, -95 }, { 70, 225, -95 }, { 70, 226, -95 },
+		{ 70, 227, -95 }, { 70, 228, -95 }, { 70, 229, -95 }, { 70, 232, -100 }, { 70, 233, -100 }, { 70, 234, -100 },
+		{ 70, 235, -100 }, { 70, 236, -40 }, { 70, 237, -40 }, { 70, 238, -40 }, { 70, 239, -40 }, { 70, 242, -70 },
+		{ 70, 243, -70 }, { 70, 244, -70 }, { 70, 245, -70 }, { 70, 246, -70 }, { 70, 248, -70 }, { 74, 44, -10 },
+		{ 74, 46, -10 }, { 74, 65, -25 }, { 74, 97, -40 }, { 74, 101, -40 }, { 74, 111, -40 }, { 74, 117, -40 },
+		{ 74, 192, -25 }, { 74, 193, -25 }, { 74, 194, -25 }, { 74, 195, -25 }, { 74, 196, -25 }, { 74, 197, -25 },
+		{ 74, 224, -40 }, { 74, 225, -40 }, { 74, 226, -40 }, { 74, 227, -40 }, { 74, 228, -40 }, { 74, 229, -40 },
+		{ 74, 232, -40 }, { 74, 233, -40 }, { 74, 234, -40 }, { 74, 235, -40 }, { 74, 242, -40 }, { 74, 243, -40 },
+		{ 74, 244, -40 }, { 74, 245, -40 }, { 74, 246, -40 }, { 74, 248, -40 }, { 74, 249, -40 }, { 74, 250, -40 },
+		{ 74, 251, -40 }, { 74, 252, -40 }, { 75, 79, -30 }, { 75, 101, -25 }, { 75, 111, -25 }, { 75, 117, -20 },
+		{ 75, 121, -20 }, { 75, 210, -30 }, { 75, 211, -30 }, { 75, 212, -30 }, { 75, 213, -30 }, { 75, 214, -30 },
+		{ 75, 216, -30 }, { 75, 232, -25 }, { 75, 233, -25 }, { 75, 234, -25 }, { 75, 235, -25 }, { 75, 242, -25 },
+		{ 75, 243, -25 }, { 75, 244, -25 }, { 75, 245, -25 }, { 75, 246, -25 }, { 75, 248, -25 }, { 75, 249, -20 },
+		{ 75, 250, -20 }, { 75, 251, -20 }, { 75, 252, -20 }, { 75, 253, -20 }, { 75, 255, -20 }, { 76, 84, -18 },
+		{ 76, 86, -37 }, { 76, 87, -37 }, { 76, 89, -37 }, { 76, 121, -37 }, { 76, 146, -55 }, { 76, 159, -37 },
+		{ 76, 221, -37 }, { 76, 253, -37 }, { 76, 255, -37 }, { 78, 65, -30 }, { 78, 192, -30 }, { 78, 193, -30 },
+		{ 78, 194, -30 }, { 78, 195, -30 }, { 78, 196, -30 }, { 78, 197, -30 }, { 79, 65, -40 }, { 79, 84, -40 },
+		{ 79, 86, -50 }, { 79, 87, -50 }, { 79, 88, -40 }, { 79, 89, -50 }, { 79, 159, -50 }, { 79, 192, -40 },
+		{ 79, 193, -40 }, { 79, 194, -40 }, { 79, 195, -40 }, { 79, 196, -40 }, { 79, 197, -40 }, { 79, 221, -50 },
+		{ 80, 44, -129 }, { 80, 46, -129 }, { 80, 65, -85 }, { 80, 97, -40 }, { 80, 101, -50 }, { 80, 111, -55 },
+		{ 80, 192, -85 }, { 80, 193, -85 }, { 80, 194, -85 }, { 80, 195, -85 }, { 80, 196, -85 }, { 80, 197, -85 },
+		{ 80, 224, -40 }, { 80, 225, -40 }, { 80, 226, -40 }, { 80, 227, -40 }, { 80, 228, -40 }, { 80, 229, -40 },
+		{ 80, 232, -50 }, { 80, 233, -50 }, { 80, 234, -50 }, { 80, 235, -50 }, { 80, 242, -55 }, { 80, 243, -55 },
+		{ 80, 244, -55 }, { 80, 245, -55 }, { 80, 246, -55 }, { 80, 248, -55 }, { 81, 85, -10 }, { 81, 217, -10 },
+		{ 81, 218, -10 }, { 81, 219, -10 }, { 81, 220, -10 }, { 82, 79, -40 }, { 82, 84, -30 }, { 82, 85, -40 },
+		{ 82, 86, -18 }, { 82, 87, -18 }, { 82, 89, -18 }, { 82, 159, -18 }, { 82, 210, -40 }, { 82, 211, -40 },
+		{ 82, 212, -40 }, { 82, 213, -40 }, { 82, 214, -40 }, { 82, 216, -40 }, { 82, 217, -40 }, { 82, 218, -40 },
+		{ 82, 219, -40 }, { 82, 220, -40 }, { 82, 221, -18 }, { 84, 44, -92 }, { 84, 45, -92 }, { 84, 46, -92 },
+		{ 84, 58, -74 }, { 84, 59, -74 }, { 84, 65, -55 }, { 84, 79, -18 }, { 84, 97, -92 }, { 84, 101, -92 },
+		{ 84, 105, -37 }, { 84, 111, -95 }, { 84, 114, -37 }, { 84, 117, -37 }, { 84, 119, -37 }, { 84, 121, -37 },
+		{ 84, 173, -92 }, { 84, 192, -55 }, { 84, 193, -55 }, { 84, 194, -55 }, { 84, 195, -55 }, { 84, 196, -55 },
+		{ 84, 197, -55 }, { 84, 210, -18 }, { 84, 211, -18 }, { 84, 212, -18 }, { 84, 213, -18 }, { 84, 214, -18 },
+		{ 84, 216, -18 }, { 84, 224, -92 }, { 84, 225, -92 }, { 84, 226, -92 }, { 84, 227, -92 }, { 84, 228, -92 },
+		{ 84, 229, -92 }, { 84, 232, -52 }, { 84, 233, -92 }, { 84, 234, -92 }, { 84, 235, -52 }, { 84, 237, -37 },
+		{ 84, 242, -95 }, { 84, 243, -95 }, { 84, 244, -95 }, { 84, 245, -95 }, { 84, 246, -95 }, { 84, 248, -95 },
+		{ 84, 249, -37 }, { 84, 250, -37 }, { 84, 251, -37 }, { 84, 252, -37 }, { 84, 253, -37 }, { 84, 255, -37 },
+		{ 85, 65, -45 }, { 85, 192, -45 }, { 85, 193, -45 }, { 85, 194, -45 }, { 85, 195, -45 }, { 85, 196, -45 },
+		{ 85, 197, -45 }, { 86, 44, -129 }, { 86, 45, -70 }, { 86, 46, -129 }, { 86, 58, -74 }, { 86, 59, -74 },
+		{ 86, 65, -85 }, { 86, 71, -10 }, { 86, 79, -30 }, { 86, 97, -111 }, { 86, 101, -111 }, { 86, 105, -55 },
+		{ 86, 111, -111 }, { 86, 117, -55 }, { 86, 173, -70 }, { 86, 192, -85 }, { 86, 193, -85 }, { 86, 194, -85 },
+		{ 86, 195, -85 }, { 86, 196, -85 }, { 86, 197, -85 }, { 86, 210, -30 }, { 86, 211, -30 }, { 86, 212, -30 },
+		{ 86, 213, -30 }, { 86, 214, -30 }, { 86, 216, -30 }, { 86, 224, -111 }, { 86, 225, -111 }, { 86, 226, -111 },
+		{ 86, 227, -111 }, { 86, 228, -111 }, { 86, 229, -111 }, { 86, 232, -71 }, { 86, 233, -111 }, { 86, 234, -111 },
+		{ 86, 235, -71 }, { 86, 237, -55 }, { 86, 242, -111 }, { 86, 243, -111 }, { 86, 244, -111 }, { 86, 245, -111 },
+		{ 86, 246, -111 }, { 86, 248, -111 }, { 86, 249, -55 }, { 86, 250, -55 }, { 86, 251, -55 }, { 86, 252, -55 },
+		{ 87, 44, -74 }, { 87, 45, -50 }, { 87, 46, -74 }, { 87, 58, -55 }, { 87, 59, -55 }, { 87, 65, -74 },
+		{ 87, 79, -15 }, { 87, 97, -85 }, { 87, 101, -90 }, { 87, 105, -37 }, { 87, 111, -80 }, { 87, 117, -55 },
+		{ 87, 121, -55 }, { 87, 173, -50 }, { 87, 192, -74 }, { 87, 193, -74 }, { 87, 194, -74 }, { 87, 195, -74 },
+		{ 87, 196, -74 }, { 87, 197, -74 }, { 87, 210, -15 }, { 87, 211, -15 }, { 87, 212, -15 }, { 87, 213, -15 },
+		{ 87, 214, -15 }, { 87, 216, -15 }, { 87, 224, -85 }, { 87, 225, -85 }, { 87, 226, -85 }, { 87, 227, -85 },
+		{ 87, 228, -85 }, { 87, 229, -85 }, { 87, 232, -50 }, { 87, 233, -90 }, { 87, 234, -90 }, { 87, 235, -50 },
+		{ 87, 237, -37 }, { 87, 242, -80 }, { 87, 243, -80 }, { 87, 244, -80 }, { 87, 245, -80 }, { 87, 246, -80 },
+		{ 87, 248, -80 }, { 87, 249, -55 }, { 87, 250, -55 }, { 87, 251, -55 }, { 87, 252, -55 }, { 87, 253, -55 },
+		{ 87, 255, -55 }, { 89, 44, -92 }, { 89, 45, -92 }, { 89, 46, -74 }, { 89, 58, -92 }, { 89, 59, -92 },
+		{ 89, 65, -74 }, { 89, 79, -25 }, { 89, 97, -92 }, { 89, 101, -111 }, { 89, 105, -55 }, { 89, 111, -111 },
+		{ 89, 117, -92 }, { 89, 173, -92 }, { 89, 192, -74 }, { 89, 193, -74 }, { 89, 194, -74 }, { 89, 195, -74 },
+		{ 89, 196, -74 }, { 89, 197, -74 }, { 89, 210, -25 }, { 89, 211, -25 }, { 89, 212, -25 }, { 89, 213, -25 },
+		{ 89, 214, -25 }, { 89, 216, -25 }, { 89, 224, -92 }, { 89, 225, -92 }, { 89, 226, -92 }, { 89, 227, -92 },
+		{ 89, 228, -92 }, { 89, 229, -92 }, { 89, 232, -71 }, { 89, 233, -111 }, { 89, 234, -71 }, { 89, 235, -71 },
+		{ 89, 237, -55 }, { 89, 242, -111 }, { 89, 243, -111 }, { 89, 244, -111 }, { 89, 245, -111 }, { 89, 246, -111 },
+		{ 89, 248, -111 }, { 89, 249, -92 }, { 89, 250, -92 }, { 89, 251, -92 }, { 89, 252, -92 }, { 98, 46, -40 },
+		{ 98, 98, -10 }, { 98, 117, -20 }, { 98, 249, -20 }, { 98, 250, -20 }, { 98, 251, -20 }, { 98, 252, -20 },
+		{ 99, 104, -10 }, { 99, 107, -10 }, { 101, 98, -10 }, { 102, 44, -10 }, { 102, 46, -10 }, { 102, 101, -10 },
+		{ 102, 102, -18 }, { 102, 111, -10 }, { 102, 146, 55 }, { 102, 233, -10 }, { 102, 242, -10 }, { 102, 243, -10 },
+		{ 102, 244, -10 }, { 102, 245, -10 }, { 102, 248, -10 }, { 107, 101, -30 }, { 107, 111, -10 }, { 107, 232, -30 },
+		{ 107, 233, -30 }, { 107, 234, -30 }, { 107, 235, -30 }, { 107, 242, -10 }, { 107, 243, -10 }, { 107, 244, -10 },
+		{ 107, 245, -10 }, { 107, 246, -10 }, { 107, 248, -10 }, { 110, 118, -40 }, { 111, 118, -15 }, { 111, 119, -25 },
+		{ 111, 120, -10 }, { 111, 121, -10 }, { 111, 253, -10 }, { 111, 255, -10 }, { 114, 44, -65 }, { 114, 46, -65 },
+		{ 118, 44, -37 }, { 118, 46, -37 }, { 118, 101, -15 }, { 118, 111, -15 }, { 118, 232, -15 }, { 118, 233, -15 },
+		{ 118, 234, -15 }, { 118, 235, -15 }, { 118, 242, -15 }, { 118, 243, -15 }, { 118, 244, -15 }, { 118, 245, -15 },
+		{ 118, 246, -15 }, { 118, 248, -15 }, { 119, 44, -37 }, { 119, 46, -37 }, { 119, 97, -10 }, { 119, 101, -10 },
+		{ 119, 111, -15 }, { 119, 224, -10 }, { 119, 225, -10 }, { 119, 226, -10 }, { 119, 227, -10 }, { 119, 228, -10 },
+		{ 119, 229, -10 }, { 119, 232, -10 }, { 119, 233, -10 }, { 119, 234, -10 }, { 119, 235, -10 }, { 119, 242, -15 },
+		{ 119, 243, -15 }, { 119, 244, -15 }, { 119, 245, -15 }, { 119, 246, -15 }, { 119, 248, -15 }, { 120, 101, -10 },
+		{ 120, 232, -10 }, { 120, 233, -10 }, { 120, 234, -10 }, { 120, 235, -10 }, { 121, 44, -37 }, { 121, 46, -37 },
+		{ 145, 145, -74 }, { 146, 32, -74 }, { 146, 100, -15 }, { 146, 114, -15 }, { 146, 115, -74 }, { 146, 116, -37 },
+		{ 146, 118, -15 }, { 146, 146, -74 }, { 146, 154, -74 }, { 146, 160, -74 }, { 159, 44, -92 }, { 159, 45, -92 },
+		{ 159, 46, -74 }, { 159, 58, -92 }, { 159, 59, -92 }, { 159, 65, -74 }, { 159, 79, -25 }, { 159, 97, -92 },
+		{ 159, 101, -111 }, { 159, 105, -55 }, { 159, 111, -111 }, { 159, 117, -92 }, { 159, 173, -92 }, { 159, 192, -74 },
+		{ 159, 193, -74 }, { 159, 194, -74 }, { 159, 195, -74 }, { 159, 196, -74 }, { 159, 197, -74 }, { 159, 210, -25 },
+		{ 159, 211, -25 }, { 159, 212, -25 }, { 159, 213, -25 }, { 159, 214, -25 }, { 159, 216, -25 }, { 159, 224, -92 },
+		{ 159, 225, -92 }, { 159, 226, -92 }, { 159, 227, -92 }, { 159, 228, -92 }, { 159, 229, -92 }, { 159, 232, -71 },
+		{ 159, 233, -111 }, { 159, 234, -71 }, { 159, 235, -71 }, { 159, 237, -55 }, { 159, 242, -111 }, { 159, 243, -111 },
+		{ 159, 244, -111 }, { 159, 245, -111 }, { 159, 246, -111 }, { 159, 248, -111 }, { 159, 249, -92 }, { 159, 250, -92 },
+		{ 159, 251, -92 }, { 159, 252, -92 }, { 160, 65, -37 }, { 160, 86, -70 }, { 160, 87, -70 }, { 160, 89, -70 },
+		{ 160, 159, -70 }, { 160, 192, -37 }, { 160, 193, -37 }, { 160, 194, -37 }, { 160, 195, -37 }, { 160, 196, -37 },
+		{ 160, 197, -37 }, { 160, 221, -70 }, { 192, 67, -65 }, { 192, 71, -60 }, { 192, 79, -50 }, { 192, 81, -55 },
+		{ 192, 84, -55 }, { 192, 85, -50 }, { 192, 86, -95 }, { 192, 87, -100 }, { 192, 89, -70 }, { 192, 117, -30 },
+		{ 192, 118, -74 }, { 192, 119, -74 }, { 192, 121, -74 }, { 192, 146, -74 }, { 192, 159, -70 }, { 192, 199, -65 },
+		{ 192, 210, -50 }, { 192, 211, -50 }, { 192, 212, -50 }, { 192, 213, -50 }, { 192, 214, -50 }, { 192, 216, -50 },
+		{ 192, 217, -50 }, { 192, 218, -50 }, { 192, 219, -50 }, { 192, 220, -50 }, { 192, 221, -70 }, { 192, 249, -30 },
+		{ 192, 250, -30 }, { 192, 251, -30 }, { 192, 252, -30 }, { 192, 253, -74 }, { 192, 255, -74 }, { 193, 67, -65 },
+		{ 193, 71, -60 }, { 193, 79, -50 }, { 193, 81, -55 }, { 193, 84, -55 }, { 193, 85, -50 }, { 193, 86, -95 },
+		{ 193, 87, -100 }, { 193, 89, -70 }, { 193, 117, -30 }, { 193, 118, -74 }, { 193, 119, -74 }, { 193, 121, -74 },
+		{ 193, 146, -74 }, { 193, 159, -70 }, { 193, 199, -65 }, { 193, 210, -50 }, { 193, 211, -50 }, { 193, 212, -50 },
+		{ 193, 213, -50 }, { 193, 214, -50 }, { 193, 216, -50 }, { 193, 217, -50 }, { 193, 218, -50 }, { 193, 219, -50 },
+		{ 193, 220, -50 }, { 193, 221, -70 }, { 193, 249, -30 }, { 193, 250, -30 }, { 193, 251, -30 }, { 193, 252, -30 },
+		{ 193, 253, -74 }, { 193, 255, -74 }, { 194, 67, -65 }, { 194, 71, -60 }, { 194, 79, -50 }, { 194, 81, -55 },
+		{ 194, 84, -55 }, { 194, 85, -50 }, { 194, 86, -95 }, { 194, 87, -100 }, { 194, 89, -70 }, { 194, 117, -30 },
+		{ 194, 118, -74 }, { 194, 119, -74 }, { 194, 121, -74 }, { 194, 146, -74 }, { 194, 159, -70 }, { 194, 199, -65 },
+		{ 194, 210, -50 }, { 194, 211, -50 }, { 194, 212, -50 }, { 194, 213, -50 }, { 194, 214, -50 }, { 194, 216, -50 },
+		{ 194, 217, -50 }, { 194, 218, -50 }, { 194, 219, -50 }, { 194, 220, -50 }, { 194, 221, -70 }, { 194, 249, -30 },
+		{ 194, 250, -30 }, { 194, 251, -30 }, { 194, 252, -30 }, { 194, 253, -74 }, { 194, 255, -74 }, { 195, 67, -65 },
+		{ 195, 71, -60 }, { 195, 79, -50 }, { 195, 81, -55 }, { 195, 84, -55 }, { 195, 85, -50 }, { 195, 86, -95 },
+		{ 195, 87, -100 }, { 195, 89, -70 }, { 195, 117, -30 }, { 195, 118, -74 }, { 195, 119, -74 }, { 195, 121, -74 },
+		{ 195, 146, -74 }, { 195, 159, -70 }, { 195, 199, -65 }, { 195, 210, -50 }, { 195, 211, -50 }, { 195, 212, -50 },
+		{ 195, 213, -50 }, { 195, 214, -50 }, { 195, 216, -50 }, { 195, 217, -50 }, { 195, 218, -50 }, { 195, 219, -50 },
+		{ 195, 220, -50 }, { 195, 221, -70 }, { 195, 249, -30 }, { 195, 250, -30 }, { 195, 251, -30 }, { 195, 252, -30 },
+		{ 195, 253, -74 }, { 195, 255, -74 }, { 196, 67, -65 }, { 196, 71, -60 }, { 196, 79, -50 }, { 196, 81, -55 },
+		{ 196, 84, -55 }, { 196, 85, -50 }, { 196, 86, -95 }, { 196, 87, -100 }, { 196, 89, -70 }, { 196, 117, -30 },
+		{ 196, 118, -74 }, { 196, 119, -74 }, { 196, 121, -74 }, { 196, 146, -74 }, { 196, 159, -70 }, { 196, 199, -65 },
+		{ 196, 210, -50 }, { 196, 211, -50 }, { 196, 212, -50 }, { 196, 213, -50 }, { 196, 214, -50 }, { 196, 216, -50 },
+		{ 196, 217, -50 }, { 196, 218, -50 }, { 196, 219, -50 }, { 196, 220, -50 }, { 196, 221, -70 }, { 196, 249, -30 },
+		{ 196, 250, -30 }, { 196, 251, -30 }, { 196, 252, -30 }, { 196, 253, -74 }, { 196, 255, -74 }, { 197, 67, -65 },
+		{ 197, 71, -60 }, { 197, 79, -50 }, { 197, 81, -55 }, { 197, 84, -55 }, { 197, 85, -50 }, { 197, 86, -95 },
+		{ 197, 87, -100 }, { 197, 89, -70 }, { 197, 117, -30 }, { 197, 118, -74 }, { 197, 119, -74 }, { 197, 121, -74 },
+		{ 197, 146, -74 }, { 197, 159, -70 }, { 197, 199, -65 }, { 197, 210, -50 }, { 197, 211, -50 }, { 197, 212, -50 },
+		{ 197, 213, -50 }, { 197, 214, -50 }, { 197, 216, -50 }, { 197, 217, -50 }, { 197, 218, -50 }, { 197, 219, -50 },
+		{ 197, 220, -50 }, { 197, 221, -70 }, { 197, 249, -30 }, { 197, 250, -30 }, { 197, 251, -30 }, { 197, 252, -30 },
+		{ 197, 253, -74 }, { 197, 255, -74 }, { 209, 65, -30 }, { 209, 192, -30 }, { 209, 193, -30 }, { 209, 194, -30 },
+		{ 209, 195, -30 }, { 209, 196, -30 }, { 209, 197, -30 }, { 210, 65, -40 }, { 210, 84, -40 }, { 210, 86, -50 },
+		{ 210, 87, -50 }, { 210, 88, -40 }, { 210, 89, -50 }, { 210, 159, -50 }, { 210, 192, -40 }, { 210, 193, -40 },
+		{ 210, 194, -40 }, { 210, 195, -40 }, { 210, 196, -40 }, { 210, 197, -40 }, { 210, 221, -50 }, { 211, 65, -40 },
+		{ 211, 84, -40 }, { 211, 86, -50 }, { 211, 87, -50 }, { 211, 88, -40 }, { 211, 89, -50 }, { 211, 159, -50 },
+		{ 211, 192, -40 }, { 211, 193, -40 }, { 211, 194, -40 }, { 211, 195, -40 }, { 211, 196, -40 }, { 211, 197, -40 },
+		{ 211, 221, -50 }, { 212, 65, -40 }, { 212, 84, -40 }, { 212, 86, -50 }, { 212, 87, -50 }, { 212, 88, -40 },
+		{ 212, 89, -50 }, { 212, 159, -50 }, { 212, 192, -40 }, { 212, 193, -40 }, { 212, 194, -40 }, { 212, 195, -40 },
+		{ 212, 196, -40 }, { 212, 197, -40 }, { 212, 221, -50 }, { 213, 65, -40 }, { 213, 84, -40 }, { 213, 86, -50 },
+		{ 213, 87, -50 }, { 213, 88, -40 }, { 213, 89, -50 }, { 213, 159, -50 }, { 213, 192, -40 }, { 213, 193, -40 },
+		{ 213, 194, -40 }, { 213, 195, -40 }, { 213, 196, -40 }, { 213, 197, -40 }, { 213, 221, -50 }, { 214, 65, -40 },
+		{ 214, 84, -40 }, { 214, 86, -50 }, { 214, 87, -50 }, { 214, 88, -40 }, { 214, 89, -50 }, { 214, 159, -50 },
+		{ 214, 192, -40 }, { 214, 193, -40 }, { 214, 194, -40 }, { 214, 195, -40 }, { 214, 196, -40 }, { 214, 197, -40 },
+		{ 214, 221, -50 }, { 216, 65, -40 }, { 216, 84, -40 }, { 216, 86, -50 }, { 216, 87, -50 }, { 216, 88, -40 },
+		{ 216, 89, -50 }, { 216, 159, -50 }, { 216, 192, -40 }, { 216, 193, -40 }, { 216, 194, -40 }, { 216, 195, -40 },
+		{ 216, 196, -40 }, { 216, 197, -40 }, { 216, 221, -50 }, { 217, 65, -45 }, { 217, 192, -45 }, { 217, 193, -45 },
+		{ 217, 194, -45 }, { 217, 195, -45 }, { 217, 196, -45 }, { 217, 197, -45 }, { 218, 65, -45 }, { 218, 192, -45 },
+		{ 218, 193, -45 }, { 218, 194, -45 }, { 218, 195, -45 }, { 218, 196, -45 }, { 218, 197, -45 }, { 219, 65, -45 },
+		{ 219, 192, -45 }, { 219, 193, -45 }, { 219, 194, -45 }, { 219, 195, -45 }, { 219, 196, -45 }, { 219, 197, -45 },
+		{ 220, 65, -45 }, { 220, 192, -45 }, { 220, 193, -45 }, { 220, 194, -45 }, { 220, 195, -45 }, { 220, 196, -45 },
+		{ 220, 197, -45 }, { 221, 44, -92 }, { 221, 45, -92 }, { 221, 46, -74 }, { 221, 58, -92 }, { 221, 59, -92 },
+		{ 221, 65, -74 }, { 221, 79, -25 }, { 221, 97, -92 }, { 221, 101, -111 }, { 221, 105, -55 }, { 221, 111, -111 },
+		{ 221, 117, -92 }, { 221, 173, -92 }, { 221, 192, -74 }, { 221, 193, -74 }, { 221, 194, -74 }, { 221, 195, -74 },
+		{ 221, 196, -74 }, { 221, 197, -74 }, { 221, 210, -25 }, { 221, 211, -25 }, { 221, 212, -25 }, { 221, 213, -25 },
+		{ 221, 214, -25 }, { 221, 216, -25 }, { 221, 224, -92 }, { 221, 225, -92 }, { 221, 226, -92 }, { 221, 227, -92 },
+		{ 221, 228, -92 }, { 221, 229, -92 }, { 221, 232, -71 }, { 221, 233, -111 }, { 221, 234, -71 }, { 221, 235, -71 },
+		{ 221, 237, -55 }, { 221, 242, -111 }, { 221, 243, -111 }, { 221, 244, -111 }, { 221, 245, -111 }, { 221, 246, -111 },
+		{ 221, 248, -111 }, { 221, 249, -92 }, { 221, 250, -92 }, { 221, 251, -92 }, { 221, 252, -92 }, { 231, 104, -10 },
+		{ 231, 107, -10 }, { 232, 98, -10 }, { 233, 98, -10 }, { 234, 98, -10 }, { 235, 98, -10 }, { 241, 118, -40 },
+		{ 242, 118, -15 }, { 242, 119, -25 }, { 242, 120, -10 }, { 242, 121, -10 }, { 242, 253, -10 }, { 242, 255, -10 },
+		{ 243, 118, -15 }, { 243, 119, -25 }, { 243, 120, -10 }, { 243, 121, -10 }, { 243, 253, -10 }, { 243, 255, -10 },
+		{ 244, 118, -15 }, { 244, 119, -25 }, { 244, 120, -10 }, { 244, 121, -10 }, { 244, 253, -10 }, { 244, 255, -10 },
+		{ 245, 118, -15 }, { 245, 119, -25 }, { 245, 120, -10 }, { 245, 121, -10 }, { 245, 253, -10 }, { 245, 255, -10 },
+		{ 246, 118, -15 }, { 246, 119, -25 }, { 246, 120, -10 }, { 246, 121, -10 }, { 246, 253, -10 }, { 246, 255, -10 },
+		{ 248, 118, -15 }, { 248, 119, -25 }, { 248, 120, -10 }, { 248, 121, -10 }, { 248, 253, -10 }, { 248, 255, -10 },
+		{ 253, 44, -37 }, { 253, 46, -37 }, { 255, 44, -37 }, { 255, 46, -37 },
+	};
+
+	static constexpr GlyphMetrics HELVETICA_GLYPHS[256] = {
+		/* 00 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 03 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 06 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 09 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0f */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 12 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 15 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 18 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1b */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 278, 0, 0, 0, 0 },
+		/* 21 */ { 278, 90, 0, 187, 718 }, { 355, 70, 463, 285, 718 }, { 556, 28, 0, 529, 688 },
+		/* 24 */ { 556, 32, -115, 520, 775 }, { 889, 39, -19, 850, 703 }, { 667, 44, -15, 645, 718 },
+		/* 27 */ { 191, 59, 463, 132, 718 }, { 333, 68, -207, 299, 733 }, { 333, 34, -207, 265, 733 },
+		/* 2a */ { 389, 39, 431, 349, 718 }, { 584, 39, 0, 545, 505 }, { 278, 87, -147, 191, 106 },
+		/* 2d */ { 333, 44, 232, 289, 322 }, { 278, 87, 0, 191, 106 }, { 278, -17, -19, 295, 737 },
+		/* 30 */ { 556, 37, -19, 519, 703 }, { 556, 101, 0, 359, 703 }, { 556, 26, 0, 507, 703 },
+		/* 33 */ { 556, 34, -19, 522, 703 }, { 556, 25, 0, 523, 703 }, { 556, 32, -19, 514, 688 },
+		/* 36 */ { 556, 38, -19, 518, 703 }, { 556, 37, 0, 523, 688 }, { 556, 38, -19, 517, 703 },
+		/* 39 */ { 556, 42, -19, 514, 703 }, { 278, 87, 0, 191, 516 }, { 278, 87, -147, 191, 516 },
+		/* 3c */ { 584, 48, 11, 536, 495 }, { 584, 39, 115, 545, 390 }, { 584, 48, 11, 536, 495 },
+		/* 3f */ { 556, 56, 0, 492, 727 }, { 1015, 147, -19, 868, 737 }, { 667, 14, 0, 654, 718 },
+		/* 42 */ { 667, 74, 0, 627, 718 }, { 722, 44, -19, 681, 737 }, { 722, 81, 0, 674, 718 },
+		/* 45 */ { 667, 86, 0, 616, 718 }, { 611, 86, 0, 583, 718 }, { 778, 48, -19, 704, 737 },
+		/* 48 */ { 722, 77, 0, 646, 718 }, { 278, 91, 0, 188, 718 }, { 500, 17, -19, 428, 718 },
+		/* 4b */ { 667, 76, 0, 663, 718 }, { 556, 76, 0, 537, 718 }, { 833, 73, 0, 761, 718 },
+		/* 4e */ { 722, 76, 0, 646, 718 }, { 778, 39, -19, 739, 737 }, { 667, 86, 0, 622, 718 },
+		/* 51 */ { 778, 39, -56, 739, 737 }, { 722, 88, 0, 684, 718 }, { 667, 49, -19, 620, 737 },
+		/* 54 */ { 611, 14, 0, 597, 718 }, { 722, 79, -19, 644, 718 }, { 667, 20, 0, 647, 718 },
+		/* 57 */ { 944, 16, 0, 928, 718 }, { 667, 19, 0, 648, 718 }, { 667, 14, 0, 653, 718 },
+		/* 5a */ { 611, 23, 0, 588, 718 }, { 278, 63, -196, 250, 722 }, { 278, -17, -19, 295, 737 },
+		/* 5d */ { 278, 28, -196, 215, 722 }, { 469, -14, 264, 483, 688 }, { 556, 0, -125, 556, -75 },
+		/* 60 */ { 333, 14, 593, 211, 734 }, { 556, 36, -15, 530, 538 }, { 556, 58, -15, 517, 718 },
+		/* 63 */ { 500, 30, -15, 477, 538 }, { 556, 35, -15, 499, 718 }, { 556, 40, -15, 516, 538 },
+		/* 66 */ { 278, 14, 0, 262, 728 }, { 556, 40, -220, 499, 538 }, { 556, 65, 0, 491, 718 },
+		/* 69 */ { 222, 67, 0, 155, 718 }, { 222, -16, -210, 155, 718 }, { 500, 67, 0, 501, 718 },
+		/* 6c */ { 222, 67, 0, 155, 718 }, { 833, 65, 0, 769, 538 }, { 556, 65, 0, 491, 538 },
+		/* 6f */ { 556, 35, -14, 521, 538 }, { 556, 58, -207, 517, 538 }, { 556, 35, -207, 494, 538 },
+		/* 72 */ { 333, 77, 0, 332, 538 }, { 500, 32, -15, 464, 538 }, { 278, 14, -7, 257, 669 },
+		/* 75 */ { 556, 68, -15, 489, 523 }, { 500, 8, 0, 492, 523 }, { 722, 14, 0, 709, 523 },
+		/* 78 */ { 500, 11, 0, 490, 523 }, { 500, 11, -214, 489, 523 }, { 500, 31, 0, 469, 523 },
+		/* 7b */ { 334, 42, -196, 292, 722 }, { 260, 94, -225, 167, 775 }, { 334, 42, -196, 292, 722 },
+		/* 7e */ { 584, 61, 180, 523, 326 }, { 0, 0, 0, 0, 0 }, { 556, 0, 0, 0, 0 },
+		/* 81 */ { 0, 0, 0, 0, 0 }, { 222, 53, -149, 157, 106 }, { 556, -11, -207, 501, 737 },
+		/* 84 */ { 333, 26, -149, 295, 106 }, { 1000, 115, 0, 885, 106 }, { 556, 43, -159, 514, 718 },
+		/* 87 */ { 556, 43, -159, 514, 718 }, { 333, 21, 593, 312, 734 }, { 1000, 7, -19, 994, 703 },
+		/* 8a */ { 667, 49, -19, 620, 929 }, { 333, 88, 108, 245, 446 }, { 1000, 36, -19, 965, 737 },
+		/* 8d */ { 0, 0, 0, 0, 0 }, { 611, 23, 0, 588, 929 }, { 0, 0, 0, 0, 0 },
+		/* 90 */ { 0, 0, 0, 0, 0 }, { 222, 65, 470, 169, 725 }, { 222, 53, 463, 157, 718 },
+		/* 93 */ { 333, 38, 470, 307, 725 }, { 333, 26, 463, 295, 718 }, { 350, 18, 202, 333, 517 },
+		/* 96 */ { 556, 0, 240, 556, 313 }, { 1000, 0, 240, 1000, 313 }, { 333, -4, 606, 337, 722 },
+		/* 99 */ { 1000, 46, 306, 903, 718 }, { 500, 32, -15, 464, 734 }, { 333, 88, 108, 245, 446 },
+		/* 9c */ { 944, 35, -15, 902, 538 }, { 0, 0, 0, 0, 0 }, { 500, 31, 0, 469, 734 },
+		/* 9f */ { 667, 14, 0, 653, 901 }, { 278, 0, 0, 0, 0 }, { 333, 118, -195, 215, 523 },
+		/* a2 */ { 556, 51, -115, 513, 623 }, { 556, 33, -16, 539, 718 }, { 556, 28, 99, 528, 603 },
+		/* a5 */ { 556, 3, 0, 553, 688 }, { 260, 94, -150, 167, 700 }, { 556, 43, -191, 512, 737 },
+		/* a8 */ { 333, 40, 604, 293, 706 }, { 737, -14, -19, 752, 737 }, { 370, 24, 405, 346, 737 },
+		/* ab */ { 556, 97, 108, 459, 446 }, { 584, 39, 108, 545, 390 }, { 333, 44, 232, 289, 322 },
+		/* ae */ { 737, -14, -19, 752, 737 }, { 333, 10, 627, 323, 684 }, { 400, 54, 411, 346, 703 },
+		/* b1 */ { 584, 39, 0, 545, 506 }, { 333, 4, 281, 323, 703 }, { 333, 5, 270, 325, 703 },
+		/* b4 */ { 333, 122, 593, 319, 734 }, { 556, 68, -207, 489, 523 }, { 537, 18, -173, 497, 718 },
+		/* b7 */ { 278, 77, 190, 202, 315 }, { 333, 45, -225, 259, 0 }, { 333, 43, 281, 222, 703 },
+		/* ba */ { 365, 25, 405, 341, 737 }, { 556, 97, 108, 459, 446 }, { 834, 73, -19, 756, 703 },
+		/* bd */ { 834, 43, -19, 773, 703 }, { 834, 45, -19, 810, 703 }, { 611, 91, -201, 527, 525 },
+		/* c0 */ { 667, 14, 0, 654, 929 }, { 667, 14, 0, 654, 929 }, { 667, 14, 0, 654, 929 },
+		/* c3 */ { 667, 14, 0, 654, 917 }, { 667, 14, 0, 654, 901 }, { 667, 14, 0, 654, 931 },
+		/* c6 */ { 1000, 8, 0, 951, 718 }, { 722, 44, -225, 681, 737 }, { 667, 86, 0, 616, 929 },
+		/* c9 */ { 667, 86, 0, 616, 929 }, { 667, 86, 0, 616, 929 }, { 667, 86, 0, 616, 901 },
+		/* cc */ { 278, -13, 0, 188, 929 }, { 278, 91, 0, 292, 929 }, { 278, -6, 0, 285, 929 },
+		/* cf */ { 278, 13, 0, 266, 901 }, { 722, 0, 0, 674, 718 }, { 722, 76, 0, 646, 917 },
+		/* d2 */ { 778, 39, -19, 739, 929 }, { 778, 39, -19, 739, 929 }, { 778, 39, -19, 739, 929 },
+		/* d5 */ { 778, 39, -19, 739, 917 }, { 778, 39, -19, 739, 901 }, { 584, 39, 0, 545, 506 },
+		/* d8 */ { 778, 39, -19, 740, 737 }, { 722, 79, -19, 644, 929 }, { 722, 79, -19, 644, 929 },
+		/* db */ { 722, 79, -19, 644, 929 }, { 722, 79, -19, 644, 901 }, { 667, 14, 0, 653, 929 },
+		/* de */ { 667, 86, 0, 622, 718 }, { 611, 67, -15, 571, 728 }, { 556, 36, -15, 530, 734 },
+		/* e1 */ { 556, 36, -15, 530, 734 }, { 556, 36, -15, 530, 734 }, { 556, 36, -15, 530, 722 },
+		/* e4 */ { 556, 36, -15, 530, 706 }, { 556, 36, -15, 530, 756 }, { 889, 36, -15, 847, 538 },
+		/* e7 */ { 500, 30, -225, 477, 538 }, { 556, 40, -15, 516, 734 }, { 556, 40, -15, 516, 734 },
+		/* ea */ { 556, 40, -15, 516, 734 }, { 556, 40, -15, 516, 706 }, { 278, -13, 0, 184, 734 },
+		/* ed */ { 278, 95, 0, 292, 734 }, { 278, -6, 0, 285, 734 }, { 278, 13, 0, 266, 706 },
+		/* f0 */ { 556, 35, -15, 522, 737 }, { 556, 65, 0, 491, 722 }, { 556, 35, -14, 521, 734 },
+		/* f3 */ { 556, 35, -14, 521, 734 }, { 556, 35, -14, 521, 734 }, { 556, 35, -14, 521, 722 },
+		/* f6 */ { 556, 35, -14, 521, 706 }, { 584, 39, -19, 545, 524 }, { 611, 28, -22, 537, 545 },
+		/* f9 */ { 556, 68, -15, 489, 734 }, { 556, 68, -15, 489, 734 }, { 556, 68, -15, 489, 734 },
+		/* fc */ { 556, 68, -15, 489, 706 }, { 500, 11, -214, 489, 734 }, { 556, 58, -207, 517, 718 },
+		/* ff */ { 500, 11, -214, 489, 706 },
+	};
+
+	static constexpr KerningPair HELVETICA_KERNING[] = {
+		{ 32, 84, -50 }, { 32, 86, -50 }, { 32, 87, -40 }, { 32, 89, -90 }, { 32, 145, -60 }, { 32, 147, -30 },
+		{ 32, 159, -90 }, { 32, 221, -90 }, { 44, 146, -100 }, { 44, 148, -100 }, { 46, 32, -60 }, { 46, 146, -100 },
+		{ 46, 148, -100 }, { 46, 160, -60 }, { 58, 32, -50 }, { 58, 160, -50 }, { 59, 32, -50 }, { 59, 160, -50 },
+		{ 65, 67, -30 }, { 65, 71, -30 }, { 65, 79, -30 }, { 65, 81, -30 }, { 65, 84, -120 }, { 65, 85, -50 },
+		{ 65, 86, -70 }, { 65, 87, -50 }, { 65, 89, -100 }, { 65, 117, -30 }, { 65, 118, -40 }, { 65, 119, -40 },
+		{ 65, 121, -40 }, { 65, 159, -100 }, { 65, 199, -30 }, { 65, 210, -30 }, { 65, 211, -30 }, { 65, 212, -30 },
+		{ 65, 213, -30 }, { 65, 214, -30 }, { 65, 216, -30 }, { 65, 217, -50 }, { 65, 218, -50 }, { 65, 219, -50 },
+		{ 65, 220, -50 }, { 65, 221, -100 }, { 65, 249, -30 }, { 65, 250, -30 }, { 65, 251, -30 }, { 65, 252, -30 },
+		{ 65, 253, -40 }, { 65, 255, -40 }, { 66, 44, -20 }, { 66, 46, -20 }, { 66, 85, -10 }, { 66, 217, -10 },
+		{ 66, 218, -10 }, { 66, 219, -10 }, { 66, 220, -10 }, { 67, 44, -30 }, { 67, 46, -30 }, { 68, 44, -70 },
+		{ 68, 46, -70 }, { 68, 65, -40 }, { 68, 86, -70 }, { 68, 87, -40 }, { 68, 89, -90 }, { 68, 159, -90 },
+		{ 68, 192, -40 }, { 68, 193, -40 }, { 68, 194, -40 }, { 68, 195, -40 }, { 68, 196, -40 }, { 68, 197, -40 },
+		{ 68, 221, -90 }, { 70, 44, -150 }, { 70, 46, -150 }, { 70, 65, -80 }, { 70, 97, -50 }, { 70, 101, -30 },
+		{ 70, 111, -30 }, { 70, 114, -45 }, { 70, 192, -80 }, { 70, 193, -80 }, { 70, 194, -80 }, { 70, 195, -80 },
+		{ 70, 196, -80 }, { 70, 197, -80 }, { 70, 224, -50 }, { 70, 225, -50 }, { 70, 226, -50 }, { 70, 227, -50 },
+		{ 70, 228, -50 }, { 70, 229, -50 }, { 70, 232, -30 }, { 70, 233, -30 }, { 70, 234, -30 }, { 70, 235, -30 },
+		{ 70, 242, -30 }, { 70, 243, -30 }, { 70, 244, -30 }, { 70, 245, -30 }, { 70, 246, -30 }, { 70, 248, -30 },
+		{ 74, 44, -30 }, { 74, 46, -30 }, { 74, 65, -20 }, { 74, 97, -20 }, { 74, 117, -20 }, { 74, 192, -20 },
+		{ 74, 193, -20 }, { 74, 194, -20 }, { 74, 195, -20 }, { 74, 196, -20 }, { 74, 197, -20 }, { 74, 224, -20 },
+		{ 74, 225, -20 }, { 74, 226, -20 }, { 74, 227, -20 }, { 74, 228, -20 }, { 74, 229, -20 }, { 74, 249, -20 },
+		{ 74, 250, -20 }, { 74, 251, -20 }, { 74, 252, -20 }, { 75, 79, -50 }, { 75, 101, -40 }, { 75, 111, -40 },
+		{ 75, 117, -30 }, { 75, 121, -50 }, { 75, 210, -50 }, { 75, 211, -50 }, { 75, 212, -50 }, { 75, 213, -50 },
+		{ 75, 214, -50 }, { 75, 216, -50 }, { 75, 232, -40 }, { 75, 233, -40 }, { 75, 234, -40 }, { 75, 235, -40 },
+		{ 75, 242, -40 }, { 75, 243, -40 }, { 75, 244, -40 }, { 75, 245, -40 }, { 75, 246, -40 }, { 75, 248, -40 },
+		{ 75, 249, -30 }, { 75, 250, -30 }, { 75, 251, -30 }, { 75, 252, -30 }, { 75, 253, -50 }, { 75, 255, -50 },
+		{ 76, 84, -110 }, { 76, 86, -110 }, { 76, 87, -70 }, { 76, 89, -140 }, { 76, 121, -30 }, { 76, 146, -160 },
+		{ 76, 148, -140 }, { 76, 159, -140 }, { 76, 221, -140 }, { 76, 253, -30 }, { 76, 255, -30 }, { 79, 44, -40 },
+		{ 79, 46, -40 }, { 79, 65, -20 }, { 79, 84, -40 }, { 79, 86, -50 }, { 79, 87, -30 }, { 79, 88, -60 },
+		{ 79, 89, -70 }, { 79, 159, -70 }, { 79, 192, -20 }, { 79, 193, -20 }, { 79, 194, -20 }, { 79, 195, -20 },
+		{ 79, 196, -20 }, { 79, 197, -20 }, { 79, 221, -70 }, { 80, 44, -180 }, { 80, 46, -180 }, { 80, 65, -120 },
+		{ 80, 97, -40 }, { 80, 101, -50 }, { 80, 111, -50 }, { 80, 192, -120 }, { 80, 193, -120 }, { 80, 194, -120 },
+		{ 80, 195, -120 }, { 80, 196, -120 }, { 80, 197, -120 }, { 80, 224, -40 }, { 80, 225, -40 }, { 80, 226, -40 },
+		{ 80, 227, -40 }, { 80, 228, -40 }, { 80, 229, -40 }, { 80, 232, -50 }, { 80, 233, -50 }, { 80, 234, -50 },
+		{ 80, 235, -50 }, { 80, 242, -50 }, { 80, 243, -50 }, { 80, 244, -50 }, { 80, 245, -50 }, { 80, 246, -50 },
+		{ 80, 248, -50 }, { 81, 85, -10 }, { 81, 217, -10 }, { 81, 218, -10 }, { 81, 219, -10 }, { 81, 220, -10 },
+		{ 82, 79, -20 }, { 82, 84, -30 }, { 82, 85, -40 }, { 82, 86, -50 }, { 82, 87, -30 }, { 82, 89, -50 },
+		{ 82, 159, -50 }, { 82, 210, -20 }, { 82, 211, -20 }, { 82, 212, -20 }, { 82, 213, -20 }, { 82, 214, -20 },
+		{ 82, 216, -20 }, { 82, 217, -40 }, { 82, 218, -40 }, { 82, 219, -40 }, { 82, 220, -40 }, { 82, 221, -50 },
+		{ 83, 44, -20 }, { 83, 46, -20 }, { 84, 44, -120 }, { 84, 45, -140 }, { 84, 46, -120 }, { 84, 58, -20 },
+		{ 84, 59, -20 }, { 84, 65, -120 }, { 84, 79, -40 }, { 84, 97, -120 }, { 84, 101, -120 }, { 84, 111, -120 },
+		{ 84, 114, -120 }, { 84, 117, -120 }, { 84, 119, -120 }, { 84, 121, -120 }, { 84, 173, -140 }, { 84, 192, -120 },
+		{ 84, 193, -120 }, { 84, 194, -120 }, { 84, 195, -120 }, { 84, 196, -120 }, { 84, 197, -120 }, { 84, 210, -40 },
+		{ 84, 211, -40 }, { 84, 212, -40 }, { 84, 213, -40 }, { 84, 214, -40 }, { 84, 216, -40 }, { 84, 224, -120 },
+		{ 84, 225, -120 }, { 84, 226, -120 }, { 84, 227, -60 }, { 84, 228, -120 }, { 84, 229, -120 }, { 84, 232, -60 },
+		{ 84, 233, -120 }, { 84, 234, -120 }, { 84, 235, -120 }, { 84, 242, -120 }, { 84, 243, -120 }, { 84, 244, -120 },
+		{ 84, 245, -60 }, { 84, 246, -120 }, { 84, 248, -120 }, { 84, 249, -120 }, { 84, 250, -120 }, { 84, 251, -120 },
+		{ 84, 252, -120 }, { 84, 253, -120 }, { 84, 255, -60 }, { 85, 44, -40 }, { 85, 46, -40 }, { 85, 65, -40 },
+		{ 85, 192, -40 }, { 85, 193, -40 }, { 85, 194, -40 }, { 85, 195, -40 }, { 85, 196, -40 }, { 85, 197, -40 },
+		{ 86, 44, -125 }, { 86, 45, -80 }, { 86, 46, -125 }, { 86, 58, -40 }, { 86, 59, -40 }, { 86, 65, -80 },
+		{ 86, 71, -40 }, { 86, 79, -40 }, { 86, 97, -70 }, { 86, 101, -80 }, { 86, 111, -80 }, { 86, 117, -70 },
+		{ 86, 173, -80 }, { 86, 192, -80 }, { 86, 193, -80 }, { 86, 194, -80 }, { 86, 195, -80 }, { 86, 196, -80 },
+		{ 86, 197, -80 }, { 86, 210, -40 }, { 86, 211, -40 }, { 86, 212, -40 }, { 86, 213, -40 }, { 86, 214, -40 },
+		{ 86, 216, -40 }, { 86, 224, -70 }, { 86, 225, -70 }, { 86, 226, -70 }, { 86, 227, -70 }, { 86, 228, -70 },
+		{ 86, 229, -70 }, { 86, 232, -80 }, { 86, 233, -80 }, { 86, 234, -80 }, { 86, 235, -80 }, { 86, 242, -80 },
+		{ 86, 243, -80 }, { 86, 244, -80 }, { 86, 245, -80 }, { 86, 246, -80 }, { 86, 248, -80 }, { 86, 249, -70 },
+		{ 86, 250, -70 }, { 86, 251, -70 }, { 86, 252, -70 }, { 87, 44, -80 }, { 87, 45, -40 }, { 87, 46, -80 },
+		{ 87, 65, -50 }, { 87, 79, -20 }, { 87, 97, -40 }, { 87, 101, -30 }, { 87, 111, -30 }, { 87, 117, -30 },
+		{ 87, 121, -20 }, { 87, 173, -40 }, { 87, 192, -50 }, { 87, 193, -50 }, { 87, 194, -50 }, { 87, 195, -50 },
+		{ 87, 196, -50 }, { 87, 197, -50 }, { 87, 210, -20 }, { 87, 211, -20 }, { 87, 212, -20 }, { 87, 213, -20 },
+		{ 87, 214, -20 }, { 87, 216, -20 }, { 87, 224, -40 }, { 87, 225, -40 }, { 87, 226, -40 }, { 87, 227, -40 },
+		{ 87, 228, -40 }, { 87, 229, -40 }, { 87, 232, -30 }, { 87, 233, -30 }, { 87, 234, -30 }, { 87, 235, -30 },
+		{ 87, 242, -30 }, { 87, 243, -30 }, { 87, 244, -30 }, { 87, 245, -30 }, { 87, 246, -30 }, { 87, 248, -30 },
+		{ 87, 249, -30 }, { 87, 250, -30 }, { 87, 251, -30 }, { 87, 252, -30 }, { 87, 253, -20 }, { 87, 255, -20 },
+		{ 89, 44, -140 }, { 89, 45, -140 }, { 89, 46, -140 }, { 89, 58, -60 }, { 89, 59, -60 }, { 89, 65, -110 },
+		{ 89, 79, -85 }, { 89, 97, -140 }, { 89, 101, -140 }, { 89, 105, -20 }, { 89, 111, -140 }, { 89, 117, -110 },
+		{ 89, 173, -140 }, { 89, 192, -110 }, { 89, 193, -110 }, { 89, 194, -110 }, { 89, 195, -110 }, { 89, 196, -110 },
+		{ 89, 197, -110 }, { 89, 210, -85 }, { 89, 211, -85 }, { 89, 212, -85 }, { 89, 213, -85 }, { 89, 214, -85 },
+		{ 89, 216, -85 }, { 89, 224, -140 }, { 89, 225, -140 }, { 89, 226, -140 }, { 89, 227, -140 }, { 89, 228, -140 },
+		{ 89, 229, -140 }, { 89, 232, -140 }, { 89, 233, -140 }, { 89, 234, -140 }, { 89, 235, -140 }, { 89, 237, -20 },
+		{ 89, 242, -140 }, { 89, 243, -140 }, { 89, 244, -140 }, { 89, 245, -140 }, { 89, 246, -140 }, { 89, 248, -140 },
+		{ 89, 249, -110 }, { 89, 250, -110 }, { 89, 251, -110 }, { 89, 252, -110 }, { 97, 118, -20 }, { 97, 119, -20 },
+		{ 97, 121, -30 }, { 97, 253, -30 }, { 97, 255, -30 }, { 98, 44, -40 }, { 98, 46, -40 }, { 98, 98, -10 },
+		{ 98, 108, -20 }, { 98, 117, -20 }, { 98, 118, -20 }, { 98, 121, -20 }, { 98, 249, -20 }, { 98, 250, -20 },
+		{ 98, 251, -20 }, { 98, 252, -20 }, { 98, 253, -20 }, { 98, 255, -20 }, { 99, 44, -15 }, { 99, 107, -20 },
+		{ 101, 44, -15 }, { 101, 46, -15 }, { 101, 118, -30 }, { 101, 119, -20 }, { 101, 120, -30 }, { 101, 121, -20 },
+		{ 101, 253, -20 }, { 101, 255, -20 }, { 102, 44, -30 }, { 102, 46, -30 }, { 102, 97, -30 }, { 102, 101, -30 },
+		{ 102, 111, -30 }, { 102, 146, 50 }, { 102, 148, 60 }, { 102, 224, -30 }, { 102, 225, -30 }, { 102, 226, -30 },
+		{ 102, 227, -30 }, { 102, 228, -30 }, { 102, 229, -30 }, { 102, 232, -30 }, { 102, 233, -30 }, { 102, 234, -30 },
+		{ 102, 235, -30 }, { 102, 242, -30 }, { 102, 243, -30 }, { 102, 244, -30 }, { 102, 245, -30 }, { 102, 246, -30 },
+		{ 102, 248, -30 }, { 103, 114, -10 }, { 104, 121, -30 }, { 104, 253, -30 }, { 104, 255, -30 }, { 107, 101, -20 },
+		{ 107, 111, -20 }, { 107, 232, -20 }, { 107, 233, -20 }, { 107, 234, -20 }, { 107, 235, -20 }, { 107, 242, -20 },
+		{ 107, 243, -20 }, { 107, 244, -20 }, { 107, 245, -20 }, { 107, 246, -20 }, { 107, 248, -20 }, { 109, 117, -10 },
+		{ 109, 121, -15 }, { 109, 249, -10 }, { 109, 250, -10 }, { 109, 251, -10 }, { 109, 252, -10 }, { 109, 253, -15 },
+		{ 109, 255, -15 }, { 110, 117, -10 }, { 110, 118, -20 }, { 110, 121, -15 }, { 110, 249, -10 }, { 110, 250, -10 },
+		{ 110, 251, -10 }, { 110, 252, -10 }, { 110, 253, -15 }, { 110, 255, -15 }, { 111, 44, -40 }, { 111, 46, -40 },
+		{ 111, 118, -15 }, { 111, 119, -15 }, { 111, 120, -30 }, { 111, 121, -30 }, { 111, 253, -30 }, { 111, 255, -30 },
+		{ 112, 44, -35 }, { 112, 46, -35 }, { 112, 121, -30 }, { 112, 253, -30 }, { 112, 255, -30 }, { 114, 44, -50 },
+		{ 114, 46, -50 }, { 114, 58, 30 }, { 114, 59, 30 }, { 114, 97, -10 }, { 114, 105, 15 }, { 114, 107, 15 },
+		{ 114, 108, 15 }, { 114, 109, 25 }, { 114, 110, 25 }, { 114, 112, 30 }, { 114, 116, 40 }, { 114, 117, 15 },
+		{ 114, 118, 30 }, { 114, 121, 30 }, { 114, 224, -10 }, { 114, 225, -10 }, { 114, 226, -10 }, { 114, 227, -10 },
+		{ 114, 228, -10 }, { 114, 229, -10 }, { 114, 236, 15 }, { 114, 237, 15 }, { 114, 238, 15 }, { 114, 239, 15 },
+		{ 114, 241, 25 }, { 114, 249, 15 }, { 114, 250, 15 }, { 114, 251, 15 }, { 114, 252, 15 }, { 114, 253, 30 },
+		{ 114, 255, 30 }, { 115, 44, -15 }, { 115, 46, -15 }, { 115, 119, -30 }, { 118, 44, -80 }, { 118, 46, -80 },
+		{ 118, 97, -25 }, { 118, 101, -25 }, { 118, 111, -25 }, { 118, 224, -25 }, { 118, 225, -25 }, { 118, 226, -25 },
+		{ 118, 227, -25 }, { 118, 228, -25 }, { 118, 229, -25 }, { 118, 232, -25 }, { 118, 233, -25 }, { 118, 234, -25 },
+		{ 118, 235, -25 }, { 118, 242, -25 }, { 118, 243, -25 }, { 118, 244, -25 }, { 118, 245, -25 }, { 118, 246, -25 },
+		{ 118, 248, -25 }, { 119, 44, -60 }, { 119, 46, -60 }, { 119, 97, -15 }, { 119, 101, -10 }, { 119, 111, -10 },
+		{ 119, 224, -15 }, { 119, 225, -15 }, { 119, 226, -15 }, { 119, 227, -15 }, { 119, 228, -15 }, { 119, 229, -15 },
+		{ 119, 232, -10 }, { 119, 233, -10 }, { 119, 234, -10 }, { 119, 235, -10 }, { 119, 242, -10 }, { 119, 243, -10 },
+		{ 119, 244, -10 }, { 119, 245, -10 }, { 119, 246, -10 }, { 119, 248, -10 }, { 120, 101, -30 }, { 120, 232, -30 },
+		{ 120, 233, -30 }, { 120, 234, -30 }, { 120, 235, -30 }, { 121, 44, -100 }, { 121, 46, -100 }, { 121, 97, -20 },
+		{ 121, 101, -20 }, { 121, 111, -20 }, { 121, 224, -20 }, { 121, 225, -20 }, { 121, 226, -20 }, { 121, 227, -20 },
+		{ 121, 228, -20 }, { 121, 229, -20 }, { 121, 232, -20 }, { 121, 233, -20 }, { 121, 234, -20 }, { 121, 235, -20 },
+		{ 121, 242, -20 }, { 121, 243, -20 }, { 121, 244, -20 }, { 121, 245, -20 }, { 121, 246, -20 }, { 121, 248, -20 },
+		{ 122, 101, -15 }, { 122, 111, -15 }, { 122, 232, -15 }, { 122, 233, -15 }, { 122, 234, -15 }, { 122, 235, -15 },
+		{ 122, 242, -15 }, { 122, 243, -15 }, { 122, 244, -15 }, { 122, 245, -15 }, { 122, 246, -15 }, { 122, 248, -15 },
+		{ 138, 44, -20 }, { 138, 46, -20 }, { 145, 145, -57 }, { 146, 32, -70 }, { 146, 100, -50 }, { 146, 114, -50 },
+		{ 146, 115, -50 }, { 146, 146, -57 }, { 146, 154, -50 }, { 146, 160, -70 }, { 148, 32, -40 }, { 148, 160, -40 },
+		{ 154, 44, -15 }, { 154, 46, -15 }, { 154, 119, -30 }, { 158, 101, -15 }, { 158, 111, -15 }, { 158, 232, -15 },
+		{ 158, 233, -15 }, { 158, 234, -15 }, { 158, 235, -15 }, { 158, 242, -15 }, { 158, 243, -15 }, { 158, 244, -15 },
+		{ 158, 245, -15 }, { 158, 246, -15 }, { 158, 248, -15 }, { 159, 44, -140 }, { 159, 45, -140 }, { 159, 46, -140 },
+		{ 159, 58, -60 }, { 159, 59, -60 }, { 159, 65, -110 }, { 159, 79, -85 }, { 159, 97, -140 }, { 159, 101, -140 },
+		{ 159, 105, -20 }, { 159, 111, -140 }, { 159, 117, -110 }, { 159, 173, -140 }, { 159, 192, -110 }, { 159, 193, -110 },
+		{ 159, 194, -110 }, { 159, 195, -110 }, { 159, 196, -110 }, { 159, 197, -110 }, { 159, 210, -85 }, { 159, 211, -85 },
+		{ 159, 212, -85 }, { 159, 213, -85 }, { 159, 214, -85 }, { 159, 216, -85 }, { 159, 224, -140 }, { 159, 225, -140 },
+		{ 159, 226, -140 }, { 159, 227, -70 }, { 159, 228, -140 }, { 159, 229, -140 }, { 159, 232, -140 }, { 159, 233, -140 },
+		{ 159, 234, -140 }, { 159, 235, -140 }, { 159, 237, -20 }, { 159, 242, -140 }, { 159, 243, -140 }, { 159, 244, -140 },
+		{ 159, 245, -140 }, { 159, 246, -140 }, { 159, 248, -140 }, { 159, 249, -110 }, { 159, 250, -110 }, { 159, 251, -110 },
+		{ 159, 252, -110 }, { 160, 84, -50 }, { 160, 86, -50 }, { 160, 87, -40 }, { 160, 89, -90 }, { 160, 145, -60 },
+		{ 160, 147, -30 }, { 160, 159, -90 }, { 160, 221, -90 }, { 192, 67, -30 }, { 192, 71, -30 }, { 192, 79, -30 },
+		{ 192, 81, -30 }, { 192, 84, -120 }, { 192, 85, -50 }, { 192, 86, -70 }, { 192, 87, -50 }, { 192, 89, -100 },
+		{ 192, 117, -30 }, { 192, 118, -40 }, { 192, 119, -40 }, { 192, 121, -40 }, { 192, 159, -100 }, { 192, 199, -30 },
+		{ 192, 210, -30 }, { 192, 211, -30 }, { 192, 212, -30 }, { 192, 213, -30 }, { 192, 214, -30 }, { 192, 216, -30 },
+		{ 192, 217, -50 }, { 192, 218, -50 }, { 192, 219, -50 }, { 192, 220, -50 }, { 192, 221, -100 }, { 192, 249, -30 },
+		{ 192, 250, -30 }, { 192, 251, -30 }, { 192, 252, -30 }, { 192, 253, -40 }, { 192, 255, -40 }, { 193, 67, -30 },
+		{ 193, 71, -30 }, { 193, 79, -30 }, { 193, 81, -30 }, { 193, 84, -120 }, { 193, 85, -50 }, { 193, 86, -70 },
+		{ 193, 87, -50 }, { 193, 89, -100 }, { 193, 117, -30 }, { 193, 118, -40 }, { 193, 119, -40 }, { 193, 121, -40 },
+		{ 193, 159, -100 }, { 193, 199, -30 }, { 193, 210, -30 }, { 193, 211, -30 }, { 193, 212, -30 }, { 193, 213, -30 },
+		{ 193, 214, -30 }, { 193, 216, -30 }, { 193, 217, -50 }, { 193, 218, -50 }, { 193, 219, -50 }, { 193, 220, -50 },
+		{ 193, 221, -100 }, { 193, 249, -30 }, { 193, 250, -30 }, { 193, 251, -30 }, { 193, 252, -30 }, { 193, 253, -40 },
+		{ 193, 255, -40 }, { 194, 67, -30 }, { 194, 71, -30 }, { 194, 79, -30 }, { 194, 81, -30 }, { 194, 84, -120 },
+		{ 194, 85, -50 }, { 194, 86, -70 }, { 194, 87, -50 }, { 194, 89, -100 }, { 194, 117, -30 }, { 194, 118, -40 },
+		{ 194, 119, -40 }, { 194, 121, -40 }, { 194, 159, -100 }, { 194, 199, -30 }, { 194, 210, -30 }, { 194, 211, -30 },
+		{ 194, 212, -30 }, { 194, 213, -30 }, { 194, 214, -30 }, { 194, 216, -30 }, { 194, 217, -50 }, { 194, 218, -50 },
+		{ 194, 219, -50 }, { 194, 220, -50 }, { 194, 221, -100 }, { 194, 249, -30 }, { 194, 250, -30 }, { 194, 251, -30 },
+		{ 194, 252, -30 }, { 194, 253, -40 }, { 194, 255, -40 }, { 195, 67, -30 }, { 195, 71, -30 }, { 195, 79, -30 },
+		{ 195, 81, -30 }, { 195, 84, -120 }, { 195, 85, -50 }, { 195, 86, -70 }, { 195, 87, -50 }, { 195, 89, -100 },
+		{ 195, 117, -30 }, { 195, 118, -40 }, { 195, 119, -40 }, { 195, 121, -40 }, { 195, 159, -100 }, { 195, 199, -30 },
+		{ 195, 210, -30 }, { 195, 211, -30 }, { 195, 212, -30 }, { 195, 213, -30 }, { 195, 214, -30 }, { 195, 216, -30 },
+		{ 195, 217, -50 }, { 195, 218, -50 }, { 195, 219, -50 }, { 195, 220, -50 }, { 195, 221, -100 }, { 195, 249, -30 },
+		{ 195, 250, -30 }, { 195, 251, -30 }, { 195, 252, -30 }, { 195, 253, -40 }, { 195, 255, -40 }, { 196, 67, -30 },
+		{ 196, 71, -30 }, { 196, 79, -30 }, { 196, 81, -30 }, { 196, 84, -120 }, { 196, 85, -50 }, { 196, 86, -70 },
+		{ 196, 87, -50 }, { 196, 89, -100 }, { 196, 117, -30 }, { 196, 118, -40 }, { 196, 119, -40 }, { 196, 121, -40 },
+		{ 196, 159, -100 }, { 196, 199, -30 }, { 196, 210, -30 }, { 196, 211, -30 }, { 196, 212, -30 }, { 196, 213, -30 },
+		{ 196, 214, -30 }, { 196, 216, -30 }, { 196, 217, -50 }, { 196, 218, -50 }, { 196, 219, -50 }, { 196, 220, -50 },
+		{ 196, 221, -100 }, { 196, 249, -30 }, { 196, 250, -30 }, { 196, 251, -30 }, { 196, 252, -30 }, { 196, 253, -40 },
+		{ 196, 255, -40 }, { 197, 67, -30 }, { 197, 71, -30 }, { 197, 79, -30 }, { 197, 81, -30 }, { 197, 84, -120 },
+		{ 197, 85, -50 }, { 197, 86, -70 }, { 197, 87, -50 }, { 197, 89, -100 }, { 197, 117, -30 }, { 197, 118, -40 },
+		{ 197, 119, -40 }, { 197, 121, -40 }, { 197, 159, -100 }, { 197, 199, -30 }, { 197, 210, -30 }, { 197, 211, -30 },
+		{ 197, 212, -30 }, { 197, 213, -30 }, { 197, 214, -30 }, { 197, 216, -30 }, { 197, 217, -50 }, { 197, 218, -50 },
+		{ 197, 219, -50 }, { 197, 220, -50 }, { 197, 221, -100 }, { 197, 249, -30 }, { 197, 250, -30 }, { 197, 251, -30 },
+		{ 197, 252, -30 }, { 197, 253, -40 }, { 197, 255, -40 }, { 199, 44, -30 }, { 199, 46, -30 }, { 210, 44, -40 },
+		{ 210, 46, -40 }, { 210, 65, -20 }, { 210, 84, -40 }, { 210, 86, -50 }, { 210, 87, -30 }, { 210, 88, -60 },
+		{ 210, 89, -70 }, { 210, 159, -70 }, { 210, 192, -20 }, { 210, 193, -20 }, { 210, 194, -20 }, { 210, 195, -20 },
+		{ 210, 196, -20 }, { 210, 197, -20 }, { 210, 221, -70 }, { 211, 44, -40 }, { 211, 46, -40 }, { 211, 65, -20 },
+		{ 211, 84, -40 }, { 211, 86, -50 }, { 211, 87, -30 }, { 211, 88, -60 }, { 211, 89, -70 }, { 211, 159, -70 },
+		{ 211, 192, -20 }, { 211, 193, -20 }, { 211, 194, -20 }, { 211, 195, -20 }, { 211, 196, -20 }, { 211, 197, -20 },
+		{ 211, 221, -70 }, { 212, 44, -40 }, { 212, 46, -40 }, { 212, 65, -20 }, { 212, 84, -40 }, { 212, 86, -50 },
+		{ 212, 87, -30 }, { 212, 88, -60 }, { 212, 89, -70 }, { 212, 159, -70 }, { 212, 192, -20 }, { 212, 193, -20 },
+		{ 212, 194, -20 }, { 212, 195, -20 }, { 212, 196, -20 }, { 212, 197, -20 }, { 212, 221, -70 }, { 213, 44, -40 },
+		{ 213, 46, -40 }, { 213, 65, -20 }, { 213, 84, -40 }, { 213, 86, -50 }, { 213, 87, -30 }, { 213, 88, -60 },
+		{ 213, 89, -70 }, { 213, 159, -70 }, { 213, 192, -20 }, { 213, 193, -20 }, { 213, 194, -20 }, { 213, 195, -20 },
+		{ 213, 196, -20 }, { 213, 197, -20 }, { 213, 221, -70 }, { 214, 44, -40 }, { 214, 46, -40 }, { 214, 65, -20 },
+		{ 214, 84, -40 }, { 214, 86, -50 }, { 214, 87, -30 }, { 214, 88, -60 }, { 214, 89, -70 }, { 214, 159, -70 },
+		{ 214, 192, -20 }, { 214, 193, -20 }, { 214, 194, -20 }, { 214, 195, -20 }, { 214, 196, -20 }, { 214, 197, -20 },
+		{ 214, 221, -70 }, { 216, 44, -40 }, { 216, 46, -40 }, { 216, 65, -20 }, { 216, 84, -40 }, { 216, 86, -50 },
+		{ 216, 87, -30 }, { 216, 88, -60 }, { 216, 89, -70 }, { 216, 159, -70 }, { 216, 192, -20 }, { 216, 193, -20 },
+		{ 216, 194, -20 }, { 216, 195, -20 }, { 216, 196, -20 }, { 216, 197, -20 }, { 216, 221, -70 }, { 217, 44, -40 },
+		{ 217, 46, -40 }, { 217, 65, -40 }, { 217, 192, -40 }, { 217, 193, -40 }, { 217, 194, -40 }, { 217, 195, -40 },
+		{ 217, 196, -40 }, { 217, 197, -40 }, { 218, 44, -40 }, { 218, 46, -40 }, { 218, 65, -40 }, { 218, 192, -40 },
+		{ 218, 193, -40 }, { 218, 194, -40 }, { 218, 195, -40 }, { 218, 196, -40 }, { 218, 197, -40 }, { 219, 44, -40 },
+		{ 219, 46, -40 }, { 219, 65, -40 }, { 219, 192, -40 }, { 219, 193, -40 }, { 219, 194, -40 }, { 219, 195, -40 },
+		{ 219, 196, -40 }, { 219, 197, -40 }, { 220, 44, -40 }, { 220, 46, -40 }, { 220, 65, -40 }, { 220, 192, -40 },
+		{ 220, 193, -40 }, { 220, 194, -40 }, { 220, 195, -40 }, { 220, 196, -40 }, { 220, 197, -40 }, { 221, 44, -140 },
+		{ 221, 45, -140 }, { 221, 46, -140 }, { 221, 58, -60 }, { 221, 59, -60 }, { 221, 65, -110 }, { 221, 79, -85 },
+		{ 221, 97, -140 }, { 221, 101, -140 }, { 221, 105, -20 }, { 221, 111, -140 }, { 221, 117, -110 }, { 221, 173, -140 },
+		{ 221, 192, -110 }, { 221, 193, -110 }, { 221, 194, -110 }, { 221, 195, -110 }, { 221, 196, -110 }, { 221, 197, -110 },
+		{ 221, 210, -85 }, { 221, 211, -85 }, { 221, 212, -85 }, { 221, 213, -85 }, { 221, 214, -85 }, { 221, 216, -85 },
+		{ 221, 224, -140 }, { 221, 225, -140 }, { 221, 226, -140 }, { 221, 227, -70 }, { 221, 228, -140 }, { 221, 229, -140 },
+		{ 221, 232, -140 }, { 221, 233, -140 }, { 221, 234, -140 }, { 221, 235, -140 }, { 221, 237, -20 }, { 221, 242, -140 },
+		{ 221, 243, -140 }, { 221, 244, -140 }, { 221, 245, -140 }, { 221, 246, -140 }, { 221, 248, -140 }, { 221, 249, -110 },
+		{ 221, 250, -110 }, { 221, 251, -110 }, { 221, 252, -110 }, { 224, 118, -20 }, { 224, 119, -20 }, { 224, 121, -30 },
+		{ 224, 253, -30 }, { 224, 255, -30 }, { 225, 118, -20 }, { 225, 119, -20 }, { 225, 121, -30 }, { 225, 253, -30 },
+		{ 225, 255, -30 }, { 226, 118, -20 }, { 226, 119, -20 }, { 226, 121, -30 }, { 226, 253, -30 }, { 226, 255, -30 },
+		{ 227, 118, -20 }, { 227, 119, -20 }, { 227, 121, -30 }, { 227, 253, -30 }, { 227, 255, -30 }, { 228, 118, -20 },
+		{ 228, 119, -20 }, { 228, 121, -30 }, { 228, 253, -30 }, { 228, 255, -30 }, { 229, 118, -20 }, { 229, 119, -20 },
+		{ 229, 121, -30 }, { 229, 253, -30 }, { 229, 255, -30 }, { 231, 44, -15 }, { 231, 107, -20 }, { 232, 44, -15 },
+		{ 232, 46, -15 }, { 232, 118, -30 }, { 232, 119, -20 }, { 232, 120, -30 }, { 232, 121, -20 }, { 232, 253, -20 },
+		{ 232, 255, -20 }, { 233, 44, -15 }, { 233, 46, -15 }, { 233, 118, -30 }, { 233, 119, -20 }, { 233, 120, -30 },
+		{ 233, 121, -20 }, { 233, 253, -20 }, { 233, 255, -20 }, { 234, 44, -15 }, { 234, 46, -15 }, { 234, 118, -30 },
+		{ 234, 119, -20 }, { 234, 120, -30 }, { 234, 121, -20 }, { 234, 253, -20 }, { 234, 255, -20 }, { 235, 44, -15 },
+		{ 235, 46, -15 }, { 235, 118, -30 }, { 235, 119, -20 }, { 235, 120, -30 }, { 235, 121, -20 }, { 235, 253, -20 },
+		{ 235, 255, -20 }, { 241, 117, -10 }, { 241, 118, -20 }, { 241, 121, -15 }, { 241, 249, -10 }, { 241, 250, -10 },
+		{ 241, 251, -10 }, { 241, 252, -10 }, { 241, 253, -15 }, { 241, 255, -15 }, { 242, 44, -40 }, { 242, 46, -40 },
+		{ 242, 118, -15 }, { 242, 119, -15 }, { 242, 120, -30 }, { 242, 121, -30 }, { 242, 253, -30 }, { 242, 255, -30 },
+		{ 243, 44, -40 }, { 243, 46, -40 }, { 243, 118, -15 }, { 243, 119, -15 }, { 243, 120, -30 }, { 243, 121, -30 },
+		{ 243, 253, -30 }, { 243, 255, -30 }, { 244, 44, -40 }, { 244, 46, -40 }, { 244, 118, -15 }, { 244, 119, -15 },
+		{ 244, 120, -30 }, { 244, 121, -30 }, { 244, 253, -30 }, { 244, 255, -30 }, { 245, 44, -40 }, { 245, 46, -40 },
+		{ 245, 118, -15 }, { 245, 119, -15 }, { 245, 120, -30 }, { 245, 121, -30 }, { 245, 253, -30 }, { 245, 255, -30 },
+		{ 246, 44, -40 }, { 246, 46, -40 }, { 246, 118, -15 }, { 246, 119, -15 }, { 246, 120, -30 }, { 246, 121, -30 },
+		{ 246, 253, -30 }, { 246, 255, -30 }, { 248, 44, -95 }, { 248, 46, -95 }, { 248, 97, -55 }, { 248, 98, -55 },
+		{ 248, 99, -55 }, { 248, 100, -55 }, { 248, 101, -55 }, { 248, 102, -55 }, { 248, 103, -55 }, { 248, 104, -55 },
+		{ 248, 105, -55 }, { 248, 106, -55 }, { 248, 107, -55 }, { 248, 108, -55 }, { 248, 109, -55 }, { 248, 110, -55 },
+		{ 248, 111, -55 }, { 248, 112, -55 }, { 248, 113, -55 }, { 248, 114, -55 }, { 248, 115, -55 }, { 248, 116, -55 },
+		{ 248, 117, -55 }, { 248, 118, -70 }, { 248, 119, -70 }, { 248, 120, -85 }, { 248, 121, -70 }, { 248, 122, -55 },
+		{ 248, 154, -55 }, { 248, 158, -55 }, { 248, 224, -55 }, { 248, 225, -55 }, { 248, 226, -55 }, { 248, 227, -55 },
+		{ 248, 228, -55 }, { 248, 229, -55 }, { 248, 231, -55 }, { 248, 232, -55 }, { 248, 233, -55 }, { 248, 234, -55 },
+		{ 248, 235, -55 }, { 248, 236, -55 }, { 248, 237, -55 }, { 248, 238, -55 }, { 248, 239, -55 }, { 248, 241, -55 },
+		{ 248, 242, -55 }, { 248, 243, -55 }, { 248, 244, -55 }, { 248, 245, -55 }, { 248, 246, -55 }, { 248, 248, -55 },
+		{ 248, 249, -55 }, { 248, 250, -55 }, { 248, 251, -55 }, { 248, 252, -55 }, { 248, 253, -70 }, { 248, 255, -70 },
+		{ 253, 44, -100 }, { 253, 46, -100 }, { 253, 97, -20 }, { 253, 101, -20 }, { 253, 111, -20 }, { 253, 224, -20 },
+		{ 253, 225, -20 }, { 253, 226, -20 }, { 253, 227, -20 }, { 253, 228, -20 }, { 253, 229, -20 }, { 253, 232, -20 },
+		{ 253, 233, -20 }, { 253, 234, -20 }, { 253, 235, -20 }, { 253, 242, -20 }, { 253, 243, -20 }, { 253, 244, -20 },
+		{ 253, 245, -20 }, { 253, 246, -20 }, { 253, 248, -20 }, { 255, 44, -100 }, { 255, 46, -100 }, { 255, 97, -20 },
+		{ 255, 101, -20 }, { 255, 111, -20 }, { 255, 224, -20 }, { 255, 225, -20 }, { 255, 226, -20 }, { 255, 227, -20 },
+		{ 255, 228, -20 }, { 255, 229, -20 }, { 255, 232, -20 }, { 255, 233, -20 }, { 255, 234, -20 }, { 255, 235, -20 },
+		{ 255, 242, -20 }, { 255, 243, -20 }, { 255, 244, -20 }, { 255, 245, -20 }, { 255, 246, -20 }, { 255, 248, -20 },
+	};
+
+	static constexpr GlyphMetrics HELVETICA_OBLIQUE_GLYPHS[256] = {
+		/* 00 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 03 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 06 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 09 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0f */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 12 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 15 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 18 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1b */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 278, 0, 0, 0, 0 },
+		/* 21 */ { 278, 90, 0, 340, 718 }, { 355, 168, 463, 438, 718 }, { 556, 73, 0, 631, 688 },
+		/* 24 */ { 556, 69, -115, 617, 775 }, { 889, 147, -19, 889, 703 }, { 667, 77, -15, 647, 718 },
+		/* 27 */ { 191, 157, 463, 285, 718 }, { 333, 108, -207, 454, 733 }, { 333, -9, -207, 337, 733 },
+		/* 2a */ { 389, 165, 431, 475, 718 }, { 584, 85, 0, 606, 505 }, { 278, 56, -147, 214, 106 },
+		/* 2d */ { 333, 93, 232, 357, 322 }, { 278, 87, 0, 214, 106 }, { 278, -21, -19, 452, 737 },
+		/* 30 */ { 556, 93, -19, 608, 703 }, { 556, 207, 0, 508, 703 }, { 556, 26, 0, 617, 703 },
+		/* 33 */ { 556, 75, -19, 610, 703 }, { 556, 61, 0, 576, 703 }, { 556, 68, -19, 621, 688 },
+		/* 36 */ { 556, 91, -19, 615, 703 }, { 556, 137, 0, 669, 688 }, { 556, 74, -19, 607, 703 },
+		/* 39 */ { 556, 82, -19, 609, 703 }, { 278, 87, 0, 301, 516 }, { 278, 56, -147, 301, 516 },
+		/* 3c */ { 584, 94, 11, 641, 495 }, { 584, 63, 115, 628, 390 }, { 584, 50, 11, 597, 495 },
+		/* 3f */ { 556, 161, 0, 610, 727 }, { 1015, 215, -19, 965, 737 }, { 667, 14, 0, 654, 718 },
+		/* 42 */ { 667, 74, 0, 712, 718 }, { 722, 108, -19, 782, 737 }, { 722, 81, 0, 764, 718 },
+		/* 45 */ { 667, 86, 0, 762, 718 }, { 611, 86, 0, 736, 718 }, { 778, 111, -19, 799, 737 },
+		/* 48 */ { 722, 77, 0, 799, 718 }, { 278, 91, 0, 341, 718 }, { 500, 47, -19, 581, 718 },
+		/* 4b */ { 667, 76, 0, 808, 718 }, { 556, 76, 0, 555, 718 }, { 833, 73, 0, 914, 718 },
+		/* 4e */ { 722, 76, 0, 799, 718 }, { 778, 105, -19, 826, 737 }, { 667, 86, 0, 737, 718 },
+		/* 51 */ { 778, 105, -56, 826, 737 }, { 722, 88, 0, 773, 718 }, { 667, 90, -19, 713, 737 },
+		/* 54 */ { 611, 148, 0, 750, 718 }, { 722, 123, -19, 797, 718 }, { 667, 173, 0, 800, 718 },
+		/* 57 */ { 944, 169, 0, 1081, 718 }, { 667, 19, 0, 790, 718 }, { 667, 167, 0, 806, 718 },
+		/* 5a */ { 611, 23, 0, 741, 718 }, { 278, 21, -196, 403, 722 }, { 278, 140, -19, 291, 737 },
+		/* 5d */ { 278, -14, -196, 368, 722 }, { 469, 42, 264, 539, 688 }, { 556, -27, -125, 540, -75 },
+		/* 60 */ { 333, 170, 593, 337, 734 }, { 556, 61, -15, 559, 538 }, { 556, 58, -15, 584, 718 },
+		/* 63 */ { 500, 74, -15, 553, 538 }, { 556, 84, -15, 652, 718 }, { 556, 84, -15, 578, 538 },
+		/* 66 */ { 278, 86, 0, 416, 728 }, { 556, 42, -220, 610, 538 }, { 556, 65, 0, 573, 718 },
+		/* 69 */ { 222, 67, 0, 308, 718 }, { 222, -60, -210, 308, 718 }, { 500, 67, 0, 600, 718 },
+		/* 6c */ { 222, 67, 0, 308, 718 }, { 833, 65, 0, 852, 538 }, { 556, 65, 0, 573, 538 },
+		/* 6f */ { 556, 83, -14, 585, 538 }, { 556, 14, -207, 584, 538 }, { 556, 84, -207, 605, 538 },
+		/* 72 */ { 333, 77, 0, 446, 538 }, { 500, 63, -15, 529, 538 }, { 278, 102, -7, 368, 669 },
+		/* 75 */ { 556, 94, -15, 600, 523 }, { 500, 119, 0, 603, 523 }, { 722, 125, 0, 820, 523 },
+		/* 78 */ { 500, 11, 0, 594, 523 }, { 500, 15, -214, 600, 523 }, { 500, 31, 0, 571, 523 },
+		/* 7b */ { 334, 92, -196, 445, 722 }, { 260, 46, -225, 332, 775 }, { 334, 0, -196, 354, 722 },
+		/* 7e */ { 584, 111, 180, 580, 326 }, { 0, 0, 0, 0, 0 }, { 556, 0, 0, 0, 0 },
+		/* 81 */ { 0, 0, 0, 0, 0 }, { 222, 21, -149, 180, 106 }, { 556, -52, -207, 654, 737 },
+		/* 84 */ { 333, -6, -149, 318, 106 }, { 1000, 115, 0, 908, 106 }, { 556, 135, -159, 622, 718 },
+		/* 87 */ { 556, 52, -159, 623, 718 }, { 333, 147, 593, 438, 734 }, { 1000, 88, -19, 1029, 703 },
+		/* 8a */ { 667, 90, -19, 713, 929 }, { 333, 137, 108, 340, 446 }, { 1000, 98, -19, 1116, 737 },
+		/* 8d */ { 0, 0, 0, 0, 0 }, { 611, 23, 0, 741, 929 }, { 0, 0, 0, 0, 0 },
+		/* 90 */ { 0, 0, 0, 0, 0 }, { 222, 165, 470, 323, 725 }, { 222, 151, 463, 310, 718 },
+		/* 93 */ { 333, 138, 470, 461, 725 }, { 333, 124, 463, 448, 718 }, { 350, 91, 202, 413, 517 },
+		/* 96 */ { 556, 51, 240, 623, 313 }, { 1000, 51, 240, 1067, 313 }, { 333, 125, 606, 490, 722 },
+		/* 99 */ { 1000, 186, 306, 1056, 718 }, { 500, 63, -15, 552, 734 }, { 333, 111, 108, 314, 446 },
+		/* 9c */ { 944, 83, -15, 964, 538 }, { 0, 0, 0, 0, 0 }, { 500, 31, 0, 571, 734 },
+		/* 9f */ { 667, 167, 0, 806, 901 }, { 278, 0, 0, 0, 0 }, { 333, 77, -195, 326, 523 },
+		/* a2 */ { 556, 95, -115, 584, 623 }, { 556, 49, -16, 634, 718 }, { 556, 60, 99, 646, 603 },
+		/* a5 */ { 556, 81, 0, 699, 688 }, { 260, 62, -150, 316, 700 }, { 556, 76, -191, 584, 737 },
+		/* a8 */ { 333, 168, 604, 443, 706 }, { 737, 54, -19, 837, 737 }, { 370, 127, 405, 449, 737 },
+		/* ab */ { 556, 146, 108, 554, 446 }, { 584, 106, 108, 628, 390 }, { 333, 93, 232, 357, 322 },
+		/* ae */ { 737, 54, -19, 837, 737 }, { 333, 143, 627, 468, 684 }, { 400, 169, 411, 468, 703 },
+		/* b1 */ { 584, 39, 0, 618, 506 }, { 333, 64, 281, 449, 703 }, { 333, 90, 270, 436, 703 },
+		/* b4 */ { 333, 248, 593, 475, 734 }, { 556, 24, -207, 600, 523 }, { 537, 126, -173, 650, 718 },
+		/* b7 */ { 278, 129, 190, 257, 315 }, { 333, 2, -225, 232, 0 }, { 333, 166, 281, 371, 703 },
+		/* ba */ { 365, 141, 405, 468, 737 }, { 556, 120, 108, 528, 446 }, { 834, 150, -19, 802, 703 },
+		/* bd */ { 834, 114, -19, 839, 703 }, { 834, 130, -19, 861, 703 }, { 611, 85, -201, 534, 525 },
+		/* c0 */ { 667, 14, 0, 654, 929 }, { 667, 14, 0, 683, 929 }, { 667, 14, 0, 654, 929 },
+		/* c3 */ { 667, 14, 0, 699, 917 }, { 667, 14, 0, 654, 901 }, { 667, 14, 0, 654, 931 },
+		/* c6 */ { 1000, 8, 0, 1097, 718 }, { 722, 108, -225, 782, 737 }, { 667, 86, 0, 762, 929 },
+		/* c9 */ { 667, 86, 0, 762, 929 }, { 667, 86, 0, 762, 929 }, { 667, 86, 0, 762, 901 },
+		/* cc */ { 278, 91, 0, 351, 929 }, { 278, 91, 0, 489, 929 }, { 278, 91, 0, 452, 929 },
+		/* cf */ { 278, 91, 0, 458, 901 }, { 722, 69, 0, 764, 718 }, { 722, 76, 0, 799, 917 },
+		/* d2 */ { 778, 105, -19, 826, 929 }, { 778, 105, -19, 826, 929 }, { 778, 105, -19, 826, 929 },
+		/* d5 */ { 778, 105, -19, 826, 917 }, { 778, 105, -19, 826, 901 }, { 584, 50, 0, 642, 506 },
+		/* d8 */ { 778, 43, -19, 890, 737 }, { 722, 123, -19, 797, 929 }, { 722, 123, -19, 797, 929 },
+		/* db */ { 722, 123, -19, 797, 929 }, { 722, 123, -19, 797, 901 }, { 667, 167, 0, 806, 929 },
+		/* de */ { 667, 86, 0, 712, 718 }, { 611, 67, -15, 658, 728 }, { 556, 61, -15, 559, 734 },
+		/* e1 */ { 556, 61, -15, 587, 734 }, { 556, 61, -15, 559, 734 }, { 556, 61, -15, 592, 722 },
+		/* e4 */ { 556, 61, -15, 559, 706 }, { 556, 61, -15, 559, 756 }, { 889, 61, -15, 909, 538 },
+		/* e7 */ { 500, 74, -225, 553, 538 }, { 556, 84, -15, 578, 734 }, { 556, 84, -15, 587, 734 },
+		/* ea */ { 556, 84, -15, 578, 734 }, { 556, 84, -15, 578, 706 }, { 278, 95, 0, 310, 734 },
+		/* ed */ { 278, 95, 0, 448, 734 }, { 278, 95, 0, 411, 734 }, { 278, 95, 0, 416, 706 },
+		/* f0 */ { 556, 81, -15, 617, 737 }, { 556, 65, 0, 592, 722 }, { 556, 83, -14, 585, 734 },
+		/* f3 */ { 556, 83, -14, 587, 734 }, { 556, 83, -14, 585, 734 }, { 556, 83, -14, 602, 722 },
+		/* f6 */ { 556, 83, -14, 585, 706 }, { 584, 85, -19, 606, 524 }, { 611, 29, -22, 647, 545 },
+		/* f9 */ { 556, 94, -15, 600, 734 }, { 556, 94, -15, 600, 734 }, { 556, 94, -15, 600, 734 },
+		/* fc */ { 556, 94, -15, 600, 706 }, { 500, 15, -214, 600, 734 }, { 556, 14, -207, 584, 718 },
+		/* ff */ { 500, 15, -214, 600, 706 },
+	};
+
+	static constexpr KerningPair HELVETICA_OBLIQUE_KERNING[] = {
+		{ 32, 84, -50 }, { 32, 86, -50 }, { 32, 87, -40 }, { 32, 89, -90 }, { 32, 145, -60 }, { 32, 147, -30 },
+		{ 32, 159, -90 }, { 32, 221, -90 }, { 44, 146, -100 }, { 44, 148, -100 }, { 46, 32, -60 }, { 46, 146, -100 },
+		{ 46, 148, -100 }, { 46, 160, -60 }, { 58, 32, -50 }, { 58, 160, -50 }, { 59, 32, -50 }, { 59, 160, -50 },
+		{ 65, 67, -30 }, { 65, 71, -30 }, { 65, 79, -30 }, { 65, 81, -30 }, { 65, 84, -120 }, { 65, 85, -50 },
+		{ 65, 86, -70 }, { 65, 87, -50 }, { 65, 89, -100 }, { 65, 117, -30 }, { 65, 118, -40 }, { 65, 119, -40 },
+		{ 65, 121, -40 }, { 65, 159, -100 }, { 65, 199, -30 }, { 65, 210, -30 }, { 65, 211, -30 }, { 65, 212, -30 },
+		{ 65, 213, -30 }, { 65, 214, -30 }, { 65, 216, -30 }, { 65, 217, -50 }, { 65, 218, -50 }, { 65, 219, -50 },
+		{ 65, 220, -50 }, { 65, 221, -100 }, { 65, 249, -30 }, { 65, 250, -30 }, { 65, 251, -30 }, { 65, 252, -30 },
+		{ 65, 253, -40 }, { 65, 255, -40 }, { 66, 44, -20 }, { 66, 46, -20 }, { 66, 85, -10 }, { 66, 217, -10 },
+		{ 66, 218, -10 }, { 66, 219, -10 }, { 66, 220, -10 }, { 67, 44, -30 }, { 67, 46, -30 }, { 68, 44, -70 },
+		{ 68, 46, -70 }, { 68, 65, -40 }, { 68, 86, -70 }, { 68, 87, -40 }, { 68, 89, -90 }, { 68, 159, -90 },
+		{ 68, 192, -40 }, { 68, 193, -40 }, { 68, 194, -40 }, { 68, 195, -40 }, { 68, 196, -40 }, { 68, 197, -40 },
+		{ 68, 221, -90 }, { 70, 44, -150 }, { 70, 46, -150 }, { 70, 65, -80 }, { 70, 97, -50 }, { 70, 101, -30 },
+		{ 70, 111, -30 }, { 70, 114, -45 }, { 70, 192, -80 }, { 70, 193, -80 }, { 70, 194, -80 }, { 70, 195, -80 },
+		{ 70, 196, -80 }, { 70, 197, -80 }, { 70, 224, -50 }, { 70, 225, -50 }, { 70, 226, -50 }, { 70, 227, -50 },
+		{ 70, 228, -50 }, { 70, 229, -50 }, { 70, 232, -30 }, { 70, 233, -30 }, { 70, 234, -30 }, { 70, 235, -30 },
+		{ 70, 242, -30 }, { 70, 243, -30 }, { 70, 244, -30 }, { 70, 245, -30 }, { 70, 246, -30 }, { 70, 248, -30 },
+		{ 74, 44, -30 }, { 74, 46, -30 }, { 74, 65, -20 }, { 74, 97, -20 }, { 74, 117, -20 }, { 74, 192, -20 },
+		{ 74, 193, -20 }, { 74, 194, -20 }, { 74, 195, -20 }, { 74, 196, -20 }, { 74, 197, -20 }, { 74, 224, -20 },
+		{ 74, 225, -20 }, { 74, 226, -20 }, { 74, 227, -20 }, { 74, 228, -20 }, { 74, 229, -20 }, { 74, 249, -20 },
+		{ 74, 250, -20 }, { 74, 251, -20 }, { 74, 252, -20 }, { 75, 79, -50 }, { 75, 101, -40 }, { 75, 111, -40 },
+		{ 75, 117, -30 }, { 75, 121, -50 }, { 75, 210, -50 }, { 75, 211, -50 }, { 75, 212, -50 }, { 75, 213, -50 },
+		{ 75, 214, -50 }, { 75, 216, -50 }, { 75, 232, -40 }, { 75, 233, -40 }, { 75, 234, -40 }, { 75, 235, -40 },
+		{ 75, 242, -40 }, { 75, 243, -40 }, { 75, 244, -40 }, { 75, 245, -40 }, { 75, 246, -40 }, { 75, 248, -40 },
+		{ 75, 249, -30 }, { 75, 250, -30 }, { 75, 251, -30 }, { 75, 252, -30 }, { 75, 253, -50 }, { 75, 255, -50 },
+		{ 76, 84, -110 }, { 76, 86, -110 }, { 76, 87, -70 }, { 76, 89, -140 }, { 76, 121, -30 }, { 76, 146, -160 },
+		{ 76, 148, -140 }, { 76, 159, -140 }, { 76, 221, -140 }, { 76, 253, -30 }, { 76, 255, -30 }, { 79, 44, -40 },
+		{ 79, 46, -40 }, { 79, 65, -20 }, { 79, 84, -40 }, { 79, 86, -50 }, { 79, 87, -30 }, { 79, 88, -60 },
+		{ 79, 89, -70 }, { 79, 159, -70 }, { 79, 192, -20 }, { 79, 193, -20 }, { 79, 194, -20 }, { 79, 195, -20 },
+		{ 79, 196, -20 }, { 79, 197, -20 }, { 79, 221, -70 }, { 80, 44, -180 }, { 80, 46, -180 }, { 80, 65, -120 },
+		{ 80, 97, -40 }, { 80, 101, -50 }, { 80, 111, -50 }, { 80, 192, -120 }, { 80, 193, -120 }, { 80, 194, -120 },
+		{ 80, 195, -120 }, { 80, 196, -120 }, { 80, 197, -120 }, { 80, 224, -40 }, { 80, 225, -40 }, { 80, 226, -40 },
+		{ 80, 227, -40 }, { 80, 228, -40 }, { 80, 229, -40 }, { 80, 232, -50 }, { 80, 233, -50 }, { 80, 234, -50 },
+		{ 80, 235, -50 }, { 80, 242, -50 }, { 80, 243, -50 }, { 80, 244, -50 }, { 80, 245, -50 }, { 80, 246, -50 },
+		{ 80, 248, -50 }, { 81, 85, -10 }, { 81, 217, -10 }, { 81, 218, -10 }, { 81, 219, -10 }, { 81, 220, -10 },
+		{ 82, 79, -20 }, { 82, 84, -30 }, { 82, 85, -40 }, { 82, 86, -50 }, { 82, 87, -30 }, { 82, 89, -50 },
+		{ 82, 159, -50 }, { 82, 210, -20 }, { 82, 211, -20 }, { 82, 212, -20 }, { 82, 213, -20 }, { 82, 214, -20 },
+		{ 82, 216, -20 }, { 82, 217, -40 }, { 82, 218, -40 }, { 82, 219, -40 }, { 82, 220, -40 }, { 82, 221, -50 },
+		{ 83, 44, -20 }, { 83, 46, -20 }, { 84, 44, -120 }, { 84, 45, -140 }, { 84, 46, -120 }, { 84, 58, -20 },
+		{ 84, 59, -20 }, { 84, 65, -120 }, { 84, 79, -40 }, { 84, 97, -120 }, { 84, 101, -120 }, { 84, 111, -120 },
+		{ 84, 114, -120 }, { 84, 117, -120 }, { 84, 119, -120 }, { 84, 121, -120 }, { 84, 173, -140 }, { 84, 192, -120 },
+		{ 84, 193, -120 }, { 84, 194, -120 }, { 84, 195, -120 }, { 84, 196, -120 }, { 84, 197, -120 }, { 84, 210, -40 },
+		{ 84, 211, -40 }, { 84, 212, -40 }, { 84, 213, -40 }, { 84, 214, -40 }, { 84, 216, -40 }, { 84, 224, -120 },
+		{ 84, 225, -120 }, { 84, 226, -120 }, { 84, 227, -60 }, { 84, 228, -120 }, { 84, 229, -120 }, { 84, 232, -60 },
+		{ 84, 233, -120 }, { 84, 234, -120 }, { 84, 235, -120 }, { 84, 242, -120 }, { 84, 243, -120 }, { 84, 244, -120 },
+		{ 84, 245, -60 }, { 84, 246, -120 }, { 84, 248, -120 }, { 84, 249, -120 }, { 84, 250, -120 }, { 84, 251, -120 },
+		{ 84, 252, -120 }, { 84, 253, -120 }, { 84, 255, -60 }, { 85, 44, -40 }, { 85, 46, -40 }, { 85, 65, -40 },
+		{ 85, 192, -40 }, { 85, 193, -40 }, { 85, 194, -40 }, { 85, 195, -40 }, { 85, 196, -40 }, { 85, 197, -40 },
+		{ 86, 44, -125 }, { 86, 45, -80 }, { 86, 46, -125 }, { 86, 58, -40 }, { 86, 59, -40 }, { 86, 65, -80 },
+		{ 86, 71, -40 }, { 86, 79, -40 }, { 86, 97, -70 }, { 86, 101, -80 }, { 86, 111, -80 }, { 86, 117, -70 },
+		{ 86, 173, -80 }, { 86, 192, -80 }, { 86, 193, -80 }, { 86, 194, -80 }, { 86, 195, -80 }, { 86, 196, -80 },
+		{ 86, 197, -80 }, { 86, 210, -40 }, { 86, 211, -40 }, { 86, 212, -40 }, { 86, 213, -40 }, { 86, 214, -40 },
+		{ 86, 216, -40 }, { 86, 224, -70 }, { 86, 225, -70 }, { 86, 226, -70 }, { 86, 227, -70 }, { 86, 228, -70 },
+		{ 86, 229, -70 }, { 86, 232, -80 }, { 86, 233, -80 }, { 86, 234, -80 }, { 86, 235, -80 }, { 86, 242, -80 },
+		{ 86, 243, -80 }, { 86, 244, -80 }, { 86, 245, -80 }, { 86, 246, -80 }, { 86, 248, -80 }, { 86, 249, -70 },
+		{ 86, 250, -70 }, { 86, 251, -70 }, { 86, 252, -70 }, { 87, 44, -80 }, { 87, 45, -40 }, { 87, 46, -80 },
+		{ 87, 65, -50 }, { 87, 79, -20 }, { 87, 97, -40 }, { 87, 101, -30 }, { 87, 111, -30 }, { 87, 117, -30 },
+		{ 87, 121, -20 }, { 87, 173, -40 }, { 87, 192, -50 }, { 87, 193, -50 }, { 87, 194, -50 }, { 87, 195, -50 },
+		{ 87, 196, -50 }, { 87, 197, -50 }, { 87, 210, -20 }, { 87, 211, -20 }, { 87, 212, -20 }, { 87, 213, -20 },
+		{ 87, 214, -20 }, { 87, 216, -20 }, { 87, 224, -40 }, { 87, 225, -40 }, { 87, 226, -40 }, { 87, 227, -40 },
+		{ 87, 228, -40 }, { 87, 229, -40 }, { 87, 232, -30 }, { 87, 233, -30 }, { 87, 234, -30 }, { 87, 235, -30 },
+		{ 87, 242, -30 }, { 87, 243, -30 }, { 87, 244, -30 }, { 87, 245, -30 }, { 87, 246, -30 }, { 87, 248, -30 },
+		{ 87, 249, -30 }, { 87, 250, -30 }, { 87, 251, -30 }, { 87, 252, -30 }, { 87, 253, -20 }, { 87, 255, -20 },
+		{ 89, 44, -140 }, { 89, 45, -140 }, { 89, 46, -140 }, { 89, 58, -60 }, { 89, 59, -60 }, { 89, 65, -110 },
+		{ 89, 79, -85 }, { 89, 97, -140 }, { 89, 101, -140 }, { 89, 105, -20 }, { 89, 111, -140 }, { 89, 117, -110 },
+		{ 89, 173, -140 }, { 89, 192, -110 }, { 89, 193, -110 }, { 89, 194, -110 }, { 89, 195, -110 }, { 89, 196, -110 },
+		{ 89, 197, -110 }, { 89, 210, -85 }, { 89, 211, -85 }, { 89, 212, -85 }, { 89, 213, -85 }, { 89, 214, -85 },
+		{ 89, 216, -85 }, { 89, 224, -140 }, { 89, 225, -140 }, { 89, 226, -140 }, { 89, 227, -140 }, { 89, 228, -140 },
+		{ 89, 229, -140 }, { 89, 232, -140 }, { 89, 233, -140 }, { 89, 234, -140 }, { 89, 235, -140 }, { 89, 237, -20 },
+		{ 89, 242, -140 }, { 89, 243, -140 }, { 89, 244, -140 }, { 89, 245, -140 }, { 89, 246, -140 }, { 89, 248, -140 },
+		{ 89, 249, -110 }, { 89, 250, -110 }, { 89, 251, -110 }, { 89, 252, -110 }, { 97, 118, -20 }, { 97, 119, -20 },
+		{ 97, 121, -30 }, { 97, 253, -30 }, { 97, 255, -30 }, { 98, 44, -40 }, { 98, 46, -40 }, { 98, 98, -10 },
+		{ 98, 108, -20 }, { 98, 117, -20 }, { 98, 118, -20 }, { 98, 121, -20 }, { 98, 249, -20 }, { 98, 250, -20 },
+		{ 98, 251, -20 }, { 98, 252, -20 }, { 98, 253, -20 }, { 98, 255, -20 }, { 99, 44, -15 }, { 99, 107, -20 },
+		{ 101, 44, -15 }, { 101, 46, -15 }, { 101, 118, -30 }, { 101, 119, -20 }, { 101, 120, -30 }, { 101, 121, -20 },
+		{ 101, 253, -20 }, { 101, 255, -20 }, { 102, 44, -30 }, { 102, 46, -30 }, { 102, 97, -30 }, { 102, 101, -30 },
+		{ 102, 111, -30 }, { 102, 146, 50 }, { 102, 148, 60 }, { 102, 224, -30 }, { 102, 225, -30 }, { 102, 226, -30 },
+		{ 102, 227, -30 }, { 102, 228, -30 }, { 102, 229, -30 }, { 102, 232, -30 }, { 102, 233, -30 }, { 102, 234, -30 },
+		{ 102, 235, -30 }, { 102, 242, -30 }, { 102, 243, -30 }, { 102, 244, -30 }, { 102, 245, -30 }, { 102, 246, -30 },
+		{ 102, 248, -30 }, { 103, 114, -10 }, { 104, 121, -30 }, { 104, 253, -30 }, { 104, 255, -30 }, { 107, 101, -20 },
+		{ 107, 111, -20 }, { 107, 232, -20 }, { 107, 233, -20 }, { 107, 234, -20 }, { 107, 235, -20 }, { 107, 242, -20 },
+		{ 107, 243, -20 }, { 107, 244, -20 }, { 107, 245, -20 }, { 107, 246, -20 }, { 107, 248, -20 }, { 109, 117, -10 },
+		{ 109, 121, -15 }, { 109, 249, -10 }, { 109, 250, -10 }, { 109, 251, -10 }, { 109, 252, -10 }, { 109, 253, -15 },
+		{ 109, 255, -15 }, { 110, 117, -10 }, { 110, 118, -20 }, { 110, 121, -15 }, { 110, 249, -10 }, { 110, 250, -10 },
+		{ 110, 251, -10 }, { 110, 252, -10 }, { 110, 253, -15 }, { 110, 255, -15 }, { 111, 44, -40 }, { 111, 46, -40 },
+		{ 111, 118, -15 }, { 111, 119, -15 }, { 111, 120, -30 }, { 111, 121, -30 }, { 111, 253, -30 }, { 111, 255, -30 },
+		{ 112, 44, -35 }, { 112, 46, -35 }, { 112, 121, -30 }, { 112, 253, -30 }, { 112, 255, -30 }, { 114, 44, -50 },
+		{ 114, 46, -50 }, { 114, 58, 30 }, { 114, 59, 30 }, { 114, 97, -10 }, { 114, 105, 15 }, { 114, 107, 15 },
+		{ 114, 108, 15 }, { 114, 109, 25 }, { 114, 110, 25 }, { 114, 112, 30 }, { 114, 116, 40 }, { 114, 117, 15 },
+		{ 114, 118, 30 }, { 114, 121, 30 }, { 114, 224, -10 }, { 114, 225, -10 }, { 114, 226, -10 }, { 114, 227, -10 },
+		{ 114, 228, -10 }, { 114, 229, -10 }, { 114, 236, 15 }, { 114, 237, 15 }, { 114, 238, 15 }, { 114, 239, 15 },
+		{ 114, 241, 25 }, { 114, 249, 15 }, { 114, 250, 15 }, { 114, 251, 15 }, { 114, 252, 15 }, { 114, 253, 30 },
+		{ 114, 255, 30 }, { 115, 44, -15 }, { 115, 46, -15 }, { 115, 119, -30 }, { 118, 44, -80 }, { 118, 46, -80 },
+		{ 118, 97, -25 }, { 118, 101, -25 }, { 118, 111, -25 }, { 118, 224, -25 }, { 118, 225, -25 }, { 118, 226, -25 },
+		{ 118, 227, -25 }, { 118, 228, -25 }, { 118, 229, -25 }, { 118, 232, -25 }, { 118, 233, -25 }, { 118, 234, -25 },
+		{ 118, 235, -25 }, { 118, 242, -25 }, { 118, 243, -25 }, { 118, 244, -25 }, { 118, 245, -25 }, { 118, 246, -25 },
+		{ 118, 248, -25 }, { 119, 44, -60 }, { 119, 46, -60 }, { 119, 97, -15 }, { 119, 101, -10 }, { 119, 111, -10 },
+		{ 119, 224, -15 }, { 119, 225, -15 }, { 119, 226, -15 }, { 119, 227, -15 }, { 119, 228, -15 }, { 119, 229, -15 },
+		{ 119, 232, -10 }, { 119, 233, -10 }, { 119, 234, -10 }, { 119, 235, -10 }, { 119, 242, -10 }, { 119, 243, -10 },
+		{ 119, 244, -10 }, { 119, 245, -10 }, { 119, 246, -10 }, { 119, 248, -10 }, { 120, 101, -30 }, { 120, 232, -30 },
+		{ 120, 233, -30 }, { 120, 234, -30 }, { 120, 235, -30 }, { 121, 44, -100 }, { 121, 46, -100 }, { 121, 97, -20 },
+		{ 121, 101, -20 }, { 121, 111, -20 }, { 121, 224, -20 }, { 121, 225, -20 }, { 121, 226, -20 }, { 121, 227, -20 },
+		{ 121, 228, -20 }, { 121, 229, -20 }, { 121, 232, -20 }, { 121, 233, -20 }, { 121, 234, -20 }, { 121, 235, -20 },
+		{ 121, 242, -20 }, { 121, 243, -20 }, { 121, 244, -20 }, { 121, 245, -20 }, { 121, 246, -20 }, { 121, 248, -20 },
+		{ 122, 101, -15 }, { 122, 111, -15 }, { 122, 232, -15 }, { 122, 233, -15 }, { 122, 234, -15 }, { 122, 235, -15 },
+		{ 122, 242, -15 }, { 122, 243, -15 }, { 122, 244, -15 }, { 122, 245, -15 }, { 122, 246, -15 }, { 122, 248, -15 },
+		{ 138, 44, -20 }, { 138, 46, -20 }, { 145, 145, -57 }, { 146, 32, -70 }, { 146, 100, -50 }, { 146, 114, -50 },
+		{ 146, 115, -50 }, { 146, 146, -57 }, { 146, 154, -50 }, { 146, 160, -70 }, { 148, 32, -40 }, { 148, 160, -40 },
+		{ 154, 44, -15 }, { 154, 46, -15 }, { 154, 119, -30 }, { 158, 101, -15 }, { 158, 111, -15 }, { 158, 232, -15 },
+		{ 158, 233, -15 }, { 158, 234, -15 }, { 158, 235, -15 }, { 158, 242, -15 }, { 158, 243, -15 }, { 158, 244, -15 },
+		{ 158, 245, -15 }, { 158, 246, -15 }, { 158, 248, -15 }, { 159, 44, -140 }, { 159, 45, -140 }, { 159, 46, -140 },
+		{ 159, 58, -60 }, { 159, 59, -60 }, { 159, 65, -110 }, { 159, 79, -85 }, { 159, 97, -140 }, { 159, 101, -140 },
+		{ 159, 105, -20 }, { 159, 111, -140 }, { 159, 117, -110 }, { 159, 173, -140 }, { 159, 192, -110 }, { 159, 193, -110 },
+		{ 159, 194, -110 }, { 159, 195, -110 }, { 159, 196, -110 }, { 159, 197, -110 }, { 159, 210, -85 }, { 159, 211, -85 },
+		{ 159, 212, -85 }, { 159, 213, -85 }, { 159, 214, -85 }, { 159, 216, -85 }, { 159, 224, -140 }, { 159, 225, -140 },
+		{ 159, 226, -140 }, { 159, 227, -70 }, { 159, 228, -140 }, { 159, 229, -140 }, { 159, 232, -140 }, { 159, 233, -140 },
+		{ 159, 234, -140 }, { 159, 235, -140 }, { 159, 237, -20 }, { 159, 242, -140 }, { 159, 243, -140 }, { 159, 244, -140 },
+		{ 159, 245, -140 }, { 159, 246, -140 }, { 159, 248, -140 }, { 159, 249, -110 }, { 159, 250, -110 }, { 159, 251, -110 },
+		{ 159, 252, -110 }, { 160, 84, -50 }, { 160, 86, -50 }, { 160, 87, -40 }, { 160, 89, -90 }, { 160, 145, -60 },
+		{ 160, 147, -30 }, { 160, 159, -90 }, { 160, 221, -90 }, { 192, 67, -30 }, { 192, 71, -30 }, { 192, 79, -30 },
+		{ 192, 81, -30 }, { 192, 84, -120 }, { 192, 85, -50 }, { 192, 86, -70 }, { 192, 87, -50 }, { 192, 89, -100 },
+		{ 192, 117, -30 }, { 192, 118, -40 }, { 192, 119, -40 }, { 192, 121, -40 }, { 192, 159, -100 }, { 192, 199, -30 },
+		{ 192, 210, -30 }, { 192, 211, -30 }, { 192, 212, -30 }, { 192, 213, -30 }, { 192, 214, -30 }, { 192, 216, -30 },
+		{ 192, 217, -50 }, { 192, 218, -50 }, { 192, 219, -50 }, { 192, 220, -50 }, { 192, 221, -100 }, { 192, 249, -30 },
+		{ 192, 250, -30 }, { 192, 251, -30 }, { 192, 252, -30 }, { 192, 253, -40 }, { 192, 255, -40 }, { 193, 67, -30 },
+		{ 193, 71, -30 }, { 193, 79, -30 }, { 193, 81, -30 }, { 193, 84, -120 }, { 193, 85, -50 }, { 193, 86, -70 },
+		{ 193, 87, -50 }, { 193, 89, -100 }, { 193, 117, -30 }, { 193, 118, -40 }, { 193, 119, -40 }, { 193, 121, -40 },
+		{ 193, 159, -100 }, { 193, 199, -30 }, { 193, 210, -30 }, { 193, 211, -30 }, { 193, 212, -30 }, { 193, 213, -30 },
+		{ 193, 214, -30 }, { 193, 216, -30 }, { 193, 217, -50 }, { 193, 218, -50 }, { 193, 219, -50 }, { 193, 220, -50 },
+		{ 193, 221, -100 }, { 193, 249, -30 }, { 193, 250, -30 }, { 193, 251, -30 }, { 193, 252, -30 }, { 193, 253, -40 },
+		{ 193, 255, -40 }, { 194, 67, -30 }, { 194, 71, -30 }, { 194, 79, -30 }, { 194, 81, -30 }, { 194, 84, -120 },
+		{ 194, 85, -50 }, { 194, 86, -70 }, { 194, 87, -50 }, { 194, 89, -100 }, { 194, 117, -30 }, { 194, 118, -40 },
+		{ 194, 119, -40 }, { 194, 121, -40 }, { 194, 159, -100 }, { 194, 199, -30 }, { 194, 210, -30 }, { 194, 211, -30 },
+		{ 194, 212, -30 }, { 194, 213, -30 }, { 194, 214, -30 }, { 194, 216, -30 }, { 194, 217, -50 }, { 194, 218, -50 },
+		{ 194, 219, -50 }, { 194, 220, -50 }, { 194, 221, -100 }, { 194, 249, -30 }, { 194, 250, -30 }, { 194, 251, -30 },
+		{ 194, 252, -30 }, { 194, 253, -40 }, { 194, 255, -40 }, { 195, 67, -30 }, { 195, 71, -30 }, { 195, 79, -30 },
+		{ 195, 81, -30 }, { 195, 84, -120 }, { 195, 85, -50 }, { 195, 86, -70 }, { 195, 87, -50 }, { 195, 89, -100 },
+		{ 195, 117, -30 }, { 195, 118, -40 }, { 195, 119, -40 }, { 195, 121, -40 }, { 195, 159, -100 }, { 195, 199, -30 },
+		{ 195, 210, -30 }, { 195, 211, -30 }, { 195, 212, -30 }, { 195, 213, -30 }, { 195, 214, -30 }, { 195, 216, -30 },
+		{ 195, 217, -50 }, { 195, 218, -50 }, { 195, 219, -50 }, { 195, 220, -50 }, { 195, 221, -100 }, { 195, 249, -30 },
+		{ 195, 250, -30 }, { 195, 251, -30 }, { 195, 252, -30 }, { 195, 253, -40 }, { 195, 255, -40 }, { 196, 67, -30 },
+		{ 196, 71, -30 }, { 196, 79, -30 }, { 196, 81, -30 }, { 196, 84, -120 }, { 196, 85, -50 }, { 196, 86, -70 },
+		{ 196, 87, -50 }, { 196, 89, -100 }, { 196, 117, -30 }, { 196, 118, -40 }, { 196, 119, -40 }, { 196, 121, -40 },
+		{ 196, 159, -100 }, { 196, 199, -30 }, { 196, 210, -30 }, { 196, 211, -30 }, { 196, 212, -30 }, { 196, 213, -30 },
+		{ 196, 214, -30 }, { 196, 216, -30 }, { 196, 217, -50 }, { 196, 218, -50 }, { 196, 219, -50 }, { 196, 220, -50 },
+		{ 196, 221, -100 }, { 196, 249, -30 }, { 196, 250, -30 }, { 196, 251, -30 }, { 196, 252, -30 }, { 196, 253, -40 },
+		{ 196, 255, -40 }, { 197, 67, -30 }, { 197, 71, -30 }, { 197, 79, -30 }, { 197, 81, -30 }, { 197, 84, -120 },
+		{ 197, 85, -50 }, { 197, 86, -70 }, { 197, 87, -50 }, { 197, 89, -100 }, { 197, 117, -30 }, { 197, 118, -40 },
+		{ 197, 119, -40 }, { 197, 121, -40 }, { 197, 159, -100 }, { 197, 199, -30 }, { 197, 210, -30 }, { 197, 211, -30 },
+		{ 197, 212, -30 }, { 197, 213, -30 }, { 197, 214, -30 }, { 197, 216, -30 }, { 197, 217, -50 }, { 197, 218, -50 },
+		{ 197, 219, -50 }, { 197, 220, -50 }, { 197, 221, -100 }, { 197, 249, -30 }, { 197, 250, -30 }, { 197, 251, -30 },
+		{ 197, 252, -30 }, { 197, 253, -40 }, { 197, 255, -40 }, { 199, 44, -30 }, { 199, 46, -30 }, { 210, 44, -40 },
+		{ 210, 46, -40 }, { 210, 65, -20 }, { 210, 84, -40 }, { 210, 86, -50 }, { 210, 87, -30 }, { 210, 88, -60 },
+		{ 210, 89, -70 }, { 210, 159, -70 }, { 210, 192, -20 }, { 210, 193, -20 }, { 210, 194, -20 }, { 210, 195, -20 },
+		{ 210, 196, -20 }, { 210, 197, -20 }, { 210, 221, -70 }, { 211, 44, -40 }, { 211, 46, -40 }, { 211, 65, -20 },
+		{ 211, 84, -40 }, { 211, 86, -50 }, { 211, 87, -30 }, { 211, 88, -60 }, { 211, 89, -70 }, { 211, 159, -70 },
+		{ 211, 192, -20 }, { 211, 193, -20 }, { 211, 194, -20 }, { 211, 195, -20 }, { 211, 196, -20 }, { 211, 197, -20 },
+		{ 211, 221, -70 }, { 212, 44, -40 }, { 212, 46, -40 }, { 212, 65, -20 }, { 212, 84, -40 }, { 212, 86, -50 },
+		{ 212, 87, -30 }, { 212, 88, -60 }, { 212, 89, -70 }, { 212, 159, -70 }, { 212, 192, -20 }, { 212, 193, -20 },
+		{ 212, 194, -20 }, { 212, 195, -20 }, { 212, 196, -20 }, { 212, 197, -20 }, { 212, 221, -70 }, { 213, 44, -40 },
+		{ 213, 46, -40 }, { 213, 65, -20 }, { 213, 84, -40 }, { 213, 86, -50 }, { 213, 87, -30 }, { 213, 88, -60 },
+		{ 213, 89, -70 }, { 213, 159, -70 }, { 213, 192, -20 }, { 213, 193, -20 }, { 213, 194, -20 }, { 213, 195, -20 },
+		{ 213, 196, -20 }, { 213, 197, -20 }, { 213, 221, -70 }, { 214, 44, -40 }, { 214, 46, -40 }, { 214, 65, -20 },
+		{ 214, 84, -40 }, { 214, 86, -50 }, { 214, 87, -30 }, { 214, 88, -60 }, { 214, 89, -70 }, { 214, 159, -70 },
+		{ 214, 192, -20 }, { 214, 193, -20 }, { 214, 194, -20 }, { 214, 195, -20 }, { 214, 196, -20 }, { 214, 197, -20 },
+		{ 214, 221, -70 }, { 216, 44, -40 }, { 216, 46, -40 }, { 216, 65, -20 }, { 216, 84, -40 }, { 216, 86, -50 },
+		{ 216, 87, -30 }, { 216, 88, -60 }, { 216, 89, -70 }, { 216, 159, -70 }, { 216, 192, -20 }, { 216, 193, -20 },
+		{ 216, 194, -20 }, { 216, 195, -20 }, { 216, 196, -20 }, { 216, 197, -20 }, { 216, 221, -70 }, { 217, 44, -40 },
+		{ 217, 46, -40 }, { 217, 65, -40 }, { 217, 192, -40 }, { 217, 193, -40 }, { 217, 194, -40 }, { 217, 195, -40 },
+		{ 217, 196, -40 }, { 217, 197, -40 }, { 218, 44, -40 }, { 218, 46, -40 }, { 218, 65, -40 }, { 218, 192, -40 },
+		{ 218, 193, -40 }, { 218, 194, -40 }, { 218, 195, -40 }, { 218, 196, -40 }, { 218, 197, -40 }, { 219, 44, -40 },
+		{ 219, 46, -40 }, { 219, 65, -40 }, { 219, 192, -40 }, { 219, 193, -40 }, { 219, 194, -40 }, { 219, 195, -40 },
+		{ 219, 196, -40 }, { 219, 197, -40 }, { 220, 44, -40 }, { 220, 46, -40 }, { 220, 65, -40 }, { 220, 192, -40 },
+		{ 220, 193, -40 }, { 220, 194, -40 }, { 220, 195, -40 }, { 220, 196, -40 }, { 220, 197, -40 }, { 221, 44, -140 },
+		{ 221, 45, -140 }, { 221, 46, -140 }, { 221, 58, -60 }, { 221, 59, -60 }, { 221, 65, -110 }, { 221, 79, -85 },
+		{ 221, 97, -140 }, { 221, 101, -140 }, { 221, 105, -20 }, { 221, 111, -140 }, { 221, 117, -110 }, { 221, 173, -140 },
+		{ 221, 192, -110 }, { 221, 193, -110 }, { 221, 194, -110 }, { 221, 195, -110 }, { 221, 196, -110 }, { 221, 197, -110 },
+		{ 221, 210, -85 }, { 221, 211, -85 }, { 221, 212, -85 }, { 221, 213, -85 }, { 221, 214, -85 }, { 221, 216, -85 },
+		{ 221, 224, -140 }, { 221, 225, -140 }, { 221, 226, -140 }, { 221, 227, -70 }, { 221, 228, -140 }, { 221, 229, -140 },
+		{ 221, 232, -140 }, { 221, 233, -140 }, { 221, 234, -140 }, { 221, 235, -140 }, { 221, 237, -20 }, { 221, 242, -140 },
+		{ 221, 243, -140 }, { 221, 244, -140 }, { 221, 245, -140 }, { 221, 246, -140 }, { 221, 248, -140 }, { 221, 249, -110 },
+		{ 221, 250, -110 }, { 221, 251, -110 }, { 221, 252, -110 }, { 224, 118, -20 }, { 224, 119, -20 }, { 224, 121, -30 },
+		{ 224, 253, -30 }, { 224, 255, -30 }, { 225, 118, -20 }, { 225, 119, -20 }, { 225, 121, -30 }, { 225, 253, -30 },
+		{ 225, 255, -30 }, { 226, 118, -20 }, { 226, 119, -20 }, { 226, 121, -30 }, { 226, 253, -30 }, { 226, 255, -30 },
+		{ 227, 118, -20 }, { 227, 119, -20 }, { 227, 121, -30 }, { 227, 253, -30 }, { 227, 255, -30 }, { 228, 118, -20 },
+		{ 228, 119, -20 }, { 228, 121, -30 }, { 228, 253, -30 }, { 228, 255, -30 }, { 229, 118, -20 }, { 229, 119, -20 },
+		{ 229, 121, -30 }, { 229, 253, -30 }, { 229, 255, -30 }, { 231, 44, -15 }, { 231, 107, -20 }, { 232, 44, -15 },
+		{ 232, 46, -15 }, { 232, 118, -30 }, { 232, 119, -20 }, { 232, 120, -30 }, { 232, 121, -20 }, { 232, 253, -20 },
+		{ 232, 255, -20 }, { 233, 44, -15 }, { 233, 46, -15 }, { 233, 118, -30 }, { 233, 119, -20 }, { 233, 120, -30 },
+		{ 233, 121, -20 }, { 233, 253, -20 }, { 233, 255, -20 }, { 234, 44, -15 }, { 234, 46, -15 }, { 234, 118, -30 },
+		{ 234, 119, -20 }, { 234, 120, -30 }, { 234, 121, -20 }, { 234, 253, -20 }, { 234, 255, -20 }, { 235, 44, -15 },
+		{ 235, 46, -15 }, { 235, 118, -30 }, { 235, 119, -20 }, { 235, 120, -30 }, { 235, 121, -20 }, { 235, 253, -20 },
+		{ 235, 255, -20 }, { 241, 117, -10 }, { 241, 118, -20 }, { 241, 121, -15 }, { 241, 249, -10 }, { 241, 250, -10 },
+		{ 241, 251, -10 }, { 241, 252, -10 }, { 241, 253, -15 }, { 241, 255, -15 }, { 242, 44, -40 }, { 242, 46, -40 },
+		{ 242, 118, -15 }, { 242, 119, -15 }, { 242, 120, -30 }, { 242, 121, -30 }, { 242, 253, -30 }, { 242, 255, -30 },
+		{ 243, 44, -40 }, { 243, 46, -40 }, { 243, 118, -15 }, { 243, 119, -15 }, { 243, 120, -30 }, { 243, 121, -30 },
+		{ 243, 253, -30 }, { 243, 255, -30 }, { 244, 44, -40 }, { 244, 46, -40 }, { 244, 118, -15 }, { 244, 119, -15 },
+		{ 244, 120, -30 }, { 244, 121, -30 }, { 244, 253, -30 }, { 244, 255, -30 }, { 245, 44, -40 }, { 245, 46, -40 },
+		{ 245, 118, -15 }, { 245, 119, -15 }, { 245, 120, -30 }, { 245, 121, -30 }, { 245, 253, -30 }, { 245, 255, -30 },
+		{ 246, 44, -40 }, { 246, 46, -40 }, { 246, 118, -15 }, { 246, 119, -15 }, { 246, 120, -30 }, { 246, 121, -30 },
+		{ 246, 253, -30 }, { 246, 255, -30 }, { 248, 44, -95 }, { 248, 46, -95 }, { 248, 97, -55 }, { 248, 98, -55 },
+		{ 248, 99, -55 }, { 248, 100, -55 }, { 248, 101, -55 }, { 248, 102, -55 }, { 248, 103, -55 }, { 248, 104, -55 },
+		{ 248, 105, -55 }, { 248, 106, -55 }, { 248, 107, -55 }, { 248, 108, -55 }, { 248, 109, -55 }, { 248, 110, -55 },
+		{ 248, 111, -55 }, { 248, 112, -55 }, { 248, 113, -55 }, { 248, 114, -55 }, { 248, 115, -55 }, { 248, 116, -55 },
+		{ 248, 117, -55 }, { 248, 118, -70 }, { 248, 119, -70 }, { 248, 120, -85 }, { 248, 121, -70 }, { 248, 122, -55 },
+		{ 248, 154, -55 }, { 248, 158, -55 }, { 248, 224, -55 }, { 248, 225, -55 }, { 248, 226, -55 }, { 248, 227, -55 },
+		{ 248, 228, -55 }, { 248, 229, -55 }, { 248, 231, -55 }, { 248, 232, -55 }, { 248, 233, -55 }, { 248, 234, -55 },
+		{ 248, 235, -55 }, { 248, 236, -55 }, { 248, 237, -55 }, { 248, 238, -55 }, { 248, 239, -55 }, { 248, 241, -55 },
+		{ 248, 242, -55 }, { 248, 243, -55 }, { 248, 244, -55 }, { 248, 245, -55 }, { 248, 246, -55 }, { 248, 248, -55 },
+		{ 248, 249, -55 }, { 248, 250, -55 }, { 248, 251, -55 }, { 248, 252, -55 }, { 248, 253, -70 }, { 248, 255, -70 },
+		{ 253, 44, -100 }, { 253, 46, -100 }, { 253, 97, -20 }, { 253, 101, -20 }, { 253, 111, -20 }, { 253, 224, -20 },
+		{ 253, 225, -20 }, { 253, 226, -20 }, { 253, 227, -20 }, { 253, 228, -20 }, { 253, 229, -20 }, { 253, 232, -20 },
+		{ 253, 233, -20 }, { 253, 234, -20 }, { 253, 235, -20 }, { 253, 242, -20 }, { 253, 243, -20 }, { 253, 244, -20 },
+		{ 253, 245, -20 }, { 253, 246, -20 }, { 253, 248, -20 }, { 255, 44, -100 }, { 255, 46, -100 }, { 255, 97, -20 },
+		{ 255, 101, -20 }, { 255, 111, -20 }, { 255, 224, -20 }, { 255, 225, -20 }, { 255, 226, -20 }, { 255, 227, -20 },
+		{ 255, 228, -20 }, { 255, 229, -20 }, { 255, 232, -20 }, { 255, 233, -20 }, { 255, 234, -20 }, { 255, 235, -20 },
+		{ 255, 242, -20 }, { 255, 243, -20 }, { 255, 244, -20 }, { 255, 245, -20 }, { 255, 246, -20 }, { 255, 248, -20 },
+	};
+
+	static constexpr GlyphMetrics HELVETICA_BOLD_GLYPHS[256] = {
+		/* 00 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 03 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 06 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 09 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0f */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 12 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 15 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 18 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1b */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 278, 0, 0, 0, 0 },
+		/* 21 */ { 333, 90, 0, 244, 718 }, { 474, 98, 447, 376, 718 }, { 556, 18, 0, 538, 698 },
+		/* 24 */ { 556, 30, -115, 523, 775 }, { 889, 28, -19, 861, 710 }, { 722, 54, -19, 701, 718 },
+		/* 27 */ { 238, 70, 447, 168, 718 }, { 333, 35, -208, 314, 734 }, { 333, 19, -208, 298, 734 },
+		/* 2a */ { 389, 27, 387, 362, 718 }, { 584, 40, 0, 544, 506 }, { 278, 64, -168, 214, 146 },
+		/* 2d */ { 333, 27, 215, 306, 345 }, { 278, 64, 0, 214, 146 }, { 278, -33, -19, 311, 737 },
+		/* 30 */ { 556, 32, -19, 524, 710 }, { 556, 69, 0, 378, 710 }, { 556, 26, 0, 511, 710 },
+		/* 33 */ { 556, 27, -19, 516, 710 }, { 556, 27, 0, 526, 710 }, { 556, 27, -19, 516, 698 },
+		/* 36 */ { 556, 31, -19, 520, 710 }, { 556, 25, 0, 528, 698 }, { 556, 32, -19, 524, 710 },
+		/* 39 */ { 556, 30, -19, 522, 710 }, { 333, 92, 0, 242, 512 }, { 333, 92, -168, 242, 512 },
+		/* 3c */ { 584, 38, -8, 546, 514 }, { 584, 40, 87, 544, 419 }, { 584, 38, -8, 546, 514 },
+		/* 3f */ { 611, 60, 0, 556, 727 }, { 975, 118, -19, 856, 737 }, { 722, 20, 0, 702, 718 },
+		/* 42 */ { 722, 76, 0, 669, 718 }, { 722, 44, -19, 684, 737 }, { 722, 76, 0, 685, 718 },
+		/* 45 */ { 667, 76, 0, 621, 718 }, { 611, 76, 0, 587, 718 }, { 778, 44, -19, 713, 737 },
+		/* 48 */ { 722, 71, 0, 651, 718 }, { 278, 64, 0, 214, 718 }, { 556, 22, -18, 484, 718 },
+		/* 4b */ { 722, 87, 0, 722, 718 }, { 611, 76, 0, 583, 718 }, { 833, 69, 0, 765, 718 },
+		/* 4e */ { 722, 69, 0, 654, 718 }, { 778, 44, -19, 734, 737 }, { 667, 76, 0, 627, 718 },
+		/* 51 */ { 778, 44, -52, 737, 737 }, { 722, 76, 0, 677, 718 }, { 667, 39, -19, 629, 737 },
+		/* 54 */ { 611, 14, 0, 598, 718 }, { 722, 72, -19, 651, 718 }, { 667, 19, 0, 648, 718 },
+		/* 57 */ { 944, 16, 0, 929, 718 }, { 667, 14, 0, 653, 718 }, { 667, 15, 0, 653, 718 },
+		/* 5a */ { 611, 25, 0, 586, 718 }, { 333, 63, -196, 309, 722 }, { 278, -33, -19, 311, 737 },
+		/* 5d */ { 333, 24, -196, 270, 722 }, { 584, 62, 323, 522, 698 }, { 556, 0, -125, 556, -75 },
+		/* 60 */ { 333, -23, 604, 225, 750 }, { 556, 29, -14, 527, 546 }, { 611, 61, -14, 578, 718 },
+		/* 63 */ { 556, 34, -14, 524, 546 }, { 611, 34, -14, 551, 718 }, { 556, 23, -14, 528, 546 },
+		/* 66 */ { 333, 10, 0, 318, 727 }, { 611, 40, -217, 553, 546 }, { 611, 65, 0, 546, 718 },
+		/* 69 */ { 278, 69, 0, 209, 725 }, { 278, 3, -214, 209, 725 }, { 556, 69, 0, 562, 718 },
+		/* 6c */ { 278, 69, 0, 209, 718 }, { 889, 64, 0, 826, 546 }, { 611, 65, 0, 546, 546 },
+		/* 6f */ { 611, 34, -14, 578, 546 }, { 611, 62, -207, 578, 546 }, { 611, 34, -207, 552, 546 },
+		/* 72 */ { 389, 64, 0, 373, 546 }, { 556, 30, -14, 519, 546 }, { 333, 10, -6, 309, 676 },
+		/* 75 */ { 611, 66, -14, 545, 532 }, { 556, 13, 0, 543, 532 }, { 778, 10, 0, 769, 532 },
+		/* 78 */ { 556, 15, 0, 541, 532 }, { 556, 10, -214, 539, 532 }, { 500, 20, 0, 480, 532 },
+		/* 7b */ { 389, 48, -196, 365, 722 }, { 280, 84, -225, 196, 775 }, { 389, 24, -196, 341, 722 },
+		/* 7e */ { 584, 61, 163, 523, 343 }, { 0, 0, 0, 0, 0 }, { 556, 0, 0, 0, 0 },
+		/* 81 */ { 0, 0, 0, 0, 0 }, { 278, 69, -146, 209, 127 }, { 556, -10, -210, 516, 737 },
+		/* 84 */ { 500, 64, -146, 436, 127 }, { 1000, 92, 0, 908, 146 }, { 556, 36, -171, 520, 718 },
+		/* 87 */ { 556, 36, -171, 520, 718 }, { 333, -10, 604, 343, 750 }, { 1000, -3, -19, 1003, 710 },
+		/* 8a */ { 667, 39, -19, 629, 936 }, { 333, 83, 76, 250, 484 }, { 1000, 37, -19, 961, 737 },
+		/* 8d */ { 0, 0, 0, 0, 0 }, { 611, 25, 0, 586, 936 }, { 0, 0, 0, 0, 0 },
+		/* 90 */ { 0, 0, 0, 0, 0 }, { 278, 69, 454, 209, 727 }, { 278, 69, 445, 209, 718 },
+		/* 93 */ { 500, 64, 454, 436, 727 }, { 500, 64, 445, 436, 718 }, { 350, 10, 194, 340, 524 },
+		/* 96 */ { 556, 0, 227, 556, 333 }, { 1000, 0, 227, 1000, 333 }, { 333, -17, 610, 350, 737 },
+		/* 99 */ { 1000, 44, 306, 956, 718 }, { 556, 30, -14, 519, 750 }, { 333, 83, 76, 250, 484 },
+		/* 9c */ { 944, 34, -14, 912, 546 }, { 0, 0, 0, 0, 0 }, { 500, 20, 0, 480, 750 },
+		/* 9f */ { 667, 15, 0, 653, 915 }, { 278, 0, 0, 0, 0 }, { 333, 90, -186, 244, 532 },
+		/* a2 */ { 556, 34, -118, 524, 628 }, { 556, 28, -16, 541, 718 }, { 556, -3, 76, 559, 636 },
+		/* a5 */ { 556, -9, 0, 565, 698 }, { 280, 84, -150, 196, 700 }, { 556, 34, -184, 522, 727 },
+		/* a8 */ { 333, 6, 614, 327, 729 }, { 737, -11, -19, 749, 737 }, { 370, 22, 401, 347, 737 },
+		/* ab */ { 556, 88, 76, 468, 484 }, { 584, 40, 108, 544, 419 }, { 333, 27, 215, 306, 345 },
+		/* ae */ { 737, -11, -19, 748, 737 }, { 333, -6, 604, 339, 678 }, { 400, 57, 426, 343, 712 },
+		/* b1 */ { 584, 40, 0, 544, 506 }, { 333, 9, 283, 324, 710 }, { 333, 8, 271, 326, 710 },
+		/* b4 */ { 333, 108, 604, 356, 750 }, { 611, 66, -207, 545, 532 }, { 556, -8, -191, 539, 700 },
+		/* b7 */ { 278, 58, 172, 220, 334 }, { 333, 6, -228, 245, 0 }, { 333, 26, 283, 237, 710 },
+		/* ba */ { 365, 6, 401, 360, 737 }, { 556, 88, 76, 468, 484 }, { 834, 26, -19, 766, 710 },
+		/* bd */ { 834, 26, -19, 794, 710 }, { 834, 16, -19, 799, 710 }, { 611, 55, -195, 551, 532 },
+		/* c0 */ { 722, 20, 0, 702, 936 }, { 722, 20, 0, 702, 936 }, { 722, 20, 0, 702, 936 },
+		/* c3 */ { 722, 20, 0, 702, 923 }, { 722, 20, 0, 702, 915 }, { 722, 20, 0, 702, 962 },
+		/* c6 */ { 1000, 5, 0, 954, 718 }, { 722, 44, -228, 684, 737 }, { 667, 76, 0, 621, 936 },
+		/* c9 */ { 667, 76, 0, 621, 936 }, { 667, 76, 0, 621, 936 }, { 667, 76, 0, 621, 915 },
+		/* cc */ { 278, -50, 0, 214, 936 }, { 278, 64, 0, 329, 936 }, { 278, -37, 0, 316, 936 },
+		/* cf */ { 278, -21, 0, 300, 915 }, { 722, -5, 0, 685, 718 }, { 722, 69, 0, 654, 923 },
+		/* d2 */ { 778, 44, -19, 734, 936 }, { 778, 44, -19, 734, 936 }, { 778, 44, -19, 734, 936 },
+		/* d5 */ { 778, 44, -19, 734, 923 }, { 778, 44, -19, 734, 915 }, { 584, 40, 1, 545, 505 },
+		/* d8 */ { 778, 33, -27, 744, 745 }, { 722, 72, -19, 651, 936 }, { 722, 72, -19, 651, 936 },
+		/* db */ { 722, 72, -19, 651, 936 }, { 722, 72, -19, 651, 915 }, { 667, 15, 0, 653, 936 },
+		/* de */ { 667, 76, 0, 627, 718 }, { 611, 69, -14, 579, 731 }, { 556, 29, -14, 527, 750 },
+		/* e1 */ { 556, 29, -14, 527, 750 }, { 556, 29, -14, 527, 750 }, { 556, 29, -14, 527, 737 },
+		/* e4 */ { 556, 29, -14, 527, 729 }, { 556, 29, -14, 527, 776 }, { 889, 29, -14, 858, 546 },
+		/* e7 */ { 556, 34, -228, 524, 546 }, { 556, 23, -14, 528, 750 }, { 556, 23, -14, 528, 750 },
+		/* ea */ { 556, 23, -14, 528, 750 }, { 556, 23, -14, 528, 729 }, { 278, -50, 0, 209, 750 },
+		/* ed */ { 278, 69, 0, 329, 750 }, { 278, -37, 0, 316, 750 }, { 278, -21, 0, 300, 729 },
+		/* f0 */ { 611, 34, -14, 578, 737 }, { 611, 65, 0, 546, 737 }, { 611, 34, -14, 578, 750 },
+		/* f3 */ { 611, 34, -14, 578, 750 }, { 611, 34, -14, 578, 750 }, { 611, 34, -14, 578, 737 },
+		/* f6 */ { 611, 34, -14, 578, 729 }, { 584, 40, -42, 544, 548 }, { 611, 22, -29, 589, 560 },
+		/* f9 */ { 611, 66, -14, 545, 750 }, { 611, 66, -14, 545, 750 }, { 611, 66, -14, 545, 750 },
+		/* fc */ { 611, 66, -14, 545, 729 }, { 556, 10, -214, 539, 750 }, { 611, 62, -208, 578, 718 },
+		/* ff */ { 556, 10, -214, 539, 729 },
+	};
+
+	static constexpr KerningPair HELVETICA_BOLD_KERNING[] = {
+		{ 32, 84, -100 }, { 32, 86, -80 }, { 32, 87, -80 }, { 32, 89, -120 }, { 32, 145, -60 }, { 32, 147, -80 },
+		{ 32, 159, -120 }, { 32, 221, -120 }, { 44, 32, -40 }, { 44, 146, -120 }, { 44, 148, -120 }, { 44, 160, -40 },
+		{ 46, 32, -40 }, { 46, 146, -120 }, { 46, 148, -120 }, { 46, 160, -40 }, { 58, 32, -40 }, { 58, 160, -40 },
+		{ 59, 32, -40 }, { 59, 160, -40 }, { 65, 67, -40 }, { 65, 71, -50 }, { 65, 79, -40 }, { 65, 81, -40 },
+		{ 65, 84, -90 }, { 65, 85, -50 }, { 65, 86, -80 }, { 65, 87, -60 }, { 65, 89, -110 }, { 65, 117, -30 },
+		{ 65, 118, -40 }, { 65, 119, -30 }, { 65, 121, -30 }, { 65, 159, -110 }, { 65, 199, -40 }, { 65, 210, -40 },
+		{ 65, 211, -40 }, { 65, 212, -40 }, { 65, 213, -40 }, { 65, 214, -40 }, { 65, 216, -40 }, { 65, 217, -50 },
+		{ 65, 218, -50 }, { 65, 219, -50 }, { 65, 220, -50 }, { 65, 221, -110 }, { 65, 249, -30 }, { 65, 250, -30 },
+		{ 65, 251, -30 }, { 65, 252, -30 }, { 65, 253, -30 }, { 65, 255, -30 }, { 66, 65, -30 }, { 66, 85, -10 },
+		{ 66, 192, -30 }, { 66, 193, -30 }, { 66, 194, -30 }, { 66, 195, -30 }, { 66, 196, -30 }, { 66, 197, -30 },
+		{ 66, 217, -10 }, { 66, 218, -10 }, { 66, 219, -10 }, { 66, 220, -10 }, { 68, 44, -30 }, { 68, 46, -30 },
+		{ 68, 65, -40 }, { 68, 86, -40 }, { 68, 87, -40 }, { 68, 89, -70 }, { 68, 159, -70 }, { 68, 192, -40 },
+		{ 68, 193, -40 }, { 68, 194, -40 }, { 68, 195, -40 }, { 68, 196, -40 }, { 68, 197, -40 }, { 68, 221, -70 },
+		{ 70, 44, -100 }, { 70, 46, -100 }, { 70, 65, -80 }, { 70, 97, -20 }, { 70, 192, -80 }, { 70, 193, -80 },
+		{ 70, 194, -80 }, { 70, 195, -80 }, { 70, 196, -80 }, { 70, 197, -80 }, { 70, 224, -20 }, { 70, 225, -20 },
+		{ 70, 226, -20 }, { 70, 227, -20 }, { 70, 228, -20 }, { 70, 229, -20 }, { 74, 44, -20 }, { 74, 46, -20 },
+		{ 74, 65, -20 }, { 74, 117, -20 }, { 74, 192, -20 }, { 74, 193, -20 }, { 74, 194, -20 }, { 74, 195, -20 },
+		{ 74, 196, -20 }, { 74, 197, -20 }, { 74, 249, -20 }, { 74, 250, -20 }, { 74, 251, -20 }, { 74, 252, -20 },
+		{ 75, 79, -30 }, { 75, 101, -15 }, { 75, 111, -35 }, { 75, 117, -30 }, { 75, 121, -40 }, { 75, 210, -30 },
+		{ 75, 211, -30 }, { 75, 212, -30 }, { 75, 213, -30 }, { 75, 214, -30 }, { 75, 216, -30 }, { 75, 232, -15 },
+		{ 75, 233, -15 }, { 75, 234, -15 }, { 75, 235, -15 }, { 75, 242, -35 }, { 75, 243, -35 }, { 75, 244, -35 },
+		{ 75, 245, -35 }, { 75, 246, -35 }, { 75, 248, -35 }, { 75, 249, -30 }, { 75, 250, -30 }, { 75, 251, -30 },
+		{ 75, 252, -30 }, { 75, 253, -40 }, { 75, 255, -40 }, { 76, 84, -90 }, { 76, 86, -110 }, { 76, 87, -80 },
+		{ 76, 89, -120 }, { 76, 121, -30 }, { 76, 146, -140 }, { 76, 148, -140 }, { 76, 159, -120 }, { 76, 221, -120 },
+		{ 76, 253, -30 }, { 76, 255, -30 }, { 79, 44, -40 }, { 79, 46, -40 }, { 79, 65, -50 }, { 79, 84, -40 },
+		{ 79, 86, -50 }, { 79, 87, -50 }, { 79, 88, -50 }, { 79, 89, -70 }, { 79, 159, -70 }, { 79, 192, -50 },
+		{ 79, 193, -50 }, { 79, 194, -50 }, { 79, 195, -50 }, { 79, 196, -50 }, { 79, 197, -50 }, { 79, 221, -70 },
+		{ 80, 44, -120 }, { 80, 46, -120 }, { 80, 65, -100 }, { 80, 97, -30 }, { 80, 101, -30 }, { 80, 111, -40 },
+		{ 80, 192, -100 }, { 80, 193, -100 }, { 80, 194, -100 }, { 80, 195, -100 }, { 80, 196, -100 }, { 80, 197, -100 },
+		{ 80, 224, -30 }, { 80, 225, -30 }, { 80, 226, -30 }, { 80, 227, -30 }, { 80, 228, -30 }, { 80, 229, -30 },
+		{ 80, 232, -30 }, { 80, 233, -30 }, { 80, 234, -30 }, { 80, 235, -30 }, { 80, 242, -40 }, { 80, 243, -40 },
+		{ 80, 244, -40 }, { 80, 245, -40 }, { 80, 246, -40 }, { 80, 248, -40 }, { 81, 44, 20 }, { 81, 46, 20 },
+		{ 81, 85, -10 }, { 81, 217, -10 }, { 81, 218, -10 }, { 81, 219, -10 }, { 81, 220, -10 }, { 82, 79, -20 },
+		{ 82, 84, -20 }, { 82, 85, -20 }, { 82, 86, -50 }, { 82, 87, -40 }, { 82, 89, -50 }, { 82, 159, -50 },
+		{ 82, 210, -20 }, { 82, 211, -20 }, { 82, 212, -20 }, { 82, 213, -20 }, { 82, 214, -20 }, { 82, 216, -20 },
+		{ 82, 217, -20 }, { 82, 218, -20 }, { 82, 219, -20 }, { 82, 220, -20 }, { 82, 221, -50 }, { 84, 44, -80 },
+		{ 84, 45, -120 }, { 84, 46, -80 }, { 84, 58, -40 }, { 84, 59, -40 }, { 84, 65, -90 }, { 84, 79, -40 },
+		{ 84, 97, -80 }, { 84, 101, -60 }, { 84, 111, -80 }, { 84, 114, -80 }, { 84, 117, -90 }, { 84, 119, -60 },
+		{ 84, 121, -60 }, { 84, 173, -120 }, { 84, 192, -90 }, { 84, 193, -90 }, { 84, 194, -90 }, { 84, 195, -90 },
+		{ 84, 196, -90 }, { 84, 197, -90 }, { 84, 210, -40 }, { 84, 211, -40 }, { 84, 212, -40 }, { 84, 213, -40 },
+		{ 84, 214, -40 }, { 84, 216, -40 }, { 84, 224, -80 }, { 84, 225, -80 }, { 84, 226, -80 }, { 84, 227, -80 },
+		{ 84, 228, -80 }, { 84, 229, -80 }, { 84, 232, -60 }, { 84, 233, -60 }, { 84, 234, -60 }, { 84, 235, -60 },
+		{ 84, 242, -80 }, { 84, 243, -80 }, { 84, 244, -80 }, { 84, 245, -80 }, { 84, 246, -80 }, { 84, 248, -80 },
+		{ 84, 249, -90 }, { 84, 250, -90 }, { 84, 251, -90 }, { 84, 252, -90 }, { 84, 253, -60 }, { 84, 255, -60 },
+		{ 85, 44, -30 }, { 85, 46, -30 }, { 85, 65, -50 }, { 85, 192, -50 }, { 85, 193, -50 }, { 85, 194, -50 },
+		{ 85, 195, -50 }, { 85, 196, -50 }, { 85, 197, -50 }, { 86, 44, -120 }, { 86, 45, -80 }, { 86, 46, -120 },
+		{ 86, 58, -40 }, { 86, 59, -40 }, { 86, 65, -80 }, { 86, 71, -50 }, { 86, 79, -50 }, { 86, 97, -60 },
+		{ 86, 101, -50 }, { 86, 111, -90 }, { 86, 117, -60 }, { 86, 173, -80 }, { 86, 192, -80 }, { 86, 193, -80 },
+		{ 86, 194, -80 }, { 86, 195, -80 }, { 86, 196, -80 }, { 86, 197, -80 }, { 86, 210, -50 }, { 86, 211, -50 },
+		{ 86, 212, -50 }, { 86, 213, -50 }, { 86, 214, -50 }, { 86, 216, -50 }, { 86, 224, -60 }, { 86, 225, -60 },
+		{ 86, 226, -60 }, { 86, 227, -60 }, { 86, 228, -60 }, { 86, 229, -60 }, { 86, 232, -50 }, { 86, 233, -50 },
+		{ 86, 234, -50 }, { 86, 235, -50 }, { 86, 242, -90 }, { 86, 243, -90 }, { 86, 244, -90 }, { 86, 245, -90 },
+		{ 86, 246, -90 }, { 86, 248, -90 }, { 86, 249, -60 }, { 86, 250, -60 }, { 86, 251, -60 }, { 86, 252, -60 },
+		{ 87, 44, -80 }, { 87, 45, -40 }, { 87, 46, -80 }, { 87, 58, -10 }, { 87, 59, -10 }, { 87, 65, -60 },
+		{ 87, 79, -20 }, { 87, 97, -40 }, { 87, 101, -35 }, { 87, 111, -60 }, { 87, 117, -45 }, { 87, 121, -20 },
+		{ 87, 173, -40 }, { 87, 192, -60 }, { 87, 193, -60 }, { 87, 194, -60 }, { 87, 195, -60 }, { 87, 196, -60 },
+		{ 87, 197, -60 }, { 87, 210, -20 }, { 87, 211, -20 }, { 87, 212, -20 }, { 87, 213, -20 }, { 87, 214, -20 },
+		{ 87, 216, -20 }, { 87, 224, -40 }, { 87, 225, -40 }, { 87, 226, -40 }, { 87, 227, -40 }, { 87, 228, -40 },
+		{ 87, 229, -40 }, { 87, 232, -35 }, { 87, 233, -35 }, { 87, 234, -35 }, { 87, 235, -35 }, { 87, 242, -60 },
+		{ 87, 243, -60 }, { 87, 244, -60 }, { 87, 245, -60 }, { 87, 246, -60 }, { 87, 248, -60 }, { 87, 249, -45 },
+		{ 87, 250, -45 }, { 87, 251, -45 }, { 87, 252, -45 }, { 87, 253, -20 }, { 87, 255, -20 }, { 89, 44, -100 },
+		{ 89, 46, -100 }, { 89, 58, -50 }, { 89, 59, -50 }, { 89, 65, -110 }, { 89, 79, -70 }, { 89, 97, -90 },
+		{ 89, 101, -80 }, { 89, 111, -100 }, { 89, 117, -100 }, { 89, 192, -110 }, { 89, 193, -110 }, { 89, 194, -110 },
+		{ 89, 195, -110 }, { 89, 196, -110 }, { 89, 197, -110 }, { 89, 210, -70 }, { 89, 211, -70 }, { 89, 212, -70 },
+		{ 89, 213, -70 }, { 89, 214, -70 }, { 89, 216, -70 }, { 89, 224, -90 }, { 89, 225, -90 }, { 89, 226, -90 },
+		{ 89, 227, -90 }, { 89, 228, -90 }, { 89, 229, -90 }, { 89, 232, -80 }, { 89, 233, -80 }, { 89, 234, -80 },
+		{ 89, 235, -80 }, { 89, 242, -100 }, { 89, 243, -100 }, { 89, 244, -100 }, { 89, 245, -100 }, { 89, 246, -100 },
+		{ 89, 248, -100 }, { 89, 249, -100 }, { 89, 250, -100 }, { 89, 251, -100 }, { 89, 252, -100 }, { 97, 103, -10 },
+		{ 97, 118, -15 }, { 97, 119, -15 }, { 97, 121, -20 }, { 97, 253, -20 }, { 97, 255, -20 }, { 98, 108, -10 },
+		{ 98, 117, -20 }, { 98, 118, -20 }, { 98, 121, -20 }, { 98, 249, -20 }, { 98, 250, -20 }, { 98, 251, -20 },
+		{ 98, 252, -20 }, { 98, 253, -20 }, { 98, 255, -20 }, { 99, 104, -10 }, { 99, 107, -20 }, { 99, 108, -20 },
+		{ 99, 121, -10 }, { 99, 253, -10 }, { 99, 255, -10 }, { 100, 100, -10 }, { 100, 118, -15 }, { 100, 119, -15 },
+		{ 100, 121, -15 }, { 100, 253, -15 }, { 100, 255, -15 }, { 101, 44, 10 }, { 101, 46, 20 }, { 101, 118, -15 },
+		{ 101, 119, -15 }, { 101, 120, -15 }, { 101, 121, -15 }, { 101, 253, -15 }, { 101, 255, -15 }, { 102, 44, -10 },
+		{ 102, 46, -10 }, { 102, 101, -10 }, { 102, 111, -20 }, { 102, 146, 30 }, { 102, 148, 30 }, { 102, 232, -10 },
+		{ 102, 233, -10 }, { 102, 234, -10 }, { 102, 235, -10 }, { 102, 242, -20 }, { 102, 243, -20 }, { 102, 244, -20 },
+		{ 102, 245, -20 }, { 102, 246, -20 }, { 102, 248, -20 }, { 103, 101, 10 }, { 103, 103, -10 }, { 103, 232, 10 },
+		{ 103, 233, 10 }, { 103, 234, 10 }, { 103, 235, 10 }, { 104, 121, -20 }, { 104, 253, -20 }, { 104, 255, -20 },
+		{ 107, 111, -15 }, { 107, 242, -15 }, { 107, 243, -15 }, { 107, 244, -15 }, { 107, 245, -15 }, { 107, 246, -15 },
+		{ 107, 248, -15 }, { 108, 119, -15 }, { 108, 121, -15 }, { 108, 253, -15 }, { 108, 255, -15 }, { 109, 117, -20 },
+		{ 109, 121, -30 }, { 109, 249, -20 }, { 109, 250, -20 }, { 109, 251, -20 }, { 109, 252, -20 }, { 109, 253, -30 },
+		{ 109, 255, -30 }, { 110, 117, -10 }, { 110, 118, -40 }, { 110, 121, -20 }, { 110, 249, -10 }, { 110, 250, -10 },
+		{ 110, 251, -10 }, { 110, 252, -10 }, { 110, 253, -20 }, { 110, 255, -20 }, { 111, 118, -20 }, { 111, 119, -15 },
+		{ 111, 120, -30 }, { 111, 121, -20 }, { 111, 253, -20 }, { 111, 255, -20 }, { 112, 121, -15 }, { 112, 253, -15 },
+		{ 112, 255, -15 }, { 114, 44, -60 }, { 114, 45, -20 }, { 114, 46, -60 }, { 114, 99, -20 }, { 114, 100, -20 },
+		{ 114, 103, -15 }, { 114, 111, -20 }, { 114, 113, -20 }, { 114, 115, -15 }, { 114, 116, 20 }, { 114, 118, 10 },
+		{ 114, 121, 10 }, { 114, 154, -15 }, { 114, 173, -20 }, { 114, 231, -20 }, { 114, 242, -20 }, { 114, 243, -20 },
+		{ 114, 244, -20 }, { 114, 245, -20 }, { 114, 246, -20 }, { 114, 248, -20 }, { 114, 253, 10 }, { 114, 255, 10 },
+		{ 115, 119, -15 }, { 118, 44, -80 }, { 118, 46, -80 }, { 118, 97, -20 }, { 118, 111, -30 }, { 118, 224, -20 },
+		{ 118, 225, -20 }, { 118, 226, -20 }, { 118, 227, -20 }, { 118, 228, -20 }, { 118, 229, -20 }, { 118, 242, -30 },
+		{ 118, 243, -30 }, { 118, 244, -30 }, { 118, 245, -30 }, { 118, 246, -30 }, { 118, 248, -30 }, { 119, 44, -40 },
+		{ 119, 46, -40 }, { 119, 111, -20 }, { 119, 242, -20 }, { 119, 243, -20 }, { 119, 244, -20 }, { 119, 245, -20 },
+		{ 119, 246, -20 }, { 119, 248, -20 }, { 120, 101, -10 }, { 120, 232, -10 }, { 120, 233, -10 }, { 120, 234, -10 },
+		{ 120, 235, -10 }, { 121, 44, -80 }, { 121, 46, -80 }, { 121, 97, -30 }, { 121, 101, -10 }, { 121, 111, -25 },
+		{ 121, 224, -30 }, { 121, 225, -30 }, { 121, 226, -30 }, { 121, 227, -30 }, { 121, 228, -30 }, { 121, 229, -30 },
+		{ 121, 232, -10 }, { 121, 233, -10 }, { 121, 234, -10 }, { 121, 235, -10 }, { 121, 242, -25 }, { 121, 243, -25 },
+		{ 121, 244, -25 }, { 121, 245, -25 }, { 121, 246, -25 }, { 121, 248, -25 }, { 122, 101, 10 }, { 122, 232, 10 },
+		{ 122, 233, 10 }, { 122, 234, 10 }, { 122, 235, 10 }, { 145, 145, -46 }, { 146, 32, -80 }, { 146, 100, -80 },
+		{ 146, 108, -20 }, { 146, 114, -40 }, { 146, 115, -60 }, { 146, 118, -20 }, { 146, 146, -46 }, { 146, 154, -60 },
+		{ 146, 160, -80 }, { 148, 32, -80 }, { 148, 160, -80 }, { 154, 119, -15 }, { 158, 101, 10 }, { 158, 232, 10 },
+		{ 158, 233, 10 }, { 158, 234, 10 }, { 158, 235, 10 }, { 159, 44, -100 }, { 159, 46, -100 }, { 159, 58, -50 },
+		{ 159, 59, -50 }, { 159, 65, -110 }, { 159, 79, -70 }, { 159, 97, -90 }, { 159, 101, -80 }, { 159, 111, -100 },
+		{ 159, 117, -100 }, { 159, 192, -110 }, { 159, 193, -110 }, { 159, 194, -110 }, { 159, 195, -110 }, { 159, 196, -110 },
+		{ 159, 197, -110 }, { 159, 210, -70 }, { 159, 211, -70 }, { 159, 212, -70 }, { 159, 213, -70 }, { 159, 214, -70 },
+		{ 159, 216, -70 }, { 159, 224, -90 }, { 159, 225, -90 }, { 159, 226, -90 }, { 159, 227, -90 }, { 159, 228, -90 },
+		{ 159, 229, -90 }, { 159, 232, -80 }, { 159, 233, -80 }, { 159, 234, -80 }, { 159, 235, -80 }, { 159, 242, -100 },
+		{ 159, 243, -100 }, { 159, 244, -100 }, { 159, 245, -100 }, { 159, 246, -100 }, { 159, 248, -100 }, { 159, 249, -100 },
+		{ 159, 250, -100 }, { 159, 251, -100 }, { 159, 252, -100 }, { 160, 84, -100 }, { 160, 86, -80 }, { 160, 87, -80 },
+		{ 160, 89, -120 }, { 160, 145, -60 }, { 160, 147, -80 }, { 160, 159, -120 }, { 160, 221, -120 }, { 192, 67, -40 },
+		{ 192, 71, -50 }, { 192, 79, -40 }, { 192, 81, -40 }, { 192, 84, -90 }, { 192, 85, -50 }, { 192, 86, -80 },
+		{ 192, 87, -60 }, { 192, 89, -110 }, { 192, 117, -30 }, { 192, 118, -40 }, { 192, 119, -30 }, { 192, 121, -30 },
+		{ 192, 159, -110 }, { 192, 199, -40 }, { 192, 210, -40 }, { 192, 211, -40 }, { 192, 212, -40 }, { 192, 213, -40 },
+		{ 192, 214, -40 }, { 192, 216, -40 }, { 192, 217, -50 }, { 192, 218, -50 }, { 192, 219, -50 }, { 192, 220, -50 },
+		{ 192, 221, -110 }, { 192, 249, -30 }, { 192, 250, -30 }, { 192, 251, -30 }, { 192, 252, -30 }, { 192, 253, -30 },
+		{ 192, 255, -30 }, { 193, 67, -40 }, { 193, 71, -50 }, { 193, 79, -40 }, { 193, 81, -40 }, { 193, 84, -90 },
+		{ 193, 85, -50 }, { 193, 86, -80 }, { 193, 87, -60 }, { 193, 89, -110 }, { 193, 117, -30 }, { 193, 118, -40 },
+		{ 193, 119, -30 }, { 193, 121, -30 }, { 193, 159, -110 }, { 193, 199, -40 }, { 193, 210, -40 }, { 193, 211, -40 },
+		{ 193, 212, -40 }, { 193, 213, -40 }, { 193, 214, -40 }, { 193, 216, -40 }, { 193, 217, -50 }, { 193, 218, -50 },
+		{ 193, 219, -50 }, { 193, 220, -50 }, { 193, 221, -110 }, { 193, 249, -30 }, { 193, 250, -30 }, { 193, 251, -30 },
+		{ 193, 252, -30 }, { 193, 253, -30 }, { 193, 255, -30 }, { 194, 67, -40 }, { 194, 71, -50 }, { 194, 79, -40 },
+		{ 194, 81, -40 }, { 194, 84, -90 }, { 194, 85, -50 }, { 194, 86, -80 }, { 194, 87, -60 }, { 194, 89, -110 },
+		{ 194, 117, -30 }, { 194, 118, -40 }, { 194, 119, -30 }, { 194, 121, -30 }, { 194, 159, -110 }, { 194, 199, -40 },
+		{ 194, 210, -40 }, { 194, 211, -40 }, { 194, 212, -40 }, { 194, 213, -40 }, { 194, 214, -40 }, { 194, 216, -40 },
+		{ 194, 217, -50 }, { 194, 218, -50 }, { 194, 219, -50 }, { 194, 220, -50 }, { 194, 221, -110 }, { 194, 249, -30 },
+		{ 194, 250, -30 }, { 194, 251, -30 }, { 194, 252, -30 }, { 194, 253, -30 }, { 194, 255, -30 }, { 195, 67, -40 },
+		{ 195, 71, -50 }, { 195, 79, -40 }, { 195, 81, -40 }, { 195, 84, -90 }, { 195, 85, -50 }, { 195, 86, -80 },
+		{ 195, 87, -60 }, { 195, 89, -110 }, { 195, 117, -30 }, { 195, 118, -40 }, { 195, 119, -30 }, { 195, 121, -30 },
+		{ 195, 159, -110 }, { 195, 199, -40 }, { 195, 210, -40 }, { 195, 211, -40 }, { 195, 212, -40 }, { 195, 213, -40 },
+		{ 195, 214, -40 }, { 195, 216, -40 }, { 195, 217, -50 }, { 195, 218, -50 }, { 195, 219, -50 }, { 195, 220, -50 },
+		{ 195, 221, -110 }, { 195, 249, -30 }, { 195, 250, -30 }, { 195, 251, -30 }, { 195, 252, -30 }, { 195, 253, -30 },
+		{ 195, 255, -30 }, { 196, 67, -40 }, { 196, 71, -50 }, { 196, 79, -40 }, { 196, 81, -40 }, { 196, 84, -90 },
+		{ 196, 85, -50 }, { 196, 86, -80 }, { 196, 87, -60 }, { 196, 89, -110 }, { 196, 117, -30 }, { 196, 118, -40 },
+		{ 196, 119, -30 }, { 196, 121, -30 }, { 196, 159, -110 }, { 196, 199, -40 }, { 196, 210, -40 }, { 196, 211, -40 },
+		{ 196, 212, -40 }, { 196, 213, -40 }, { 196, 214, -40 }, { 196, 216, -40 }, { 196, 217, -50 }, { 196, 218, -50 },
+		{ 196, 219, -50 }, { 196, 220, -50 }, { 196, 221, -110 }, { 196, 249, -30 }, { 196, 250, -30 }, { 196, 251, -30 },
+		{ 196, 252, -30 }, { 196, 253, -30 }, { 196, 255, -30 }, { 197, 67, -40 }, { 197, 71, -50 }, { 197, 79, -40 },
+		{ 197, 81, -40 }, { 197, 84, -90 }, { 197, 85, -50 }, { 197, 86, -80 }, { 197, 87, -60 }, { 197, 89, -110 },
+		{ 197, 117, -30 }, { 197, 118, -40 }, { 197, 119, -30 }, { 197, 121, -30 }, { 197, 159, -110 }, { 197, 199, -40 },
+		{ 197, 210, -40 }, { 197, 211, -40 }, { 197, 212, -40 }, { 197, 213, -40 }, { 197, 214, -40 }, { 197, 216, -40 },
+		{ 197, 217, -50 }, { 197, 218, -50 }, { 197, 219, -50 }, { 197, 220, -50 }, { 197, 221, -110 }, { 197, 249, -30 },
+		{ 197, 250, -30 }, { 197, 251, -30 }, { 197, 252, -30 }, { 197, 253, -30 }, { 197, 255, -30 }, { 210, 44, -40 },
+		{ 210, 46, -40 }, { 210, 65, -50 }, { 210, 84, -40 }, { 210, 86, -50 }, { 210, 87, -50 }, { 210, 88, -50 },
+		{ 210, 89, -70 }, { 210, 159, -70 }, { 210, 192, -50 }, { 210, 193, -50 }, { 210, 194, -50 }, { 210, 195, -50 },
+		{ 210, 196, -50 }, { 210, 197, -50 }, { 210, 221, -70 }, { 211, 44, -40 }, { 211, 46, -40 }, { 211, 65, -50 },
+		{ 211, 84, -40 }, { 211, 86, -50 }, { 211, 87, -50 }, { 211, 88, -50 }, { 211, 89, -70 }, { 211, 159, -70 },
+		{ 211, 192, -50 }, { 211, 193, -50 }, { 211, 194, -50 }, { 211, 195, -50 }, { 211, 196, -50 }, { 211, 197, -50 },
+		{ 211, 221, -70 }, { 212, 44, -40 }, { 212, 46, -40 }, { 212, 65, -50 }, { 212, 84, -40 }, { 212, 86, -50 },
+		{ 212, 87, -50 }, { 212, 88, -50 }, { 212, 89, -70 }, { 212, 159, -70 }, { 212, 192, -50 }, { 212, 193, -50 },
+		{ 212, 194, -50 }, { 212, 195, -50 }, { 212, 196, -50 }, { 212, 197, -50 }, { 212, 221, -70 }, { 213, 44, -40 },
+		{ 213, 46, -40 }, { 213, 65, -50 }, { 213, 84, -40 }, { 213, 86, -50 }, { 213, 87, -50 }, { 213, 88, -50 },
+		{ 213, 89, -70 }, { 213, 159, -70 }, { 213, 192, -50 }, { 213, 193, -50 }, { 213, 194, -50 }, { 213, 195, -50 },
+		{ 213, 196, -50 }, { 213, 197, -50 }, { 213, 221, -70 }, { 214, 44, -40 }, { 214, 46, -40 }, { 214, 65, -50 },
+		{ 214, 84, -40 }, { 214, 86, -50 }, { 214, 87, -50 }, { 214, 88, -50 }, { 214, 89, -70 }, { 214, 159, -70 },
+		{ 214, 192, -50 }, { 214, 193, -50 }, { 214, 194, -50 }, { 214, 195, -50 }, { 214, 196, -50 }, { 214, 197, -50 },
+		{ 214, 221, -70 }, { 216, 44, -40 }, { 216, 46, -40 }, { 216, 65, -50 }, { 216, 84, -40 }, { 216, 86, -50 },
+		{ 216, 87, -50 }, { 216, 88, -50 }, { 216, 89, -70 }, { 216, 159, -70 }, { 216, 192, -50 }, { 216, 193, -50 },
+		{ 216, 194, -50 }, { 216, 195, -50 }, { 216, 196, -50 }, { 216, 197, -50 }, { 216, 221, -70 }, { 217, 44, -30 },
+		{ 217, 46, -30 }, { 217, 65, -50 }, { 217, 192, -50 }, { 217, 193, -50 }, { 217, 194, -50 }, { 217, 195, -50 },
+		{ 217, 196, -50 }, { 217, 197, -50 }, { 218, 44, -30 }, { 218, 46, -30 }, { 218, 65, -50 }, { 218, 192, -50 },
+		{ 218, 193, -50 }, { 218, 194, -50 }, { 218, 195, -50 }, { 218, 196, -50 }, { 218, 197, -50 }, { 219, 44, -30 },
+		{ 219, 46, -30 }, { 219, 65, -50 }, { 219, 192, -50 }, { 219, 193, -50 }, { 219, 194, -50 }, { 219, 195, -50 },
+		{ 219, 196, -50 }, { 219, 197, -50 }, { 220, 44, -30 }, { 220, 46, -30 }, { 220, 65, -50 }, { 220, 192, -50 },
+		{ 220, 193, -50 }, { 220, 194, -50 }, { 220, 195, -50 }, { 220, 196, -50 }, { 220, 197, -50 }, { 221, 44, -100 },
+		{ 221, 46, -100 }, { 221, 58, -50 }, { 221, 59, -50 }, { 221, 65, -110 }, { 221, 79, -70 }, { 221, 97, -90 },
+		{ 221, 101, -80 }, { 221, 111, -100 }, { 221, 117, -100 }, { 221, 192, -110 }, { 221, 193, -110 }, { 221, 194, -110 },
+		{ 221, 195, -110 }, { 221, 196, -110 }, { 221, 197, -110 }, { 221, 210, -70 }, { 221, 211, -70 }, { 221, 212, -70 },
+		{ 221, 213, -70 }, { 221, 214, -70 }, { 221, 216, -70 }, { 221, 224, -90 }, { 221, 225, -90 }, { 221, 226, -90 },
+		{ 221, 227, -90 }, { 221, 228, -90 }, { 221, 229, -90 }, { 221, 232, -80 }, { 221, 233, -80 }, { 221, 234, -80 },
+		{ 221, 235, -80 }, { 221, 242, -100 }, { 221, 243, -100 }, { 221, 244, -100 }, { 221, 245, -100 }, { 221, 246, -100 },
+		{ 221, 248, -100 }, { 221, 249, -100 }, { 221, 250, -100 }, { 221, 251, -100 }, { 221, 252, -100 }, { 224, 103, -10 },
+		{ 224, 118, -15 }, { 224, 119, -15 }, { 224, 121, -20 }, { 224, 253, -20 }, { 224, 255, -20 }, { 225, 103, -10 },
+		{ 225, 118, -15 }, { 225, 119, -15 }, { 225, 121, -20 }, { 225, 253, -20 }, { 225, 255, -20 }, { 226, 103, -10 },
+		{ 226, 118, -15 }, { 226, 119, -15 }, { 226, 121, -20 }, { 226, 253, -20 }, { 226, 255, -20 }, { 227, 103, -10 },
+		{ 227, 118, -15 }, { 227, 119, -15 }, { 227, 121, -20 }, { 227, 253, -20 }, { 227, 255, -20 }, { 228, 103, -10 },
+		{ 228, 118, -15 }, { 228, 119, -15 }, { 228, 121, -20 }, { 228, 253, -20 }, { 228, 255, -20 }, { 229, 103, -10 },
+		{ 229, 118, -15 }, { 229, 119, -15 }, { 229, 121, -20 }, { 229, 253, -20 }, { 229, 255, -20 }, { 231, 104, -10 },
+		{ 231, 107, -20 }, { 231, 108, -20 }, { 231, 121, -10 }, { 231, 253, -10 }, { 231, 255, -10 }, { 232, 44, 10 },
+		{ 232, 46, 20 }, { 232, 118, -15 }, { 232, 119, -15 }, { 232, 120, -15 }, { 232, 121, -15 }, { 232, 253, -15 },
+		{ 232, 255, -15 }, { 233, 44, 10 }, { 233, 46, 20 }, { 233, 118, -15 }, { 233, 119, -15 }, { 233, 120, -15 },
+		{ 233, 121, -15 }, { 233, 253, -15 }, { 233, 255, -15 }, { 234, 44, 10 }, { 234, 46, 20 }, { 234, 118, -15 },
+		{ 234, 119, -15 }, { 234, 120, -15 }, { 234, 121, -15 }, { 234, 253, -15 }, { 234, 255, -15 }, { 235, 44, 10 },
+		{ 235, 46, 20 }, { 235, 118, -15 }, { 235, 119, -15 }, { 235, 120, -15 }, { 235, 121, -15 }, { 235, 253, -15 },
+		{ 235, 255, -15 }, { 241, 117, -10 }, { 241, 118, -40 }, { 241, 121, -20 }, { 241, 249, -10 }, { 241, 250, -10 },
+		{ 241, 251, -10 }, { 241, 252, -10 }, { 241, 253, -20 }, { 241, 255, -20 }, { 242, 118, -20 }, { 242, 119, -15 },
+		{ 242, 120, -30 }, { 242, 121, -20 }, { 242, 253, -20 }, { 242, 255, -20 }, { 243, 118, -20 }, { 243, 119, -15 },
+		{ 243, 120, -30 }, { 243, 121, -20 }, { 243, 253, -20 }, { 243, 255, -20 }, { 244, 118, -20 }, { 244, 119, -15 },
+		{ 244, 120, -30 }, { 244, 121, -20 }, { 244, 253, -20 }, { 244, 255, -20 }, { 245, 118, -20 }, { 245, 119, -15 },
+		{ 245, 120, -30 }, { 245, 121, -20 }, { 245, 253, -20 }, { 245, 255, -20 }, { 246, 118, -20 }, { 246, 119, -15 },
+		{ 246, 120, -30 }, { 246, 121, -20 }, { 246, 253, -20 }, { 246, 255, -20 }, { 248, 118, -20 }, { 248, 119, -15 },
+		{ 248, 120, -30 }, { 248, 121, -20 }, { 248, 253, -20 }, { 248, 255, -20 }, { 253, 44, -80 }, { 253, 46, -80 },
+		{ 253, 97, -30 }, { 253, 101, -10 }, { 253, 111, -25 }, { 253, 224, -30 }, { 253, 225, -30 }, { 253, 226, -30 },
+		{ 253, 227, -30 }, { 253, 228, -30 }, { 253, 229, -30 }, { 253, 232, -10 }, { 253, 233, -10 }, { 253, 234, -10 },
+		{ 253, 235, -10 }, { 253, 242, -25 }, { 253, 243, -25 }, { 253, 244, -25 }, { 253, 245, -25 }, { 253, 246, -25 },
+		{ 253, 248, -25 }, { 255, 44, -80 }, { 255, 46, -80 }, { 255, 97, -30 }, { 255, 101, -10 }, { 255, 111, -25 },
+		{ 255, 224, -30 }, { 255, 225, -30 }, { 255, 226, -30 }, { 255, 227, -30 }, { 255, 228, -30 }, { 255, 229, -30 },
+		{ 255, 232, -10 }, { 255, 233, -10 }, { 255, 234, -10 }, { 255, 235, -10 }, { 255, 242, -25 }, { 255, 243, -25 },
+		{ 255, 244, -25 }, { 255, 245, -25 }, { 255, 246, -25 }, { 255, 248, -25 },
+	};
+
+	static constexpr GlyphMetrics HELVETICA_BOLDOBLIQUE_GLYPHS[256] = {
+		/* 00 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 03 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 06 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 09 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0f */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 12 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 15 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 18 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1b */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 278, 0, 0, 0, 0 },
+		/* 21 */ { 333, 94, 0, 397, 718 }, { 474, 193, 447, 529, 718 }, { 556, 60, 0, 644, 698 },
+		/* 24 */ { 556, 67, -115, 622, 775 }, { 889, 136, -19, 901, 710 }, { 722, 89, -19, 732, 718 },
+		/* 27 */ { 238, 165, 447, 321, 718 }, { 333, 76, -208, 470, 734 }, { 333, -25, -208, 369, 734 },
+		/* 2a */ { 389, 146, 387, 481, 718 }, { 584, 82, 0, 610, 506 }, { 278, 28, -168, 245, 146 },
+		/* 2d */ { 333, 73, 215, 379, 345 }, { 278, 64, 0, 245, 146 }, { 278, -37, -19, 468, 737 },
+		/* 30 */ { 556, 86, -19, 617, 710 }, { 556, 173, 0, 529, 710 }, { 556, 26, 0, 619, 710 },
+		/* 33 */ { 556, 65, -19, 608, 710 }, { 556, 60, 0, 598, 710 }, { 556, 64, -19, 636, 698 },
+		/* 36 */ { 556, 85, -19, 619, 710 }, { 556, 125, 0, 676, 698 }, { 556, 69, -19, 616, 710 },
+		/* 39 */ { 556, 78, -19, 615, 710 }, { 333, 92, 0, 351, 512 }, { 333, 56, -168, 351, 512 },
+		/* 3c */ { 584, 82, -8, 655, 514 }, { 584, 58, 87, 633, 419 }, { 584, 36, -8, 609, 514 },
+		/* 3f */ { 611, 165, 0, 671, 727 }, { 975, 186, -19, 954, 737 }, { 722, 20, 0, 702, 718 },
+		/* 42 */ { 722, 76, 0, 764, 718 }, { 722, 107, -19, 789, 737 }, { 722, 76, 0, 777, 718 },
+		/* 45 */ { 667, 76, 0, 757, 718 }, { 611, 76, 0, 740, 718 }, { 778, 108, -19, 817, 737 },
+		/* 48 */ { 722, 71, 0, 804, 718 }, { 278, 64, 0, 367, 718 }, { 556, 60, -18, 637, 718 },
+		/* 4b */ { 722, 87, 0, 858, 718 }, { 611, 76, 0, 611, 718 }, { 833, 69, 0, 918, 718 },
+		/* 4e */ { 722, 69, 0, 807, 718 }, { 778, 107, -19, 823, 737 }, { 667, 76, 0, 738, 718 },
+		/* 51 */ { 778, 107, -52, 823, 737 }, { 722, 76, 0, 778, 718 }, { 667, 81, -19, 718, 737 },
+		/* 54 */ { 611, 140, 0, 751, 718 }, { 722, 116, -19, 804, 718 }, { 667, 172, 0, 801, 718 },
+		/* 57 */ { 944, 169, 0, 1082, 718 }, { 667, 14, 0, 791, 718 }, { 667, 168, 0, 806, 718 },
+		/* 5a */ { 611, 25, 0, 737, 718 }, { 333, 21, -196, 462, 722 }, { 278, 124, -19, 307, 737 },
+		/* 5d */ { 333, -18, -196, 423, 722 }, { 584, 131, 323, 591, 698 }, { 556, -27, -125, 540, -75 },
+		/* 60 */ { 333, 136, 604, 353, 750 }, { 556, 55, -14, 583, 546 }, { 611, 61, -14, 645, 718 },
+		/* 63 */ { 556, 79, -14, 599, 546 }, { 611, 82, -14, 704, 718 }, { 556, 70, -14, 593, 546 },
+		/* 66 */ { 333, 87, 0, 469, 727 }, { 611, 38, -217, 666, 546 }, { 611, 65, 0, 629, 718 },
+		/* 69 */ { 278, 69, 0, 363, 725 }, { 278, -42, -214, 363, 725 }, { 556, 69, 0, 670, 718 },
+		/* 6c */ { 278, 69, 0, 362, 718 }, { 889, 64, 0, 909, 546 }, { 611, 65, 0, 629, 546 },
+		/* 6f */ { 611, 82, -14, 643, 546 }, { 611, 18, -207, 645, 546 }, { 611, 80, -207, 665, 546 },
+		/* 72 */ { 389, 64, 0, 489, 546 }, { 556, 63, -14, 584, 546 }, { 333, 100, -6, 422, 676 },
+		/* 75 */ { 611, 98, -14, 658, 532 }, { 556, 126, 0, 656, 532 }, { 778, 123, 0, 882, 532 },
+		/* 78 */ { 556, 15, 0, 648, 532 }, { 556, 42, -214, 652, 532 }, { 500, 20, 0, 583, 532 },
+		/* 7b */ { 389, 94, -196, 518, 722 }, { 280, 36, -225, 361, 775 }, { 389, -18, -196, 407, 722 },
+		/* 7e */ { 584, 115, 163, 577, 343 }, { 0, 0, 0, 0, 0 }, { 556, 0, 0, 0, 0 },
+		/* 81 */ { 0, 0, 0, 0, 0 }, { 278, 41, -146, 236, 127 }, { 556, -50, -210, 669, 737 },
+		/* 84 */ { 500, 36, -146, 463, 127 }, { 1000, 92, 0, 939, 146 }, { 556, 118, -171, 626, 718 },
+		/* 87 */ { 556, 46, -171, 628, 718 }, { 333, 118, 604, 471, 750 }, { 1000, 76, -19, 1038, 710 },
+		/* 8a */ { 667, 81, -19, 718, 936 }, { 333, 130, 76, 353, 484 }, { 1000, 99, -19, 1114, 737 },
+		/* 8d */ { 0, 0, 0, 0, 0 }, { 611, 25, 0, 737, 936 }, { 0, 0, 0, 0, 0 },
+		/* 90 */ { 0, 0, 0, 0, 0 }, { 278, 165, 454, 361, 727 }, { 278, 167, 445, 362, 718 },
+		/* 93 */ { 500, 160, 454, 588, 727 }, { 500, 162, 445, 589, 718 }, { 350, 83, 194, 420, 524 },
+		/* 96 */ { 556, 48, 227, 627, 333 }, { 1000, 48, 227, 1071, 333 }, { 333, 113, 610, 507, 737 },
+		/* 99 */ { 1000, 179, 306, 1109, 718 }, { 556, 63, -14, 614, 750 }, { 333, 99, 76, 322, 484 },
+		/* 9c */ { 944, 82, -14, 977, 546 }, { 0, 0, 0, 0, 0 }, { 500, 20, 0, 586, 750 },
+		/* 9f */ { 667, 168, 0, 806, 915 }, { 278, 0, 0, 0, 0 }, { 333, 50, -186, 353, 532 },
+		/* a2 */ { 556, 79, -118, 599, 628 }, { 556, 50, -16, 635, 718 }, { 556, 27, 76, 680, 636 },
+		/* a5 */ { 556, 60, 0, 713, 698 }, { 280, 52, -150, 345, 700 }, { 556, 61, -184, 598, 727 },
+		/* a8 */ { 333, 137, 614, 482, 729 }, { 737, 56, -19, 835, 737 }, { 370, 125, 401, 465, 737 },
+		/* ab */ { 556, 135, 76, 571, 484 }, { 584, 105, 108, 633, 419 }, { 333, 73, 215, 379, 345 },
+		/* ae */ { 737, 55, -19, 834, 737 }, { 333, 122, 604, 483, 678 }, { 400, 175, 426, 467, 712 },
+		/* b1 */ { 584, 40, 0, 625, 506 }, { 333, 69, 283, 449, 710 }, { 333, 91, 271, 441, 710 },
+		/* b4 */ { 333, 236, 604, 515, 750 }, { 611, 22, -207, 658, 532 }, { 556, 98, -191, 688, 700 },
+		/* b7 */ { 278, 110, 172, 276, 334 }, { 333, -37, -228, 220, 0 }, { 333, 148, 283, 388, 710 },
+		/* ba */ { 365, 123, 401, 485, 737 }, { 556, 104, 76, 540, 484 }, { 834, 132, -19, 806, 710 },
+		/* bd */ { 834, 132, -19, 858, 710 }, { 834, 99, -19, 839, 710 }, { 611, 53, -195, 559, 532 },
+		/* c0 */ { 722, 20, 0, 702, 936 }, { 722, 20, 0, 750, 936 }, { 722, 20, 0, 706, 936 },
+		/* c3 */ { 722, 20, 0, 741, 923 }, { 722, 20, 0, 716, 915 }, { 722, 20, 0, 702, 962 },
+		/* c6 */ { 1000, 5, 0, 1100, 718 }, { 722, 107, -228, 789, 737 }, { 667, 76, 0, 757, 936 },
+		/* c9 */ { 667, 76, 0, 757, 936 }, { 667, 76, 0, 757, 936 }, { 667, 76, 0, 757, 915 },
+		/* cc */ { 278, 64, 0, 367, 936 }, { 278, 64, 0, 528, 936 }, { 278, 64, 0, 484, 936 },
+		/* cf */ { 278, 64, 0, 494, 915 }, { 722, 62, 0, 777, 718 }, { 722, 69, 0, 807, 923 },
+		/* d2 */ { 778, 107, -19, 823, 936 }, { 778, 107, -19, 823, 936 }, { 778, 107, -19, 823, 936 },
+		/* d5 */ { 778, 107, -19, 823, 923 }, { 778, 107, -19, 823, 915 }, { 584, 57, 1, 635, 505 },
+		/* d8 */ { 778, 35, -27, 894, 745 }, { 722, 116, -19, 804, 936 }, { 722, 116, -19, 804, 936 },
+		/* db */ { 722, 116, -19, 804, 936 }, { 722, 116, -19, 804, 915 }, { 667, 168, 0, 806, 936 },
+		/* de */ { 667, 76, 0, 716, 718 }, { 611, 69, -14, 657, 731 }, { 556, 55, -14, 583, 750 },
+		/* e1 */ { 556, 55, -14, 627, 750 }, { 556, 55, -14, 583, 750 }, { 556, 55, -14, 619, 737 },
+		/* e4 */ { 556, 55, -14, 594, 729 }, { 556, 55, -14, 583, 776 }, { 889, 56, -14, 923, 546 },
+		/* e7 */ { 556, 79, -228, 599, 546 }, { 556, 70, -14, 593, 750 }, { 556, 70, -14, 627, 750 },
+		/* ea */ { 556, 70, -14, 593, 750 }, { 556, 70, -14, 594, 729 }, { 278, 69, 0, 326, 750 },
+		/* ed */ { 278, 69, 0, 488, 750 }, { 278, 69, 0, 444, 750 }, { 278, 69, 0, 455, 729 },
+		/* f0 */ { 611, 82, -14, 670, 737 }, { 611, 65, 0, 646, 737 }, { 611, 82, -14, 643, 750 },
+		/* f3 */ { 611, 82, -14, 654, 750 }, { 611, 82, -14, 643, 750 }, { 611, 82, -14, 646, 737 },
+		/* f6 */ { 611, 82, -14, 643, 729 }, { 584, 82, -42, 610, 548 }, { 611, 22, -29, 701, 560 },
+		/* f9 */ { 611, 98, -14, 658, 750 }, { 611, 98, -14, 658, 750 }, { 611, 98, -14, 658, 750 },
+		/* fc */ { 611, 98, -14, 658, 729 }, { 556, 42, -214, 652, 750 }, { 611, 18, -208, 645, 718 },
+		/* ff */ { 556, 42, -214, 652, 729 },
+	};
+
+	static constexpr KerningPair HELVETICA_BOLDOBLIQUE_KERNING[] = {
+		{ 32, 84, -100 }, { 32, 86, -80 }, { 32, 87, -80 }, { 32, 89, -120 }, { 32, 145, -60 }, { 32, 147, -80 },
+		{ 32, 159, -120 }, { 32, 221, -120 }, { 44, 32, -40 }, { 44, 146, -120 }, { 44, 148, -120 }, { 44, 160, -40 },
+		{ 46, 32, -40 }, { 46, 146, -120 }, { 46, 148, -120 }, { 46, 160, -40 }, { 58, 32, -40 }, { 58, 160, -40 },
+		{ 59, 32, -40 }, { 59, 160, -40 }, { 65, 67, -40 }, { 65, 71, -50 }, { 65, 79, -40 }, { 65, 81, -40 },
+		{ 65, 84, -90 }, { 65, 85, -50 }, { 65, 86, -80 }, { 65, 87, -60 }, { 65, 89, -110 }, { 65, 117, -30 },
+		{ 65, 118, -40 }, { 65, 119, -30 }, { 65, 121, -30 }, { 65, 159, -110 }, { 65, 199, -40 }, { 65, 210, -40 },
+		{ 65, 211, -40 }, { 65, 212, -40 }, { 65, 213, -40 }, { 65, 214, -40 }, { 65, 216, -40 }, { 65, 217, -50 },
+		{ 65, 218, -50 }, { 65, 219, -50 }, { 65, 220, -50 }, { 65, 221, -110 }, { 65, 249, -30 }, { 65, 250, -30 },
+		{ 65, 251, -30 }, { 65, 252, -30 }, { 65, 253, -30 }, { 65, 255, -30 }, { 66, 65, -30 }, { 66, 85, -10 },
+		{ 66, 192, -30 }, { 66, 193, -30 }, { 66, 194, -30 }, { 66, 195, -30 }, { 66, 196, -30 }, { 66, 197, -30 },
+		{ 66, 217, -10 }, { 66, 218, -10 }, { 66, 219, -10 }, { 66, 220, -10 }, { 68, 44, -30 }, { 68, 46, -30 },
+		{ 68, 65, -40 }, { 68, 86, -40 }, { 68, 87, -40 }, { 68, 89, -70 }, { 68, 159, -70 }, { 68, 192, -40 },
+		{ 68, 193, -40 }, { 68, 194, -40 }, { 68, 195, -40 }, { 68, 196, -40 }, { 68, 197, -40 }, { 68, 221, -70 },
+		{ 70, 44, -100 }, { 70, 46, -100 }, { 70, 65, -80 }, { 70, 97, -20 }, { 70, 192, -80 }, { 70, 193, -80 },
+		{ 70, 194, -80 }, { 70, 195, -80 }, { 70, 196, -80 }, { 70, 197, -80 }, { 70, 224, -20 }, { 70, 225, -20 },
+		{ 70, 226, -20 }, { 70, 227, -20 }, { 70, 228, -20 }, { 70, 229, -20 }, { 74, 44, -20 }, { 74, 46, -20 },
+		{ 74, 65, -20 }, { 74, 117, -20 }, { 74, 192, -20 }, { 74, 193, -20 }, { 74, 194, -20 }, { 74, 195, -20 },
+		{ 74, 196, -20 }, { 74, 197, -20 }, { 74, 249, -20 }, { 74, 250, -20 }, { 74, 251, -20 }, { 74, 252, -20 },
+		{ 75, 79, -30 }, { 75, 101, -15 }, { 75, 111, -35 }, { 75, 117, -30 }, { 75, 121, -40 }, { 75, 210, -30 },
+		{ 75, 211, -30 }, { 75, 212, -30 }, { 75, 213, -30 }, { 75, 214, -30 }, { 75, 216, -30 }, { 75, 232, -15 },
+		{ 75, 233, -15 }, { 75, 234, -15 }, { 75, 235, -15 }, { 75, 242, -35 }, { 75, 243, -35 }, { 75, 244, -35 },
+		{ 75, 245, -35 }, { 75, 246, -35 }, { 75, 248, -35 }, { 75, 249, -30 }, { 75, 250, -30 }, { 75, 251, -30 },
+		{ 75, 252, -30 }, { 75, 253, -40 }, { 75, 255, -40 }, { 76, 84, -90 }, { 76, 86, -110 }, { 76, 87, -80 },
+		{ 76, 89, -120 }, { 76, 121, -30 }, { 76, 146, -140 }, { 76, 148, -140 }, { 76, 159, -120 }, { 76, 221, -120 },
+		{ 76, 253, -30 }, { 76, 255, -30 }, { 79, 44, -40 }, { 79, 46, -40 }, { 79, 65, -50 }, { 79, 84, -40 },
+		{ 79, 86, -50 }, { 79, 87, -50 }, { 79, 88, -50 }, { 79, 89, -70 }, { 79, 159, -70 }, { 79, 192, -50 },
+		{ 79, 193, -50 }, { 79, 194, -50 }, { 79, 195, -50 }, { 79, 196, -50 }, { 79, 197, -50 }, { 79, 221, -70 },
+		{ 80, 44, -120 }, { 80, 46, -120 }, { 80, 65, -100 }, { 80, 97, -30 }, { 80, 101, -30 }, { 80, 111, -40 },
+		{ 80, 192, -100 }, { 80, 193, -100 }, { 80, 194, -100 }, { 80, 195, -100 }, { 80, 196, -100 }, { 80, 197, -100 },
+		{ 80, 224, -30 }, { 80, 225, -30 }, { 80, 226, -30 }, { 80, 227, -30 }, { 80, 228, -30 }, { 80, 229, -30 },
+		{ 80, 232, -30 }, { 80, 233, -30 }, { 80, 234, -30 }, { 80, 235, -30 }, { 80, 242, -40 }, { 80, 243, -40 },
+		{ 80, 244, -40 }, { 80, 245, -40 }, { 80, 246, -40 }, { 80, 248, -40 }, { 81, 44, 20 }, { 81, 46, 20 },
+		{ 81, 85, -10 }, { 81, 217, -10 }, { 81, 218, -10 }, { 81, 219, -10 }, { 81, 220, -10 }, { 82, 79, -20 },
+		{ 82, 84, -20 }, { 82, 85, -20 }, { 82, 86, -50 }, { 82, 87, -40 }, { 82, 89, -50 }, { 82, 159, -50 },
+		{ 82, 210, -20 }, { 82, 211, -20 }, { 82, 212, -20 }, { 82, 213, -20 }, { 82, 214, -20 }, { 82, 216, -20 },
+		{ 82, 217, -20 }, { 82, 218, -20 }, { 82, 219, -20 }, { 82, 220, -20 }, { 82, 221, -50 }, { 84, 44, -80 },
+		{ 84, 45, -120 }, { 84, 46, -80 }, { 84, 58, -40 }, { 84, 59, -40 }, { 84, 65, -90 }, { 84, 79, -40 },
+		{ 84, 97, -80 }, { 84, 101, -60 }, { 84, 111, -80 }, { 84, 114, -80 }, { 84, 117, -90 }, { 84, 119, -60 },
+		{ 84, 121, -60 }, { 84, 173, -120 }, { 84, 192, -90 }, { 84, 193, -90 }, { 84, 194, -90 }, { 84, 195, -90 },
+		{ 84, 196, -90 }, { 84, 197, -90 }, { 84, 210, -40 }, { 84, 211, -40 }, { 84, 212, -40 }, { 84, 213, -40 },
+		{ 84, 214, -40 }, { 84, 216, -40 }, { 84, 224, -80 }, { 84, 225, -80 }, { 84, 226, -80 }, { 84, 227, -80 },
+		{ 84, 228, -80 }, { 84, 229, -80 }, { 84, 232, -60 }, { 84, 233, -60 }, { 84, 234, -60 }, { 84, 235, -60 },
+		{ 84, 242, -80 }, { 84, 243, -80 }, { 84, 244, -80 }, { 84, 245, -80 }, { 84, 246, -80 }, { 84, 248, -80 },
+		{ 84, 249, -90 }, { 84, 250, -90 }, { 84, 251, -90 }, { 84, 252, -90 }, { 84, 253, -60 }, { 84, 255, -60 },
+		{ 85, 44, -30 }, { 85, 46, -30 }, { 85, 65, -50 }, { 85, 192, -50 }, { 85, 193, -50 }, { 85, 194, -50 },
+		{ 85, 195, -50 }, { 85, 196, -50 }, { 85, 197, -50 }, { 86, 44, -120 }, { 86, 45, -80 }, { 86, 46, -120 },
+		{ 86, 58, -40 }, { 86, 59, -40 }, { 86, 65, -80 }, { 86, 71, -50 }, { 86, 79, -50 }, { 86, 97, -60 },
+		{ 86, 101, -50 }, { 86, 111, -90 }, { 86, 117, -60 }, { 86, 173, -80 }, { 86, 192, -80 }, { 86, 193, -80 },
+		{ 86, 194, -80 }, { 86, 195, -80 }, { 86, 196, -80 }, { 86, 197, -80 }, { 86, 210, -50 }, { 86, 211, -50 },
+		{ 86, 212, -50 }, { 86, 213, -50 }, { 86, 214, -50 }, { 86, 216, -50 }, { 86, 224, -60 }, { 86, 225, -60 },
+		{ 86, 226, -60 }, { 86, 227, -60 }, { 86, 228, -60 }, { 86, 229, -60 }, { 86, 232, -50 }, { 86, 233, -50 },
+		{ 86, 234, -50 }, { 86, 235, -50 }, { 86, 242, -90 }, { 86, 243, -90 }, { 86, 244, -90 }, { 86, 245, -90 },
+		{ 86, 246, -90 }, { 86, 248, -90 }, { 86, 249, -60 }, { 86, 250, -60 }, { 86, 251, -60 }, { 86, 252, -60 },
+		{ 87, 44, -80 }, { 87, 45, -40 }, { 87, 46, -80 }, { 87, 58, -10 }, { 87, 59, -10 }, { 87, 65, -60 },
+		{ 87, 79, -20 }, { 87, 97, -40 }, { 87, 101, -35 }, { 87, 111, -60 }, { 87, 117, -45 }, { 87, 121, -20 },
+		{ 87, 173, -40 }, { 87, 192, -60 }, { 87, 193, -60 }, { 87, 194, -60 }, { 87, 195, -60 }, { 87, 196, -60 },
+		{ 87, 197, -60 }, { 87, 210, -20 }, { 87, 211, -20 }, { 87, 212, -20 }, { 87, 213, -20 }, { 87, 214, -20 },
+		{ 87, 216, -20 }, { 87, 224, -40 }, { 87, 225, -40 }, { 87, 226, -40 }, { 87, 227, -40 }, { 87, 228, -40 },
+		{ 87, 229, -40 }, { 87, 232, -35 }, { 87, 233, -35 }, { 87, 234, -35 }, { 87, 235, -35 }, { 87, 242, -60 },
+		{ 87, 243, -60 }, { 87, 244, -60 }, { 87, 245, -60 }, { 87, 246, -60 }, { 87, 248, -60 }, { 87, 249, -45 },
+		{ 87, 250, -45 }, { 87, 251, -45 }, { 87, 252, -45 }, { 87, 253, -20 }, { 87, 255, -20 }, { 89, 44, -100 },
+		{ 89, 46, -100 }, { 89, 58, -50 }, { 89, 59, -50 }, { 89, 65, -110 }, { 89, 79, -70 }, { 89, 97, -90 },
+		{ 89, 101, -80 }, { 89, 111, -100 }, { 89, 117, -100 }, { 89, 192, -110 }, { 89, 193, -110 }, { 89, 194, -110 },
+		{ 89, 195, -110 }, { 89, 196, -110 }, { 89, 197, -110 }, { 89, 210, -70 }, { 89, 211, -70 }, { 89, 212, -70 },
+		{ 89, 213, -70 }, { 89, 214, -70 }, { 89, 216, -70 }, { 89, 224, -90 }, { 89, 225, -90 }, { 89, 226, -90 },
+		{ 89, 227, -90 }, { 89, 228, -90 }, { 89, 229, -90 }, { 89, 232, -80 }, { 89, 233, -80 }, { 89, 234, -80 },
+		{ 89, 235, -80 }, { 89, 242, -100 }, { 89, 243, -100 }, { 89, 244, -100 }, { 89, 245, -100 }, { 89, 246, -100 },
+		{ 89, 248, -100 }, { 89, 249, -100 }, { 89, 250, -100 }, { 89, 251, -100 }, { 89, 252, -100 }, { 97, 103, -10 },
+		{ 97, 118, -15 }, { 97, 119, -15 }, { 97, 121, -20 }, { 97, 253, -20 }, { 97, 255, -20 }, { 98, 108, -10 },
+		{ 98, 117, -20 }, { 98, 118, -20 }, { 98, 121, -20 }, { 98, 249, -20 }, { 98, 250, -20 }, { 98, 251, -20 },
+		{ 98, 252, -20 }, { 98, 253, -20 }, { 98, 255, -20 }, { 99, 104, -10 }, { 99, 107, -20 }, { 99, 108, -20 },
+		{ 99, 121, -10 }, { 99, 253, -10 }, { 99, 255, -10 }, { 100, 100, -10 }, { 100, 118, -15 }, { 100, 119, -15 },
+		{ 100, 121, -15 }, { 100, 253, -15 }, { 100, 255, -15 }, { 101, 44, 10 }, { 101, 46, 20 }, { 101, 118, -15 },
+		{ 101, 119, -15 }, { 101, 120, -15 }, { 101, 121, -15 }, { 101, 253, -15 }, { 101, 255, -15 }, { 102, 44, -10 },
+		{ 102, 46, -10 }, { 102, 101, -10 }, { 102, 111, -20 }, { 102, 146, 30 }, { 102, 148, 30 }, { 102, 232, -10 },
+		{ 102, 233, -10 }, { 102, 234, -10 }, { 102, 235, -10 }, { 102, 242, -20 }, { 102, 243, -20 }, { 102, 244, -20 },
+		{ 102, 245, -20 }, { 102, 246, -20 }, { 102, 248, -20 }, { 103, 101, 10 }, { 103, 103, -10 }, { 103, 232, 10 },
+		{ 103, 233, 10 }, { 103, 234, 10 }, { 103, 235, 10 }, { 104, 121, -20 }, { 104, 253, -20 }, { 104, 255, -20 },
+		{ 107, 111, -15 }, { 107, 242, -15 }, { 107, 243, -15 }, { 107, 244, -15 }, { 107, 245, -15 }, { 107, 246, -15 },
+		{ 107, 248, -15 }, { 108, 119, -15 }, { 108, 121, -15 }, { 108, 253, -15 }, { 108, 255, -15 }, { 109, 117, -20 },
+		{ 109, 121, -30 }, { 109, 249, -20 }, { 109, 250, -20 }, { 109, 251, -20 }, { 109, 252, -20 }, { 109, 253, -30 },
+		{ 109, 255, -30 }, { 110, 117, -10 }, { 110, 118, -40 }, { 110, 121, -20 }, { 110, 249, -10 }, { 110, 250, -10 },
+		{ 110, 251, -10 }, { 110, 252, -10 }, { 110, 253, -20 }, { 110, 255, -20 }, { 111, 118, -20 }, { 111, 119, -15 },
+		{ 111, 120, -30 }, { 111, 121, -20 }, { 111, 253, -20 }, { 111, 255, -20 }, { 112, 121, -15 }, { 112, 253, -15 },
+		{ 112, 255, -15 }, { 114, 44, -60 }, { 114, 45, -20 }, { 114, 46, -60 }, { 114, 99, -20 }, { 114, 100, -20 },
+		{ 114, 103, -15 }, { 114, 111, -20 }, { 114, 113, -20 }, { 114, 115, -15 }, { 114, 116, 20 }, { 114, 118, 10 },
+		{ 114, 121, 10 }, { 114, 154, -15 }, { 114, 173, -20 }, { 114, 231, -20 }, { 114, 242, -20 }, { 114, 243, -20 },
+		{ 114, 244, -20 }, { 114, 245, -20 }, { 114, 246, -20 }, { 114, 248, -20 }, { 114, 253, 10 }, { 114, 255, 10 },
+		{ 115, 119, -15 }, { 118, 44, -80 }, { 118, 46, -80 }, { 118, 97, -20 }, { 118, 111, -30 }, { 118, 224, -20 },
+		{ 118, 225, -20 }, { 118, 226, -20 }, { 118, 227, -20 }, { 118, 228, -20 }, { 118, 229, -20 }, { 118, 242, -30 },
+		{ 118, 243, -30 }, { 118, 244, -30 }, { 118, 245, -30 }, { 118, 246, -30 }, { 118, 248, -30 }, { 119, 44, -40 },
+		{ 119, 46, -40 }, { 119, 111, -20 }, { 119, 242, -20 }, { 119, 243, -20 }, { 119, 244, -20 }, { 119, 245, -20 },
+		{ 119, 246, -20 }, { 119, 248, -20 }, { 120, 101, -10 }, { 120, 232, -10 }, { 120, 233, -10 }, { 120, 234, -10 },
+		{ 120, 235, -10 }, { 121, 44, -80 }, { 121, 46, -80 }, { 121, 97, -30 }, { 121, 101, -10 }, { 121, 111, -25 },
+		{ 121, 224, -30 }, { 121, 225, -30 }, { 121, 226, -30 }, { 121, 227, -30 }, { 121, 228, -30 }, { 121, 229, -30 },
+		{ 121, 232, -10 }, { 121, 233, -10 }, { 121, 234, -10 }, { 121, 235, -10 }, { 121, 242, -25 }, { 121, 243, -25 },
+		{ 121, 244, -25 }, { 121, 245, -25 }, { 121, 246, -25 }, { 121, 248, -25 }, { 122, 101, 10 }, { 122, 232, 10 },
+		{ 122, 233, 10 }, { 122, 234, 10 }, { 122, 235, 10 }, { 145, 145, -46 }, { 146, 32, -80 }, { 146, 100, -80 },
+		{ 146, 108, -20 }, { 146, 114, -40 }, { 146, 115, -60 }, { 146, 118, -20 }, { 146, 146, -46 }, { 146, 154, -60 },
+		{ 146, 160, -80 }, { 148, 32, -80 }, { 148, 160, -80 }, { 154, 119, -15 }, { 158, 101, 10 }, { 158, 232, 10 },
+		{ 158, 233, 10 }, { 158, 234, 10 }, { 158, 235, 10 }, { 159, 44, -100 }, { 159, 46, -100 }, { 159, 58, -50 },
+		{ 159, 59, -50 }, { 159, 65, -110 }, { 159, 79, -70 }, { 159, 97, -90 }, { 159, 101, -80 }, { 159, 111, -100 },
+		{ 159, 117, -100 }, { 159, 192, -110 }, { 159, 193, -110 }, { 159, 194, -110 }, { 159, 195, -110 }, { 159, 196, -110 },
+		{ 159, 197, -110 }, { 159, 210, -70 }, { 159, 211, -70 }, { 159, 212, -70 }, { 159, 213, -70 }, { 159, 214, -70 },
+		{ 159, 216, -70 }, { 159, 224, -90 }, { 159, 225, -90 }, { 159, 226, -90 }, { 159, 227, -90 }, { 159, 228, -90 },
+		{ 159, 229, -90 }, { 159, 232, -80 }, { 159, 233, -80 }, { 159, 234, -80 }, { 159, 235, -80 }, { 159, 242, -100 },
+		{ 159, 243, -100 }, { 159, 244, -100 }, { 159, 245, -100 }, { 159, 246, -100 }, { 159, 248, -100 }, { 159, 249, -100 },
+		{ 159, 250, -100 }, { 159, 251, -100 }, { 159, 252, -100 }, { 160, 84, -100 }, { 160, 86, -80 }, { 160, 87, -80 },
+		{ 160, 89, -120 }, { 160, 145, -60 }, { 160, 147, -80 }, { 160, 159, -120 }, { 160, 221, -120 }, { 192, 67, -40 },
+		{ 192, 71, -50 }, { 192, 79, -40 }, { 192, 81, -40 }, { 192, 84, -90 }, { 192, 85, -50 }, { 192, 86, -80 },
+		{ 192, 87, -60 }, { 192, 89, -110 }, { 192, 117, -30 }, { 192, 118, -40 }, { 192, 119, -30 }, { 192, 121, -30 },
+		{ 192, 159, -110 }, { 192, 199, -40 }, { 192, 210, -40 }, { 192, 211, -40 }, { 192, 212, -40 }, { 192, 213, -40 },
+		{ 192, 214, -40 }, { 192, 216, -40 }, { 192, 217, -50 }, { 192, 218, -50 }, { 192, 219, -50 }, { 192, 220, -50 },
+		{ 192, 221, -110 }, { 192, 249, -30 }, { 192, 250, -30 }, { 192, 251, -30 }, { 192, 252, -30 }, { 192, 253, -30 },
+		{ 192, 255, -30 }, { 193, 67, -40 }, { 193, 71, -50 }, { 193, 79, -40 }, { 193, 81, -40 }, { 193, 84, -90 },
+		{ 193, 85, -50 }, { 193, 86, -80 }, { 193, 87, -60 }, { 193, 89, -110 }, { 193, 117, -30 }, { 193, 118, -40 },
+		{ 193, 119, -30 }, { 193, 121, -30 }, { 193, 159, -110 }, { 193, 199, -40 }, { 193, 210, -40 }, { 193, 211, -40 },
+		{ 193, 212, -40 }, { 193, 213, -40 }, { 193, 214, -40 }, { 193, 216, -40 }, { 193, 217, -50 }, { 193, 218, -50 },
+		{ 193, 219, -50 }, { 193, 220, -50 }, { 193, 221, -110 }, { 193, 249, -30 }, { 193, 250, -30 }, { 193, 251, -30 },
+		{ 193, 252, -30 }, { 193, 253, -30 }, { 193, 255, -30 }, { 194, 67, -40 }, { 194, 71, -50 }, { 194, 79, -40 },
+		{ 194, 81, -40 }, { 194, 84, -90 }, { 194, 85, -50 }, { 194, 86, -80 }, { 194, 87, -60 }, { 194, 89, -110 },
+		{ 194, 117, -30 }, { 194, 118, -40 }, { 194, 119, -30 }, { 194, 121, -30 }, { 194, 159, -110 }, { 194, 199, -40 },
+		{ 194, 210, -40 }, { 194, 211, -40 }, { 194, 212, -40 }, { 194, 213, -40 }, { 194, 214, -40 }, { 194, 216, -40 },
+		{ 194, 217, -50 }, { 194, 218, -50 }, { 194, 219, -50 }, { 194, 220, -50 }, { 194, 221, -110 }, { 194, 249, -30 },
+		{ 194, 250, -30 }, { 194, 251, -30 }, { 194, 252, -30 }, { 194, 253, -30 }, { 194, 255, -30 }, { 195, 67, -40 },
+		{ 195, 71, -50 }, { 195, 79, -40 }, { 195, 81, -40 }, { 195, 84, -90 }, { 195, 85, -50 }, { 195, 86, -80 },
+		{ 195, 87, -60 }, { 195, 89, -110 }, { 195, 117, -30 }, { 195, 118, -40 }, { 195, 119, -30 }, { 195, 121, -30 },
+		{ 195, 159, -110 }, { 195, 199, -40 }, { 195, 210, -40 }, { 195, 211, -40 }, { 195, 212, -40 }, { 195, 213, -40 },
+		{ 195, 214, -40 }, { 195, 216, -40 }, { 195, 217, -50 }, { 195, 218, -50 }, { 195, 219, -50 }, { 195, 220, -50 },
+		{ 195, 221, -110 }, { 195, 249, -30 }, { 195, 250, -30 }, { 195, 251, -30 }, { 195, 252, -30 }, { 195, 253, -30 },
+		{ 195, 255, -30 }, { 196, 67, -40 }, { 196, 71, -50 }, { 196, 79, -40 }, { 196, 81, -40 }, { 196, 84, -90 },
+		{ 196, 85, -50 }, { 196, 86, -80 }, { 196, 87, -60 }, { 196, 89, -110 }, { 196, 117, -30 }, { 196, 118, -40 },
+		{ 196, 119, -30 }, { 196, 121, -30 }, { 196, 159, -110 }, { 196, 199, -40 }, { 196, 210, -40 }, { 196, 211, -40 },
+		{ 196, 212, -40 }, { 196, 213, -40 }, { 196, 214, -40 }, { 196, 216, -40 }, { 196, 217, -50 }, { 196, 218, -50 },
+		{ 196, 219, -50 }, { 196, 220, -50 }, { 196, 221, -110 }, { 196, 249, -30 }, { 196, 250, -30 }, { 196, 251, -30 },
+		{ 196, 252, -30 }, { 196, 253, -30 }, { 196, 255, -30 }, { 197, 67, -40 }, { 197, 71, -50 }, { 197, 79, -40 },
+		{ 197, 81, -40 }, { 197, 84, -90 }, { 197, 85, -50 }, { 197, 86, -80 }, { 197, 87, -60 }, { 197, 89, -110 },
+		{ 197, 117, -30 }, { 197, 118, -40 }, { 197, 119, -30 }, { 197, 121, -30 }, { 197, 159, -110 }, { 197, 199, -40 },
+		{ 197, 210, -40 }, { 197, 211, -40 }, { 197, 212, -40 }, { 197, 213, -40 }, { 197, 214, -40 }, { 197, 216, -40 },
+		{ 197, 217, -50 }, { 197, 218, -50 }, { 197, 219, -50 }, { 197, 220, -50 }, { 197, 221, -110 }, { 197, 249, -30 },
+		{ 197, 250, -30 }, { 197, 251, -30 }, { 197, 252, -30 }, { 197, 253, -30 }, { 197, 255, -30 }, { 210, 44, -40 },
+		{ 210, 46, -40 }, { 210, 65, -50 }, { 210, 84, -40 }, { 210, 86, -50 }, { 210, 87, -50 }, { 210, 88, -50 },
+		{ 210, 89, -70 }, { 210, 159, -70 }, { 210, 192, -50 }, { 210, 193, -50 }, { 210, 194, -50 }, { 210, 195, -50 },
+		{ 210, 196, -50 }, { 210, 197, -50 }, { 210, 221, -70 }, { 211, 44, -40 }, { 211, 46, -40 }, { 211, 65, -50 },
+		{ 211, 84, -40 }, { 211, 86, -50 }, { 211, 87, -50 }, { 211, 88, -50 }, { 211, 89, -70 }, { 211, 159, -70 },
+		{ 211, 192, -50 }, { 211, 193, -50 }, { 211, 194, -50 }, { 211, 195, -50 }, { 211, 196, -50 }, { 211, 197, -50 },
+		{ 211, 221, -70 }, { 212, 44, -40 }, { 212, 46, -40 }, { 212, 65, -50 }, { 212, 84, -40 }, { 212, 86, -50 },
+		{ 212, 87, -50 }, { 212, 88, -50 }, { 212, 89, -70 }, { 212, 159, -70 }, { 212, 192, -50 }, { 212, 193, -50 },
+		{ 212, 194, -50 }, { 212, 195, -50 }, { 212, 196, -50 }, { 212, 197, -50 }, { 212, 221, -70 }, { 213, 44, -40 },
+		{ 213, 46, -40 }, { 213, 65, -50 }, { 213, 84, -40 }, { 213, 86, -50 }, { 213, 87, -50 }, { 213, 88, -50 },
+		{ 213, 89, -70 }, { 213, 159, -70 }, { 213, 192, -50 }, { 213, 193, -50 }, { 213, 194, -50 }, { 213, 195, -50 },
+		{ 213, 196, -50 }, { 213, 197, -50 }, { 213, 221, -70 }, { 214, 44, -40 }, { 214, 46, -40 }, { 214, 65, -50 },
+		{ 214, 84, -40 }, { 214, 86, -50 }, { 214, 87, -50 }, { 214, 88, -50 }, { 214, 89, -70 }, { 214, 159, -70 },
+		{ 214, 192, -50 }, { 214, 193, -50 }, { 214, 194, -50 }, { 214, 195, -50 }, { 214, 196, -50 }, { 214, 197, -50 },
+		{ 214, 221, -70 }, { 216, 44, -40 }, { 216, 46, -40 }, { 216, 65, -50 }, { 216, 84, -40 }, { 216, 86, -50 },
+		{ 216, 87, -50 }, { 216, 88, -50 }, { 216, 89, -70 }, { 216, 159, -70 }, { 216, 192, -50 }, { 216, 193, -50 },
+		{ 216, 194, -50 }, { 216, 195, -50 }, { 216, 196, -50 }, { 216, 197, -50 }, { 216, 221, -70 }, { 217, 44, -30 },
+		{ 217, 46, -30 }, { 217, 65, -50 }, { 217, 192, -50 }, { 217, 193, -50 }, { 217, 194, -50 }, { 217, 195, -50 },
+		{ 217, 196, -50 }, { 217, 197, -50 }, { 218, 44, -30 }, { 218, 46, -30 }, { 218, 65, -50 }, { 218, 192, -50 },
+		{ 218, 193, -50 }, { 218, 194, -50 }, { 218, 195, -50 }, { 218, 196, -50 }, { 218, 197, -50 }, { 219, 44, -30 },
+		{ 219, 46, -30 }, { 219, 65, -50 }, { 219, 192, -50 }, { 219, 193, -50 }, { 219, 194, -50 }, { 219, 195, -50 },
+		{ 219, 196, -50 }, { 219, 197, -50 }, { 220, 44, -30 }, { 220, 46, -30 }, { 220, 65, -50 }, { 220, 192, -50 },
+		{ 220, 193, -50 }, { 220, 194, -50 }, { 220, 195, -50 }, { 220, 196, -50 }, { 220, 197, -50 }, { 221, 44, -100 },
+		{ 221, 46, -100 }, { 221, 58, -50 }, { 221, 59, -50 }, { 221, 65, -110 }, { 221, 79, -70 }, { 221, 97, -90 },
+		{ 221, 101, -80 }, { 221, 111, -100 }, { 221, 117, -100 }, { 221, 192, -110 }, { 221, 193, -110 }, { 221, 194, -110 },
+		{ 221, 195, -110 }, { 221, 196, -110 }, { 221, 197, -110 }, { 221, 210, -70 }, { 221, 211, -70 }, { 221, 212, -70 },
+		{ 221, 213, -70 }, { 221, 214, -70 }, { 221, 216, -70 }, { 221, 224, -90 }, { 221, 225, -90 }, { 221, 226, -90 },
+		{ 221, 227, -90 }, { 221, 228, -90 }, { 221, 229, -90 }, { 221, 232, -80 }, { 221, 233, -80 }, { 221, 234, -80 },
+		{ 221, 235, -80 }, { 221, 242, -100 }, { 221, 243, -100 }, { 221, 244, -100 }, { 221, 245, -100 }, { 221, 246, -100 },
+		{ 221, 248, -100 }, { 221, 249, -100 }, { 221, 250, -100 }, { 221, 251, -100 }, { 221, 252, -100 }, { 224, 103, -10 },
+		{ 224, 118, -15 }, { 224, 119, -15 }, { 224, 121, -20 }, { 224, 253, -20 }, { 224, 255, -20 }, { 225, 103, -10 },
+		{ 225, 118, -15 }, { 225, 119, -15 }, { 225, 121, -20 }, { 225, 253, -20 }, { 225, 255, -20 }, { 226, 103, -10 },
+		{ 226, 118, -15 }, { 226, 119, -15 }, { 226, 121, -20 }, { 226, 253, -20 }, { 226, 255, -20 }, { 227, 103, -10 },
+		{ 227, 118, -15 }, { 227, 119, -15 }, { 227, 121, -20 }, { 227, 253, -20 }, { 227, 255, -20 }, { 228, 103, -10 },
+		{ 228, 118, -15 }, { 228, 119, -15 }, { 228, 121, -20 }, { 228, 253, -20 }, { 228, 255, -20 }, { 229, 103, -10 },
+		{ 229, 118, -15 }, { 229, 119, -15 }, { 229, 121, -20 }, { 229, 253, -20 }, { 229, 255, -20 }, { 231, 104, -10 },
+		{ 231, 107, -20 }, { 231, 108, -20 }, { 231, 121, -10 }, { 231, 253, -10 }, { 231, 255, -10 }, { 232, 44, 10 },
+		{ 232, 46, 20 }, { 232, 118, -15 }, { 232, 119, -15 }, { 232, 120, -15 }, { 232, 121, -15 }, { 232, 253, -15 },
+		{ 232, 255, -15 }, { 233, 44, 10 }, { 233, 46, 20 }, { 233, 118, -15 }, { 233, 119, -15 }, { 233, 120, -15 },
+		{ 233, 121, -15 }, { 233, 253, -15 }, { 233, 255, -15 }, { 234, 44, 10 }, { 234, 46, 20 }, { 234, 118, -15 },
+		{ 234, 119, -15 }, { 234, 120, -15 }, { 234, 121, -15 }, { 234, 253, -15 }, { 234, 255, -15 }, { 235, 44, 10 },
+		{ 235, 46, 20 }, { 235, 118, -15 }, { 235, 119, -15 }, { 235, 120, -15 }, { 235, 121, -15 }, { 235, 253, -15 },
+		{ 235, 255, -15 }, { 241, 117, -10 }, { 241, 118, -40 }, { 241, 121, -20 }, { 241, 249, -10 }, { 241, 250, -10 },
+		{ 241, 251, -10 }, { 241, 252, -10 }, { 241, 253, -20 }, { 241, 255, -20 }, { 242, 118, -20 }, { 242, 119, -15 },
+		{ 242, 120, -30 }, { 242, 121, -20 }, { 242, 253, -20 }, { 242, 255, -20 }, { 243, 118, -20 }, { 243, 119, -15 },
+		{ 243, 120, -30 }, { 243, 121, -20 }, { 243, 253, -20 }, { 243, 255, -20 }, { 244, 118, -20 }, { 244, 119, -15 },
+		{ 244, 120, -30 }, { 244, 121, -20 }, { 244, 253, -20 }, { 244, 255, -20 }, { 245, 118, -20 }, { 245, 119, -15 },
+		{ 245, 120, -30 }, { 245, 121, -20 }, { 245, 253, -20 }, { 245, 255, -20 }, { 246, 118, -20 }, { 246, 119, -15 },
+		{ 246, 120, -30 }, { 246, 121, -20 }, { 246, 253, -20 }, { 246, 255, -20 }, { 248, 118, -20 }, { 248, 119, -15 },
+		{ 248, 120, -30 }, { 248, 121, -20 }, { 248, 253, -20 }, { 248, 255, -20 }, { 253, 44, -80 }, { 253, 46, -80 },
+		{ 253, 97, -30 }, { 253, 101, -10 }, { 253, 111, -25 }, { 253, 224, -30 }, { 253, 225, -30 }, { 253, 226, -30 },
+		{ 253, 227, -30 }, { 253, 228, -30 }, { 253, 229, -30 }, { 253, 232, -10 }, { 253, 233, -10 }, { 253, 234, -10 },
+		{ 253, 235, -10 }, { 253, 242, -25 }, { 253, 243, -25 }, { 253, 244, -25 }, { 253, 245, -25 }, { 253, 246, -25 },
+		{ 253, 248, -25 }, { 255, 44, -80 }, { 255, 46, -80 }, { 255, 97, -30 }, { 255, 101, -10 }, { 255, 111, -25 },
+		{ 255, 224, -30 }, { 255, 225, -30 }, { 255, 226, -30 }, { 255, 227, -30 }, { 255, 228, -30 }, { 255, 229, -30 },
+		{ 255, 232, -10 }, { 255, 233, -10 }, { 255, 234, -10 }, { 255, 235, -10 }, { 255, 242, -25 }, { 255, 243, -25 },
+		{ 255, 244, -25 }, { 255, 245, -25 }, { 255, 246, -25 }, { 255, 248, -25 },
+	};
+
+	static constexpr GlyphMetrics COURIER_GLYPHS[256] = {
+		/* 00 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 03 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 06 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 09 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0f */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 12 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 15 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 18 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1b */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 600, 0, 0, 0, 0 },
+		/* 21 */ { 600, 236, -15, 364, 572 }, { 600, 187, 328, 413, 562 }, { 600, 93, -32, 507, 639 },
+		/* 24 */ { 600, 105, -126, 496, 662 }, { 600, 81, -15, 518, 622 }, { 600, 63, -15, 538, 543 },
+		/* 27 */ { 600, 259, 328, 341, 562 }, { 600, 269, -108, 440, 622 }, { 600, 160, -108, 331, 622 },
+		/* 2a */ { 600, 116, 257, 484, 607 }, { 600, 80, 44, 520, 470 }, { 600, 181, -112, 344, 122 },
+		/* 2d */ { 600, 103, 231, 497, 285 }, { 600, 229, -15, 371, 109 }, { 600, 125, -80, 475, 629 },
+		/* 30 */ { 600, 106, -15, 494, 622 }, { 600, 96, 0, 505, 622 }, { 600, 70, 0, 471, 622 },
+		/* 33 */ { 600, 75, -15, 466, 622 }, { 600, 78, 0, 500, 622 }, { 600, 92, -15, 497, 607 },
+		/* 36 */ { 600, 111, -15, 497, 622 }, { 600, 82, 0, 483, 607 }, { 600, 102, -15, 498, 622 },
+		/* 39 */ { 600, 96, -15, 489, 622 }, { 600, 229, -15, 371, 385 }, { 600, 181, -112, 371, 385 },
+		/* 3c */ { 600, 41, 42, 519, 472 }, { 600, 80, 138, 520, 376 }, { 600, 66, 42, 544, 472 },
+		/* 3f */ { 600, 129, -15, 492, 572 }, { 600, 77, -15, 533, 622 }, { 600, 3, 0, 597, 562 },
+		/* 42 */ { 600, 43, 0, 559, 562 }, { 600, 41, -18, 540, 580 }, { 600, 43, 0, 574, 562 },
+		/* 45 */ { 600, 53, 0, 550, 562 }, { 600, 53, 0, 545, 562 }, { 600, 31, -18, 575, 580 },
+		/* 48 */ { 600, 32, 0, 568, 562 }, { 600, 96, 0, 504, 562 }, { 600, 34, -18, 566, 562 },
+		/* 4b */ { 600, 38, 0, 582, 562 }, { 600, 47, 0, 554, 562 }, { 600, 4, 0, 596, 562 },
+		/* 4e */ { 600, 7, -13, 593, 562 }, { 600, 43, -18, 557, 580 }, { 600, 79, 0, 558, 562 },
+		/* 51 */ { 600, 43, -138, 557, 580 }, { 600, 38, 0, 588, 562 }, { 600, 72, -20, 529, 580 },
+		/* 54 */ { 600, 38, 0, 563, 562 }, { 600, 17, -18, 583, 562 }, { 600, -4, -13, 604, 562 },
+		/* 57 */ { 600, -3, -13, 603, 562 }, { 600, 23, 0, 577, 562 }, { 600, 24, 0, 576, 562 },
+		/* 5a */ { 600, 86, 0, 514, 562 }, { 600, 269, -108, 442, 622 }, { 600, 118, -80, 482, 629 },
+		/* 5d */ { 600, 158, -108, 331, 622 }, { 600, 94, 354, 506, 622 }, { 600, 0, -125, 600, -75 },
+		/* 60 */ { 600, 151, 497, 378, 672 }, { 600, 53, -15, 559, 441 }, { 600, 14, -15, 575, 629 },
+		/* 63 */ { 600, 66, -15, 529, 441 }, { 600, 45, -15, 591, 629 }, { 600, 66, -15, 548, 441 },
+		/* 66 */ { 600, 114, 0, 531, 629 }, { 600, 45, -157, 566, 441 }, { 600, 18, 0, 582, 629 },
+		/* 69 */ { 600, 95, 0, 505, 657 }, { 600, 82, -157, 410, 657 }, { 600, 43, 0, 580, 629 },
+		/* 6c */ { 600, 95, 0, 505, 629 }, { 600, -5, 0, 605, 441 }, { 600, 26, 0, 575, 441 },
+		/* 6f */ { 600, 62, -15, 538, 441 }, { 600, 9, -157, 555, 441 }, { 600, 45, -157, 591, 441 },
+		/* 72 */ { 600, 60, 0, 559, 441 }, { 600, 80, -15, 513, 441 }, { 600, 87, -15, 530, 561 },
+		/* 75 */ { 600, 21, -15, 562, 426 }, { 600, 10, -10, 590, 426 }, { 600, -4, -10, 604, 426 },
+		/* 78 */ { 600, 20, 0, 580, 426 }, { 600, 7, -157, 592, 426 }, { 600, 99, 0, 502, 426 },
+		/* 7b */ { 600, 182, -108, 437, 622 }, { 600, 275, -250, 326, 750 }, { 600, 163, -108, 418, 622 },
+		/* 7e */ { 600, 63, 197, 540, 320 }, { 0, 0, 0, 0, 0 }, { 600, 0, 0, 0, 0 },
+		/* 81 */ { 0, 0, 0, 0, 0 }, { 600, 213, -134, 376, 100 }, { 600, 4, -143, 539, 622 },
+		/* 84 */ { 600, 143, -134, 457, 100 }, { 600, 37, -15, 563, 111 }, { 600, 141, -78, 459, 580 },
+		/* 87 */ { 600, 141, -78, 459, 580 }, { 600, 124, 477, 476, 654 }, { 600, 3, -15, 600, 622 },
+		/* 8a */ { 600, 72, -20, 529, 802 }, { 600, 149, 70, 451, 446 }, { 600, 7, 0, 567, 562 },
+		/* 8d */ { 0, 0, 0, 0, 0 }, { 600, 86, 0, 514, 802 }, { 0, 0, 0, 0, 0 },
+		/* 90 */ { 0, 0, 0, 0, 0 }, { 600, 224, 328, 387, 562 }, { 600, 213, 328, 376, 562 },
+		/* 93 */ { 600, 143, 328, 471, 562 }, { 600, 143, 328, 457, 562 }, { 600, 172, 130, 428, 383 },
+		/* 96 */ { 600, 75, 231, 525, 285 }, { 600, 0, 231, 600, 285 }, { 600, 105, 489, 503, 606 },
+		/* 99 */ { 600, -23, 263, 623, 562 }, { 600, 80, -15, 513, 669 }, { 600, 149, 70, 451, 446 },
+		/* 9c */ { 600, 19, -15, 559, 441 }, { 0, 0, 0, 0, 0 }, { 600, 99, 0, 502, 669 },
+		/* 9f */ { 600, 24, 0, 576, 753 }, { 600, 0, 0, 0, 0 }, { 600, 236, -157, 364, 430 },
+		/* a2 */ { 600, 96, -49, 500, 614 }, { 600, 84, -21, 521, 611 }, { 600, 73, 58, 527, 506 },
+		/* a5 */ { 600, 26, 0, 574, 562 }, { 600, 275, -175, 326, 675 }, { 600, 113, -78, 488, 580 },
+		/* a8 */ { 600, 148, 537, 453, 640 }, { 600, 0, -18, 600, 580 }, { 600, 156, 249, 442, 580 },
+		/* ab */ { 600, 37, 70, 563, 446 }, { 600, 87, 108, 513, 369 }, { 600, 103, 231, 497, 285 },
+		/* ae */ { 600, 0, -18, 600, 580 }, { 600, 120, 525, 480, 565 }, { 600, 123, 269, 477, 622 },
+		/* b1 */ { 600, 87, 44, 513, 558 }, { 600, 177, 249, 424, 622 }, { 600, 155, 240, 406, 622 },
+		/* b4 */ { 600, 242, 497, 469, 672 }, { 600, 21, -157, 562, 426 }, { 600, 50, -78, 511, 562 },
+		/* b7 */ { 600, 222, 189, 378, 327 }, { 600, 224, -151, 362, 10 }, { 600, 172, 249, 428, 622 },
+		/* ba */ { 600, 157, 249, 443, 580 }, { 600, 37, 70, 563, 446 }, { 600, 0, -57, 600, 665 },
+		/* bd */ { 600, 0, -57, 611, 665 }, { 600, 8, -56, 593, 666 }, { 600, 108, -157, 471, 430 },
+		/* c0 */ { 600, 3, 0, 597, 805 }, { 600, 3, 0, 597, 805 }, { 600, 3, 0, 597, 787 },
+		/* c3 */ { 600, 3, 0, 597, 729 }, { 600, 3, 0, 597, 753 }, { 600, 3, 0, 597, 750 },
+		/* c6 */ { 600, 3, 0, 550, 562 }, { 600, 41, -151, 540, 580 }, { 600, 53, 0, 550, 805 },
+		/* c9 */ { 600, 53, 0, 550, 805 }, { 600, 53, 0, 550, 787 }, { 600, 53, 0, 550, 753 },
+		/* cc */ { 600, 96, 0, 504, 805 }, { 600, 96, 0, 504, 805 }, { 600, 96, 0, 504, 787 },
+		/* cf */ { 600, 96, 0, 504, 753 }, { 600, 30, 0, 574, 562 }, { 600, 7, -13, 593, 729 },
+		/* d2 */ { 600, 43, -18, 557, 805 }, { 600, 43, -18, 557, 805 }, { 600, 43, -18, 557, 787 },
+		/* d5 */ { 600, 43, -18, 557, 729 }, { 600, 43, -18, 557, 753 }, { 600, 87, 43, 515, 470 },
+		/* d8 */ { 600, 43, -80, 557, 629 }, { 600, 17, -18, 583, 805 }, { 600, 17, -18, 583, 805 },
+		/* db */ { 600, 17, -18, 583, 787 }, { 600, 17, -18, 583, 753 }, { 600, 24, 0, 576, 805 },
+		/* de */ { 600, 79, 0, 538, 562 }, { 600, 48, -15, 588, 629 }, { 600, 53, -15, 559, 672 },
+		/* e1 */ { 600, 53, -15, 559, 672 }, { 600, 53, -15, 559, 654 }, { 600, 53, -15, 559, 606 },
+		/* e4 */ { 600, 53, -15, 559, 620 }, { 600, 53, -15, 559, 627 }, { 600, 19, -15, 570, 441 },
+		/* e7 */ { 600, 66, -151, 529, 441 }, { 600, 66, -15, 548, 672 }, { 600, 66, -15, 548, 672 },
+		/* ea */ { 600, 66, -15, 548, 654 }, { 600, 66, -15, 548, 620 }, { 600, 95, 0, 505, 672 },
+		/* ed */ { 600, 95, 0, 505, 672 }, { 600, 94, 0, 505, 654 }, { 600, 95, 0, 505, 620 },
+		/* f0 */ { 600, 62, -15, 538, 629 }, { 600, 26, 0, 575, 606 }, { 600, 62, -15, 538, 672 },
+		/* f3 */ { 600, 62, -15, 538, 672 }, { 600, 62, -15, 538, 654 }, { 600, 62, -15, 538, 606 },
+		/* f6 */ { 600, 62, -15, 538, 620 }, { 600, 87, 48, 513, 467 }, { 600, 62, -80, 538, 506 },
+		/* f9 */ { 600, 21, -15, 562, 672 }, { 600, 21, -15, 562, 672 }, { 600, 21, -15, 562, 654 },
+		/* fc */ { 600, 21, -15, 562, 620 }, { 600, 7, -157, 592, 672 }, { 600, -6, -157, 555, 629 },
+		/* ff */ { 600, 7, -157, 592, 620 },
+	};
+
+	static constexpr GlyphMetrics COURIER_OBLIQUE_GLYPHS[256] = {
+		/* 00 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 03 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 06 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 09 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0f */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 12 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 15 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 18 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1b */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 600, 0, 0, 0, 0 },
+		/* 21 */ { 600, 243, -15, 464, 572 }, { 600, 273, 328, 532, 562 }, { 600, 133, -32, 596, 639 },
+		/* 24 */ { 600, 108, -126, 596, 662 }, { 600, 134, -15, 599, 622 }, { 600, 87, -15, 580, 543 },
+		/* 27 */ { 600, 345, 328, 460, 562 }, { 600, 313, -108, 572, 622 }, { 600, 137, -108, 396, 622 },
+		/* 2a */ { 600, 212, 257, 580, 607 }, { 600, 129, 44, 580, 470 }, { 600, 157, -112, 370, 122 },
+		/* 2d */ { 600, 152, 231, 558, 285 }, { 600, 238, -15, 382, 109 }, { 600, 112, -80, 604, 629 },
+		/* 30 */ { 600, 154, -15, 575, 622 }, { 600, 98, 0, 515, 622 }, { 600, 70, 0, 568, 622 },
+		/* 33 */ { 600, 82, -15, 538, 622 }, { 600, 108, 0, 541, 622 }, { 600, 99, -15, 589, 607 },
+		/* 36 */ { 600, 155, -15, 629, 622 }, { 600, 182, 0, 612, 607 }, { 600, 132, -15, 588, 622 },
+		/* 39 */ { 600, 93, -15, 574, 622 }, { 600, 238, -15, 441, 385 }, { 600, 157, -112, 441, 385 },
+		/* 3c */ { 600, 96, 42, 610, 472 }, { 600, 109, 138, 600, 376 }, { 600, 85, 42, 599, 472 },
+		/* 3f */ { 600, 222, -15, 583, 572 }, { 600, 127, -15, 582, 622 }, { 600, 3, 0, 607, 562 },
+		/* 42 */ { 600, 43, 0, 616, 562 }, { 600, 93, -18, 655, 580 }, { 600, 43, 0, 645, 562 },
+		/* 45 */ { 600, 53, 0, 660, 562 }, { 600, 53, 0, 660, 562 }, { 600, 83, -18, 645, 580 },
+		/* 48 */ { 600, 32, 0, 687, 562 }, { 600, 96, 0, 623, 562 }, { 600, 52, -18, 685, 562 },
+		/* 4b */ { 600, 38, 0, 671, 562 }, { 600, 47, 0, 607, 562 }, { 600, 4, 0, 715, 562 },
+		/* 4e */ { 600, 7, -13, 712, 562 }, { 600, 94, -18, 625, 580 }, { 600, 79, 0, 644, 562 },
+		/* 51 */ { 600, 95, -138, 625, 580 }, { 600, 38, 0, 598, 562 }, { 600, 76, -20, 650, 580 },
+		/* 54 */ { 600, 108, 0, 665, 562 }, { 600, 125, -18, 702, 562 }, { 600, 105, -13, 723, 562 },
+		/* 57 */ { 600, 106, -13, 722, 562 }, { 600, 23, 0, 675, 562 }, { 600, 133, 0, 695, 562 },
+		/* 5a */ { 600, 86, 0, 610, 562 }, { 600, 246, -108, 574, 622 }, { 600, 249, -80, 468, 629 },
+		/* 5d */ { 600, 135, -108, 463, 622 }, { 600, 175, 354, 587, 622 }, { 600, -27, -125, 584, -75 },
+		/* 60 */ { 600, 294, 497, 484, 672 }, { 600, 76, -15, 569, 441 }, { 600, 29, -15, 625, 629 },
+		/* 63 */ { 600, 106, -15, 608, 441 }, { 600, 85, -15, 640, 629 }, { 600, 106, -15, 598, 441 },
+		/* 66 */ { 600, 114, 0, 662, 629 }, { 600, 61, -157, 657, 441 }, { 600, 33, 0, 592, 629 },
+		/* 69 */ { 600, 95, 0, 515, 657 }, { 600, 52, -157, 550, 657 }, { 600, 58, 0, 633, 629 },
+		/* 6c */ { 600, 95, 0, 515, 629 }, { 600, -5, 0, 615, 441 }, { 600, 26, 0, 585, 441 },
+		/* 6f */ { 600, 102, -15, 588, 441 }, { 600, -24, -157, 605, 441 }, { 600, 85, -157, 682, 441 },
+		/* 72 */ { 600, 60, 0, 636, 441 }, { 600, 78, -15, 584, 441 }, { 600, 167, -15, 561, 561 },
+		/* 75 */ { 600, 101, -15, 572, 426 }, { 600, 90, -10, 681, 426 }, { 600, 76, -10, 695, 426 },
+		/* 78 */ { 600, 20, 0, 655, 426 }, { 600, -4, -157, 683, 426 }, { 600, 99, 0, 593, 426 },
+		/* 7b */ { 600, 233, -108, 569, 622 }, { 600, 222, -250, 485, 750 }, { 600, 140, -108, 477, 622 },
+		/* 7e */ { 600, 116, 197, 600, 320 }, { 0, 0, 0, 0, 0 }, { 600, 0, 0, 0, 0 },
+		/* 81 */ { 0, 0, 0, 0, 0 }, { 600, 185, -134, 397, 100 }, { 600, -26, -143, 671, 622 },
+		/* 84 */ { 600, 115, -134, 478, 100 }, { 600, 46, -15, 575, 111 }, { 600, 217, -78, 546, 580 },
+		/* 87 */ { 600, 163, -78, 546, 580 }, { 600, 229, 477, 581, 654 }, { 600, 59, -15, 627, 622 },
+		/* 8a */ { 600, 76, -20, 672, 802 }, { 600, 204, 70, 540, 446 }, { 600, 59, 0, 672, 562 },
+		/* 8d */ { 0, 0, 0, 0, 0 }, { 600, 86, 0, 642, 802 }, { 0, 0, 0, 0, 0 },
+		/* 90 */ { 0, 0, 0, 0, 0 }, { 600, 343, 328, 457, 562 }, { 600, 283, 328, 495, 562 },
+		/* 93 */ { 600, 262, 328, 541, 562 }, { 600, 213, 328, 576, 562 }, { 600, 224, 130, 485, 383 },
+		/* 96 */ { 600, 124, 231, 586, 285 }, { 600, 49, 231, 661, 285 }, { 600, 212, 489, 629, 606 },
+		/* 99 */ { 600, 75, 263, 742, 562 }, { 600, 78, -15, 614, 669 }, { 600, 170, 70, 506, 446 },
+		/* 9c */ { 600, 54, -15, 615, 441 }, { 0, 0, 0, 0, 0 }, { 600, 99, 0, 624, 669 },
+		/* 9f */ { 600, 133, 0, 695, 753 }, { 600, 0, 0, 0, 0 }, { 600, 225, -157, 445, 430 },
+		/* a2 */ { 600, 151, -49, 588, 614 }, { 600, 124, -21, 621, 611 }, { 600, 94, 58, 628, 506 },
+		/* a5 */ { 600, 120, 0, 693, 562 }, { 600, 238, -175, 469, 675 }, { 600, 104, -78, 590, 580 },
+		/* a8 */ { 600, 272, 537, 579, 640 }, { 600, 53, -18, 667, 580 }, { 600, 209, 249, 512, 580 },
+		/* ab */ { 600, 92, 70, 652, 446 }, { 600, 155, 108, 591, 369 }, { 600, 152, 231, 558, 285 },
+		/* ae */ { 600, 53, -18, 667, 580 }, { 600, 232, 525, 600, 565 }, { 600, 214, 269, 576, 622 },
+		/* b1 */ { 600, 96, 44, 594, 558 }, { 600, 230, 249, 535, 622 }, { 600, 213, 240, 501, 622 },
+		/* b4 */ { 600, 348, 497, 612, 672 }, { 600, 72, -157, 572, 426 }, { 600, 100, -78, 630, 562 },
+		/* b7 */ { 600, 275, 189, 434, 327 }, { 600, 197, -151, 344, 10 }, { 600, 231, 249, 491, 622 },
+		/* ba */ { 600, 210, 249, 535, 580 }, { 600, 58, 70, 618, 446 }, { 600, 65, -57, 674, 665 },
+		/* bd */ { 600, 65, -57, 669, 665 }, { 600, 73, -56, 659, 666 }, { 600, 105, -157, 466, 430 },
+		/* c0 */ { 600, 3, 0, 607, 805 }, { 600, 3, 0, 660, 805 }, { 600, 3, 0, 607, 787 },
+		/* c3 */ { 600, 3, 0, 655, 729 }, { 600, 3, 0, 607, 753 }, { 600, 3, 0, 607, 750 },
+		/* c6 */ { 600, 3, 0, 655, 562 }, { 600, 93, -151, 658, 580 }, { 600, 53, 0, 660, 805 },
+		/* c9 */ { 600, 53, 0, 670, 805 }, { 600, 53, 0, 660, 787 }, { 600, 53, 0, 660, 753 },
+		/* cc */ { 600, 96, 0, 623, 805 }, { 600, 96, 0, 640, 805 }, { 600, 96, 0, 623, 787 },
+		/* cf */ { 600, 96, 0, 623, 753 }, { 600, 43, 0, 645, 562 }, { 600, 7, -13, 712, 729 },
+		/* d2 */ { 600, 94, -18, 625, 805 }, { 600, 94, -18, 640, 805 }, { 600, 94, -18, 625, 787 },
+		/* d5 */ { 600, 94, -18, 655, 729 }, { 600, 94, -18, 625, 753 }, { 600, 103, 43, 607, 470 },
+		/* d8 */ { 600, 94, -80, 625, 629 }, { 600, 125, -18, 702, 805 }, { 600, 125, -18, 702, 805 },
+		/* db */ { 600, 125, -18, 702, 787 }, { 600, 125, -18, 702, 753 }, { 600, 133, 0, 695, 805 },
+		/* de */ { 600, 79, 0, 606, 562 }, { 600, 48, -15, 617, 629 }, { 600, 76, -15, 569, 672 },
+		/* e1 */ { 600, 76, -15, 612, 672 }, { 600, 76, -15, 581, 654 }, { 600, 76, -15, 629, 606 },
+		/* e4 */ { 600, 76, -15, 575, 620 }, { 600, 76, -15, 569, 627 }, { 600, 41, -15, 626, 441 },
+		/* e7 */ { 600, 106, -151, 614, 441 }, { 600, 106, -15, 598, 672 }, { 600, 106, -15, 612, 672 },
+		/* ea */ { 600, 106, -15, 598, 654 }, { 600, 106, -15, 598, 620 }, { 600, 95, 0, 515, 672 },
+		/* ed */ { 600, 95, 0, 612, 672 }, { 600, 95, 0, 551, 654 }, { 600, 95, 0, 545, 620 },
+		/* f0 */ { 600, 102, -15, 639, 629 }, { 600, 26, 0, 629, 606 }, { 600, 102, -15, 588, 672 },
+		/* f3 */ { 600, 102, -15, 612, 672 }, { 600, 102, -15, 588, 654 }, { 600, 102, -15, 629, 606 },
+		/* f6 */ { 600, 102, -15, 588, 620 }, { 600, 136, 48, 573, 467 }, { 600, 102, -80, 588, 506 },
+		/* f9 */ { 600, 101, -15, 572, 672 }, { 600, 101, -15, 602, 672 }, { 600, 101, -15, 572, 654 },
+		/* fc */ { 600, 101, -15, 575, 620 }, { 600, -4, -157, 683, 672 }, { 600, -24, -157, 605, 629 },
+		/* ff */ { 600, -4, -157, 683, 620 },
+	};
+
+	static constexpr GlyphMetrics COURIER_BOLD_GLYPHS[256] = {
+		/* 00 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 03 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 06 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 09 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0f */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 12 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 15 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 18 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1b */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 600, 0, 0, 0, 0 },
+		/* 21 */ { 600, 202, -15, 398, 572 }, { 600, 135, 277, 465, 562 }, { 600, 56, -45, 544, 651 },
+		/* 24 */ { 600, 82, -126, 519, 666 }, { 600, 5, -15, 595, 616 }, { 600, 36, -15, 546, 543 },
+		/* 27 */ { 600, 227, 277, 373, 562 }, { 600, 219, -102, 461, 616 }, { 600, 139, -102, 381, 616 },
+		/* 2a */ { 600, 91, 219, 509, 601 }, { 600, 71, 39, 529, 478 }, { 600, 123, -111, 393, 174 },
+		/* 2d */ { 600, 100, 203, 500, 313 }, { 600, 192, -15, 408, 171 }, { 600, 98, -77, 502, 626 },
+		/* 30 */ { 600, 87, -15, 513, 616 }, { 600, 81, 0, 539, 616 }, { 600, 61, 0, 499, 616 },
+		/* 33 */ { 600, 63, -15, 501, 616 }, { 600, 53, 0, 507, 616 }, { 600, 70, -15, 521, 601 },
+		/* 36 */ { 600, 90, -15, 521, 616 }, { 600, 55, 0, 494, 601 }, { 600, 83, -15, 517, 616 },
+		/* 39 */ { 600, 79, -15, 510, 616 }, { 600, 191, -15, 407, 425 }, { 600, 123, -111, 408, 425 },
+		/* 3c */ { 600, 66, 15, 523, 501 }, { 600, 71, 118, 529, 398 }, { 600, 77, 15, 534, 501 },
+		/* 3f */ { 600, 98, -14, 501, 580 }, { 600, 16, -15, 584, 616 }, { 600, -9, 0, 609, 562 },
+		/* 42 */ { 600, 30, 0, 573, 562 }, { 600, 22, -18, 560, 580 }, { 600, 30, 0, 594, 562 },
+		/* 45 */ { 600, 25, 0, 560, 562 }, { 600, 39, 0, 570, 562 }, { 600, 22, -18, 594, 580 },
+		/* 48 */ { 600, 20, 0, 580, 562 }, { 600, 77, 0, 523, 562 }, { 600, 37, -18, 601, 562 },
+		/* 4b */ { 600, 21, 0, 599, 562 }, { 600, 39, 0, 578, 562 }, { 600, -2, 0, 602, 562 },
+		/* 4e */ { 600, 8, -12, 610, 562 }, { 600, 22, -18, 578, 580 }, { 600, 48, 0, 559, 562 },
+		/* 51 */ { 600, 32, -138, 578, 580 }, { 600, 24, 0, 599, 562 }, { 600, 47, -22, 553, 582 },
+		/* 54 */ { 600, 21, 0, 579, 562 }, { 600, 4, -18, 596, 562 }, { 600, -13, 0, 613, 562 },
+		/* 57 */ { 600, -18, 0, 618, 562 }, { 600, 12, 0, 588, 562 }, { 600, 12, 0, 589, 562 },
+		/* 5a */ { 600, 62, 0, 539, 562 }, { 600, 245, -102, 475, 616 }, { 600, 99, -77, 503, 626 },
+		/* 5d */ { 600, 125, -102, 355, 616 }, { 600, 108, 250, 492, 616 }, { 600, 0, -125, 600, -75 },
+		/* 60 */ { 600, 132, 508, 395, 661 }, { 600, 35, -15, 570, 454 }, { 600, 0, -15, 584, 626 },
+		/* 63 */ { 600, 40, -15, 545, 459 }, { 600, 20, -15, 591, 626 }, { 600, 40, -15, 563, 454 },
+		/* 66 */ { 600, 83, 0, 547, 626 }, { 600, 30, -146, 580, 454 }, { 600, 5, 0, 592, 626 },
+		/* 69 */ { 600, 77, 0, 523, 658 }, { 600, 63, -146, 440, 658 }, { 600, 20, 0, 585, 626 },
+		/* 6c */ { 600, 77, 0, 523, 626 }, { 600, -22, 0, 626, 454 }, { 600, 18, 0, 592, 454 },
+		/* 6f */ { 600, 30, -15, 570, 454 }, { 600, -1, -142, 570, 454 }, { 600, 20, -142, 591, 454 },
+		/* 72 */ { 600, 47, 0, 580, 454 }, { 600, 68, -17, 535, 459 }, { 600, 47, -15, 532, 562 },
+		/* 75 */ { 600, -1, -15, 569, 439 }, { 600, -1, 0, 601, 439 }, { 600, -18, 0, 618, 439 },
+		/* 78 */ { 600, 6, 0, 594, 439 }, { 600, -4, -142, 601, 439 }, { 600, 81, 0, 520, 439 },
+		/* 7b */ { 600, 160, -102, 464, 616 }, { 600, 255, -250, 345, 750 }, { 600, 136, -102, 440, 616 },
+		/* 7e */ { 600, 71, 153, 530, 356 }, { 0, 0, 0, 0, 0 }, { 600, 0, 0, 0, 0 },
+		/* 81 */ { 0, 0, 0, 0, 0 }, { 600, 175, -142, 427, 143 }, { 600, -30, -131, 572, 616 },
+		/* 84 */ { 600, 65, -142, 529, 143 }, { 600, 26, -15, 574, 116 }, { 600, 106, -70, 494, 580 },
+		/* 87 */ { 600, 106, -70, 494, 580 }, { 600, 103, 483, 497, 657 }, { 600, -113, -15, 713, 616 },
+		/* 8a */ { 600, 47, -22, 553, 790 }, { 600, 141, 70, 459, 446 }, { 600, -25, 0, 595, 562 },
+		/* 8d */ { 0, 0, 0, 0, 0 }, { 600, 62, 0, 539, 790 }, { 0, 0, 0, 0, 0 },
+		/* 90 */ { 0, 0, 0, 0, 0 }, { 600, 178, 277, 428, 562 }, { 600, 171, 277, 423, 562 },
+		/* 93 */ { 600, 71, 277, 535, 562 }, { 600, 61, 277, 525, 562 }, { 600, 140, 132, 460, 430 },
+		/* 96 */ { 600, 65, 203, 535, 313 }, { 600, -10, 203, 610, 313 }, { 600, 89, 493, 512, 636 },
+		/* 99 */ { 600, -9, 230, 749, 562 }, { 600, 68, -17, 535, 667 }, { 600, 141, 70, 459, 446 },
+		/* 9c */ { 600, -18, -15, 611, 454 }, { 0, 0, 0, 0, 0 }, { 600, 81, 0, 520, 667 },
+		/* 9f */ { 600, 12, 0, 589, 761 }, { 600, 0, 0, 0, 0 }, { 600, 202, -146, 398, 449 },
+		/* a2 */ { 600, 66, -49, 518, 614 }, { 600, 72, -28, 558, 611 }, { 600, 54, 49, 546, 517 },
+		/* a5 */ { 600, 10, 0, 590, 562 }, { 600, 255, -175, 345, 675 }, { 600, 83, -70, 517, 580 },
+		/* a8 */ { 600, 128, 498, 472, 638 }, { 600, 0, -18, 600, 580 }, { 600, 147, 196, 453, 580 },
+		/* ab */ { 600, 8, 70, 553, 446 }, { 600, 71, 103, 529, 413 }, { 600, 100, 203, 500, 313 },
+		/* ae */ { 600, 0, -18, 600, 580 }, { 600, 88, 505, 512, 585 }, { 600, 86, 243, 474, 616 },
+		/* b1 */ { 600, 71, 24, 529, 515 }, { 600, 143, 230, 436, 616 }, { 600, 138, 222, 433, 616 },
+		/* b4 */ { 600, 205, 508, 468, 661 }, { 600, -1, -142, 569, 439 }, { 600, 6, -70, 576, 580 },
+		/* b7 */ { 600, 196, 165, 404, 351 }, { 600, 205, -206, 387, 0 }, { 600, 153, 230, 447, 616 },
+		/* ba */ { 600, 147, 196, 453, 580 }, { 600, 47, 70, 592, 446 }, { 600, -56, -60, 656, 661 },
+		/* bd */ { 600, -47, -60, 648, 661 }, { 600, -47, -60, 648, 661 }, { 600, 99, -146, 502, 449 },
+		/* c0 */ { 600, -9, 0, 609, 784 }, { 600, -9, 0, 609, 784 }, { 600, -9, 0, 609, 780 },
+		/* c3 */ { 600, -9, 0, 609, 759 }, { 600, -9, 0, 609, 761 }, { 600, -9, 0, 609, 801 },
+		/* c6 */ { 600, -29, 0, 602, 562 }, { 600, 22, -206, 560, 580 }, { 600, 25, 0, 560, 784 },
+		/* c9 */ { 600, 25, 0, 560, 784 }, { 600, 25, 0, 560, 780 }, { 600, 25, 0, 560, 761 },
+		/* cc */ { 600, 77, 0, 523, 784 }, { 600, 77, 0, 523, 784 }, { 600, 77, 0, 523, 780 },
+		/* cf */ { 600, 77, 0, 523, 761 }, { 600, 30, 0, 594, 562 }, { 600, 8, -12, 610, 759 },
+		/* d2 */ { 600, 22, -18, 578, 784 }, { 600, 22, -18, 578, 784 }, { 600, 22, -18, 578, 780 },
+		/* d5 */ { 600, 22, -18, 578, 759 }, { 600, 22, -18, 578, 761 }, { 600, 81, 39, 520, 478 },
+		/* d8 */ { 600, 22, -22, 578, 584 }, { 600, 4, -18, 596, 784 }, { 600, 4, -18, 596, 784 },
+		/* db */ { 600, 4, -18, 596, 780 }, { 600, 4, -18, 596, 761 }, { 600, 12, 0, 589, 784 },
+		/* de */ { 600, 48, 0, 557, 562 }, { 600, 22, -15, 596, 626 }, { 600, 35, -15, 570, 661 },
+		/* e1 */ { 600, 35, -15, 570, 661 }, { 600, 35, -15, 570, 657 }, { 600, 35, -15, 570, 636 },
+		/* e4 */ { 600, 35, -15, 570, 638 }, { 600, 35, -15, 570, 678 }, { 600, -4, -15, 601, 454 },
+		/* e7 */ { 600, 40, -206, 545, 459 }, { 600, 40, -15, 563, 661 }, { 600, 40, -15, 563, 661 },
+		/* ea */ { 600, 40, -15, 563, 657 }, { 600, 40, -15, 563, 638 }, { 600, 77, 0, 523, 661 },
+		/* ed */ { 600, 77, 0, 523, 661 }, { 600, 73, 0, 523, 657 }, { 600, 77, 0, 523, 618 },
+		/* f0 */ { 600, 58, -27, 543, 626 }, { 600, 18, 0, 592, 636 }, { 600, 30, -15, 570, 661 },
+		/* f3 */ { 600, 30, -15, 570, 661 }, { 600, 30, -15, 570, 657 }, { 600, 30, -15, 570, 636 },
+		/* f6 */ { 600, 30, -15, 570, 638 }, { 600, 71, 16, 529, 500 }, { 600, 30, -24, 570, 463 },
+		/* f9 */ { 600, -1, -15, 569, 661 }, { 600, -1, -15, 569, 661 }, { 600, -1, -15, 569, 657 },
+		/* fc */ { 600, -1, -15, 569, 638 }, { 600, -4, -142, 601, 661 }, { 600, -14, -142, 570, 626 },
+		/* ff */ { 600, -4, -142, 601, 638 },
+	};
+
+	static constexpr GlyphMetrics COURIER_BOLDOBLIQUE_GLYPHS[256] = {
+		/* 00 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 03 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 06 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 09 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0f */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 12 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 15 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 18 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1b */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 600, 0, 0, 0, 0 },
+		/* 21 */ { 600, 215, -15, 495, 572 }, { 600, 211, 277, 585, 562 }, { 600, 88, -45, 641, 651 },
+		/* 24 */ { 600, 87, -126, 630, 666 }, { 600, 101, -15, 625, 616 }, { 600, 61, -15, 595, 543 },
+		/* 27 */ { 600, 303, 277, 493, 562 }, { 600, 265, -102, 592, 616 }, { 600, 117, -102, 444, 616 },
+		/* 2a */ { 600, 179, 219, 598, 601 }, { 600, 114, 39, 596, 478 }, { 600, 99, -111, 430, 174 },
+		/* 2d */ { 600, 143, 203, 567, 313 }, { 600, 206, -15, 427, 171 }, { 600, 90, -77, 626, 626 },
+		/* 30 */ { 600, 135, -15, 593, 616 }, { 600, 93, 0, 562, 616 }, { 600, 61, 0, 594, 616 },
+		/* 33 */ { 600, 71, -15, 571, 616 }, { 600, 81, 0, 559, 616 }, { 600, 77, -15, 621, 601 },
+		/* 36 */ { 600, 135, -15, 652, 616 }, { 600, 147, 0, 622, 601 }, { 600, 115, -15, 604, 616 },
+		/* 39 */ { 600, 75, -15, 592, 616 }, { 600, 205, -15, 480, 425 }, { 600, 99, -111, 481, 425 },
+		/* 3c */ { 600, 120, 15, 613, 501 }, { 600, 96, 118, 614, 398 }, { 600, 97, 15, 589, 501 },
+		/* 3f */ { 600, 183, -14, 592, 580 }, { 600, 65, -15, 642, 616 }, { 600, -9, 0, 632, 562 },
+		/* 42 */ { 600, 30, 0, 630, 562 }, { 600, 74, -18, 675, 580 }, { 600, 30, 0, 664, 562 },
+		/* 45 */ { 600, 25, 0, 670, 562 }, { 600, 39, 0, 684, 562 }, { 600, 74, -18, 675, 580 },
+		/* 48 */ { 600, 20, 0, 700, 562 }, { 600, 77, 0, 643, 562 }, { 600, 58, -18, 721, 562 },
+		/* 4b */ { 600, 21, 0, 692, 562 }, { 600, 39, 0, 636, 562 }, { 600, -2, 0, 722, 562 },
+		/* 4e */ { 600, 8, -12, 730, 562 }, { 600, 74, -18, 645, 580 }, { 600, 48, 0, 643, 562 },
+		/* 51 */ { 600, 83, -138, 636, 580 }, { 600, 24, 0, 617, 562 }, { 600, 54, -22, 673, 582 },
+		/* 54 */ { 600, 86, 0, 679, 562 }, { 600, 101, -18, 716, 562 }, { 600, 84, 0, 733, 562 },
+		/* 57 */ { 600, 79, 0, 738, 562 }, { 600, 12, 0, 690, 562 }, { 600, 109, 0, 709, 562 },
+		/* 5a */ { 600, 62, 0, 637, 562 }, { 600, 223, -102, 606, 616 }, { 600, 222, -77, 496, 626 },
+		/* 5d */ { 600, 103, -102, 486, 616 }, { 600, 171, 250, 556, 616 }, { 600, -27, -125, 585, -75 },
+		/* 60 */ { 600, 272, 508, 503, 661 }, { 600, 61, -15, 593, 454 }, { 600, 13, -15, 636, 626 },
+		/* 63 */ { 600, 81, -15, 631, 459 }, { 600, 60, -15, 645, 626 }, { 600, 81, -15, 605, 454 },
+		/* 66 */ { 600, 83, 0, 677, 626 }, { 600, 40, -146, 674, 454 }, { 600, 18, 0, 615, 626 },
+		/* 69 */ { 600, 77, 0, 546, 658 }, { 600, 36, -146, 580, 658 }, { 600, 33, 0, 643, 626 },
+		/* 6c */ { 600, 77, 0, 546, 626 }, { 600, -22, 0, 649, 454 }, { 600, 18, 0, 615, 454 },
+		/* 6f */ { 600, 71, -15, 622, 454 }, { 600, -32, -142, 622, 454 }, { 600, 60, -142, 685, 454 },
+		/* 72 */ { 600, 47, 0, 655, 454 }, { 600, 66, -17, 608, 459 }, { 600, 118, -15, 567, 562 },
+		/* 75 */ { 600, 70, -15, 592, 439 }, { 600, 70, 0, 695, 439 }, { 600, 53, 0, 712, 439 },
+		/* 78 */ { 600, 6, 0, 671, 439 }, { 600, -21, -142, 695, 439 }, { 600, 81, 0, 614, 439 },
+		/* 7b */ { 600, 203, -102, 595, 616 }, { 600, 201, -250, 505, 750 }, { 600, 114, -102, 506, 616 },
+		/* 7e */ { 600, 120, 153, 590, 356 }, { 0, 0, 0, 0, 0 }, { 600, 0, 0, 0, 0 },
+		/* 81 */ { 0, 0, 0, 0, 0 }, { 600, 144, -142, 458, 143 }, { 600, -57, -131, 702, 616 },
+		/* 84 */ { 600, 34, -142, 560, 143 }, { 600, 35, -15, 587, 116 }, { 600, 175, -70, 586, 580 },
+		/* 87 */ { 600, 121, -70, 587, 580 }, { 600, 212, 483, 607, 657 }, { 600, -45, -15, 743, 616 },
+		/* 8a */ { 600, 54, -22, 689, 790 }, { 600, 195, 70, 545, 446 }, { 600, 26, 0, 701, 562 },
+		/* 8d */ { 0, 0, 0, 0, 0 }, { 600, 62, 0, 659, 790 }, { 0, 0, 0, 0, 0 },
+		/* 90 */ { 0, 0, 0, 0, 0 }, { 600, 297, 277, 487, 562 }, { 600, 229, 277, 543, 562 },
+		/* 93 */ { 600, 190, 277, 594, 562 }, { 600, 119, 277, 645, 562 }, { 600, 196, 132, 523, 430 },
+		/* 96 */ { 600, 108, 203, 602, 313 }, { 600, 33, 203, 677, 313 }, { 600, 199, 493, 643, 636 },
+		/* 99 */ { 600, 86, 230, 869, 562 }, { 600, 66, -17, 633, 667 }, { 600, 165, 70, 514, 446 },
+		/* 9c */ { 600, 18, -15, 662, 454 }, { 0, 0, 0, 0, 0 }, { 600, 81, 0, 643, 667 },
+		/* 9f */ { 600, 109, 0, 709, 761 }, { 600, 0, 0, 0, 0 }, { 600, 196, -146, 477, 449 },
+		/* a2 */ { 600, 121, -49, 605, 614 }, { 600, 106, -28, 650, 611 }, { 600, 77, 49, 644, 517 },
+		/* a5 */ { 600, 98, 0, 710, 562 }, { 600, 217, -175, 489, 675 }, { 600, 74, -70, 620, 580 },
+		/* a8 */ { 600, 246, 498, 595, 638 }, { 600, 53, -18, 667, 580 }, { 600, 188, 196, 526, 580 },
+		/* ab */ { 600, 62, 70, 639, 446 }, { 600, 135, 103, 617, 413 }, { 600, 143, 203, 567, 313 },
+		/* ae */ { 600, 53, -18, 667, 580 }, { 600, 195, 505, 637, 585 }, { 600, 173, 243, 570, 616 },
+		/* b1 */ { 600, 76, 24, 614, 515 }, { 600, 191, 230, 542, 616 }, { 600, 193, 222, 526, 616 },
+		/* b4 */ { 600, 312, 508, 609, 661 }, { 600, 49, -142, 592, 439 }, { 600, 61, -70, 700, 580 },
+		/* b7 */ { 600, 248, 165, 461, 351 }, { 600, 168, -206, 368, 0 }, { 600, 212, 230, 514, 616 },
+		/* ba */ { 600, 188, 196, 543, 580 }, { 600, 71, 70, 647, 446 }, { 600, 13, -60, 707, 661 },
+		/* bd */ { 600, 22, -60, 716, 661 }, { 600, 8, -60, 699, 661 }, { 600, 100, -146, 509, 449 },
+		/* c0 */ { 600, -9, 0, 632, 784 }, { 600, -9, 0, 655, 784 }, { 600, -9, 0, 632, 780 },
+		/* c3 */ { 600, -9, 0, 669, 759 }, { 600, -9, 0, 632, 761 }, { 600, -9, 0, 632, 801 },
+		/* c6 */ { 600, -29, 0, 708, 562 }, { 600, 74, -206, 675, 580 }, { 600, 25, 0, 670, 784 },
+		/* c9 */ { 600, 25, 0, 670, 784 }, { 600, 25, 0, 670, 780 }, { 600, 25, 0, 670, 761 },
+		/* cc */ { 600, 77, 0, 643, 784 }, { 600, 77, 0, 643, 784 }, { 600, 77, 0, 643, 780 },
+		/* cf */ { 600, 77, 0, 643, 761 }, { 600, 30, 0, 664, 562 }, { 600, 8, -12, 730, 759 },
+		/* d2 */ { 600, 74, -18, 645, 784 }, { 600, 74, -18, 645, 784 }, { 600, 74, -18, 645, 780 },
+		/* d5 */ { 600, 74, -18, 669, 759 }, { 600, 74, -18, 645, 761 }, { 600, 104, 39, 606, 478 },
+		/* d8 */ { 600, 48, -22, 673, 584 }, { 600, 101, -18, 716, 784 }, { 600, 101, -18, 716, 784 },
+		/* db */ { 600, 101, -18, 716, 780 }, { 600, 101, -18, 716, 761 }, { 600, 109, 0, 709, 784 },
+		/* de */ { 600, 48, 0, 620, 562 }, { 600, 22, -15, 629, 626 }, { 600, 61, -15, 593, 661 },
+		/* e1 */ { 600, 61, -15, 609, 661 }, { 600, 61, -15, 607, 657 }, { 600, 61, -15, 643, 636 },
+		/* e4 */ { 600, 61, -15, 595, 638 }, { 600, 61, -15, 593, 678 }, { 600, 21, -15, 652, 454 },
+		/* e7 */ { 600, 81, -206, 631, 459 }, { 600, 81, -15, 605, 661 }, { 600, 81, -15, 609, 661 },
+		/* ea */ { 600, 81, -15, 607, 657 }, { 600, 81, -15, 605, 638 }, { 600, 77, 0, 546, 661 },
+		/* ed */ { 600, 77, 0, 609, 661 }, { 600, 77, 0, 577, 657 }, { 600, 77, 0, 561, 618 },
+		/* f0 */ { 600, 93, -27, 661, 626 }, { 600, 18, 0, 643, 636 }, { 600, 71, -15, 622, 661 },
+		/* f3 */ { 600, 71, -15, 649, 661 }, { 600, 71, -15, 622, 657 }, { 600, 71, -15, 643, 636 },
+		/* f6 */ { 600, 71, -15, 622, 638 }, { 600, 114, 16, 596, 500 }, { 600, 54, -24, 638, 463 },
+		/* f9 */ { 600, 70, -15, 592, 661 }, { 600, 70, -15, 599, 661 }, { 600, 70, -15, 597, 657 },
+		/* fc */ { 600, 70, -15, 595, 638 }, { 600, -21, -142, 695, 661 }, { 600, -32, -142, 622, 626 },
+		/* ff */ { 600, -21, -142, 695, 638 },
+	};
+
+	static constexpr GlyphMetrics SYMBOL_GLYPHS[256] = {
+		/* 00 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 03 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 06 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 09 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0f */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 12 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 15 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 18 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1b */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 250, 0, 0, 0, 0 },
+		/* 21 */ { 333, 128, -17, 240, 672 }, { 0, 0, 0, 0, 0 }, { 500, 20, -16, 481, 673 },
+		/* 24 */ { 0, 0, 0, 0, 0 }, { 833, 63, -36, 771, 655 }, { 778, 41, -18, 750, 661 },
+		/* 27 */ { 0, 0, 0, 0, 0 }, { 333, 53, -191, 300, 673 }, { 333, 30, -191, 277, 673 },
+		/* 2a */ { 0, 0, 0, 0, 0 }, { 549, 10, 0, 539, 533 }, { 250, 56, -152, 194, 104 },
+		/* 2d */ { 0, 0, 0, 0, 0 }, { 250, 69, -17, 181, 95 }, { 278, 0, -18, 254, 646 },
+		/* 30 */ { 500, 24, -14, 476, 685 }, { 500, 117, 0, 390, 673 }, { 500, 25, 0, 475, 685 },
+		/* 33 */ { 500, 43, -14, 435, 685 }, { 500, 15, 0, 469, 685 }, { 500, 32, -14, 445, 690 },
+		/* 36 */ { 500, 34, -14, 468, 685 }, { 500, 24, -16, 448, 673 }, { 500, 56, -14, 445, 685 },
+		/* 39 */ { 500, 30, -18, 459, 685 }, { 278, 81, -17, 193, 460 }, { 278, 83, -152, 221, 460 },
+		/* 3c */ { 549, 26, 0, 523, 522 }, { 549, 11, 141, 537, 390 }, { 549, 26, 0, 523, 522 },
+		/* 3f */ { 444, 70, -17, 412, 686 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 42 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 45 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 48 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 4b */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 4e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 51 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 54 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 57 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 5a */ { 0, 0, 0, 0, 0 }, { 333, 86, -155, 299, 674 }, { 0, 0, 0, 0, 0 },
+		/* 5d */ { 333, 33, -155, 246, 674 }, { 0, 0, 0, 0, 0 }, { 500, -2, -125, 502, -75 },
+		/* 60 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 63 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 66 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 69 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 6c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 6f */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 72 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 75 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 78 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 7b */ { 480, 58, -183, 397, 673 }, { 200, 65, -293, 135, 707 }, { 480, 79, -183, 418, 673 },
+		/* 7e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 750, 20, -12, 714, 685 },
+		/* 81 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 500, 2, -193, 494, 686 },
+		/* 84 */ { 0, 0, 0, 0, 0 }, { 1000, 111, -17, 889, 95 }, { 0, 0, 0, 0, 0 },
+		/* 87 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 8a */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 8d */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 90 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 93 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 460, 50, 113, 410, 473 },
+		/* 96 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 99 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 9c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 9f */ { 0, 0, 0, 0, 0 }, { 250, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* a2 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* a5 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* a8 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* ab */ { 0, 0, 0, 0, 0 }, { 713, 15, 0, 680, 288 }, { 0, 0, 0, 0, 0 },
+		/* ae */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 400, 50, 385, 350, 685 },
+		/* b1 */ { 549, 10, 0, 539, 645 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* b4 */ { 0, 0, 0, 0, 0 }, { 576, 33, -223, 567, 500 }, { 0, 0, 0, 0, 0 },
+		/* b7 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* ba */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* bd */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* c0 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* c3 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* c6 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* c9 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* cc */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* cf */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* d2 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* d5 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 549, 17, 8, 533, 524 },
+		/* d8 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* db */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* de */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* e1 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* e4 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* e7 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* ea */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* ed */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* f0 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* f3 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* f6 */ { 0, 0, 0, 0, 0 }, { 549, 10, 71, 536, 456 }, { 0, 0, 0, 0, 0 },
+		/* f9 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* fc */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* ff */ { 0, 0, 0, 0, 0 },
+	};
+
+	static constexpr GlyphMetrics ZAPFDINGBATS_GLYPHS[256] = {
+		/* 00 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 03 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 06 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 09 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 0f */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 12 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 15 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 18 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1b */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 1e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 278, 0, 0, 0, 0 },
+		/* 21 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 24 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 27 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 2a */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 2d */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 30 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 33 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 36 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 39 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 3c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 3f */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 42 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 45 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 48 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 4b */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 4e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 51 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 54 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 57 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 5a */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 5d */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 60 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 63 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 66 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 69 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 6c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 6f */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 72 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 75 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 78 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 7b */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 7e */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 81 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 84 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 87 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 8a */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 8d */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 90 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 93 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 96 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 99 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 9c */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* 9f */ { 0, 0, 0, 0, 0 }, { 278, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* a2 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* a5 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* a8 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* ab */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* ae */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* b1 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* b4 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* b7 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* ba */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* bd */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* c0 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* c3 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* c6 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* c9 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* cc */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* cf */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* d2 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* d5 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* d8 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* db */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* de */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* e1 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* e4 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* e7 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* ea */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* ed */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* f0 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* f3 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* f6 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* f9 */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* fc */ { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+		/* ff */ { 0, 0, 0, 0, 0 },
+	};
+
+	static constexpr FontMetrics FONTS[] = {
+		{
+			.name = "Times-Roman",
+			.xmin = -168,
+			.ymin = -218,
+			.xmax = 1000,
+			.ymax = 898,
+			.ascent = 683,
+			.descent = -217,
+			.cap_height = 662,
+			.x_height = 450,
+			.italic_angle = 0,
+			.is_monospaced = false,
+			.glyphs = TIMES_ROMAN_GLYPHS,
+			.kerning_pairs = TIMES_ROMAN_KERNING,
+			.num_kerning_pairs = std::size(TIMES_ROMAN_KERNING),
+		},
+		{
+			.name = "Times-Italic",
+			.xmin = -169,
+			.ymin = -217,
+			.xmax = 1010,
+			.ymax = 883,
+			.ascent = 683,
+			.descent = -217,
+			.cap_height = 653,
+			.x_height = 441,
+			.italic_angle = -15.5,
+			.is_monospaced = false,
+			.glyphs = TIMES_ITALIC_GLYPHS,
+			.kerning_pairs = TIMES_ITALIC_KERNING,
+			.num_kerning_pairs = std::size(TIMES_ITALIC_KERNING),
+		},
+		{
+			.name = "Times-Bold",
+			.xmin = -168,
+			.ymin = -218,
+			.xmax = 1000,
+			.ymax = 935,
+			.ascent = 683,
+			.descent = -217,
+			.cap_height = 676,
+			.x_height = 461,
+			.italic_angle = 0,
+			.is_monospaced = false,
+			.glyphs = TIMES_BOLD_GLYPHS,
+			.kerning_pairs = TIMES_BOLD_KERNING,
+			.num_kerning_pairs = std::size(TIMES_BOLD_KERNING),
+		},
+		{
+			.name = "Times-BoldItalic",
+			.xmin = -200,
+			.ymin = -218,
+			.xmax = 996,
+			.ymax = 921,
+			.ascent = 683,
+			.descent = -217,
+			.cap_height = 669,
+			.x_height = 462,
+			.italic_angle = -15,
+			.is_monospaced = false,
+			.glyphs = TIMES_BOLDITALIC_GLYPHS,
+			.kerning_pairs = TIMES_BOLDITALIC_KERNING,
+			.num_kerning_pairs = std::size(TIMES_BOLDITALIC_KERNING),
+		},
+		{
+			.name = "Helvetica",
+			.xmin = -166,
+			.ymin = -225,
+			.xmax = 1000,
+			.ymax = 931,
+			.ascent = 718,
+			.descent = -207,
+			.cap_height = 718,
+			.x_height = 523,
+			.italic_angle = 0,
+			.is_monospaced = false,
+			.glyphs = HELVETICA_GLYPHS,
+			.kerning_pairs = HELVETICA_KERNING,
+			.num_kerning_pairs = std::size(HELVETICA_KERNING),
+		},
+		{
+			.name = "Helvetica-Oblique",
+			.xmin = -170,
+			.ymin = -225,
+			.xmax = 1116,
+			.ymax = 931,
+			.ascent = 718,
+			.descent = -207,
+			.cap_height = 718,
+			.x_height = 523,
+			.italic_angle = -12,
+			.is_monospaced = false,
+			.glyphs = HELVETICA_OBLIQUE_GLYPHS,
+			.kerning_pairs = HELVETICA_OBLIQUE_KERNING,
+			.num_kerning_pairs = std::size(HELVETICA_OBLIQUE_KERNING),
+		},
+		{
+			.name = "Helvetica-Bold",
+			.xmin = -170,
+			.ymin = -228,
+			.xmax = 1003,
+			.ymax = 962,
+			.ascent = 718,
+			.descent = -207,
+			.cap_height = 718,
+			.x_height = 532,
+			.italic_angle = 0,
+			.is_monospaced = false,
+			.glyphs = HELVETICA_BOLD_GLYPHS,
+			.kerning_pairs = HELVETICA_BOLD_KERNING,
+			.num_kerning_pairs = std::size(HELVETICA_BOLD_KERNING),
+		},
+		{
+			.name = "Helvetica-BoldOblique",
+			.xmin = -174,
+			.ymin = -228,
+			.xmax = 1114,
+			.ymax = 962,
+			.ascent = 718,
+			.descent = -207,
+			.cap_height = 718,
+			.x_height = 532,
+			.italic_angle = -12,
+			.is_monospaced = false,
+			.glyphs = HELVETICA_BOLDOBLIQUE_GLYPHS,
+			.kerning_pairs = HELVETICA_BOLDOBLIQUE_KERNING,
+			.num_kerning_pairs = std::size(HELVETICA_BOLDOBLIQUE_KERNING),
+		},
+		{
+			.name = "Courier",
+			.xmin = -23,
+			.ymin = -250,
+			.xmax = 715,
+			.ymax = 805,
+			.ascent = 629,
+			.descent = -157,
+			.cap_height = 562,
+			.x_height = 426,
+			.italic_angle = 0,
+			.is_monospaced = true,
+			.glyphs = COURIER_GLYPHS,
+		},
+		{
+			.name = "Courier-Oblique",
+			.xmin = -27,
+			.ymin = -250,
+			.xmax = 849,
+			.ymax = 805,
+			.ascent = 629,
+			.descent = -157,
+			.cap_height = 562,
+			.x_height = 426,
+			.italic_angle = -12,
+			.is_monospaced = true,
+			.glyphs = COURIER_OBLIQUE_GLYPHS,
+		},
+		{
+			.name = "Courier-Bold",
+			.xmin = -113,
+			.ymin = -250,
+			.xmax = 749,
+			.ymax = 801,
+			.ascent = 629,
+			.descent = -157,
+			.cap_height = 562,
+			.x_height = 439,
+			.italic_angle = 0,
+			.is_monospaced = true,
+			.glyphs = COURIER_BOLD_GLYPHS,
+		},
+		{
+			.name = "Courier-BoldOblique",
+			.xmin = -57,
+			.ymin = -250,
+			.xmax = 869,
+			.ymax = 801,
+			.ascent = 629,
+			.descent = -157,
+			.cap_height = 562,
+			.x_height = 439,
+			.italic_angle = -12,
+			.is_monospaced = true,
+			.glyphs = COURIER_BOLDOBLIQUE_GLYPHS,
+		},
+		{
+			.name = "Symbol",
+			.xmin = -180,
+			.ymin = -293,
+			.xmax = 1090,
+			.ymax = 1010,
+			.ascent = 1010,
+			.descent = -293,
+			.cap_height = 0,
+			.x_height = 0,
+			.italic_angle = 0,
+			.is_monospaced = false,
+			.glyphs = SYMBOL_GLYPHS,
+		},
+		{
+			.name = "ZapfDingbats",
+			.xmin = -1,
+			.ymin = -143,
+			.xmax = 981,
+			.ymax = 820,
+			.ascent = 820,
+			.descent = -143,
+			.cap_height = 0,
+			.x_height = 0,
+			.italic_angle = 0,
+			.is_monospaced = false,
+			.glyphs = ZAPFDINGBATS_GLYPHS,
+		},
+	};
+
+	static constexpr bool compare_pairs(const KerningPair& a, const KerningPair& b)
+	{
+		return a.left < b.left || (a.left == b.left && a.right < b.right);
+	}
+
+	// the kerning pairs are found with a binary search.
+	static_assert(std::all_of(std::begin(FONTS), std::end(FONTS), [](const FontMetrics& font) {
+		return std::is_sorted(font.kerning_pairs, font.kerning_pairs + font.num_kerning_pairs, &compare_pairs);
+	}));
+
+	int16_t FontMetrics::getKerning(uint8_t left, uint8_t right) const
+	{
+		auto end = this->kerning_pairs + this->num_kerning_pairs;
+		auto it = std::lower_bound(this->kerning_pairs, end, KerningPair { left, right, 0 }, &compare_pairs);
+
+		if(it != end && it->left == left && it->right == right)
+			return it->kern;
+
+		return 0;
+	}
+
+	const FontMetrics* find(zst::str_view name)
+	{
+		for(auto& font : FONTS)
+		{
+			if(zst::str_view(font.name) == name)
+				return &font;
+		}
+
+		return nullptr;
+	}
+}
@@ -0,0 +1,95 @@
+// widths.cpp
+// Copyright (c) 2022, zhiayang
+// SPDX-License-Identifier: Apache-2.0
+
+#include "pdf/font.h"
+#include "pdf/object.h"
+
+namespace pdf
+{
+	static size_t num_digits(int64_t x)
+	{
+		size_t n = (x < 0) ? 2 : 1;
+		for(x /= 10; x != 0; x /= 10)
+			n++;
+
+		return n;
+	}
+
+	/*
+	    The /W array of a CIDFont (PDF 1.7: 9.7.4.3 Glyph Metrics in CIDFonts) has two kinds of entries:
+	    `c [w1 w2 ...]` gives the widths of consecutive CIDs starting at c, and `cfirst clast w` gives the same
+	    width to all CIDs in the range. For each run of glyphs with the same width, use whichever is shorter.
+	*/
+	void Font::writeGlyphWidths(Document* doc) const
+	{
+		// the glyph set is iterated in order, so the widths are already sorted by glyph id.
+		std::vector<std::pair<uint32_t, int64_t>> widths {};
+		widths.reserve(m_used_glyphs.size());
+
+		for(auto gid : m_used_glyphs)
+		{
+			auto width = this->scaleMetricForPDFTextSpace(this->getMetricsForGlyph(gid).horz_advance);
+			widths.emplace_back(static_cast<uint32_t>(gid), static_cast<int64_t>(width.value()));
+		}
+
+		std::string out = "[";
+
+		// whether we're in the middle of a `c [w1 w2 ...]` entry, and the next cid that it would contain.
+		bool in_list = false;
+		uint32_t list_next = 0;
+
+		for(size_t i = 0; i < widths.size();)
+		{
+			auto [first, width] = widths[i];
+
+			size_t k = i + 1;
+			while(k < widths.size() && widths[k].first == widths[k - 1].first + 1 && widths[k].second == width)
+				k++;
+
+			auto last = widths[k - 1].first;
+			auto count = k - i;
+
+			bool continues_list = in_list && list_next == first;
+			bool continues_after = k < widths.size() && widths[k].first == last + 1;
+
+			// the cost (in bytes) of each form, including the `c [` that the glyphs after this need if a list is split.
+			auto list_cost = count * (num_digits(width) + 1) + (continues_list ? 0 : num_digits(first) + 4);
+			auto range_cost = num_digits(first) + num_digits(last) + num_digits(width) + 3
+			                + ((continues_list && continues_after) ? num_digits(last + 1) + 4 : 0);
+
+			if(list_cost <= range_cost)
+			{
+				if(not continues_list)
+				{
+					if(in_list)
+						out += "]";
+
+					out += zpr::sprint(" {} [", first);
+				}
+
+				for(size_t j = 0; j < count; j++)
+					out += zpr::sprint("{}{}", (continues_list || j > 0) ? " " : "", width);
+
+				in_list = true;
+				list_next = last + 1;
+			}
+			else
+			{
+				if(in_list)
+					out += "]";
+
+				out += zpr::sprint(" {} {} {}", first, last, width);
+				in_list = false;
+			}
+
+			i = k;
+		}
+
+		if(in_list)
+			out += "]";
+
+		out += " ]";
+		this->glyph_widths_array->contents = std::move(out);
+	}
+}
@@ -140,6 +140,12 @@ namespace pdf
 		w->write("{} {} R", this->id, this->generation);
 	}
 
+	void RawObject::writeFull(Writer* w) const
+	{
+		IndirHelper helper(w, this);
+		w->write(zst::str_view(this->contents));
+	}
+
 	void Dictionary::add(const Name& n, Object* obj)
 	{
 		if(auto it = this->values.find(n); it != this->values.end())
@@ -271,6 +277,16 @@ namespace pdf
 		return createObject<IndirectRef>(id, gen);
 	}
 
+	RawObject* RawObject::create(std::string contents)
+	{
+		return createObject<RawObject>(std::move(contents));
+	}
+
+	RawObject* RawObject::createIndirect(Document* doc, std::string contents)
+	{
+		return createIndirectObject<RawObject>(doc, std::move(contents));
+	}
+
 
 
 	Object::~Object()